@@ -38,9 +38,22 @@ layout(binding = 0) uniform sampler2D u_Textures[16];
 
 layout(location = 0) out vec4 FragColor;
 
+// TexIndex >= 16 marks a signed-distance-field glyph (Renderer2D DISTANCE_FIELD_TEX_INDEX_BIAS):
+// the R8 atlas is swizzled to (1,1,1,R), so .a holds the distance with the edge at 0.5.
+const int k_DistanceFieldBias = 16;
+
 void main()
 {
-    int   lIdx    = int(v_TexIndex);
+    int lIdx = int(v_TexIndex + 0.5);
+    if (lIdx >= k_DistanceFieldBias)
+    {
+        float lDist  = texture(u_Textures[lIdx - k_DistanceFieldBias], v_TexCoord).a;
+        float lWidth = max(fwidth(lDist), 1e-4);   // screen-space AA band, scale independent
+        float lAlpha = smoothstep(0.5 - lWidth, 0.5 + lWidth, lDist);
+        FragColor    = vec4(v_Color.rgb, v_Color.a * lAlpha);
+        return;
+    }
+
     vec4  lSample = texture(u_Textures[lIdx], v_TexCoord);
     FragColor     = lSample * v_Color;
 }
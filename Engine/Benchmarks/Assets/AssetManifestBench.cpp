@@ -0,0 +1,78 @@
+// Bench: AssetManifest::FindByPath on a large manifest — the hashed path index vs the linear
+// scan it replaced (what AssetRegistry::Normalize paid on every path-based Load / IsLoaded).
+//
+// Size() is the manifest entry count; the timed body does k_LookupCount lookups of paths spread
+// across the manifest (Bench::Rng, fixed seed). Compare median_ns / lookups, not ns_per_item.
+#include "BenchHarness.h"
+
+#include "Assets/AssetManifest.h"
+
+#include <string>
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr Uint32 k_LookupCount = 1024;
+
+    // Fill the manifest with InCount textures and pick k_LookupCount of their paths to query.
+    TDynArray<OpaaxString> BuildManifest(Uint32 InCount)
+    {
+        AssetManifest::Clear();
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            const std::string lIndex = std::to_string(i);
+            AssetDescriptor lDesc;
+            lDesc.ID      = OpaaxStringID(("Bench/Manifest_" + lIndex).c_str());
+            lDesc.RelPath = OpaaxString(("Game/Assets/Textures/Bench/Texture_" + lIndex + ".png").c_str());
+            lDesc.Type    = OPAAX_ID("Texture2D");
+            AssetManifest::Add(std::move(lDesc));
+        }
+
+        Bench::Rng lRng;
+        TDynArray<OpaaxString> lQueries;
+        lQueries.reserve(k_LookupCount);
+        for (Uint32 i = 0; i < k_LookupCount; ++i)
+        {
+            const Uint32 lIndex = lRng.Range(InCount);
+            lQueries.push_back(OpaaxString(("Game/Assets/Textures/Bench/Texture_" + std::to_string(lIndex) + ".png").c_str()));
+        }
+        return lQueries;
+    }
+}
+
+OPAAX_BENCHMARK(ManifestFindByPath, "Assets/AssetManifest::FindByPath", 1000, 50000)
+{
+    const TDynArray<OpaaxString> lQueries = BuildManifest(InState.Size());
+
+    InState.Measure([&]
+    {
+        Uint32 lFound = 0;
+        for (const OpaaxString& lPath : lQueries) { lFound += AssetManifest::FindByPath(lPath) != nullptr; }
+        Bench::DoNotOptimize(lFound);
+    });
+    InState.SetCounter("lookups", static_cast<double>(k_LookupCount));
+
+    AssetManifest::Clear();
+}
+
+OPAAX_BENCHMARK(ManifestFindByPathScan, "Assets/AssetManifest::FindByPath/LinearScan", 1000, 50000)
+{
+    const TDynArray<OpaaxString> lQueries = BuildManifest(InState.Size());
+
+    InState.Measure([&]
+    {
+        Uint32 lFound = 0;
+        for (const OpaaxString& lPath : lQueries)
+        {
+            for (const auto& [lKey, lDesc] : AssetManifest::GetAll())
+            {
+                if (lDesc.RelPath == lPath) { ++lFound; break; }
+            }
+        }
+        Bench::DoNotOptimize(lFound);
+    });
+    InState.SetCounter("lookups", static_cast<double>(k_LookupCount));
+
+    AssetManifest::Clear();
+}
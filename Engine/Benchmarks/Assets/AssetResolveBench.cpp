@@ -0,0 +1,84 @@
+// Bench: TAssetHandle::Get — slot-table resolve vs the registry's ID map lookup.
+//
+// k_AssetCount fake assets (no disk, no GPU) are loaded once; the timed body resolves Size()
+// handles round-robin over them. "/MapLookup" times the pre-slot path (hash-map find + type
+// check through AssetRegistry_TryResolveTyped), which Get() now only takes on a generation miss.
+#include "BenchHarness.h"
+
+#include "Assets/AssetRegistry.h"
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr Uint32 k_AssetCount = 1024;
+
+    struct BenchAsset
+    {
+        Uint32 Value = 0;
+    };
+
+    struct BenchAssetLoader final : IAssetLoader<BenchAsset>
+    {
+        Uint32 Next = 0;
+
+        BenchAsset* Load(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override
+        {
+            return new BenchAsset{ Next++ };
+        }
+
+        bool IsValid(BenchAsset* InAsset) override { return InAsset != nullptr; }
+    };
+
+    TDynArray<TAssetHandle<BenchAsset>> LoadBenchAssets()
+    {
+        AssetLoaderRegistry::Register<BenchAsset>(MakeUnique<BenchAssetLoader>());
+
+        TDynArray<TAssetHandle<BenchAsset>> lHandles;
+        lHandles.reserve(k_AssetCount);
+        for (Uint32 i = 0; i < k_AssetCount; ++i)
+        {
+            const std::string lPath = "Bench/Asset_" + std::to_string(i);
+            lHandles.push_back(AssetRegistry::Load<BenchAsset>(OPAAX_ID(lPath)));
+        }
+        return lHandles;
+    }
+}
+
+OPAAX_BENCHMARK(AssetHandleGet, "Assets/TAssetHandle::Get", 1000000)
+{
+    const Uint32 lCount = InState.Size();
+    TDynArray<TAssetHandle<BenchAsset>> lHandles = LoadBenchAssets();
+
+    InState.Measure([&]
+    {
+        Uint32 lSum = 0;
+        for (Uint32 i = 0; i < lCount; ++i) { lSum += lHandles[i & (k_AssetCount - 1)]->Value; }
+        Bench::DoNotOptimize(lSum);
+    });
+    InState.SetCounter("assets", static_cast<double>(k_AssetCount));
+
+    lHandles.clear();
+    AssetRegistry::Shutdown();
+}
+
+OPAAX_BENCHMARK(AssetHandleGetMapLookup, "Assets/TAssetHandle::Get/MapLookup", 1000000)
+{
+    const Uint32 lCount = InState.Size();
+    TDynArray<TAssetHandle<BenchAsset>> lHandles = LoadBenchAssets();
+
+    InState.Measure([&]
+    {
+        Uint32 lSum = 0;
+        for (Uint32 i = 0; i < lCount; ++i)
+        {
+            const Uint32 lKey = lHandles[i & (k_AssetCount - 1)].GetID().GetId();
+            lSum += static_cast<BenchAsset*>(Internal::AssetRegistry_TryResolveTyped(lKey, typeid(BenchAsset)))->Value;
+        }
+        Bench::DoNotOptimize(lSum);
+    });
+    InState.SetCounter("assets", static_cast<double>(k_AssetCount));
+
+    lHandles.clear();
+    AssetRegistry::Shutdown();
+}
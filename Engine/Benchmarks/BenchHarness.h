@@ -0,0 +1,204 @@
+#pragma once
+
+// =============================================================================
+// OpaaxBenchmarks harness
+//
+// Deliberately tiny: no vendored benchmark library, just steady_clock samples around a
+// caller-supplied body. A benchmark registers once (OPAAX_BENCHMARK) with the list of input
+// sizes it runs at; Main.cpp walks the registry, runs every (benchmark, size) pair and dumps
+// the collected BenchResults as JSON so runs can be diffed across commits.
+//
+// Each case does its own setup, then calls BenchState::Measure(body) exactly once. Measure
+// runs a few warm-up calls, then SampleCount timed calls; only the body is timed.
+// =============================================================================
+
+#include "Core/EngineAPI.h"   // FORCEINLINE
+#include "Core/OpaaxTypes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+namespace Opaax::Bench
+{
+    // =============================================================================
+    // DoNotOptimize
+    // =============================================================================
+
+    // Force InValue to be materialised so the optimiser cannot drop the work that produced it.
+    // A volatile read of its first byte is portable (MSVC has no inline asm on x64).
+    template<typename T>
+    FORCEINLINE void DoNotOptimize(const T& InValue)
+    {
+        static_cast<void>(*reinterpret_cast<const volatile char*>(&InValue));
+    }
+
+    // =============================================================================
+    // Rng
+    // =============================================================================
+
+    // Fixed-seed xorshift32 — inputs are identical run to run (and across platforms, unlike
+    // std::uniform_*_distribution), so results stay comparable between commits.
+    struct Rng
+    {
+        Uint32 State = 0x9E3779B9u;
+
+        FORCEINLINE Uint32 Next() noexcept
+        {
+            State ^= State << 13;
+            State ^= State >> 17;
+            State ^= State << 5;
+            return State;
+        }
+
+        FORCEINLINE Uint32 Range(Uint32 InCount) noexcept { return Next() % InCount; }
+        FORCEINLINE float  Unit() noexcept { return static_cast<float>(Next() >> 8) * (1.f / 16777216.f); }
+    };
+
+    // =============================================================================
+    // BenchResult
+    // =============================================================================
+
+    /**
+     * One (benchmark, size) measurement. Times are per call of the measured body, in ns.
+     * Counters carry benchmark-specific extras (e.g. the renderer's own phase timers).
+     */
+    struct BenchResult
+    {
+        std::string Name;
+        Uint32      Size        = 0;
+        Uint32      Samples     = 0;
+        double      MedianNs    = 0.0;
+        double      MinNs       = 0.0;
+        double      MeanNs      = 0.0;
+        double      StdDevNs    = 0.0;
+        bool        Skipped     = false;
+        std::string SkipReason;
+        TDynArray<std::pair<std::string, double>> Counters;
+    };
+
+    // =============================================================================
+    // BenchState
+    // =============================================================================
+
+    /**
+     * @class BenchState
+     *
+     * Handed to a benchmark body for one input size. Size() is the workload size; Measure()
+     * times the body; SetCounter()/Skip() annotate the result.
+     */
+    class BenchState
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        BenchState(BenchResult& OutResult, Uint32 InWarmup, Uint32 InSamples)
+            : m_Result(OutResult), m_Warmup(InWarmup), m_Samples(InSamples) {}
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        FORCEINLINE Uint32 Size() const noexcept { return m_Result.Size; }
+
+        template<typename Fn>
+        void Measure(Fn&& InBody)
+        {
+            for (Uint32 i = 0; i < m_Warmup; ++i) { InBody(); }
+
+            TDynArray<double> lNs;
+            lNs.reserve(m_Samples);
+            for (Uint32 i = 0; i < m_Samples; ++i)
+            {
+                const auto lStart = std::chrono::steady_clock::now();
+                InBody();
+                lNs.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - lStart).count());
+            }
+            Summarise(lNs);
+        }
+
+        void SetCounter(const char* InName, double InValue)
+        {
+            m_Result.Counters.emplace_back(InName, InValue);
+        }
+
+        void Skip(const char* InReason)
+        {
+            m_Result.Skipped    = true;
+            m_Result.SkipReason = InReason;
+        }
+
+    private:
+        void Summarise(TDynArray<double>& InNs)
+        {
+            if (InNs.empty()) { return; }
+
+            std::sort(InNs.begin(), InNs.end());
+            const size_t lN = InNs.size();
+
+            double lSum = 0.0;
+            for (double lV : InNs) { lSum += lV; }
+            const double lMean = lSum / static_cast<double>(lN);
+
+            double lVar = 0.0;
+            for (double lV : InNs) { lVar += (lV - lMean) * (lV - lMean); }
+
+            m_Result.Samples  = static_cast<Uint32>(lN);
+            m_Result.MinNs    = InNs.front();
+            m_Result.MedianNs = (lN % 2) ? InNs[lN / 2] : 0.5 * (InNs[lN / 2 - 1] + InNs[lN / 2]);
+            m_Result.MeanNs   = lMean;
+            m_Result.StdDevNs = std::sqrt(lVar / static_cast<double>(lN));
+        }
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        BenchResult& m_Result;
+        Uint32       m_Warmup;
+        Uint32       m_Samples;
+    };
+
+    // =============================================================================
+    // Registry
+    // =============================================================================
+
+    using BenchFn = void (*)(BenchState&);
+
+    struct BenchCase
+    {
+        const char*       Name;
+        TDynArray<Uint32> Sizes;
+        BenchFn           Fn;
+    };
+
+    // Function-local static: registration runs from static initialisers in other TUs.
+    inline TDynArray<BenchCase>& Registry()
+    {
+        static TDynArray<BenchCase> s_Cases;
+        return s_Cases;
+    }
+
+    struct BenchRegistrar
+    {
+        BenchRegistrar(const char* InName, std::initializer_list<Uint32> InSizes, BenchFn InFn)
+        {
+            Registry().push_back({ InName, TDynArray<Uint32>(InSizes), InFn });
+        }
+    };
+
+} // namespace Opaax::Bench
+
+#define OPAAX_BENCH_CONCAT_IMPL(A, B) A##B
+#define OPAAX_BENCH_CONCAT(A, B)      OPAAX_BENCH_CONCAT_IMPL(A, B)
+
+// Register a benchmark run at each listed size:
+//   OPAAX_BENCHMARK(MySort, "Renderer/MySort", 1000, 10000) { ... InState.Measure([&]{ ... }); }
+#define OPAAX_BENCHMARK(Id, Name, ...)                                                          \
+    static void Id(::Opaax::Bench::BenchState& InState);                                        \
+    static ::Opaax::Bench::BenchRegistrar OPAAX_BENCH_CONCAT(s_BenchReg_, Id)(Name, { __VA_ARGS__ }, &Id); \
+    static void Id(::Opaax::Bench::BenchState& InState)
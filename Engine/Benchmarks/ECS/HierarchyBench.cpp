@@ -0,0 +1,53 @@
+// Bench: Hierarchy::GetWorldTransform over every entity of a forest.
+//
+// Size() entities arranged as chains of k_Depth (root + k_Depth-1 descendants), each with a
+// non-identity TransformComponent so every level does the full rotate/scale/translate compose.
+// The timed body resolves the world transform of every entity once (uncached parent walks).
+#include "BenchHarness.h"
+
+#include "World/World.h"
+#include "ECS/Hierarchy.h"
+#include "ECS/Components/TransformComponent.h"
+
+using namespace Opaax;
+namespace H = Opaax::ECS::Hierarchy;
+using Opaax::ECS::TransformComponent;
+
+namespace
+{
+    constexpr Uint32 k_Depth = 8;
+}
+
+OPAAX_BENCHMARK(HierarchyWorldTransform, "ECS/Hierarchy::GetWorldTransform", 1000, 10000, 100000)
+{
+    const Uint32 lCount = InState.Size();
+
+    World lWorld;
+    TDynArray<EntityID> lEntities;
+    lEntities.reserve(lCount);
+
+    Bench::Rng lRng;
+    EntityID lParent = ENTITY_NONE;
+    for (Uint32 i = 0; i < lCount; ++i)
+    {
+        const EntityID lE = lWorld.CreateEntity("Bench");
+        auto& lTr    = lWorld.AddComponent<TransformComponent>(lE);
+        lTr.Position = { lRng.Unit() * 10.f, lRng.Unit() * 10.f };
+        lTr.Scale    = { 1.f + lRng.Unit() * 0.1f, 1.f + lRng.Unit() * 0.1f };
+        lTr.Rotation = lRng.Unit() * 0.5f;
+        lTr.ZOrder   = 0.f;
+
+        // Every k_Depth-th entity starts a new chain; the rest hang off the previous one.
+        if (i % k_Depth != 0) { H::SetParent(lWorld, lE, lParent); }
+        lParent = lE;
+        lEntities.push_back(lE);
+    }
+
+    InState.Measure([&]
+    {
+        float lSum = 0.f;
+        for (EntityID lE : lEntities) { lSum += H::GetWorldTransform(lWorld, lE).Position.x; }
+        Bench::DoNotOptimize(lSum);
+    });
+    InState.SetCounter("depth", static_cast<double>(k_Depth));
+}
@@ -0,0 +1,173 @@
+// OpaaxBenchmarks entry point.
+//
+// Brings up the headless Null RHI backend (no window, no device) so benchmarks that go through
+// Renderer2D / Text2D run the real engine code with GPU work stubbed out, then runs every
+// registered (benchmark, size) pair and writes the results as JSON.
+//
+// Usage: OpaaxBenchmarks [--out <file.json>] [--filter <substring>] [--samples <n>] [--warmup <n>]
+// Run from the exe's dir so the post-build-copied Engine/Assets resolve (fonts for Text2D).
+#include "BenchHarness.h"
+
+#include "Core/Log/OpaaxLog.h"
+#include "RHI/RenderAPI.h"
+#include "RHI/RenderCommand.h"
+#include "RHI/Null/NullContext.h"
+#include "Renderer/Renderer2D.h"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+
+#ifndef OPAAX_BENCH_GIT_REV
+#define OPAAX_BENCH_GIT_REV "unknown"
+#endif
+
+using namespace Opaax;
+
+namespace
+{
+    struct BenchOptions
+    {
+        const char* OutPath = nullptr;   // nullptr -> stdout
+        const char* Filter  = nullptr;   // substring match on the benchmark name
+        Uint32      Samples = 15;
+        Uint32      Warmup  = 3;
+    };
+
+    bool ParseArgs(int argc, char** argv, BenchOptions& OutOptions)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const bool lHasValue = (i + 1 < argc);
+            if      (!std::strcmp(argv[i], "--out")     && lHasValue) { OutOptions.OutPath = argv[++i]; }
+            else if (!std::strcmp(argv[i], "--filter")  && lHasValue) { OutOptions.Filter  = argv[++i]; }
+            else if (!std::strcmp(argv[i], "--samples") && lHasValue) { OutOptions.Samples = static_cast<Uint32>(std::strtoul(argv[++i], nullptr, 10)); }
+            else if (!std::strcmp(argv[i], "--warmup")  && lHasValue) { OutOptions.Warmup  = static_cast<Uint32>(std::strtoul(argv[++i], nullptr, 10)); }
+            else
+            {
+                std::fprintf(stderr, "usage: OpaaxBenchmarks [--out file.json] [--filter substr] [--samples n] [--warmup n]\n");
+                return false;
+            }
+        }
+        if (OutOptions.Samples == 0) { OutOptions.Samples = 1; }
+        return true;
+    }
+
+    std::string UtcTimestamp()
+    {
+        const std::time_t lNow = std::time(nullptr);
+        std::tm lTm{};
+#if defined(_WIN32)
+        gmtime_s(&lTm, &lNow);
+#else
+        gmtime_r(&lNow, &lTm);
+#endif
+        char lBuf[32];
+        std::strftime(lBuf, sizeof(lBuf), "%Y-%m-%dT%H:%M:%SZ", &lTm);
+        return lBuf;
+    }
+
+    nlohmann::json ToJson(const Bench::BenchResult& InResult)
+    {
+        nlohmann::json lJson;
+        lJson["name"] = InResult.Name;
+        lJson["size"] = InResult.Size;
+        if (InResult.Skipped)
+        {
+            lJson["skipped"] = InResult.SkipReason;
+            return lJson;
+        }
+        lJson["samples"]     = InResult.Samples;
+        lJson["median_ns"]   = InResult.MedianNs;
+        lJson["min_ns"]      = InResult.MinNs;
+        lJson["mean_ns"]     = InResult.MeanNs;
+        lJson["stddev_ns"]   = InResult.StdDevNs;
+        lJson["ns_per_item"] = InResult.Size ? InResult.MedianNs / InResult.Size : InResult.MedianNs;
+
+        nlohmann::json lCounters = nlohmann::json::object();
+        for (const auto& [lKey, lValue] : InResult.Counters) { lCounters[lKey] = lValue; }
+        lJson["counters"] = Move(lCounters);
+        return lJson;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions lOptions;
+    if (!ParseArgs(argc, argv, lOptions)) { return 2; }
+
+    OpaaxLog::Init();
+    OpaaxLog::GetCoreLogger()->set_level(spdlog::level::off);
+    OpaaxLog::GetClientLogger()->set_level(spdlog::level::off);
+
+    // Headless renderer: Null backend + a window-less context. Renderer2D::Init builds its
+    // pipeline/buffers against the Null stubs exactly as it would on a real device.
+    UniquePtr<IRenderAPI> lAPI = RenderAPI::Create(EBackend::Null);
+    NullContext lContext(nullptr);
+    lContext.Init();
+    RenderCommand::Init(lAPI.release(), lContext);
+    Renderer2D::Init();
+
+    TDynArray<Bench::BenchResult> lResults;
+    for (const Bench::BenchCase& lCase : Bench::Registry())
+    {
+        if (lOptions.Filter && !std::strstr(lCase.Name, lOptions.Filter)) { continue; }
+
+        for (Uint32 lSize : lCase.Sizes)
+        {
+            Bench::BenchResult lResult;
+            lResult.Name = lCase.Name;
+            lResult.Size = lSize;
+
+            Bench::BenchState lState(lResult, lOptions.Warmup, lOptions.Samples);
+            lCase.Fn(lState);
+
+            std::fprintf(stderr, "%-40s %8u  median %12.1f ns%s\n", lCase.Name, lSize, lResult.MedianNs,
+                         lResult.Skipped ? "  (skipped)" : "");
+            lResults.push_back(Move(lResult));
+        }
+    }
+
+    Renderer2D::Shutdown();
+    RenderCommand::Shutdown();
+
+    nlohmann::json lRoot;
+    lRoot["schema"]    = 1;
+    lRoot["timestamp"] = UtcTimestamp();
+    lRoot["revision"]  = OPAAX_BENCH_GIT_REV;
+#if defined(NDEBUG)
+    lRoot["config"]    = "Release";
+#else
+    lRoot["config"]    = "Debug";
+#endif
+    lRoot["backend"]   = RenderAPI::BackendToString(EBackend::Null);
+    lRoot["samples"]   = lOptions.Samples;
+    lRoot["warmup"]    = lOptions.Warmup;
+    lRoot["results"]   = nlohmann::json::array();
+    for (const Bench::BenchResult& lResult : lResults) { lRoot["results"].push_back(ToJson(lResult)); }
+
+    const std::string lText = lRoot.dump(2);
+    if (lOptions.OutPath)
+    {
+        std::ofstream lFile(lOptions.OutPath);
+        if (!lFile.is_open())
+        {
+            std::fprintf(stderr, "OpaaxBenchmarks: cannot write '%s'\n", lOptions.OutPath);
+            return 1;
+        }
+        lFile << lText << '\n';
+    }
+    else
+    {
+        std::cout << lText << '\n';
+    }
+
+    OpaaxLog::Shutdown();
+    return 0;
+}
@@ -0,0 +1,49 @@
+// Bench: AssignBatches over a sorted frame.
+//
+// Two texture mixes at the renderer's real caps (MAX_QUADS = 1000, 16 slots):
+//  - Runs:      long runs of the same texture (sprite-heavy scenes; hits the last-key cache),
+//  - Scattered: 24 textures drawn at random (worst case; slot scans + slot-cap batch splits).
+#include "BenchHarness.h"
+
+#include "Renderer/FrameBatcher.h"
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr Uint32 k_MaxQuads = 1000;
+    constexpr Uint32 k_MaxSlots = 16;
+
+    void RunAssign(Bench::BenchState& InState, bool InScattered)
+    {
+        const Uint32 lCount = InState.Size();
+
+        Bench::Rng lRng;
+        TDynArray<Uint64> lKeys(lCount);
+        for (Uint32 i = 0; i < lCount; ++i)
+        {
+            // 0 = white; 1..24 = synthetic texture ids.
+            lKeys[i] = InScattered ? lRng.Range(25) : (i / 64) % 25;
+        }
+
+        TDynArray<BatchAssignment> lAssign(lCount);
+        Uint32 lBatches = 0;
+
+        InState.Measure([&]
+        {
+            lBatches = AssignBatches(lKeys.data(), lCount, k_MaxQuads, k_MaxSlots, lAssign.data());
+            Bench::DoNotOptimize(lBatches);
+        });
+        InState.SetCounter("batches", static_cast<double>(lBatches));
+    }
+}
+
+OPAAX_BENCHMARK(AssignBatchesRuns, "Renderer/AssignBatches/Runs", 1000, 10000, 100000)
+{
+    RunAssign(InState, false);
+}
+
+OPAAX_BENCHMARK(AssignBatchesScattered, "Renderer/AssignBatches/Scattered", 1000, 10000, 100000)
+{
+    RunAssign(InState, true);
+}
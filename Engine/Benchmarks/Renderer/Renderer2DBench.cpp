@@ -0,0 +1,84 @@
+// Bench: Renderer2D frame on the Null backend — record N sprites, then EmitFrame.
+//
+// The timed body is one full frame (Begin, N DrawSprite/DrawQuad, End), so it covers record +
+// sort + assign + vertex gather + (stubbed) upload. The renderer's own phase timers for the last
+// frame are attached as counters; gather_us is the EmitFrame vertex-gather cost in isolation.
+#include "BenchHarness.h"
+
+#include "RHI/RenderCommand.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/Texture2D.h"
+#include "Renderer/Camera/OrthographicCamera.h"
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr Uint32 k_TextureCount = 24;   // > 16 slots: forces slot-cap batch splits
+
+    struct SpriteInput
+    {
+        Vector2F     Position;
+        float        Rotation;
+        Uint32       Texture;   // index into the texture set; k_TextureCount = solid quad
+        ERenderLayer Layer;
+        Int16        OrderInLayer;
+    };
+}
+
+OPAAX_BENCHMARK(Renderer2DFrame, "Renderer/Renderer2D/Frame", 1000, 10000, 100000)
+{
+    const Uint32 lCount  = InState.Size();
+    const Uint32 lLayers = static_cast<Uint32>(ERenderLayer::Count);
+
+    TDynArray<UniquePtr<Texture2D>> lTextures;
+    for (Uint32 i = 0; i < k_TextureCount; ++i) { lTextures.push_back(MakeUnique<Texture2D>(1u, 1u)); }
+
+    Bench::Rng lRng;
+    TDynArray<SpriteInput> lSprites(lCount);
+    for (SpriteInput& lS : lSprites)
+    {
+        lS.Position     = { lRng.Unit() * 1280.f, lRng.Unit() * 720.f };
+        lS.Rotation     = (lRng.Range(4) == 0) ? lRng.Unit() * 6.2831853f : 0.f;   // 25% rotated
+        lS.Texture      = lRng.Range(k_TextureCount + 1);
+        lS.Layer        = static_cast<ERenderLayer>(lRng.Range(lLayers));
+        lS.OrderInLayer = static_cast<Int16>(lRng.Range(8));
+    }
+
+    OrthographicCamera lCamera;
+    lCamera.SetViewportSize(1280u, 720u);
+
+    const Vector2F lSize  = { 16.f, 16.f };
+    const Vector4F lColor = Vector4F(1.f);
+
+    InState.Measure([&]
+    {
+        RenderCommand::BeginFrame();
+        Renderer2D::NewFrame();
+        Renderer2D::Begin(lCamera, RenderCommand::GetCommandBuffer());
+        for (const SpriteInput& lS : lSprites)
+        {
+            if (lS.Texture == k_TextureCount)
+            {
+                Renderer2D::DrawQuad(lS.Position, lSize, lColor, lS.Rotation, lS.Layer, lS.OrderInLayer);
+            }
+            else
+            {
+                Renderer2D::DrawSprite(lS.Position, lSize, *lTextures[lS.Texture], lColor,
+                                       lS.Rotation, lS.Layer, lS.OrderInLayer);
+            }
+        }
+        Renderer2D::End();
+        RenderCommand::EndFrame();
+    });
+
+    // Publish the last measured frame and report its phase split.
+    Renderer2D::NewFrame();
+    const RenderStats& lStats = Renderer2D::GetStats();
+    InState.SetCounter("record_us", lStats.RecordMicros);
+    InState.SetCounter("sort_us",   lStats.SortMicros);
+    InState.SetCounter("assign_us", lStats.AssignMicros);
+    InState.SetCounter("gather_us", lStats.GatherMicros);
+    InState.SetCounter("upload_us", lStats.UploadMicros);
+    InState.SetCounter("batches",   static_cast<double>(lStats.Batches));
+}
@@ -0,0 +1,87 @@
+// Bench: Text2D::DrawString layout + glyph record, N characters per call.
+//
+// Bakes Roboto-Regular from the engine asset root (EngineConfig::EngineAssetsRoot, i.e.
+// the post-build-copied Engine/Assets next to the exe) and draws one string of Size() printable
+// characters, broken every 80 columns, inside a Renderer2D Begin/End on the Null backend.
+// record_us is the Begin -> End window (the DrawString work alone); skipped if the font is missing.
+// The cached case replays the glyph run after the first call; Uncached disables the run cache.
+#include "BenchHarness.h"
+
+#include "Core/Config/EngineConfig.h"
+#include "RHI/RenderCommand.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/Camera/OrthographicCamera.h"
+#include "Renderer/Text/FontAsset.h"
+#include "Renderer/Text/Text2D.h"
+
+#include <string>
+
+using namespace Opaax;
+
+namespace
+{
+    std::string MakeText(Uint32 InChars)
+    {
+        static constexpr char k_Pangram[] = "The quick brown fox jumps over the lazy dog. AVAWAT To Ty 0123456789 ";
+        std::string lText;
+        lText.reserve(InChars);
+        for (Uint32 i = 0; i < InChars; ++i)
+        {
+            lText.push_back(((i + 1) % 80 == 0) ? '\n' : k_Pangram[i % (sizeof(k_Pangram) - 1)]);
+        }
+        return lText;
+    }
+
+    void RunDrawString(Bench::BenchState& InState, bool InCached)
+    {
+        // Baked per size (outside the timed body) so the atlas dies with the case, before shutdown.
+        const OpaaxString lPath = EngineConfig::EngineAssetsRoot() + "/Fonts/Roboto-Regular.ttf";
+        FontAsset lFont(lPath, OPAAX_ID("Fonts/Roboto-Regular"));
+        if (!lFont.IsLoaded())
+        {
+            InState.Skip("Fonts/Roboto-Regular.ttf not found under the engine asset root");
+            return;
+        }
+
+        const std::string lText = MakeText(InState.Size());
+
+        OrthographicCamera lCamera;
+        lCamera.SetViewportSize(1280u, 720u);
+
+        Text2D::DrawParams lParams;
+
+        // Uncached = every call re-runs the layout walk (glyph lookups + kerning searches).
+        Text2D::ClearGlyphRunCache();
+        if (!InCached) { Text2D::SetGlyphRunCacheCapacity(0u, 0u); }
+
+        InState.Measure([&]
+        {
+            RenderCommand::BeginFrame();
+            Renderer2D::NewFrame();
+            Renderer2D::Begin(lCamera, RenderCommand::GetCommandBuffer());
+            Text2D::DrawString(lText.c_str(), { -640.f, 360.f }, lFont, lParams);
+            Renderer2D::End();
+            RenderCommand::EndFrame();
+        });
+
+        Renderer2D::NewFrame();
+        const RenderStats& lStats = Renderer2D::GetStats();
+        InState.SetCounter("record_us",  lStats.RecordMicros);
+        InState.SetCounter("quads",      static_cast<double>(lStats.Quads));
+        InState.SetCounter("cache_hits", static_cast<double>(Text2D::GetGlyphRunCacheStats().Hits));
+
+        Text2D::SetGlyphRunCacheCapacity(Text2D::GlyphRunCache::DefaultMaxEntries,
+                                         Text2D::GlyphRunCache::DefaultMaxQuads);
+        Text2D::ClearGlyphRunCache();
+    }
+}
+
+OPAAX_BENCHMARK(Text2DDrawString, "Text/Text2D::DrawString", 64, 1024, 16384)
+{
+    RunDrawString(InState, true);
+}
+
+OPAAX_BENCHMARK(Text2DDrawStringUncached, "Text/Text2D::DrawString/Uncached", 64, 1024, 16384)
+{
+    RunDrawString(InState, false);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "IAsset.hpp"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    /**
+     * @struct AssetTypeCacheStats
+     * AssetRegistry cache counters for one AssetType.
+     */
+    struct AssetTypeCacheStats
+    {
+        Uint64 ResidentBytes = 0;   // sizeof + IAsset::GetMemorySize of every Loaded entry
+        Uint32 ResidentCount = 0;
+        Uint32 Evictions     = 0;   // across the run
+        Uint32 Reloads       = 0;   // misses on an ID the cache had evicted, across the run
+    };
+
+    /**
+     * @struct AssetCacheStats
+     * AssetRegistry cache counters, refreshed by AssetRegistry::UpdateCache. Types the registry
+     * cannot categorize (not an IAsset) land in the Unknown bucket.
+     */
+    struct AssetCacheStats
+    {
+        AssetTypeCacheStats PerType[static_cast<Uint8>(AssetType::Count)] = {};
+
+        Uint64 BudgetBytes    = 0;   // 0 = unlimited
+        Uint64 ResidentBytes  = 0;
+        Uint32 ResidentCount  = 0;
+        Uint32 EvictableCount = 0;   // resident entries with no live handle
+        Uint32 Evictions      = 0;
+        Uint32 Reloads        = 0;
+
+        FORCEINLINE const AssetTypeCacheStats& Get(AssetType InType) const noexcept
+        {
+            const Uint8 lIdx = static_cast<Uint8>(InType);
+            return PerType[lIdx < static_cast<Uint8>(AssetType::Count) ? lIdx : 0];
+        }
+    };
+
+} // namespace Opaax
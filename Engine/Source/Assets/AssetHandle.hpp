@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AssetRefBlock.hpp"
+#include "AssetSlotTable.hpp"
 #include "Core/EngineAPI.h"
 #include "Core/OpaaxTypes.h"
 #include "Core/OpaaxStringID.hpp"
@@ -32,9 +33,11 @@ namespace Opaax
      * @class TAssetHandle
      *
      * Type-safe, ID-keyed reference to an asset owned by AssetRegistry.
-     * Storage = OpaaxStringID + AssetRefBlock* — no cached payload pointer.
-     * Every Get() resolves through the registry, so the handle correctly reports
-     * invalid after Unload / type-mismatch / Shutdown without manual cleanup.
+     * Storage = OpaaxStringID + AssetRefBlock* + (slot, generation) — no cached payload
+     * pointer. Get() resolves through AssetSlotTable (one bounds check, one load); a
+     * generation miss (Unload / Reload / Shutdown) falls back to the registry's ID lookup,
+     * so the handle reports invalid without manual cleanup and still finds an asset
+     * re-loaded under the same ID. The string ID stays the serialized identity.
      *
      * Implicit-conversion policy: explicit Get() / IsValid() / operator-> / operator*
      * only. There is intentionally no operator T* — call sites must opt in to
@@ -58,8 +61,9 @@ namespace Opaax
     public:
         TAssetHandle() noexcept = default;
 
-        TAssetHandle(OpaaxStringID InID, AssetRefBlock* InBlock) noexcept
-            : m_ID(InID), m_Block(InBlock)
+        TAssetHandle(OpaaxStringID InID, AssetRefBlock* InBlock,
+                     Uint32 InSlot = AssetSlotTable::InvalidIndex, Uint32 InGeneration = 0) noexcept
+            : m_ID(InID), m_Block(InBlock), m_Slot(InSlot), m_Generation(InGeneration)
         {
             if (m_Block)
             {
@@ -76,7 +80,7 @@ namespace Opaax
         // Copy
         // =============================================================================
         TAssetHandle(const TAssetHandle& Other) noexcept
-            : m_ID(Other.m_ID), m_Block(Other.m_Block)
+            : m_ID(Other.m_ID), m_Block(Other.m_Block), m_Slot(Other.m_Slot), m_Generation(Other.m_Generation)
         {
             if (m_Block)
             {
@@ -89,8 +93,10 @@ namespace Opaax
             if (this != &Other)
             {
                 ReleaseRef();
-                m_ID    = Other.m_ID;
-                m_Block = Other.m_Block;
+                m_ID         = Other.m_ID;
+                m_Block      = Other.m_Block;
+                m_Slot       = Other.m_Slot;
+                m_Generation = Other.m_Generation;
                 if (m_Block) { m_Block->AddRef(); }
             }
             return *this;
@@ -100,10 +106,11 @@ namespace Opaax
         // Move
         // =============================================================================
         TAssetHandle(TAssetHandle&& Other) noexcept
-            : m_ID(Other.m_ID), m_Block(Other.m_Block)
+            : m_ID(Other.m_ID), m_Block(Other.m_Block), m_Slot(Other.m_Slot), m_Generation(Other.m_Generation)
         {
             Other.m_ID    = OpaaxStringID{};
             Other.m_Block = nullptr;
+            Other.m_Slot  = AssetSlotTable::InvalidIndex;
         }
 
         TAssetHandle& operator=(TAssetHandle&& Other) noexcept
@@ -113,8 +120,11 @@ namespace Opaax
                 ReleaseRef();
                 m_ID          = Other.m_ID;
                 m_Block       = Other.m_Block;
+                m_Slot        = Other.m_Slot;
+                m_Generation  = Other.m_Generation;
                 Other.m_ID    = OpaaxStringID{};
                 Other.m_Block = nullptr;
+                Other.m_Slot  = AssetSlotTable::InvalidIndex;
             }
             return *this;
         }
@@ -150,6 +160,7 @@ namespace Opaax
             ReleaseRef();
             m_ID    = OpaaxStringID{};
             m_Block = nullptr;
+            m_Slot  = AssetSlotTable::InvalidIndex;
         }
 
         //------------------------------------------------------------------------------
@@ -157,6 +168,11 @@ namespace Opaax
 
         FORCEINLINE T*             Get()         const noexcept
         {
+            if (void* lPtr = AssetSlotTable::Resolve(m_Slot, m_Generation))
+            {
+                return static_cast<T*>(lPtr);
+            }
+            // Slot reissued or empty (Unload / Reload / still Loading) — resolve by ID.
             return static_cast<T*>(Internal::AssetRegistry_TryResolveTyped(m_ID.GetId(), typeid(T)));
         }
         FORCEINLINE bool           IsValid()     const noexcept { return Get() != nullptr; }
@@ -167,8 +183,10 @@ namespace Opaax
         // Members
         // =============================================================================
     private:
-        OpaaxStringID  m_ID    = {};
-        AssetRefBlock* m_Block = nullptr;
+        OpaaxStringID  m_ID         = {};
+        AssetRefBlock* m_Block      = nullptr;
+        Uint32         m_Slot       = AssetSlotTable::InvalidIndex;   // AssetSlotTable index + the
+        Uint32         m_Generation = 0;                              // occupancy it was issued for
 
         void ReleaseRef() noexcept
         {
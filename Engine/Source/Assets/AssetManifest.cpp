@@ -3,6 +3,31 @@
 namespace Opaax
 {
     UnorderedMap<Uint32, AssetDescriptor> AssetManifest::s_Descriptors;
+    UnorderedMap<OpaaxString, Uint32, OpaaxHash> AssetManifest::s_PathIndex;
+
+    void AssetManifest::IndexPath(const AssetDescriptor& InDesc)
+    {
+        if (InDesc.RelPath.IsEmpty()) { return; }
+        s_PathIndex.insert_or_assign(InDesc.RelPath, InDesc.ID.GetId());
+    }
+
+    void AssetManifest::UnindexPath(const AssetDescriptor& InDesc)
+    {
+        auto lIt = s_PathIndex.find(InDesc.RelPath);
+        if (lIt == s_PathIndex.end() || lIt->second != InDesc.ID.GetId()) { return; }
+        s_PathIndex.erase(lIt);
+
+        // NOTE: Two entries on one path is a manifest mistake, but the survivor stays findable.
+        //   Only reached on Remove / override, never on a lookup.
+        for (const auto& [lKey, lDesc] : s_Descriptors)
+        {
+            if (lKey != InDesc.ID.GetId() && lDesc.RelPath == InDesc.RelPath)
+            {
+                s_PathIndex.emplace(lDesc.RelPath, lKey);
+                break;
+            }
+        }
+    }
 
     bool AssetManifest::GenerateEmpty(const char* InAbsPath) noexcept
     {
@@ -88,13 +113,17 @@ namespace Opaax
 
             // NOTE: Later manifests override earlier ones.
             //   Game manifest loaded after engine manifest — game wins on collision.
-            if (s_Descriptors.count(lKey))
+            auto lExisting = s_Descriptors.find(lKey);
+            if (lExisting != s_Descriptors.end())
             {
                 OPAAX_CORE_TRACE("AssetManifest: '{}' overriding existing entry.",
                     lDesc.ID);
+                UnindexPath(lExisting->second);
             }
 
-            s_Descriptors[lKey] = std::move(lDesc);
+            AssetDescriptor& lStored = s_Descriptors[lKey];
+            lStored = std::move(lDesc);
+            IndexPath(lStored);
             ++lCount;
         }
 
@@ -117,14 +146,11 @@ namespace Opaax
 
     const AssetDescriptor* AssetManifest::FindByPath(const OpaaxString& InRelPath) noexcept
     {
-        for (const auto& [lKey, lDesc] : s_Descriptors)
-        {
-            if (lDesc.RelPath == InRelPath)
-            {
-                return &lDesc;
-            }
-        }
-        return nullptr;
+        auto lIt = s_PathIndex.find(InRelPath);
+        if (lIt == s_PathIndex.end()) { return nullptr; }
+
+        auto lDesc = s_Descriptors.find(lIt->second);
+        return lDesc != s_Descriptors.end() ? &lDesc->second : nullptr;
     }
 
     bool AssetManifest::Contains(OpaaxStringID InID) noexcept
@@ -135,6 +161,7 @@ namespace Opaax
     void AssetManifest::Clear() noexcept
     {
         s_Descriptors.clear();
+        s_PathIndex.clear();
     }
 
     void AssetManifest::Add(AssetDescriptor&& InDesc)
@@ -147,7 +174,8 @@ namespace Opaax
             return;
         }
 
-        s_Descriptors.emplace(lKey, std::move(InDesc));
+        const auto lIt = s_Descriptors.emplace(lKey, std::move(InDesc)).first;
+        IndexPath(lIt->second);
     }
     
     bool AssetManifest::Remove(OpaaxStringID InID) noexcept
@@ -155,6 +183,7 @@ namespace Opaax
         auto lIt = s_Descriptors.find(InID.GetId());
         if (lIt == s_Descriptors.end()) { return false; }
 
+        UnindexPath(lIt->second);
         s_Descriptors.erase(lIt);
         OPAAX_CORE_INFO("AssetManifest: removed '{}'", InID);
         return true;
@@ -4,6 +4,7 @@
 #include "Core/OpaaxTypes.h"
 #include "Core/OpaaxString.hpp"
 #include "Core/OpaaxStringID.hpp"
+#include "Core/OpaaxHash.h"
 #include "Core/Log/OpaaxLog.h"
 
 #include <nlohmann/json.hpp>
@@ -35,6 +36,9 @@ namespace Opaax
      * Loads and owns all AssetDescriptors from one or more JSON manifest files.
      * Multiple manifests can be loaded (engine manifest + game manifest).
      *
+     * Descriptors are keyed by ID; a secondary index (RelPath -> ID) keeps FindByPath a hash
+     * lookup. Every mutation (LoadFile, Add, Remove, Clear) updates both.
+     *
      * Usage:
      *  AssetManifest::LoadFile("Engine/Assets/AssetManifest.json");
      *  AssetManifest::LoadFile("Game/Assets/AssetManifest.json");
@@ -48,6 +52,11 @@ namespace Opaax
     private:
         static bool GenerateEmpty(const char* InAbsPath) noexcept;
 
+        // Point InDesc.RelPath at InDesc / drop it from the path index (only if it still points
+        // at InDesc — another entry sharing the path then takes over).
+        static void IndexPath(const AssetDescriptor& InDesc);
+        static void UnindexPath(const AssetDescriptor& InDesc);
+
         //-----------------------------------------------------------------------------
         // Function
         //-----------------------------------------------------------------------------
@@ -71,9 +80,10 @@ namespace Opaax
         static const AssetDescriptor* Find(OpaaxStringID InID) noexcept;
         
         /**
-         * Reverse lookup — find a descriptor by its relative path.
+         * Reverse lookup — find a descriptor by its relative path (exact match, hashed).
+         * If several entries share a path, the one indexed last wins.
          * @param InRelPath 
-         * @return 
+         * @return nullptr if no entry has that path.
          */
         static const AssetDescriptor* FindByPath(const OpaaxString& InRelPath) noexcept;
         
@@ -115,6 +125,7 @@ namespace Opaax
         //-----------------------------------------------------------------------------
     private:
         static UnorderedMap<Uint32, AssetDescriptor> s_Descriptors;
+        static UnorderedMap<OpaaxString, Uint32, OpaaxHash> s_PathIndex;   // RelPath -> descriptor key
     };
 
 } // namespace Opaax
\ No newline at end of file
@@ -1,19 +1,339 @@
 #include "AssetRegistry.h"
 #include "IAsset.hpp"
+#include "Core/IO/IOSubsystem.h"
+#include "Core/Jobs/JobSubsystem.h"
+#include "Core/OpaaxLruEviction.h"
 
 namespace Opaax
 {
-    UnorderedMap<Uint32, AssetRegistry::AssetEntry> AssetRegistry::s_Assets;
+    UnorderedMap<Uint32, AssetRegistry::AssetEntry>                  AssetRegistry::s_Assets;
+    UnorderedMap<Uint32, SharedPtr<AssetRegistry::PendingLoad>>      AssetRegistry::s_PendingLoads;
+    JobSubsystem*                                                    AssetRegistry::s_Jobs = nullptr;
+    IOSubsystem*                                                     AssetRegistry::s_IO   = nullptr;
+    Uint64                                                           AssetRegistry::s_CacheFrame       = 0;
+    Uint32                                                           AssetRegistry::s_CacheEvictFrames = 0;
+    AssetCacheStats                                                  AssetRegistry::s_CacheStats;
+    UnorderedMap<Uint32, AssetType>                                  AssetRegistry::s_Evicted;
+    AssetRegistry::LookupShard                                       AssetRegistry::s_Lookup[AssetRegistry::LookupShardCount];
+    TDynArray<AssetRegistry::RetiredPayload>                         AssetRegistry::s_Retired;
+
+    namespace
+    {
+        // UpdateCache -> SelectLruEvictions; s_CandidateKeys is parallel to s_Candidates.
+        TDynArray<LruCandidate>       s_Candidates;
+        TDynArray<Uint32>             s_CandidateKeys;
+        TDynArray<Uint32>             s_Evict;
+    }
 
     namespace Internal
     {
         void* AssetRegistry_TryResolveTyped(Uint32 InKey, const std::type_index& InExpected) noexcept
         {
-            auto& lAssets = AssetRegistry::s_Assets;
-            const auto lIt = lAssets.find(InKey);
-            if (lIt == lAssets.end())                  { return nullptr; }
-            if (lIt->second.Type != InExpected)        { return nullptr; }
-            return lIt->second.Ptr;
+            AssetRegistry::LookupRecord lRecord;
+            if (!AssetRegistry::FindRecord(InKey, lRecord)) { return nullptr; }
+            if (lRecord.Type != InExpected)                 { return nullptr; }
+            return AssetSlotTable::Resolve(lRecord.Slot, lRecord.Generation);
+        }
+    }
+
+    // =============================================================================
+    // Lookup
+    // =============================================================================
+    AssetRegistry::AssetEntry& AssetRegistry::EmplaceEntry(Uint32 InKey, AssetEntry&& InEntry)
+    {
+        AssetEntry& lEntry = s_Assets.emplace(InKey, Move(InEntry)).first->second;
+
+        LookupShard& lShard = ShardOf(InKey);
+        UniqueLock<SharedMutex> lLock(lShard.Mutex);
+        lShard.Records[InKey] = { lEntry.Type, lEntry.Block, lEntry.Slot, lEntry.Generation, lEntry.State };
+        return lEntry;
+    }
+
+    bool AssetRegistry::EraseEntry(UnorderedMap<Uint32, AssetEntry>::iterator InIt, bool InOnlyIfUnreferenced)
+    {
+        const Uint32 lKey   = InIt->first;
+        AssetEntry&  lEntry = InIt->second;
+        {
+            LookupShard& lShard = ShardOf(lKey);
+            UniqueLock<SharedMutex> lLock(lShard.Mutex);
+            if (InOnlyIfUnreferenced && lEntry.LiveHandleCount() > 0) { return false; }
+            lShard.Records.erase(lKey);
+        }
+
+        // A job may still be reading what it resolved this frame — the payload outlives the entry.
+        if (s_Jobs && lEntry.Ptr && lEntry.Deleter)
+        {
+            s_Retired.push_back({ lEntry.Ptr, lEntry.Deleter, s_CacheFrame });
+            lEntry.Ptr     = nullptr;
+            lEntry.Deleter = nullptr;
+        }
+        s_Assets.erase(InIt);
+        return true;
+    }
+
+    void AssetRegistry::PublishState(Uint32 InKey, EAssetState InState)
+    {
+        LookupShard& lShard = ShardOf(InKey);
+        UniqueLock<SharedMutex> lLock(lShard.Mutex);
+        const auto lIt = lShard.Records.find(InKey);
+        if (lIt != lShard.Records.end()) { lIt->second.State = InState; }
+    }
+
+    bool AssetRegistry::FindRecord(Uint32 InKey, LookupRecord& OutRecord)
+    {
+        const LookupShard& lShard = ShardOf(InKey);
+        SharedLock<SharedMutex> lLock(lShard.Mutex);
+        const auto lIt = lShard.Records.find(InKey);
+        if (lIt == lShard.Records.end()) { return false; }
+        OutRecord = lIt->second;
+        return true;
+    }
+
+    bool AssetRegistry::AcquireRecord(Uint32 InKey, const std::type_index& InType, LookupRecord& OutRecord)
+    {
+        const LookupShard& lShard = ShardOf(InKey);
+        SharedLock<SharedMutex> lLock(lShard.Mutex);
+        const auto lIt = lShard.Records.find(InKey);
+        if (lIt == lShard.Records.end() || lIt->second.Type != InType) { return false; }
+
+        // Under the lock: the entry (and its registry ref on Block) cannot be erased before this.
+        OutRecord = lIt->second;
+        OutRecord.Block->AddRef();
+        return true;
+    }
+
+    void AssetRegistry::ClearLookup()
+    {
+        for (LookupShard& lShard : s_Lookup)
+        {
+            UniqueLock<SharedMutex> lLock(lShard.Mutex);
+            lShard.Records.clear();
+        }
+    }
+
+    void AssetRegistry::FreeRetired(bool InAll)
+    {
+        size_t lKept = 0;
+        for (const RetiredPayload& lRetired : s_Retired)
+        {
+            if (InAll || s_CacheFrame - lRetired.Frame >= LruMinIdleFrames)
+            {
+                lRetired.Deleter(lRetired.Ptr);
+            }
+            else
+            {
+                s_Retired[lKept++] = lRetired;
+            }
+        }
+        s_Retired.resize(lKept);
+    }
+
+    // =============================================================================
+    // Cache budget
+    // =============================================================================
+    void AssetRegistry::SetCacheBudget(Uint64 InBytes, Uint32 InEvictFrames) noexcept
+    {
+        s_CacheStats.BudgetBytes = InBytes;
+        s_CacheEvictFrames       = InEvictFrames;
+    }
+
+    void AssetRegistry::UpdateCache()
+    {
+        ++s_CacheFrame;
+        FreeRetired(false);
+
+        for (AssetTypeCacheStats& lType : s_CacheStats.PerType)
+        {
+            lType.ResidentBytes = 0;
+            lType.ResidentCount = 0;
+        }
+        s_CacheStats.ResidentBytes = 0;
+        s_CacheStats.ResidentCount = 0;
+
+        s_Candidates.clear();
+        s_CandidateKeys.clear();
+        for (auto& [lKey, lEntry] : s_Assets)
+        {
+            if (lEntry.State != EAssetState::Loaded || !lEntry.Ptr) { continue; }
+
+            // Re-queried every frame: GPU copies come and go (TextureResidency, async font bakes).
+            const Uint64 lBytes = lEntry.SizeOf ? lEntry.SizeOf(lEntry.Ptr) : 0u;
+            AssetTypeCacheStats& lType = s_CacheStats.PerType[static_cast<Uint8>(lEntry.Category)];
+            lType.ResidentBytes        += lBytes;
+            ++lType.ResidentCount;
+            s_CacheStats.ResidentBytes += lBytes;
+            ++s_CacheStats.ResidentCount;
+
+            // Held by someone this frame — most recently used, not a candidate.
+            if (lEntry.LiveHandleCount() > 0)
+            {
+                lEntry.LastUsedFrame = s_CacheFrame;
+                continue;
+            }
+            s_Candidates.push_back({ lBytes, lEntry.LastUsedFrame });
+            s_CandidateKeys.push_back(lKey);
+        }
+        s_CacheStats.EvictableCount = static_cast<Uint32>(s_Candidates.size());
+
+        const Uint64 lBudget = s_CacheStats.BudgetBytes;
+        if (lBudget == 0 || s_CacheStats.ResidentBytes <= lBudget) { return; }
+
+        const Uint32 lMinIdle = std::max(s_CacheEvictFrames, LruMinIdleFrames);
+        SelectLruEvictions(s_Candidates.data(), static_cast<Uint32>(s_Candidates.size()),
+                           s_CacheStats.ResidentBytes, lBudget, s_CacheFrame, lMinIdle, s_Evict);
+        if (s_Evict.empty()) { return; }
+
+        Uint64 lFreed   = 0;
+        Uint32 lEvicted = 0;
+        for (Uint32 lIndex : s_Evict)
+        {
+            const Uint32 lKey = s_CandidateKeys[lIndex];
+            const auto   lIt  = s_Assets.find(lKey);
+            if (lIt == s_Assets.end()) { continue; }
+
+            // A job took a handle (Find<T>) since the scan above — it stays.
+            const AssetType lCategory = lIt->second.Category;
+            if (!EraseEntry(lIt, true)) { continue; }
+
+            AssetTypeCacheStats& lType = s_CacheStats.PerType[static_cast<Uint8>(lCategory)];
+            lType.ResidentBytes -= s_Candidates[lIndex].Bytes;
+            --lType.ResidentCount;
+            ++lType.Evictions;
+            --s_CacheStats.ResidentCount;
+            ++s_CacheStats.Evictions;
+
+            s_Evicted[lKey] = lCategory;
+            lFreed += s_Candidates[lIndex].Bytes;
+            ++lEvicted;
+        }
+        if (lEvicted == 0) { return; }
+        s_CacheStats.ResidentBytes  -= lFreed;
+        s_CacheStats.EvictableCount -= lEvicted;
+
+        OPAAX_CORE_INFO("AssetRegistry: evicted {} asset(s), {:.2f} MiB (resident {:.2f} / budget {:.2f} MiB).",
+                        lEvicted, static_cast<double>(lFreed) / (1024.0 * 1024.0),
+                        static_cast<double>(s_CacheStats.ResidentBytes) / (1024.0 * 1024.0),
+                        static_cast<double>(lBudget) / (1024.0 * 1024.0));
+    }
+
+    void AssetRegistry::NoteCacheMiss(Uint32 InKey)
+    {
+        const auto lIt = s_Evicted.find(InKey);
+        if (lIt == s_Evicted.end()) { return; }
+
+        ++s_CacheStats.PerType[static_cast<Uint8>(lIt->second)].Reloads;
+        ++s_CacheStats.Reloads;
+        s_Evicted.erase(lIt);
+    }
+
+    void AssetRegistry::ResetCache()
+    {
+        s_Evicted.clear();
+        s_CacheStats       = {};
+        s_CacheFrame       = 0;
+        s_CacheEvictFrames = 0;
+    }
+
+    // =============================================================================
+    // Async internals
+    // =============================================================================
+    void AssetRegistry::SubmitPendingLoad(Uint32 InKey, const SharedPtr<PendingLoad>& InPending, TFunction<void()> InDecode)
+    {
+        s_PendingLoads[InKey] = InPending;
+
+        if (!s_Jobs)
+        {
+            // No worker pool (tools, tests) — same two stages, inline.
+            InDecode();
+            SettlePendingLoad(InKey, InPending);
+            return;
+        }
+
+        InPending->Job = s_Jobs->Submit(Move(InDecode), [InKey, InPending] { SettlePendingLoad(InKey, InPending); });
+    }
+
+    void AssetRegistry::SubmitPendingRead(Uint32 InKey, const SharedPtr<PendingLoad>& InPending, const OpaaxString& InAbsPath,
+                                          TFunction<void(const IOReadResult&)> InDecode)
+    {
+        s_PendingLoads[InKey] = InPending;
+        InPending->DecodeBytes = Move(InDecode);
+
+        // Completes on the IO thread, so the decode is queued the moment the bytes land — a main
+        // thread busy loading a scene never drains IO, and would otherwise decode everything itself.
+        IOReadRequest lRequest;
+        lRequest.AbsPath    = InAbsPath;
+        lRequest.CompleteOn = EIOCompletionThread::IO;
+        lRequest.OnComplete = [InKey, InPending, lJobs = s_Jobs](const IOReadResult& InRead)
+        {
+            InPending->Job = lJobs->Submit([InPending, InRead] { InPending->DecodeBytes(InRead); },
+                                           [InKey, InPending] { SettlePendingLoad(InKey, InPending); });
+        };
+        InPending->IO = s_IO->Read(Move(lRequest));
+    }
+
+    void AssetRegistry::SettlePendingLoad(Uint32 InKey, const SharedPtr<PendingLoad>& InPending)
+    {
+        // Already settled by a Load<T> that could not wait, or dropped at Shutdown.
+        if (InPending->bSettled) { return; }
+        InPending->bSettled = true;
+
+        const auto lPendingIt = s_PendingLoads.find(InKey);
+        if (lPendingIt != s_PendingLoads.end() && lPendingIt->second == InPending)
+        {
+            s_PendingLoads.erase(lPendingIt);
+        }
+
+        // Unload / Reload while decoding replaced or removed the entry — drop the result.
+        const auto lEntryIt = s_Assets.find(InKey);
+        if (lEntryIt != s_Assets.end() && lEntryIt->second.Block == InPending->Block
+            && lEntryIt->second.State == EAssetState::Loading)
+        {
+            InPending->Finish();
+        }
+        else
+        {
+            OPAAX_CORE_TRACE("AssetRegistry::LoadAsync — asset {} was unloaded while decoding; result dropped.", InKey);
+        }
+        InPending->Finish      = nullptr;   // frees the decode result
+        InPending->DecodeBytes = nullptr;
+        InPending->IO          = IORequestHandle{};   // and the file bytes
+
+        // Callbacks may start new loads — run them from a local, after the maps are consistent.
+        const TDynArray<TFunction<void()>> lCallbacks = Move(InPending->OnSettled);
+        for (const TFunction<void()>& lCallback : lCallbacks)
+        {
+            lCallback();
+        }
+    }
+
+    void AssetRegistry::FinishPendingLoad(Uint32 InKey)
+    {
+        const auto lIt = s_PendingLoads.find(InKey);
+        if (lIt == s_PendingLoads.end()) { return; }
+
+        const SharedPtr<PendingLoad> lPending = lIt->second;
+        // A read's completion submits its decode before the handle reports done, so once the read
+        // has landed Job is set — and the decode runs on a worker like any other.
+        if (s_IO) { s_IO->Wait(lPending->IO); }
+        if (s_Jobs) { s_Jobs->Wait(lPending->Job); }
+        SettlePendingLoad(InKey, lPending);
+    }
+
+    void AssetRegistry::DropPendingLoads()
+    {
+        if (s_PendingLoads.empty()) { return; }
+
+        OPAAX_CORE_WARN("AssetRegistry::Shutdown — dropping {} in-flight async load(s)", s_PendingLoads.size());
+        for (auto& [lKey, lPending] : s_PendingLoads)
+        {
+            // Let a read in flight land and queue its decode first, so no job outlives the drop.
+            if (s_IO)   { s_IO->Wait(lPending->IO); }
+            if (s_Jobs) { s_Jobs->Wait(lPending->Job); }
+            lPending->bSettled    = true;
+            lPending->Finish      = nullptr;
+            lPending->DecodeBytes = nullptr;
+            lPending->OnSettled.clear();
         }
+        s_PendingLoads.clear();
     }
 }
@@ -1,21 +1,29 @@
 ﻿#pragma once
 
 #include "AssetHandle.hpp"
+#include "IAsset.hpp"
 #include "Core/OpaaxTypes.h"
 #include "Core/OpaaxString.hpp"
 #include "Core/Log/OpaaxLog.h"
 #include "Renderer/Texture2D.h"
  
+#include <type_traits>
 #include <unordered_map>
 #include <typeindex>
 
+#include "AssetCacheStats.h"
 #include "AssetManifest.h"
 #include "AssetIdResolve.h"
 #include "Core/OpaaxPath.h"
+#include "Core/IO/IOTypes.h"
+#include "Core/Jobs/JobHandle.h"
 #include "Loader/AssetLoaderRegistry.h"
 
 namespace Opaax
 {
+    class IOSubsystem;
+    class JobSubsystem;
+
     /**
      * @class AssetRegistry
      *
@@ -23,8 +31,33 @@ namespace Opaax
      * Assets are loaded on first request, cached for subsequent requests.
      * Unloaded explicitly or all at once on Shutdown().
      *
-     * NOTE: Thread safety — Load/Unload are NOT thread-safe. Call from the main
-     * thread only. Async loading (TODO) will require a job queue + staging area.
+     * Thread safety
+     * Mutation — Load / LoadAsync / Reload / Unload / UpdateCache / Shutdown — is main thread only.
+     * Lookups are safe from any thread, concurrently with those mutations: TAssetHandle::Get
+     * (lock-free AssetSlotTable path, ID fallback), Find<T>, GetState / IsLoaded. The ID side is
+     * split into LookupShardCount tables keyed like s_Assets, each behind its own reader-writer
+     * lock: the main thread takes one shard exclusively to add or remove an entry, readers take
+     * one shard shared. With a job system set, a payload removed by Unload / Reload / eviction is
+     * retired instead of deleted and freed by UpdateCache a few frames later, so a job that
+     * resolved it this frame can finish with it — jobs must not keep payload pointers across
+     * frames. Normalizing a raw ID reads AssetManifest; rebuild the manifest between frames.
+     *
+     * LoadAsync<T>
+     * Same cache + normalization as Load, but a miss returns at once with the entry in the
+     * Loading state (handles resolve to null until it settles). IAssetLoader::Decode runs on a
+     * JobSubsystem worker; IAssetLoader::Finalize (GPU upload) runs in the job's main-thread
+     * completion, during the next JobSubsystem drain. With an IO system set, a loader that
+     * DecodesFromMemory has its file read on IOSubsystem first and the decode job is queued from
+     * the read's completion, so no worker blocks on the disk. A Load<T> that hits a Loading entry
+     * waits for its read / decode and finalizes inline. A failed async load leaves the entry
+     * Failed; the next Load / LoadAsync of that ID retries.
+     *
+     * Cache budget
+     * Every resident entry is accounted per AssetType (sizeof(T) + IAsset::GetMemorySize()).
+     * An entry with no live TAssetHandle is an eviction candidate; UpdateCache (once per frame)
+     * frees the least recently referenced candidates idle for the configured frame count while
+     * the total exceeds SetCacheBudget. A later Load of an evicted ID reads it back from disk and
+     * counts as a re-load. Budget 0 (default) never evicts. Counters: GetCacheStats.
      *
      * Load<T>
      * Cache key = canonical asset ID, normalized from the input:
@@ -69,6 +102,20 @@ namespace Opaax
                 lEntry.Deleter  = [](void* InRaw) { delete static_cast<T*>(InRaw); };
                 lEntry.Block    = new AssetRefBlock();
                 lEntry.Block->AddRef(); // registry owns 1 ref; live handles add their own
+                lEntry.Slot     = AssetSlotTable::Allocate(lEntry.Generation);
+                AssetSlotTable::SetPayload(lEntry.Slot, InPtr);
+                lEntry.SizeOf   = &MemorySizeOf<T>;
+                lEntry.Category = CategoryOf<T>(InPtr);
+                lEntry.LastUsedFrame = s_CacheFrame;
+                return lEntry;
+            }
+
+            // Placeholder for an in-flight LoadAsync: typed + ref-counted, no payload yet.
+            template<typename T>
+            static AssetEntry MakePending()
+            {
+                AssetEntry lEntry = Make<T>(nullptr);
+                lEntry.State      = EAssetState::Loading;
                 return lEntry;
             }
 
@@ -80,6 +127,7 @@ namespace Opaax
             ~AssetEntry()
             {
                 DestroyPayload();
+                ReleaseSlot();
                 if (Block)
                 {
                     Block->Release();
@@ -97,11 +145,14 @@ namespace Opaax
             // Move
             // =============================================================================
             AssetEntry(AssetEntry&& Other) noexcept
-                : Ptr(Other.Ptr), Type(Other.Type), Deleter(Other.Deleter), Block(Other.Block)
+                : Ptr(Other.Ptr), Type(Other.Type), Deleter(Other.Deleter), Block(Other.Block), State(Other.State)
+                , Slot(Other.Slot), Generation(Other.Generation)
+                , SizeOf(Other.SizeOf), Category(Other.Category), LastUsedFrame(Other.LastUsedFrame)
             {
                 Other.Ptr     = nullptr;
                 Other.Deleter = nullptr;
                 Other.Block   = nullptr;
+                Other.Slot    = AssetSlotTable::InvalidIndex;
             }
 
             AssetEntry& operator=(AssetEntry&& Other) noexcept
@@ -109,14 +160,22 @@ namespace Opaax
                 if (this != &Other)
                 {
                     DestroyPayload();
+                    ReleaseSlot();
                     if (Block) { Block->Release(); }
                     Ptr           = Other.Ptr;
                     Type          = Other.Type;
                     Deleter       = Other.Deleter;
                     Block         = Other.Block;
+                    State         = Other.State;
+                    Slot          = Other.Slot;
+                    Generation    = Other.Generation;
+                    SizeOf        = Other.SizeOf;
+                    Category      = Other.Category;
+                    LastUsedFrame = Other.LastUsedFrame;
                     Other.Ptr     = nullptr;
                     Other.Deleter = nullptr;
                     Other.Block   = nullptr;
+                    Other.Slot    = AssetSlotTable::InvalidIndex;
                 }
                 return *this;
             }
@@ -144,6 +203,15 @@ namespace Opaax
                 Deleter = nullptr;
             }
 
+            void ReleaseSlot() noexcept
+            {
+                if (Slot != AssetSlotTable::InvalidIndex)
+                {
+                    AssetSlotTable::Free(Slot);
+                    Slot = AssetSlotTable::InvalidIndex;
+                }
+            }
+
             // =============================================================================
             // Members
             // =============================================================================
@@ -154,6 +222,64 @@ namespace Opaax
             // Intrusive ref-counted block (heap, self-deletes on last Release).
             // Entry holds 1 ref from Make() through ~AssetEntry / move-from.
             AssetRefBlock*  Block   = nullptr;
+            // Loading while a LoadAsync is in flight (Ptr null), Failed if it did not finalize.
+            EAssetState     State   = EAssetState::Loaded;
+            // Dense slot mirroring Ptr for TAssetHandle's fast path; freed with the entry.
+            Uint32          Slot       = AssetSlotTable::InvalidIndex;
+            Uint32          Generation = 0;
+            // Cache accounting: bytes of the payload (re-queried each UpdateCache), its stats
+            // bucket, and the cache frame it was last requested or seen with a live handle.
+            Uint64(*SizeOf)(const void*) = nullptr;
+            AssetType       Category      = AssetType::Unknown;
+            Uint64          LastUsedFrame = 0;
+        };
+
+        /**
+         * One in-flight LoadAsync. Main-thread only — the worker touches just the decode
+         * result captured by its own closure — with one exception: an IO load's read completion
+         * sets Job on the IO thread, before its IO handle reports done, so the main thread reads
+         * Job only after waiting on IO. Settled exactly once: by the job's completion, or earlier
+         * by a Load<T> that needed the asset immediately.
+         */
+        struct PendingLoad
+        {
+            AssetRefBlock*                       Block    = nullptr;   // identifies the entry this load fills
+            IORequestHandle                      IO;                   // file read, when decoding from memory
+            TFunction<void(const IOReadResult&)> DecodeBytes;          // decode stage of an IO load
+            JobHandle                            Job;
+            TFunction<void()>                    Finish;               // Finalize into the entry
+            TDynArray<TFunction<void()>>         OnSettled;            // caller callbacks
+            bool                                 bSettled = false;
+        };
+
+        /**
+         * What a lookup from any thread needs about one entry: enough to type-check it, hand out a
+         * handle and resolve the payload through AssetSlotTable. Mirrors s_Assets; the main thread
+         * writes it under its shard's exclusive lock.
+         */
+        struct LookupRecord
+        {
+            std::type_index Type       = typeid(void);
+            AssetRefBlock*  Block      = nullptr;   // the entry's — its registry ref lives while published
+            Uint32          Slot       = AssetSlotTable::InvalidIndex;
+            Uint32          Generation = 0;
+            EAssetState     State      = EAssetState::Loaded;
+        };
+
+        struct LookupShard
+        {
+            mutable SharedMutex                Mutex;
+            UnorderedMap<Uint32, LookupRecord> Records;
+        };
+
+        static constexpr Uint32 LookupShardCount = 16;   // power of two — keys are dense intern indices
+
+        // A payload removed while jobs may still read it, freed by UpdateCache once its grace ran out.
+        struct RetiredPayload
+        {
+            void*  Ptr                = nullptr;
+            void(*Deleter)(void*)     = nullptr;
+            Uint64 Frame              = 0;   // s_CacheFrame at removal
         };
 
         // =============================================================================
@@ -202,8 +328,8 @@ namespace Opaax
                                        : lIDStr;
 
             // NOTE: If two manifest entries share the same path, FindByPath returns
-            // whichever the unordered_map iteration hits first — that's a manifest
-            // validation issue, not a registry concern.
+            // the one indexed last — that's a manifest validation issue, not a
+            // registry concern.
             const AssetDescriptor* lPathHit = (lIdHit == nullptr)
                                             ? AssetManifest::FindByPath(lRelPath)
                                             : nullptr;
@@ -245,6 +371,17 @@ namespace Opaax
 
             // --- Cache hit ---
             auto lIt = s_Assets.find(lKey);
+            if (lIt != s_Assets.end() && lIt->second.State == EAssetState::Loading)
+            {
+                // In flight from LoadAsync and needed now: wait for the decode, finalize inline.
+                FinishPendingLoad(lKey);
+                lIt = s_Assets.find(lKey);
+            }
+            if (lIt != s_Assets.end() && lIt->second.State == EAssetState::Failed)
+            {
+                EraseEntry(lIt);   // failed async load — retry synchronously
+                lIt = s_Assets.end();
+            }
             if (lIt != s_Assets.end())
             {
                 if (lIt->second.Type != typeid(T))
@@ -252,7 +389,8 @@ namespace Opaax
                     OPAAX_CORE_ERROR("AssetRegistry::Load — type mismatch for '{}'", InID);
                     return TAssetHandle<T>{};
                 }
-                return TAssetHandle<T>{ lNorm.CanonicalID, lIt->second.Block };
+                lIt->second.LastUsedFrame = s_CacheFrame;
+                return TAssetHandle<T>{ lNorm.CanonicalID, lIt->second.Block, lIt->second.Slot, lIt->second.Generation };
             }
 
             // --- Cache miss — delegate to loader ---
@@ -276,12 +414,123 @@ namespace Opaax
                 return TAssetHandle<T>{};
             }
 
-            auto& lEntry = s_Assets.emplace(lKey, AssetEntry::Make(lAsset))
-                                    .first->second;
+            auto& lEntry = EmplaceEntry(lKey, AssetEntry::Make(lAsset));
+            NoteCacheMiss(lKey);
 
             OPAAX_CORE_INFO("AssetRegistry: loaded '{}' as '{}'", lNorm.AbsPath, lNorm.CanonicalID);
 
-            return TAssetHandle<T>{ lNorm.CanonicalID, lEntry.Block };
+            return TAssetHandle<T>{ lNorm.CanonicalID, lEntry.Block, lEntry.Slot, lEntry.Generation };
+        }
+
+        /**
+         * LoadAsync<T>
+         * Non-blocking Load. A cache hit returns the existing handle (still Loading if another
+         * LoadAsync is in flight). A miss registers a Loading entry, decodes on a JobSubsystem
+         * worker (after an IOSubsystem read, for loaders that decode from memory) and finalizes
+         * on the main thread. Without a job system (tools, tests) every stage runs inline.
+         * @param InID       Any spelling Load accepts.
+         * @param InOnSettled Optional, main thread: called once the load is Loaded or Failed
+         *                    (check IsValid). Not called when LoadAsync itself returns a null
+         *                    handle (unresolvable ID, type mismatch, no loader).
+         * @return handle to the (possibly still Loading) asset.
+         */
+        template <typename T>
+        static TAssetHandle<T> LoadAsync(OpaaxStringID InID, TFunction<void(const TAssetHandle<T>&)> InOnSettled = {})
+        {
+            const NormalizedAsset lNorm = Normalize(InID);
+
+            if (lNorm.AbsPath.IsEmpty())
+            {
+                OPAAX_CORE_ERROR("AssetRegistry::LoadAsync — could not resolve '{}'", InID);
+                return TAssetHandle<T>{};
+            }
+
+            const Uint32 lKey = lNorm.CanonicalID.GetId();
+
+            // --- Cache hit (Loaded, or already in flight) ---
+            auto lIt = s_Assets.find(lKey);
+            if (lIt != s_Assets.end() && lIt->second.State == EAssetState::Failed)
+            {
+                EraseEntry(lIt);   // retry a failed load
+                lIt = s_Assets.end();
+            }
+            if (lIt != s_Assets.end())
+            {
+                if (lIt->second.Type != typeid(T))
+                {
+                    OPAAX_CORE_ERROR("AssetRegistry::LoadAsync — type mismatch for '{}'", InID);
+                    return TAssetHandle<T>{};
+                }
+                lIt->second.LastUsedFrame = s_CacheFrame;
+
+                TAssetHandle<T> lHandle{ lNorm.CanonicalID, lIt->second.Block, lIt->second.Slot, lIt->second.Generation };
+                if (InOnSettled)
+                {
+                    const auto lPendingIt = s_PendingLoads.find(lKey);
+                    if (lIt->second.State == EAssetState::Loading && lPendingIt != s_PendingLoads.end())
+                    {
+                        lPendingIt->second->OnSettled.push_back(
+                            [lHandle, lCallback = Move(InOnSettled)] { lCallback(lHandle); });
+                    }
+                    else
+                    {
+                        InOnSettled(lHandle);
+                    }
+                }
+                return lHandle;
+            }
+
+            // --- Cache miss ---
+            IAssetLoader<T>* lLoader = AssetLoaderRegistry::Get<T>();
+            if (!lLoader)
+            {
+                OPAAX_CORE_ERROR("AssetRegistry::LoadAsync — no loader registered for type '{}'.", typeid(T).name());
+                return TAssetHandle<T>{};
+            }
+
+            auto& lEntry = EmplaceEntry(lKey, AssetEntry::MakePending<T>());
+            NoteCacheMiss(lKey);
+            TAssetHandle<T> lHandle{ lNorm.CanonicalID, lEntry.Block, lEntry.Slot, lEntry.Generation };
+
+            // Holds PrepareDecode's snapshot until the worker takes it, then the decode result; only
+            // Finish (main thread) reads it, after the job.
+            auto lDecoded = MakeShared<UniquePtr<AssetDecodeData>>(
+                lLoader->PrepareDecode(lNorm.AbsPath.CStr(), lNorm.CanonicalID));
+
+            auto lPending   = MakeShared<PendingLoad>();
+            lPending->Block = lEntry.Block;
+            lPending->Finish = [lKey, lLoader, lDecoded, lPath = lNorm.AbsPath, lID = lNorm.CanonicalID]
+            {
+                FinalizePending<T>(lKey, *lLoader, Move(*lDecoded), lPath, lID);
+            };
+            if (InOnSettled)
+            {
+                lPending->OnSettled.push_back([lHandle, lCallback = Move(InOnSettled)] { lCallback(lHandle); });
+            }
+
+            if (s_IO && s_Jobs && lLoader->DecodesFromMemory(lNorm.AbsPath.CStr(), lNorm.CanonicalID))
+            {
+                SubmitPendingRead(lKey, lPending, lNorm.AbsPath,
+                    [lLoader, lDecoded, lPath = lNorm.AbsPath, lID = lNorm.CanonicalID](const IOReadResult& InRead)
+                {
+                    if (!InRead.IsOk())
+                    {
+                        OPAAX_CORE_ERROR("AssetRegistry::LoadAsync — could not read '{}'", lPath);
+                        lDecoded->reset();   // the snapshot is not a decode result
+                        return;
+                    }
+                    *lDecoded = lLoader->DecodeMemory(InRead.GetData(), InRead.GetSize(), lPath.CStr(), lID,
+                                                      Move(*lDecoded));
+                });
+                return lHandle;
+            }
+
+            SubmitPendingLoad(lKey, lPending, [lLoader, lDecoded, lPath = lNorm.AbsPath, lID = lNorm.CanonicalID]
+            {
+                *lDecoded = lLoader->Decode(lPath.CStr(), lID, Move(*lDecoded));
+            });
+
+            return lHandle;
         }
 
         /**
@@ -310,7 +559,7 @@ namespace Opaax
                         "They will resolve to the new asset on next Get().",
                         InID, lLiveHandles);
                 }
-                s_Assets.erase(lIt);
+                EraseEntry(lIt);
             }
 
             OPAAX_CORE_INFO("AssetRegistry::Reload — reloading '{}'", InID);
@@ -343,16 +592,73 @@ namespace Opaax
                     InID, lLiveHandles);
             }
 
-            s_Assets.erase(lIt);
+            EraseEntry(lIt);
             OPAAX_CORE_INFO("AssetRegistry: unloaded '{}'", InID);
         }
 
+        /**
+         * Find<T>
+         * Handle to an asset the registry already holds (Loaded, or still Loading), without ever
+         * loading it. Any thread — e.g. a decode job resolving a dependency by ID.
+         * @return null handle on a miss or a type mismatch.
+         */
+        template <typename T>
+        static TAssetHandle<T> Find(OpaaxStringID InID)
+        {
+            const NormalizedAsset lNorm = Normalize(InID);
+
+            LookupRecord lRecord;
+            if (!AcquireRecord(lNorm.CanonicalID.GetId(), typeid(T), lRecord)) { return TAssetHandle<T>{}; }
+
+            // AcquireRecord took a ref under the shard lock; the handle holds its own from here.
+            TAssetHandle<T> lHandle{ lNorm.CanonicalID, lRecord.Block, lRecord.Slot, lRecord.Generation };
+            lRecord.Block->Release();
+            return lHandle;
+        }
+
+        // True once the asset is resident — a LoadAsync still in flight (or failed) is not loaded. Any thread.
         static bool IsLoaded(OpaaxStringID InID)
+        {
+            return GetState(InID) == EAssetState::Loaded;
+        }
+
+        // Loaded / Loading / Failed for a cached entry, Unloaded if the registry has none. Any thread.
+        static EAssetState GetState(OpaaxStringID InID)
         {
             const NormalizedAsset lNorm = Normalize(InID);
-            return s_Assets.count(lNorm.CanonicalID.GetId()) > 0;
+
+            LookupRecord lRecord;
+            return FindRecord(lNorm.CanonicalID.GetId(), lRecord) ? lRecord.State : EAssetState::Unloaded;
+        }
+
+        // LoadAsync requests whose decode or finalize has not run yet.
+        static Uint32 GetPendingLoadCount() noexcept
+        {
+            return static_cast<Uint32>(s_PendingLoads.size());
         }
 
+        // Worker pool for LoadAsync (CoreEngineApp sets it once subsystems are up). Null = inline.
+        static void SetJobSystem(JobSubsystem* InJobs) noexcept { s_Jobs = InJobs; }
+
+        // File reads for LoadAsync (CoreEngineApp sets it next to the job system). Null = the decode job reads.
+        static void SetIOSystem(IOSubsystem* InIO) noexcept { s_IO = InIO; }
+
+        /**
+         * Cache budget in bytes (0 = unlimited, the default) and the frames an unreferenced
+         * asset must stay idle before UpdateCache may evict it (floored at LruMinIdleFrames so a
+         * frame still in flight never loses a resource it reads).
+         */
+        static void SetCacheBudget(Uint64 InBytes, Uint32 InEvictFrames) noexcept;
+
+        /**
+         * Advance the cache clock, refresh per-type resident bytes and, when over budget, evict
+         * the least recently referenced handle-free assets. Main thread, once per frame.
+         */
+        static void UpdateCache();
+
+        // Counters as of the last UpdateCache (evictions / re-loads accumulate across the run).
+        static const AssetCacheStats& GetCacheStats() noexcept { return s_CacheStats; }
+
         /**
          * Shutdown — drops the registry's ref on every asset.
          * Surviving handles keep their AssetRefBlock alive (intrusive RC) so their
@@ -362,6 +668,9 @@ namespace Opaax
         {
             OPAAX_CORE_INFO("AssetRegistry::Shutdown() — {} asset(s)", s_Assets.size());
 
+            // In-flight decodes still reference their loader — let them finish, drop the results.
+            DropPendingLoads();
+
             for (auto& [lKey, lEntry] : s_Assets)
             {
                 const Uint32 lLiveHandles = lEntry.LiveHandleCount();
@@ -371,26 +680,164 @@ namespace Opaax
                         lKey, lLiveHandles);
                 }
             }
+            ClearLookup();
             s_Assets.clear();
+            FreeRetired(true);
+            AssetSlotTable::Clear();
+            ResetCache();
 
             AssetLoaderRegistry::Shutdown();
             AssetManifest::Clear();
+            s_Jobs = nullptr;
+            s_IO   = nullptr;
         }
 
+        // Main thread only.
         static const UnorderedMap<Uint32, AssetEntry>& GetAssets() noexcept
         {
             return s_Assets;
         }
-         
-        // TODO: async loading interface
-        //   static void LoadAsync<T>(OpaaxStringID InID, TFunction<void(TAssetHandle<T>)> InCallback);
-        //   static void ProcessPendingLoads();   // call once per frame from RenderSubsystem
- 
+
+        // =============================================================================
+        // Async internals
+        // =============================================================================
+    private:
+        // Register InPending under InKey and queue InDecode; the job's completion settles it.
+        static void SubmitPendingLoad(Uint32 InKey, const SharedPtr<PendingLoad>& InPending, TFunction<void()> InDecode);
+
+        // Register InPending under InKey and read InAbsPath on s_IO; the read's completion (on the IO
+        // thread) queues InDecode over the bytes, and that job's completion settles it.
+        static void SubmitPendingRead(Uint32 InKey, const SharedPtr<PendingLoad>& InPending, const OpaaxString& InAbsPath,
+                                      TFunction<void(const IOReadResult&)> InDecode);
+
+        // Run Finish if the entry is still the one InPending was started for, then the callbacks.
+        static void SettlePendingLoad(Uint32 InKey, const SharedPtr<PendingLoad>& InPending);
+
+        // Wait for InKey's read / decode and settle it now (Load<T> on a Loading entry).
+        static void FinishPendingLoad(Uint32 InKey);
+
+        // Shutdown: wait for every decode, settle nothing.
+        static void DropPendingLoads();
+
+        template<typename T>
+        static void FinalizePending(Uint32 InKey, IAssetLoader<T>& InLoader, UniquePtr<AssetDecodeData> InDecoded,
+                                    const OpaaxString& InAbsPath, OpaaxStringID InCanonicalID)
+        {
+            T* lAsset = InLoader.Finalize(Move(InDecoded), InAbsPath.CStr(), InCanonicalID);
+
+            // Looked up after Finalize — a loader may load dependencies, rehashing the map.
+            auto lIt = s_Assets.find(InKey);
+            if (!InLoader.IsValid(lAsset) || lIt == s_Assets.end())
+            {
+                OPAAX_CORE_ERROR("AssetRegistry::LoadAsync — loader failed for '{}'", InAbsPath);
+                delete lAsset;
+                if (lIt != s_Assets.end())
+                {
+                    lIt->second.State = EAssetState::Failed;
+                    PublishState(InKey, EAssetState::Failed);
+                }
+                return;
+            }
+
+            lIt->second.Ptr      = lAsset;
+            lIt->second.State    = EAssetState::Loaded;
+            lIt->second.Category = CategoryOf<T>(lAsset);
+            AssetSlotTable::SetPayload(lIt->second.Slot, lAsset);
+            PublishState(InKey, EAssetState::Loaded);
+            OPAAX_CORE_INFO("AssetRegistry: loaded '{}' as '{}' (async)", InAbsPath, InCanonicalID);
+        }
+
+        // =============================================================================
+        // Lookup internals
+        // =============================================================================
+    private:
+        static FORCEINLINE LookupShard& ShardOf(Uint32 InKey) noexcept
+        {
+            return s_Lookup[InKey & (LookupShardCount - 1)];
+        }
+
+        // Insert InEntry under InKey (not present) and publish it to lookups.
+        static AssetEntry& EmplaceEntry(Uint32 InKey, AssetEntry&& InEntry);
+
+        /**
+         * Unpublish, then remove (payload retired when a job system is set). With
+         * InOnlyIfUnreferenced (eviction) nothing happens if the entry has a live handle — checked
+         * under the shard lock Find<T> takes its ref under, so no handle can appear in between.
+         */
+        static bool EraseEntry(UnorderedMap<Uint32, AssetEntry>::iterator InIt, bool InOnlyIfUnreferenced = false);
+
+        static void PublishState(Uint32 InKey, EAssetState InState);
+
+        // Copy InKey's record under the shared lock. False if the registry has no entry.
+        static bool FindRecord(Uint32 InKey, LookupRecord& OutRecord);
+
+        // FindRecord + type check + one ref on OutRecord.Block taken under the lock (caller releases).
+        static bool AcquireRecord(Uint32 InKey, const std::type_index& InType, LookupRecord& OutRecord);
+
+        static void ClearLookup();
+
+        // Delete retired payloads whose grace has run out (every one with InAll — Shutdown).
+        static void FreeRetired(bool InAll);
+
+        // =============================================================================
+        // Cache internals
+        // =============================================================================
+    private:
+        template<typename T>
+        static Uint64 MemorySizeOf(const void* InRaw)
+        {
+            if constexpr (std::is_base_of_v<IAsset, T>)
+            {
+                return sizeof(T) + static_cast<const T*>(InRaw)->GetMemorySize();
+            }
+            else
+            {
+                return sizeof(T);
+            }
+        }
+
+        template<typename T>
+        static AssetType CategoryOf(const T* InAsset)
+        {
+            if constexpr (std::is_base_of_v<IAsset, T>)
+            {
+                return InAsset ? InAsset->GetType() : AssetType::Unknown;
+            }
+            else
+            {
+                return AssetType::Unknown;
+            }
+        }
+
+        // A miss created InKey's entry — counts a re-load if UpdateCache evicted it earlier.
+        static void NoteCacheMiss(Uint32 InKey);
+
+        // Shutdown: forget the eviction history and zero the counters and budget.
+        static void ResetCache();
+
         // =============================================================================
         // Members
         // =============================================================================
     private:
-        // Uint32 key = OpaaxStringID::GetId() — avoids hashing a string at lookup time
+        // Uint32 key = OpaaxStringID::GetId() — avoids hashing a string at lookup time. Main thread only.
         static UnorderedMap<Uint32, AssetEntry> s_Assets;
+
+        // Any-thread view of s_Assets (see Thread safety above).
+        static LookupShard s_Lookup[LookupShardCount];
+
+        static TDynArray<RetiredPayload> s_Retired;
+
+        // In-flight LoadAsync requests, same key as s_Assets.
+        static UnorderedMap<Uint32, SharedPtr<PendingLoad>> s_PendingLoads;
+
+        static JobSubsystem* s_Jobs;
+        static IOSubsystem*  s_IO;
+
+        static Uint64          s_CacheFrame;
+        static Uint32          s_CacheEvictFrames;
+        static AssetCacheStats s_CacheStats;
+
+        // Keys UpdateCache evicted (with their bucket), so the next miss counts as a re-load.
+        static UnorderedMap<Uint32, AssetType> s_Evicted;
     };
 } // namespace Opaax
@@ -0,0 +1,56 @@
+#include "AssetScanCache.h"
+
+#include "Core/Config/EngineConfig.h"
+#include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxFile.h"
+
+#include <cstdio>
+
+namespace Opaax
+{
+    OpaaxString AssetScanCache::ResolveDirectory()
+    {
+        return EngineConfig::CacheDirectory("AssetScan");
+    }
+
+    OpaaxString AssetScanCache::EntryPath(const OpaaxString& InDirectory, const OpaaxString& InRootDir)
+    {
+        if (InDirectory.IsEmpty()) { return {}; }
+
+        // <RootDir hash>.scancache — the header re-checks the root, the name only has to keep roots apart.
+        char lName[32];
+        std::snprintf(lName, sizeof(lName), "/%08x.scancache", OpaaxHash::Hash(InRootDir));
+        OpaaxString lPath = InDirectory;
+        lPath += lName;
+        return lPath;
+    }
+
+    bool AssetScanCache::Read(const OpaaxString& InPath, const OpaaxString& InRootDir, AssetScanCacheData& OutData)
+    {
+        OutData = {};
+        if (InPath.IsEmpty()) { return false; }
+
+        TDynArray<Uint8> lBytes;
+        if (!OpaaxFile::ReadBinary(InPath.CStr(), lBytes))
+        {
+            return false;
+        }
+
+        if (!Deserialize(lBytes.data(), lBytes.size(), InRootDir, OutData))
+        {
+            OPAAX_CORE_WARN("AssetScanCache: discarding stale or corrupt cache '{}'", InPath);
+            return false;
+        }
+        return true;
+    }
+
+    bool AssetScanCache::Write(const OpaaxString& InPath, const OpaaxString& InRootDir, const AssetScanCacheData& InData)
+    {
+        if (InPath.IsEmpty()) { return false; }
+
+        TDynArray<Uint8> lBytes;
+        Serialize(InRootDir, InData, lBytes);
+        return OpaaxFile::WriteBinaryAtomic(InPath.CStr(), lBytes.data(), lBytes.size());
+    }
+
+} // namespace Opaax
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxHash.h"
+#include "Core/OpaaxString.hpp"
+#include "Core/OpaaxStringID.hpp"
+#include "Core/OpaaxTypes.h"
+
+#include <cstring>
+#include <string>
+
+namespace Opaax
+{
+    // =============================================================================
+    // Asset scan cache
+    //
+    // What AssetScanner derived from every file under one scan root on its last run —
+    // keyed by the path relative to that root, validated by (size, mtime) — plus a
+    // fingerprint of the manifest subset it last wrote. A file whose size and mtime
+    // still match reuses its cached ID / type / project path instead of resolving
+    // them again, and an unchanged fingerprint means the manifest file is up to date.
+    //
+    // One versioned binary blob per scan root, trailing FNV-1a checksum. Host byte
+    // order — machine-local derived data, safe to delete at any time.
+    //
+    // Serialize/Deserialize are header-inline (unit-testable); the disk half lives in
+    // AssetScanCache.cpp.
+    // =============================================================================
+
+    /**
+     * @struct AssetScanCacheEntry
+     * One file as the scanner last saw it. Type "Unknown" = skipped extension (ID / RelPath empty).
+     */
+    struct AssetScanCacheEntry
+    {
+        Uint64        Size  = 0;
+        Int64         MTime = 0;   // file_time_type ticks — only ever compared for equality
+        OpaaxString   ID;          // generated logical ID
+        OpaaxString   RelPath;     // project-relative path
+        OpaaxStringID Type;
+    };
+
+    /**
+     * @struct AssetScanCacheData
+     */
+    struct AssetScanCacheData
+    {
+        Uint64 ManifestFingerprint = 0;   // of the manifest subset last written for this root
+
+        // Key: path relative to the scan root ("Textures/Player.png").
+        UnorderedMap<OpaaxString, AssetScanCacheEntry, OpaaxHash> Files;
+    };
+
+    namespace AssetScanCache
+    {
+        static constexpr Uint32 Magic   = 0x4353414Fu;   // "OASC"
+        static constexpr Uint32 Version = 1u;            // bump on any layout / ID-rule change
+
+        namespace Detail
+        {
+            template<typename T>
+            FORCEINLINE void Put(TDynArray<Uint8>& OutBytes, const T& InValue)
+            {
+                const size_t lAt = OutBytes.size();
+                OutBytes.resize(lAt + sizeof(T));
+                std::memcpy(OutBytes.data() + lAt, &InValue, sizeof(T));
+            }
+
+            inline void PutString(TDynArray<Uint8>& OutBytes, const OpaaxString& InString)
+            {
+                const Uint32 lLength = InString.GetLength();
+                Put(OutBytes, lLength);
+                OutBytes.insert(OutBytes.end(), InString.CStr(), InString.CStr() + lLength);
+            }
+
+            struct Reader
+            {
+                const Uint8* Data;
+                size_t       Size;
+                size_t       Pos = 0;
+
+                template<typename T>
+                bool Get(T& OutValue) noexcept
+                {
+                    if (Size - Pos < sizeof(T)) { return false; }
+                    std::memcpy(&OutValue, Data + Pos, sizeof(T));
+                    Pos += sizeof(T);
+                    return true;
+                }
+
+                bool GetString(OpaaxString& OutString)
+                {
+                    Uint32 lLength = 0;
+                    if (!Get(lLength) || Size - Pos < lLength) { return false; }
+                    OutString = OpaaxString(std::string(reinterpret_cast<const char*>(Data + Pos), lLength).c_str());
+                    Pos += lLength;
+                    return true;
+                }
+            };
+        }
+
+        /** Encode InData for the scan root InRootDir. */
+        inline void Serialize(const OpaaxString& InRootDir, const AssetScanCacheData& InData, TDynArray<Uint8>& OutBytes)
+        {
+            using namespace Detail;
+            OutBytes.clear();
+            OutBytes.reserve(64 + InData.Files.size() * 96);
+
+            Put(OutBytes, Magic);
+            Put(OutBytes, Version);
+            PutString(OutBytes, InRootDir);
+            Put(OutBytes, InData.ManifestFingerprint);
+            Put(OutBytes, static_cast<Uint32>(InData.Files.size()));
+            for (const auto& [lKey, lEntry] : InData.Files)
+            {
+                PutString(OutBytes, lKey);
+                Put(OutBytes, lEntry.Size);
+                Put(OutBytes, lEntry.MTime);
+                PutString(OutBytes, lEntry.ID);
+                PutString(OutBytes, lEntry.RelPath);
+                PutString(OutBytes, lEntry.Type.ToString());
+            }
+
+            Put(OutBytes, OpaaxHash::HashBytes(OutBytes.data(), OutBytes.size()));
+        }
+
+        /**
+         * Decode a blob written by Serialize. False (OutData cleared) on a wrong magic/version,
+         * another scan root, truncation or a checksum failure.
+         */
+        inline bool Deserialize(const Uint8* InBytes, size_t InSize, const OpaaxString& InRootDir, AssetScanCacheData& OutData)
+        {
+            using namespace Detail;
+            OutData = {};
+            if (!InBytes || InSize < sizeof(Uint32)) { return false; }
+
+            const size_t lBody = InSize - sizeof(Uint32);
+            Uint32 lStoredSum = 0;
+            std::memcpy(&lStoredSum, InBytes + lBody, sizeof(Uint32));
+            if (lStoredSum != OpaaxHash::HashBytes(InBytes, lBody)) { return false; }
+
+            Reader      lIn{ InBytes, lBody };
+            Uint32      lMagic = 0, lVersion = 0, lCount = 0;
+            OpaaxString lRootDir;
+            if (!lIn.Get(lMagic) || lMagic != Magic || !lIn.Get(lVersion) || lVersion != Version) { return false; }
+            if (!lIn.GetString(lRootDir) || !(lRootDir == InRootDir))                             { return false; }
+            if (!lIn.Get(OutData.ManifestFingerprint) || !lIn.Get(lCount))                         { return false; }
+
+            OutData.Files.reserve(lCount);
+            for (Uint32 i = 0; i < lCount; ++i)
+            {
+                OpaaxString         lKey;
+                OpaaxString         lType;
+                AssetScanCacheEntry lEntry;
+                if (!lIn.GetString(lKey) || !lIn.Get(lEntry.Size) || !lIn.Get(lEntry.MTime)
+                    || !lIn.GetString(lEntry.ID) || !lIn.GetString(lEntry.RelPath) || !lIn.GetString(lType))
+                {
+                    OutData = {};
+                    return false;
+                }
+                lEntry.Type = OpaaxStringID(lType);
+                OutData.Files.emplace(Move(lKey), Move(lEntry));
+            }
+            return lIn.Pos == lIn.Size;
+        }
+
+        // <CacheDir>/AssetScan, or empty when on-disk caches are disabled (EngineConfig::CacheDirectory).
+        OPAAX_API OpaaxString ResolveDirectory();
+
+        // Cache file for one scan root inside InDirectory (empty in, empty out).
+        OPAAX_API OpaaxString EntryPath(const OpaaxString& InDirectory, const OpaaxString& InRootDir);
+
+        // Read + validate. False on a missing, stale or corrupt file (OutData empty).
+        OPAAX_API bool Read(const OpaaxString& InPath, const OpaaxString& InRootDir, AssetScanCacheData& OutData);
+
+        // Serialize + atomic write. False if InPath is empty or the write failed.
+        OPAAX_API bool Write(const OpaaxString& InPath, const OpaaxString& InRootDir, const AssetScanCacheData& InData);
+    }
+
+} // namespace Opaax
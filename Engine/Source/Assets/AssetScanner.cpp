@@ -1,7 +1,13 @@
 ﻿#include "AssetScanner.h"
+#include "Core/OpaaxHash.h"
 #include "Core/OpaaxPath.h"
+#include "Core/Jobs/JobSubsystem.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <string_view>
 #include <nlohmann/json.hpp>
 
 namespace Opaax
@@ -82,6 +88,35 @@ namespace Opaax
     // =============================================================================
     // Scan
     // =============================================================================
+    namespace
+    {
+        // One file found by the enumeration. Filled on a worker, merged on the calling thread.
+        struct ScannedFile
+        {
+            OpaaxString         Key;             // path relative to the scan root
+            AssetScanCacheEntry Info;
+            bool                bCached = false;
+        };
+
+        // One directory level's output, written only by the worker that enumerated it.
+        struct ScannedDir
+        {
+            TDynArray<ScannedFile>           Files;
+            TDynArray<std::filesystem::path> SubDirs;
+        };
+
+        FORCEINLINE bool HasPrefix(const OpaaxString& InPath, const OpaaxString& InPrefix) noexcept
+        {
+            return std::string_view(InPath.CStr(), InPath.GetLength())
+                .starts_with(std::string_view(InPrefix.CStr(), InPrefix.GetLength()));
+        }
+    }
+
+    OpaaxString AssetScanner::DefaultCachePath(const OpaaxString& InRootDir)
+    {
+        return AssetScanCache::EntryPath(AssetScanCache::ResolveDirectory(), InRootDir);
+    }
+
     AssetScanner::ScanResult AssetScanner::Scan(const ScanConfig& InConfig)
     {
         ScanResult lResult;
@@ -98,51 +133,136 @@ namespace Opaax
 
         OPAAX_CORE_INFO("AssetScanner: scanning '{}'...", lAbsRoot);
 
-        // --- Scan files on disk ---
-        for (const auto& lDirEntry :
-             std::filesystem::recursive_directory_iterator(lRootPath))
+        AssetScanCacheData lCache;
+        const bool lCacheHit = AssetScanCache::Read(InConfig.CacheAbsPath, InConfig.RootDir, lCache);
+
+        // Enumerated paths are lRootPath / child..., so the root-relative key is a plain suffix.
+        std::string lRootPrefix = lRootPath.generic_string();
+        if (!lRootPrefix.empty() && lRootPrefix.back() != '/') { lRootPrefix += '/'; }
+
+        // --- Enumerate one directory (any thread; reads lCache only) ---
+        auto lScanDirectory = [&](const std::filesystem::path& InDir, ScannedDir& OutDir)
         {
-            if (!lDirEntry.is_regular_file()) { continue; }
+            std::error_code lEc;
+            std::filesystem::directory_iterator lIt(InDir, std::filesystem::directory_options::skip_permission_denied, lEc);
+            for (; !lEc && lIt != std::filesystem::directory_iterator(); lIt.increment(lEc))
+            {
+                const std::filesystem::directory_entry& lDirEntry = *lIt;
+                std::error_code lEntryEc;
+
+                // Same policy as recursive_directory_iterator: descend into directories, not symlinks to them.
+                if (lDirEntry.is_directory(lEntryEc) && !lDirEntry.is_symlink(lEntryEc))
+                {
+                    OutDir.SubDirs.push_back(lDirEntry.path());
+                    continue;
+                }
+                if (!lDirEntry.is_regular_file(lEntryEc)) { continue; }
 
-            const std::filesystem::path& lFilePath = lDirEntry.path();
-            const OpaaxStringID lType = ResolveType(lFilePath);
+                const std::filesystem::path& lFilePath  = lDirEntry.path();
+                const std::string            lAbsFileStr = lFilePath.generic_string();
 
-            // Skip unknown extensions; every other type — including Scene — flows into the manifest.
-            if (lType == OpaaxStringID("Unknown"))
+                ScannedFile lFile;
+                lFile.Key        = OpaaxString(lAbsFileStr.c_str() + lRootPrefix.size());
+                lFile.Info.Size  = static_cast<Uint64>(lDirEntry.file_size(lEntryEc));
+                lFile.Info.MTime = static_cast<Int64>(lDirEntry.last_write_time(lEntryEc).time_since_epoch().count());
+
+                const auto lCached = lCache.Files.find(lFile.Key);
+                if (lCached != lCache.Files.end()
+                    && lCached->second.Size == lFile.Info.Size && lCached->second.MTime == lFile.Info.MTime)
+                {
+                    lFile.Info.ID      = lCached->second.ID;
+                    lFile.Info.RelPath = lCached->second.RelPath;
+                    lFile.Info.Type    = lCached->second.Type;
+                    lFile.bCached      = true;
+                }
+                else
+                {
+                    lFile.Info.Type = ResolveType(lFilePath);
+                    if (lFile.Info.Type != OpaaxStringID("Unknown"))
+                    {
+                        // Generate relative path (project-root-relative — not relative to scan root)
+                        lFile.Info.ID      = GenerateID(lFilePath, lRootPath);
+                        lFile.Info.RelPath = OpaaxPath::ToProjectRelative(OpaaxString(lAbsFileStr.c_str()));
+                    }
+                }
+                OutDir.Files.push_back(Move(lFile));
+            }
+        };
+
+        // --- Scan files on disk — breadth-first, one ParallelFor per directory level ---
+        TDynArray<ScannedFile>           lFiles;
+        TDynArray<std::filesystem::path> lFrontier{ lRootPath };
+        while (!lFrontier.empty())
+        {
+            TDynArray<ScannedDir> lLevel(lFrontier.size());
+            const auto lBody = [&](Uint32 InIndex) { lScanDirectory(lFrontier[InIndex], lLevel[InIndex]); };
+            if (InConfig.Jobs)
             {
-                ++lResult.Skipped;
-                continue;
+                InConfig.Jobs->ParallelFor(static_cast<Uint32>(lFrontier.size()), lBody);
+            }
+            else
+            {
+                for (Uint32 i = 0; i < static_cast<Uint32>(lFrontier.size()); ++i) { lBody(i); }
             }
 
-            // Generate logical ID
-            const OpaaxString lID = GenerateID(lFilePath, lRootPath);
-            const OpaaxStringID lStringID(lID);
+            lFrontier.clear();
+            for (ScannedDir& lDir : lLevel)
+            {
+                std::move(lDir.Files.begin(), lDir.Files.end(), std::back_inserter(lFiles));
+                std::move(lDir.SubDirs.begin(), lDir.SubDirs.end(), std::back_inserter(lFrontier));
+            }
+        }
+
+        // Deterministic merge order (first file wins when two collapse to one ID), whatever the workers did.
+        std::sort(lFiles.begin(), lFiles.end(), [](const ScannedFile& A, const ScannedFile& B)
+        {
+            return std::strcmp(A.Key.CStr(), B.Key.CStr()) < 0;
+        });
+
+        // --- Merge logic ---
+        AssetScanCacheData                    lNewCache;
+        UnorderedSet<OpaaxString, OpaaxHash>  lOnDisk;
+        lNewCache.Files.reserve(lFiles.size());
+        lOnDisk.reserve(lFiles.size());
 
-            // Generate relative path (project-root-relative — not relative to scan root)
-            const std::string lAbsFileStr = lFilePath.generic_string();
-            const OpaaxString lRelPath =
-                OpaaxPath::ToProjectRelative(OpaaxString(lAbsFileStr.c_str()));
+        for (ScannedFile& lFile : lFiles)
+        {
+            if (lFile.bCached) { ++lResult.Cached; }
 
-            // --- Merge logic ---
-            if (AssetManifest::Contains(lStringID))
+            // Skip unknown extensions; every other type — including Scene — flows into the manifest.
+            if (lFile.Info.Type == OpaaxStringID("Unknown"))
             {
-                // Already in manifest — preserve existing entry
-                ++lResult.Existing;
-                OPAAX_CORE_TRACE("AssetScanner: '{}' already in manifest, preserved.", lID);
+                ++lResult.Skipped;
             }
             else
             {
-                // New entry — add to manifest
-                AssetDescriptor lDesc;
-                lDesc.ID      = lStringID;
-                lDesc.RelPath = lRelPath;
-                lDesc.Type    = lType;
+                const OpaaxStringID lStringID(lFile.Info.ID);
+                lOnDisk.insert(lFile.Info.RelPath);
+
+                if (AssetManifest::Contains(lStringID))
+                {
+                    // Already in manifest — preserve existing entry
+                    ++lResult.Existing;
+                    if (!lFile.bCached)
+                    {
+                        OPAAX_CORE_TRACE("AssetScanner: '{}' already in manifest, preserved.", lFile.Info.ID);
+                    }
+                }
+                else
+                {
+                    // New entry — add to manifest
+                    AssetDescriptor lDesc;
+                    lDesc.ID      = lStringID;
+                    lDesc.RelPath = lFile.Info.RelPath;
+                    lDesc.Type    = lFile.Info.Type;
 
-                AssetManifest::Add(std::move(lDesc));
-                ++lResult.Added;
+                    AssetManifest::Add(std::move(lDesc));
+                    ++lResult.Added;
 
-                OPAAX_CORE_INFO("AssetScanner: added '{}' → '{}'", lID, lRelPath);
+                    OPAAX_CORE_INFO("AssetScanner: added '{}' → '{}'", lFile.Info.ID, lFile.Info.RelPath);
+                }
             }
+            lNewCache.Files.emplace(Move(lFile.Key), Move(lFile.Info));
         }
 
         // --- Flag missing entries ---
@@ -150,8 +270,12 @@ namespace Opaax
         {
             for (const auto& [lKey, lDesc] : AssetManifest::GetAll())
             {
-                const OpaaxString lAbsPath = OpaaxPath::ToAbsolute(lDesc.RelPath);
-                if (!std::filesystem::exists(lAbsPath.CStr()))
+                if (!HasPrefix(lDesc.RelPath, InConfig.RootDir)) { continue; }
+
+                // Found by this scan, or (spelled differently than the walk produced) still on disk.
+                const bool lExists = lOnDisk.contains(lDesc.RelPath)
+                                  || std::filesystem::exists(OpaaxPath::ToAbsolute(lDesc.RelPath).CStr());
+                if (!lExists)
                 {
                     AssetManifest::SetMissing(lDesc.ID, true);
                     ++lResult.Missing;
@@ -165,17 +289,63 @@ namespace Opaax
             }
         }
 
-        // --- Save updated manifest ---
+        // --- Save updated manifest — only when its subset differs from what was last written ---
         // NOTE: AssetManifest::s_Descriptors is a single global pool shared across every
         // manifest file. Filter by the scan root so each on-disk file only owns its own subset.
-        SaveManifest(InConfig.ManifestAbsPath, InConfig.RootDir);
+        lNewCache.ManifestFingerprint = ManifestFingerprint(InConfig.RootDir);
+        const bool lManifestStale = !lCacheHit
+                                 || lNewCache.ManifestFingerprint != lCache.ManifestFingerprint
+                                 || !std::filesystem::exists(InConfig.ManifestAbsPath.CStr());
+        if (lManifestStale)
+        {
+            lResult.bSaved = SaveManifest(InConfig.ManifestAbsPath, InConfig.RootDir);
+            if (!lResult.bSaved) { lNewCache.ManifestFingerprint = 0; }   // retry the write next scan
+        }
+
+        const bool lCacheStale = !lCacheHit
+                              || lResult.Cached != lCache.Files.size()
+                              || lNewCache.Files.size() != lCache.Files.size()
+                              || lNewCache.ManifestFingerprint != lCache.ManifestFingerprint;
+        if (lCacheStale)
+        {
+            AssetScanCache::Write(InConfig.CacheAbsPath, InConfig.RootDir, lNewCache);
+        }
 
-        OPAAX_CORE_INFO("AssetScanner: done — added={} existing={} missing={} skipped={}",
-            lResult.Added, lResult.Existing, lResult.Missing, lResult.Skipped);
+        OPAAX_CORE_INFO("AssetScanner: done — added={} existing={} missing={} skipped={} cached={}{}",
+            lResult.Added, lResult.Existing, lResult.Missing, lResult.Skipped, lResult.Cached,
+            lResult.bSaved ? "" : " (manifest unchanged)");
 
         return lResult;
     }
 
+    // =============================================================================
+    // Fingerprint
+    // =============================================================================
+    Uint64 AssetScanner::ManifestFingerprint(const OpaaxString& InRootPrefix) noexcept
+    {
+        // Sum of per-entry mixes: independent of the manifest map's iteration order.
+        const auto lMix = [](Uint64 InValue)
+        {
+            InValue ^= InValue >> 33; InValue *= 0xff51afd7ed558ccdull;
+            InValue ^= InValue >> 33; InValue *= 0xc4ceb9fe1a85ec53ull;
+            return InValue ^ (InValue >> 33);
+        };
+
+        Uint64 lSum   = 0;
+        Uint64 lCount = 0;
+        for (const auto& [lKey, lDesc] : AssetManifest::GetAll())
+        {
+            if (!HasPrefix(lDesc.RelPath, InRootPrefix)) { continue; }
+
+            Uint32 lHash = OpaaxHash::Hash(lDesc.ID.ToString());
+            lHash = OpaaxHash::Hash(lDesc.RelPath.CStr(), lHash);
+            lHash = OpaaxHash::Hash(lDesc.Type.ToString().CStr(), lHash);
+            lSum += lMix((static_cast<Uint64>(lHash) << 1) | (lDesc.bMissing ? 1u : 0u));
+            ++lCount;
+        }
+        return lSum ^ lMix(lCount);
+    }
+
     // =============================================================================
     // Save
     // =============================================================================
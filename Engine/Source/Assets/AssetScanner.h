@@ -1,12 +1,15 @@
 ﻿#pragma once
 
 #include "AssetManifest.h"
+#include "AssetScanCache.h"
 #include "Core/EngineAPI.h"
 #include "Core/OpaaxString.hpp"
 #include "Core/OpaaxStringID.hpp"
 
 namespace Opaax
 {
+    class JobSubsystem;
+
     // =============================================================================
     // AssetScanner
     //
@@ -33,9 +36,13 @@ namespace Opaax
     //   *.input.json               →  "InputMap"
     //   *.json (no compound)       →  "Data"
     //
-    // NOTE: Scan is synchronous — call from main thread only.
-    //   For large asset libraries this could be moved to a job,
-    //   but for a small indie project synchronous is fine.
+    // Incremental: with a CacheAbsPath, files whose (size, mtime) match the scan
+    // cache (AssetScanCache.h) reuse the type / ID / path resolved last time, and
+    // the manifest file is rewritten only when its subset actually changed.
+    // With a Jobs pool, directory enumeration fans out level by level across the
+    // workers (ParallelFor); the manifest merge stays on the calling thread.
+    //
+    // NOTE: Scan blocks until done — call from main thread only.
     // =============================================================================
 
     /**
@@ -55,8 +62,15 @@ namespace Opaax
             OpaaxString ManifestAbsPath;
 
             // If true, entries in the manifest that have no corresponding
-            // file on disk are flagged as missing (not removed).
+            // file on disk are flagged as missing (not removed). Only entries
+            // under RootDir — the rest belong to another scan target.
             bool bFlagMissing = true;
+
+            // Scan cache file (DefaultCachePath). Empty = resolve every file, always save.
+            OpaaxString CacheAbsPath;
+
+            // Enumerate directories across this pool. Null = calling thread only.
+            JobSubsystem* Jobs = nullptr;
         };
 
         struct ScanResult
@@ -65,12 +79,17 @@ namespace Opaax
             Uint32 Existing = 0;    // entries already in manifest, preserved
             Uint32 Missing  = 0;    // manifest entries with no file on disk
             Uint32 Skipped  = 0;    // files with unrecognised extensions
+            Uint32 Cached   = 0;    // files reused from the scan cache (size + mtime unchanged)
+            bool   bSaved   = false; // manifest file rewritten (something changed)
         };
 
         // Scan InConfig.RootDir, merge into AssetManifest, save to disk.
         // Returns scan statistics.
         static ScanResult Scan(const ScanConfig& InConfig);
 
+        // Scan cache file for InRootDir under EngineConfig's cache dir; empty when caching is disabled.
+        static OpaaxString DefaultCachePath(const OpaaxString& InRootDir);
+
     private:
         // Derive asset type string from filename pattern (extension + compound extension).
         static OpaaxStringID ResolveType(const std::filesystem::path& InPath) noexcept;
@@ -85,6 +104,9 @@ namespace Opaax
         // The prefix filter is what makes the per-target manifest split work — the manifest
         // pool is global, but each on-disk file only owns the subset under its scan root.
         static bool SaveManifest(const OpaaxString& InAbsPath, const OpaaxString& InRootPrefix) noexcept;
+
+        // Order-independent hash of the manifest entries SaveManifest would write for InRootPrefix.
+        static Uint64 ManifestFingerprint(const OpaaxString& InRootPrefix) noexcept;
     };
 
 } // namespace Opaax
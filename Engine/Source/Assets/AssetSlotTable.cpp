@@ -0,0 +1,89 @@
+#include "AssetSlotTable.hpp"
+
+#include <algorithm>
+
+namespace Opaax
+{
+    Atomic<AssetSlot*>   AssetSlotTable::s_Pages[AssetSlotTable::MaxPages] = {};
+    Atomic<Uint32>       AssetSlotTable::s_Count           { 0 };
+    TDynArray<Uint32>    AssetSlotTable::s_FreeList;
+    Uint32               AssetSlotTable::s_GenerationFloor = 0;
+
+    Uint32 AssetSlotTable::Allocate(Uint32& OutGeneration)
+    {
+        Uint32 lIndex = InvalidIndex;
+        if (!s_FreeList.empty())
+        {
+            lIndex = s_FreeList.back();
+            s_FreeList.pop_back();
+        }
+        else
+        {
+            lIndex = s_Count.load(std::memory_order_relaxed);
+            const Uint32 lPage = lIndex >> PageShift;
+            OPAAX_CORE_ASSERT(lPage < MaxPages)
+
+            if ((lIndex & PageMask) == 0 && !s_Pages[lPage].load(std::memory_order_relaxed))
+            {
+                AssetSlot* lSlots = new AssetSlot[PageSize];
+                for (Uint32 i = 0; i < PageSize; ++i)
+                {
+                    lSlots[i].Generation.store(s_GenerationFloor, std::memory_order_relaxed);
+                }
+                s_Pages[lPage].store(lSlots, std::memory_order_relaxed);
+            }
+            // Publishes the page (and the slot's floor generation) to Resolve.
+            s_Count.store(lIndex + 1, std::memory_order_release);
+        }
+
+        // Occupied generations are odd, free ones even — a generation once handed out is never
+        // reissued to a later occupant of the slot.
+        AssetSlot&   lSlot       = s_Pages[lIndex >> PageShift].load(std::memory_order_relaxed)[lIndex & PageMask];
+        const Uint32 lGeneration = lSlot.Generation.load(std::memory_order_relaxed) | 1u;
+        lSlot.Ptr.store(nullptr, std::memory_order_relaxed);
+        lSlot.Generation.store(lGeneration, std::memory_order_release);
+        OutGeneration = lGeneration;
+        return lIndex;
+    }
+
+    void AssetSlotTable::SetPayload(Uint32 InIndex, void* InPtr) noexcept
+    {
+        if (InIndex >= s_Count.load(std::memory_order_relaxed)) { return; }
+
+        // Release: a reader that sees this payload also sees the generation it belongs to.
+        s_Pages[InIndex >> PageShift].load(std::memory_order_relaxed)[InIndex & PageMask].Ptr.store(InPtr, std::memory_order_release);
+    }
+
+    void AssetSlotTable::Free(Uint32 InIndex)
+    {
+        if (InIndex >= s_Count.load(std::memory_order_relaxed)) { return; }
+
+        AssetSlot& lSlot = s_Pages[InIndex >> PageShift].load(std::memory_order_relaxed)[InIndex & PageMask];
+        lSlot.Ptr.store(nullptr, std::memory_order_relaxed);
+        lSlot.Generation.fetch_add(1u, std::memory_order_release);   // odd -> even: free
+        s_FreeList.push_back(InIndex);
+    }
+
+    void AssetSlotTable::Clear()
+    {
+        const Uint32 lCount = s_Count.load(std::memory_order_relaxed);
+        for (Uint32 i = 0; i < lCount; ++i)
+        {
+            const Uint32 lGeneration = s_Pages[i >> PageShift].load(std::memory_order_relaxed)[i & PageMask]
+                                           .Generation.load(std::memory_order_relaxed);
+            s_GenerationFloor = std::max(s_GenerationFloor, (lGeneration + 2u) & ~1u);
+        }
+
+        s_Count.store(0, std::memory_order_release);
+        for (Atomic<AssetSlot*>& lPage : s_Pages)
+        {
+            delete[] lPage.exchange(nullptr, std::memory_order_relaxed);
+        }
+        s_FreeList.clear();
+    }
+
+    Uint32 AssetSlotTable::GetLiveCount() noexcept
+    {
+        return s_Count.load(std::memory_order_relaxed) - static_cast<Uint32>(s_FreeList.size());
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    /**
+     * @struct AssetSlot
+     * One dense slot: the payload of the asset occupying it (null while Loading / Failed) and the
+     * generation that names the current occupant. Both atomic — resolved from any thread.
+     */
+    struct AssetSlot
+    {
+        Atomic<void*>  Ptr        { nullptr };
+        Atomic<Uint32> Generation { 0 };
+    };
+
+    // =============================================================================
+    // AssetSlotTable
+    // =============================================================================
+    /**
+     * @class AssetSlotTable
+     *
+     * Dense, generation-checked payload table behind TAssetHandle::Get. Every AssetRegistry entry
+     * owns one slot for its lifetime; handles carry (slot index, generation) next to their string
+     * ID, so resolving is one bounds check and one slot load — no hash, no type_index compare.
+     * The type check happens once, when the registry hands out the handle: a slot never changes
+     * type within a generation.
+     *
+     * Freeing a slot bumps its generation, so a handle that outlived its entry misses and falls
+     * back to the ID lookup (which finds a re-loaded asset under the same ID, as before).
+     *
+     * Mutation (Allocate / SetPayload / Free / Clear) is AssetRegistry's, main thread only.
+     * Resolve may run on any thread, concurrently with all of them but Clear: slots live in
+     * fixed-size pages that never move, and Resolve re-reads the generation after the payload
+     * (seqlock style), so it returns either null or the payload of the occupancy it was asked for.
+     */
+    class OPAAX_API AssetSlotTable
+    {
+    public:
+        static constexpr Uint32 InvalidIndex = ~0u;
+
+        static constexpr Uint32 PageShift = 10;                 // 1024 slots per page
+        static constexpr Uint32 PageSize  = 1u << PageShift;
+        static constexpr Uint32 PageMask  = PageSize - 1u;
+        static constexpr Uint32 MaxPages  = 1024;               // ~1M live assets
+
+        // =============================================================================
+        // Hot path
+        // =============================================================================
+    public:
+        static FORCEINLINE void* Resolve(Uint32 InIndex, Uint32 InGeneration) noexcept
+        {
+            // s_Count is published after the page that holds the new slot.
+            if (InIndex >= s_Count.load(std::memory_order_acquire)) { return nullptr; }
+
+            const AssetSlot& lSlot = s_Pages[InIndex >> PageShift].load(std::memory_order_relaxed)[InIndex & PageMask];
+            if (lSlot.Generation.load(std::memory_order_acquire) != InGeneration) { return nullptr; }
+
+            // A payload stored for a later occupant is released after that occupant's generation,
+            // so the re-check below sees the bump and rejects it.
+            void* lPtr = lSlot.Ptr.load(std::memory_order_acquire);
+            return (lSlot.Generation.load(std::memory_order_acquire) == InGeneration) ? lPtr : nullptr;
+        }
+
+        // =============================================================================
+        // Registry side
+        // =============================================================================
+    public:
+        // Take a free slot (or grow). OutGeneration names this occupancy; the payload starts null.
+        static Uint32 Allocate(Uint32& OutGeneration);
+
+        static void SetPayload(Uint32 InIndex, void* InPtr) noexcept;
+
+        // Release the slot and bump its generation — every handle to it now misses.
+        static void Free(Uint32 InIndex);
+
+        // Drop every slot (registry shutdown — no Resolve may be running). Generations keep
+        // counting up, so no stale handle can ever hit a later occupant.
+        static void Clear();
+
+        static Uint32 GetLiveCount() noexcept;
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        // Page pointers never change once set (until Clear), so a slot address is stable.
+        static Atomic<AssetSlot*>   s_Pages[MaxPages];
+        static Atomic<Uint32>       s_Count;
+
+        static TDynArray<Uint32>    s_FreeList;
+        static Uint32               s_GenerationFloor;   // generations start above this after Clear
+    };
+
+} // namespace Opaax
@@ -73,6 +73,17 @@ namespace Opaax
         return AssetType::Unknown;
     }
 
+    /**
+     * @struct AssetDependency
+     * One asset a serialized object resolves when it is loaded — a scene records these so the
+     * whole set can be prefetched before any entity is built (SceneSerializer).
+     */
+    struct AssetDependency
+    {
+        OpaaxStringID ID;
+        AssetType     Type = AssetType::Unknown;
+    };
+
     // =============================================================================
     // IAsset
     // =============================================================================
@@ -103,5 +114,8 @@ namespace Opaax
 
         /*** Project-root-relative source path (e.g. "Engine/Assets/Textures/Player.png"). */
         virtual const OpaaxString&    GetSourcePath() const = 0;
+
+        /*** Bytes held beyond sizeof (heap, GPU) — AssetRegistry's cache budget counts them. */
+        virtual Uint64                GetMemorySize() const { return 0; }
     };
 }
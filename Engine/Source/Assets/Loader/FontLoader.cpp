@@ -1,16 +1,73 @@
 #include "FontLoader.h"
 
 #include "Renderer/Text/FontAsset.h"
+#include "Renderer/Text/FontBakeCache.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/CoreEngineApp.h"
+#include "Core/Jobs/JobSubsystem.h"
 
 namespace Opaax
 {
+    namespace
+    {
+        EFontBakeMode ConfiguredBakeMode()
+        {
+            return EngineConfig::FontDistanceField() ? EFontBakeMode::DistanceField : EFontBakeMode::Bitmap;
+        }
+
+        // Settings captured by PrepareDecode, then the bake output — carried from Decode to Finalize.
+        struct FontDecodeData final : AssetDecodeData
+        {
+            EFontBakeMode Mode = EFontBakeMode::Bitmap;
+            OpaaxString   CacheDir;   // FontBakeCache::ResolveDirectory at request time
+            FontBakeData  Baked;
+        };
+    }
+
     FontAsset* FontLoader::Load(const char* InAbsPath, OpaaxStringID InCanonicalID)
     {
-        return new FontAsset(OpaaxString(InAbsPath), InCanonicalID);
+        const EFontBakeMode lMode = ConfiguredBakeMode();
+        if (m_EngineApp)
+        {
+            return new FontAsset(OpaaxString(InAbsPath), InCanonicalID, lMode,
+                                 *m_EngineApp->GetSubsystem<JobSubsystem>());
+        }
+        return new FontAsset(OpaaxString(InAbsPath), InCanonicalID, lMode);
     }
 
     bool FontLoader::IsValid(FontAsset* InAsset)
     {
-        return InAsset && InAsset->IsLoaded();
+        // An async bake is still Loading here; it can only be rejected once it has run.
+        return InAsset && InAsset->GetState() != EAssetState::Failed;
+    }
+
+    UniquePtr<AssetDecodeData> FontLoader::PrepareDecode(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/)
+    {
+        UniquePtr<FontDecodeData> lData = MakeUnique<FontDecodeData>();
+        lData->Mode     = ConfiguredBakeMode();
+        lData->CacheDir = FontBakeCache::ResolveDirectory();
+        return lData;
+    }
+
+    UniquePtr<AssetDecodeData> FontLoader::Decode(const char* InAbsPath, OpaaxStringID /*InCanonicalID*/,
+                                                  UniquePtr<AssetDecodeData> InPrepared)
+    {
+        auto* lData = static_cast<FontDecodeData*>(InPrepared.get());
+        if (!lData) { return nullptr; }
+
+        if (!FontAsset::Bake(OpaaxString(InAbsPath), lData->Mode, lData->CacheDir, lData->Baked))
+        {
+            return nullptr;
+        }
+        return InPrepared;
+    }
+
+    FontAsset* FontLoader::Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath,
+                                    OpaaxStringID InCanonicalID)
+    {
+        auto* lData = static_cast<FontDecodeData*>(InDecoded.get());
+        if (!lData) { return nullptr; }
+
+        return new FontAsset(OpaaxString(InAbsPath), InCanonicalID, lData->Mode, lData->Baked);
     }
 }
@@ -5,12 +5,19 @@
 namespace Opaax
 {
     class FontAsset;
+    class CoreEngineApp;
 
     // =============================================================================
     // FontLoader
     //
     // Constructs a FontAsset from an absolute TTF/OTF path. The FontAsset ctor
     // drives the TTF parse + R8 atlas bake (stb_truetype) + kerning LUT build.
+    // With an engine app, the bake runs on its JobSubsystem and the asset is
+    // handed back still Loading; without one (tools, benchmarks) it bakes inline.
+    // AssetRegistry::LoadAsync instead bakes in Decode (worker) and uploads the
+    // atlas in Finalize, so the registry entry itself carries the Loading state;
+    // the bake mode and cache directory are read from EngineConfig in
+    // PrepareDecode (main thread), never by the worker.
     // =============================================================================
     /**
      * @class FontLoader
@@ -18,6 +25,12 @@ namespace Opaax
      */
     class OPAAX_API FontLoader final : public IAssetLoader<FontAsset>
     {
+        // =============================================================================
+        // CTOR
+        // =============================================================================
+    public:
+        explicit FontLoader(CoreEngineApp* InEngineApp = nullptr) : m_EngineApp(InEngineApp) {}
+
         // =============================================================================
         // Override
         // =============================================================================
@@ -25,7 +38,19 @@ namespace Opaax
     public:
         FontAsset* Load(const char* InAbsPath, OpaaxStringID InCanonicalID) override;
         bool       IsValid(FontAsset* InAsset)                              override;
+
+        UniquePtr<AssetDecodeData> PrepareDecode(const char* InAbsPath, OpaaxStringID InCanonicalID) override;
+        UniquePtr<AssetDecodeData> Decode(const char* InAbsPath, OpaaxStringID InCanonicalID,
+                                          UniquePtr<AssetDecodeData> InPrepared) override;
+        FontAsset*                 Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath,
+                                            OpaaxStringID InCanonicalID) override;
         //~ End IAssetLoader interface
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        CoreEngineApp* m_EngineApp = nullptr;
     };
 
 } // namespace Opaax
@@ -7,6 +7,16 @@
 
 namespace Opaax
 {
+    /**
+     * @struct AssetDecodeData
+     * Type-erased CPU-side result of IAssetLoader::Decode (decoded pixels, a baked atlas...).
+     * Each loader derives its own; AssetRegistry only carries it from the worker to Finalize.
+     */
+    struct AssetDecodeData
+    {
+        virtual ~AssetDecodeData() = default;
+    };
+
     /**
      * @struct IAssetLoader
      * Loader Interface.
@@ -14,6 +24,14 @@ namespace Opaax
      *
      * Load() return a raw ptr — AssetRegistry take ownership
      *
+     * AssetRegistry::LoadAsync splits a load in two stages: Decode (file IO + CPU decode) on a
+     * JobSubsystem worker, then Finalize (GPU upload + construction) on the main thread. A loader
+     * that does not override them still works async — Finalize defaults to Load, so the whole load
+     * just runs in the main-thread stage. A loader that can decode from a byte buffer opts into
+     * DecodesFromMemory: the file is then read on IOSubsystem and only DecodeMemory runs on the worker.
+     * Engine state the worker stage depends on (config, resolved directories) is snapshotted by
+     * PrepareDecode on the main thread when the load is requested and handed to it.
+     *
      * @tparam T Asset type
      */
     template<typename T>
@@ -43,6 +61,76 @@ namespace Opaax
          * @return true if the loaded asset is valid and ready to use.
          */
         virtual bool IsValid(T* InAsset) = 0;
+
+        /**
+         * Main thread, once per LoadAsync miss, before the decode is queued: capture whatever engine
+         * state Decode / DecodeMemory need, since they must not read it from the worker.
+         * @return the snapshot handed to the decode stage as InPrepared; nullptr if there is none.
+         */
+        virtual UniquePtr<AssetDecodeData> PrepareDecode(const char* InAbsPath, OpaaxStringID InCanonicalID)
+        {
+            (void)InAbsPath;
+            (void)InCanonicalID;
+            return nullptr;
+        }
+
+        /**
+         * Worker-thread stage of an async load: read + decode only — no GPU calls, no registry,
+         * no engine state beyond logging. A loader overriding this must override Finalize too.
+         * @param InAbsPath     Resolved absolute path.
+         * @param InCanonicalID Registry-stable ID — also the key of the asset's cooked blob, if any
+         *                      (PackFileSystem::Find is safe to call from here).
+         * @param InPrepared    PrepareDecode's snapshot for this load (may be returned, filled in).
+         * @return the decoded data; nullptr on failure (or when the loader has no decode stage).
+         */
+        virtual UniquePtr<AssetDecodeData> Decode(const char* InAbsPath, OpaaxStringID InCanonicalID,
+                                                  UniquePtr<AssetDecodeData> InPrepared)
+        {
+            (void)InAbsPath;
+            (void)InCanonicalID;
+            (void)InPrepared;
+            return nullptr;
+        }
+
+        /**
+         * True if this load's bytes should be read through IOSubsystem and handed to DecodeMemory
+         * instead of calling Decode. Main thread, once per LoadAsync miss.
+         */
+        virtual bool DecodesFromMemory(const char* InAbsPath, OpaaxStringID InCanonicalID)
+        {
+            (void)InAbsPath;
+            (void)InCanonicalID;
+            return false;
+        }
+
+        /**
+         * Decode for a load DecodesFromMemory accepted — same contract as Decode, but from the whole
+         * file's bytes (valid for the duration of the call only).
+         */
+        virtual UniquePtr<AssetDecodeData> DecodeMemory(const Uint8* InData, Uint64 InSize, const char* InAbsPath,
+                                                        OpaaxStringID InCanonicalID,
+                                                        UniquePtr<AssetDecodeData> InPrepared)
+        {
+            (void)InData;
+            (void)InSize;
+            (void)InAbsPath;
+            (void)InCanonicalID;
+            (void)InPrepared;
+            return nullptr;
+        }
+
+        /**
+         * Main-thread stage of an async load: build the asset from Decode's output.
+         * @param InDecoded     Decode's result — nullptr if decode failed (return nullptr then).
+         * @param InAbsPath     Resolved absolute path.
+         * @param InCanonicalID Registry-stable ID stamped onto the asset.
+         * @return nullptr on failure — never throws
+         */
+        virtual T* Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath, OpaaxStringID InCanonicalID)
+        {
+            (void)InDecoded;
+            return Load(InAbsPath, InCanonicalID);
+        }
     };
 
 } // namespace Opaax
\ No newline at end of file
@@ -2,6 +2,9 @@
 
 #include "Scene/SceneAsset.h"
 
+#include <filesystem>
+#include <system_error>
+
 namespace Opaax
 {
     SceneAsset* SceneLoader::Load(const char* InAbsPath, OpaaxStringID InCanonicalID)
@@ -13,4 +16,22 @@ namespace Opaax
     {
         return InAsset != nullptr;
     }
+
+    UniquePtr<AssetDecodeData> SceneLoader::Decode(const char* InAbsPath, OpaaxStringID /*InCanonicalID*/,
+                                                   UniquePtr<AssetDecodeData> /*InPrepared*/)
+    {
+        std::error_code lError;
+        if (!std::filesystem::is_regular_file(InAbsPath, lError))
+        {
+            OPAAX_CORE_ERROR("SceneLoader: scene file '{}' not found", InAbsPath);
+            return nullptr;
+        }
+        return MakeUnique<AssetDecodeData>();
+    }
+
+    SceneAsset* SceneLoader::Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath,
+                                      OpaaxStringID InCanonicalID)
+    {
+        return InDecoded ? Load(InAbsPath, InCanonicalID) : nullptr;
+    }
 }
@@ -16,6 +16,9 @@ namespace Opaax
      * SceneAsset is metadata-only (path + ID) — runtime Scene instantiation
      * stays SceneManager's responsibility, so this loader does not deserialize
      * the scene file; it just stamps a descriptor into AssetRegistry.
+     *
+     * Async: the only IO is Decode's existence check (off the main thread — the
+     * file may sit on a slow or network drive); Finalize builds the descriptor.
      */
     class OPAAX_API SceneLoader final : public IAssetLoader<SceneAsset>
     {
@@ -26,6 +29,11 @@ namespace Opaax
     public:
         SceneAsset* Load(const char* InAbsPath, OpaaxStringID InCanonicalID) override;
         bool        IsValid(SceneAsset* InAsset)                             override;
+
+        UniquePtr<AssetDecodeData> Decode(const char* InAbsPath, OpaaxStringID InCanonicalID,
+                                          UniquePtr<AssetDecodeData> InPrepared) override;
+        SceneAsset*                Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath,
+                                            OpaaxStringID InCanonicalID) override;
         //~ End IAssetLoader interface
     };
 
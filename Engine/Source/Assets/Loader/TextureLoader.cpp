@@ -1,11 +1,55 @@
 #include "TextureLoader.h"
 
+#include "Assets/Pack/PackFileSystem.h"
+#include "Assets/Pack/TextureCook.h"
 #include "Renderer/Texture2D.h"
 
+// stb_image — declarations only; STB_IMAGE_IMPLEMENTATION lives in OpenGLTexture2D.cpp.
+#include <stb/stb_image.h>
+
 namespace Opaax
 {
+    namespace
+    {
+        // Decoded pixels, owned until Finalize uploads them — or, when bCooked, a view into a
+        // mounted pack (Cooked points into the mapping; nothing to free).
+        struct TextureDecodeData final : AssetDecodeData
+        {
+            ~TextureDecodeData() override { if (Pixels) { stbi_image_free(Pixels); } }
+
+            unsigned char* Pixels   = nullptr;
+            Int32          Width    = 0;
+            Int32          Height   = 0;
+            Int32          Channels = 0;
+
+            TextureDesc    Cooked;
+            bool           bCooked        = false;
+            bool           bPremultiplied = false;
+        };
+
+        // The cooked levels for InID straight out of the pack mapping; false if the texture is not packed.
+        bool FindPackedTexture(OpaaxStringID InID, TextureDesc& OutDesc, bool& OutPremultiplied)
+        {
+            const AssetPackBlob lBlob = PackFileSystem::Find(InID);
+            if (!lBlob) { return false; }
+            if (!TextureCook::Read(lBlob, OutDesc, OutPremultiplied))
+            {
+                OPAAX_CORE_WARN("TextureLoader: packed '{}' is not a valid texture blob — using the loose file.", InID);
+                return false;
+            }
+            return true;
+        }
+    }
+
     Texture2D* TextureLoader::Load(const char* InAbsPath, OpaaxStringID InCanonicalID)
     {
+        // Cooked textures upload as stored; loose PNGs (editor, uncooked runs) still go through stb_image.
+        TextureDesc lCooked;
+        bool        lPremultiplied = false;
+        if (FindPackedTexture(InCanonicalID, lCooked, lPremultiplied))
+        {
+            return new Texture2D(OpaaxString(InAbsPath), InCanonicalID, lCooked, lPremultiplied);
+        }
         return new Texture2D(OpaaxString(InAbsPath), InCanonicalID);
     }
 
@@ -13,4 +57,73 @@ namespace Opaax
     {
         return InAsset && InAsset->IsLoaded();
     }
+
+    UniquePtr<AssetDecodeData> TextureLoader::Decode(const char* InAbsPath, OpaaxStringID InCanonicalID,
+                                                     UniquePtr<AssetDecodeData> /*InPrepared*/)
+    {
+        UniquePtr<TextureDecodeData> lData = MakeUnique<TextureDecodeData>();
+
+        // Cooked: nothing to decode — Finalize uploads straight from the mapping.
+        if (FindPackedTexture(InCanonicalID, lData->Cooked, lData->bPremultiplied))
+        {
+            lData->bCooked = true;
+            return lData;
+        }
+
+        // Same flip as the backend path ctors, but thread-local — workers decode concurrently.
+        stbi_set_flip_vertically_on_load_thread(1);
+
+        lData->Pixels = stbi_load(InAbsPath, &lData->Width, &lData->Height, &lData->Channels, 0);
+        if (!lData->Pixels)
+        {
+            OPAAX_CORE_ERROR("TextureLoader: failed to decode '{}' — {}", InAbsPath, stbi_failure_reason());
+            return nullptr;
+        }
+        return lData;
+    }
+
+    bool TextureLoader::DecodesFromMemory(const char* /*InAbsPath*/, OpaaxStringID InCanonicalID)
+    {
+        // Packed textures are already mapped — there is nothing to read.
+        return !PackFileSystem::Find(InCanonicalID);
+    }
+
+    UniquePtr<AssetDecodeData> TextureLoader::DecodeMemory(const Uint8* InData, Uint64 InSize, const char* InAbsPath,
+                                                           OpaaxStringID /*InCanonicalID*/,
+                                                           UniquePtr<AssetDecodeData> /*InPrepared*/)
+    {
+        if (!InData || InSize == 0 || InSize > static_cast<Uint64>(INT32_MAX))
+        {
+            OPAAX_CORE_ERROR("TextureLoader: '{}' is empty or too large to decode ({} bytes)", InAbsPath, InSize);
+            return nullptr;
+        }
+
+        UniquePtr<TextureDecodeData> lData = MakeUnique<TextureDecodeData>();
+
+        stbi_set_flip_vertically_on_load_thread(1);
+
+        lData->Pixels = stbi_load_from_memory(InData, static_cast<int>(InSize),
+                                              &lData->Width, &lData->Height, &lData->Channels, 0);
+        if (!lData->Pixels)
+        {
+            OPAAX_CORE_ERROR("TextureLoader: failed to decode '{}' — {}", InAbsPath, stbi_failure_reason());
+            return nullptr;
+        }
+        return lData;
+    }
+
+    Texture2D* TextureLoader::Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath,
+                                       OpaaxStringID InCanonicalID)
+    {
+        const auto* lData = static_cast<const TextureDecodeData*>(InDecoded.get());
+        if (!lData) { return nullptr; }
+
+        if (lData->bCooked)
+        {
+            return new Texture2D(OpaaxString(InAbsPath), InCanonicalID, lData->Cooked, lData->bPremultiplied);
+        }
+        return new Texture2D(OpaaxString(InAbsPath), InCanonicalID, lData->Pixels,
+                             static_cast<Uint32>(lData->Width), static_cast<Uint32>(lData->Height),
+                             lData->Channels);
+    }
 }
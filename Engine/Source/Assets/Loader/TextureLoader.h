@@ -11,6 +11,13 @@ namespace Opaax
      *
      * Constructs a Texture2D asset from an absolute file path. The Texture2D
      * ctor drives the underlying GPU upload via stb_image inside OpenGLTexture2D.
+     *
+     * Async (AssetRegistry::LoadAsync): Decode runs stb_image on a worker into CPU pixels,
+     * Finalize uploads them through Texture2D's decoded-pixels ctor. A loose file is read on
+     * IOSubsystem first (DecodesFromMemory), so the worker only runs stb_image over the bytes.
+     *
+     * A texture cooked into a mounted pack (PackFileSystem) skips stb_image on both paths:
+     * its pixels are uploaded straight out of the mapping.
      */
     class OPAAX_API TextureLoader final : public IAssetLoader<Texture2D>
     {
@@ -21,6 +28,15 @@ namespace Opaax
     public:
         Texture2D* Load(const char* InAbsPath, OpaaxStringID InCanonicalID) override;
         bool       IsValid(Texture2D* InAsset)                              override;
+
+        UniquePtr<AssetDecodeData> Decode(const char* InAbsPath, OpaaxStringID InCanonicalID,
+                                          UniquePtr<AssetDecodeData> InPrepared) override;
+        bool                       DecodesFromMemory(const char* InAbsPath, OpaaxStringID InCanonicalID) override;
+        UniquePtr<AssetDecodeData> DecodeMemory(const Uint8* InData, Uint64 InSize, const char* InAbsPath,
+                                                OpaaxStringID InCanonicalID,
+                                                UniquePtr<AssetDecodeData> InPrepared) override;
+        Texture2D*                 Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* InAbsPath,
+                                            OpaaxStringID InCanonicalID) override;
         //~ End IAssetLoader interface
     };
 
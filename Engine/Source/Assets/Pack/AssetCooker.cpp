@@ -0,0 +1,85 @@
+#include "AssetCooker.h"
+
+#include "Assets/AssetManifest.h"
+#include "Assets/IAsset.hpp"
+#include "Assets/Pack/AssetPackWriter.h"
+#include "Core/OpaaxFile.h"
+#include "Core/OpaaxPath.h"
+#include "Core/Log/OpaaxLog.h"
+
+// stb_image — declarations only; STB_IMAGE_IMPLEMENTATION lives in OpenGLTexture2D.cpp.
+#include <stb/stb_image.h>
+
+namespace Opaax
+{
+    namespace
+    {
+        bool CookTextureEntry(const AssetDescriptor& InDesc, const OpaaxString& InAbsPath,
+                              const TextureCookSettings& InSettings, AssetPackWriter& InWriter)
+        {
+            // Same orientation as every runtime texture load — the blob uploads without a flip.
+            stbi_set_flip_vertically_on_load_thread(1);
+
+            // Always expanded to RGBA: every cooked format (RGBA8 / BC1 / BC3) starts from four channels.
+            Int32 lWidth = 0, lHeight = 0, lChannels = 0;
+            unsigned char* lPixels = stbi_load(InAbsPath.CStr(), &lWidth, &lHeight, &lChannels, 4);
+            if (!lPixels)
+            {
+                OPAAX_CORE_ERROR("AssetCooker: failed to decode '{}' — {}", InAbsPath, stbi_failure_reason());
+                return false;
+            }
+
+            TDynArray<Uint8> lBlob;
+            const bool lCooked = TextureCook::Cook(lPixels, static_cast<Uint32>(lWidth), static_cast<Uint32>(lHeight),
+                                                   InSettings, lBlob);
+            stbi_image_free(lPixels);
+            if (!lCooked)
+            {
+                return false;
+            }
+
+            return InWriter.Add(InDesc.ID, EAssetPackFormat::CookedTexture, Move(lBlob));
+        }
+    }
+
+    bool AssetCooker::CookEntry(const AssetDescriptor& InDesc, AssetPackWriter& InWriter,
+                                const TextureCookSettings& InTextureSettings)
+    {
+        const OpaaxString lAbsPath = OpaaxPath::ToAbsolute(InDesc.RelPath);
+
+        if (AssetTypeFromStringID(InDesc.Type) == AssetType::Texture2D)
+        {
+            return CookTextureEntry(InDesc, lAbsPath, InTextureSettings, InWriter);
+        }
+
+        TDynArray<Uint8> lBytes;
+        if (!OpaaxFile::ReadBinary(lAbsPath.CStr(), lBytes))
+        {
+            OPAAX_CORE_ERROR("AssetCooker: cannot read '{}'", lAbsPath);
+            return false;
+        }
+        return InWriter.Add(InDesc.ID, EAssetPackFormat::Source, Move(lBytes));
+    }
+
+    bool AssetCooker::CookManifest(const OpaaxString& InAbsPackPath, Uint32& OutCooked, Uint32& OutFailed,
+                                   const TextureCookSettings& InTextureSettings)
+    {
+        OutCooked = 0;
+        OutFailed = 0;
+
+        AssetPackWriter lWriter;
+        for (const auto& [lKey, lDesc] : AssetManifest::GetAll())
+        {
+            if (lDesc.bMissing)
+            {
+                continue;
+            }
+
+            if (CookEntry(lDesc, lWriter, InTextureSettings)) { ++OutCooked; }
+            else                           { ++OutFailed; }
+        }
+
+        return lWriter.Write(InAbsPackPath.CStr());
+    }
+
+} // namespace Opaax
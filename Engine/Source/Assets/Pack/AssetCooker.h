@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxString.hpp"
+#include "Assets/Pack/TextureCook.h"
+
+namespace Opaax
+{
+    struct AssetDescriptor;
+    class  AssetPackWriter;
+
+    /**
+     * @class AssetCooker
+     *
+     * Turns manifest entries into pack blobs in their runtime-ready form: textures are decoded
+     * (and flipped, as the runtime upload expects) and run through TextureCook into
+     * EAssetPackFormat::CookedTexture, so a packed texture uploads straight from the mapping with
+     * its mip chain; every other type is stored verbatim.
+     * Keyed by the manifest ID — the canonical ID AssetRegistry resolves it to.
+     *
+     * Lives in the engine (stb_image is linked here); OpaaxAssetCook is the command-line driver.
+     */
+    class OPAAX_API AssetCooker
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /** Cook one manifest entry into InWriter. False (logged) if its source cannot be read. */
+        static bool CookEntry(const AssetDescriptor& InDesc, AssetPackWriter& InWriter,
+                              const TextureCookSettings& InTextureSettings = {});
+
+        /**
+         * Cook every present entry of the loaded manifests into one pack at InAbsPackPath.
+         * Entries that fail are logged and left out. @return false if nothing could be written.
+         */
+        static bool CookManifest(const OpaaxString& InAbsPackPath, Uint32& OutCooked, Uint32& OutFailed,
+                                 const TextureCookSettings& InTextureSettings = {});
+    };
+
+} // namespace Opaax
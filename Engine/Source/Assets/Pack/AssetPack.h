@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Core/OpaaxHash.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    // =============================================================================
+    // Cooked asset pack — on-disk layout
+    // =============================================================================
+    //
+    //   [AssetPackHeader]                      offset 0
+    //   [blob][pad]...                         each blob starts on an AssetPackAlignment boundary
+    //   [AssetPackTocEntry x TocCapacity]      at Header.TocOffset (aligned too)
+    //
+    // The TOC is an open-addressed hash table keyed by AssetPackKey — a 64-bit FNV-1a hash of the
+    // canonical ID string, not the OpaaxStringID index, which depends on intern order and differs
+    // between the cooker and the game: bucket = Key & (TocCapacity - 1), linear probing, key 0
+    // marks an empty bucket. Each entry stores the full key, so two IDs sharing a bucket never
+    // return each other's blob; two IDs sharing a key are refused when the pack is written.
+    // TocCapacity is a power of two at most half full, so a lookup is a probe or two straight
+    // into the mapped file. Little-endian, written and read as-is.
+
+    inline constexpr Uint32 AssetPackMagic     = 0x4B41504Fu;   // "OPAK"
+    inline constexpr Uint32 AssetPackVersion   = 3;             // 2: cooked textures (formats + mips), 3: 64-bit TOC keys
+    inline constexpr Uint64 AssetPackAlignment = 64;            // blob + TOC alignment (cache line)
+
+    /**
+     * @enum EAssetPackFormat
+     * How a blob's bytes are laid out — what the loader can consume without decoding.
+     */
+    enum class EAssetPackFormat : Uint32
+    {
+        Source        = 0,  // the source file verbatim (JSON, TTF, GLSL...)
+        CookedTexture = 1,  // AssetPackTextureHeader + the mip chain, GPU-ready (see TextureCook.h)
+    };
+
+    struct AssetPackHeader
+    {
+        Uint32 Magic       = AssetPackMagic;
+        Uint32 Version     = AssetPackVersion;
+        Uint32 EntryCount  = 0;
+        Uint32 TocCapacity = 0;   // power of two
+        Uint64 TocOffset   = 0;
+        Uint64 FileSize    = 0;   // truncation check
+    };
+    static_assert(sizeof(AssetPackHeader) == 32, "AssetPackHeader layout is part of the file format");
+
+    struct AssetPackTocEntry
+    {
+        Uint64 Key      = 0;      // AssetPackKey of the canonical ID; 0 = empty bucket
+        Uint32 Format   = 0;      // EAssetPackFormat
+        Uint32 Reserved = 0;
+        Uint64 Offset   = 0;      // from the start of the pack, AssetPackAlignment-aligned
+        Uint64 Size     = 0;
+    };
+    static_assert(sizeof(AssetPackTocEntry) == 32, "AssetPackTocEntry layout is part of the file format");
+
+    // TOC key for a canonical asset ID string. Never 0 — that marks an empty bucket.
+    inline constexpr Uint64 AssetPackKey(const char* InCanonicalID) noexcept
+    {
+        const Uint64 lKey = OpaaxHash::Hash64(InCanonicalID);
+        return lKey != 0 ? lKey : 1;
+    }
+
+    inline constexpr Uint8 AssetPackTextureFlag_Premultiplied = 1u << 0;   // rgb already scaled by alpha
+
+    // Prefix of an EAssetPackFormat::CookedTexture blob; MipCount tightly packed levels follow
+    // back to back, largest first, rows bottom-up.
+    struct AssetPackTextureHeader
+    {
+        Uint32 Width    = 0;
+        Uint32 Height   = 0;
+        Uint8  Format   = 0;      // ETextureFormat
+        Uint8  MipCount = 0;
+        Uint8  Flags    = 0;      // AssetPackTextureFlag_*
+        Uint8  Pad      = 0;
+        Uint32 Reserved = 0;
+    };
+    static_assert(sizeof(AssetPackTextureHeader) == 16, "AssetPackTextureHeader layout is part of the file format");
+
+    // Probe the hashed TOC for InKey; nullptr if absent. InCapacity must be a non-zero power of two.
+    inline const AssetPackTocEntry* AssetPackFindEntry(const AssetPackTocEntry* InToc, Uint32 InCapacity,
+                                                       Uint64 InKey) noexcept
+    {
+        const Uint32 lMask = InCapacity - 1;
+        for (Uint32 lProbe = 0, lBucket = static_cast<Uint32>(InKey) & lMask; lProbe < InCapacity;
+             ++lProbe, lBucket = (lBucket + 1) & lMask)
+        {
+            const AssetPackTocEntry& lEntry = InToc[lBucket];
+            if (lEntry.Key == InKey) { return &lEntry; }
+            if (lEntry.Key == 0)     { return nullptr; }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @struct AssetPackBlob
+     * Zero-copy view of one cooked asset inside a mapped pack. Valid while the pack stays
+     * mounted (PackFileSystem) — do not keep it past PackFileSystem::UnmountAll.
+     */
+    struct AssetPackBlob
+    {
+        const Uint8*     Data   = nullptr;
+        Uint64           Size   = 0;
+        EAssetPackFormat Format = EAssetPackFormat::Source;
+
+        explicit operator bool() const noexcept { return Data != nullptr; }
+    };
+
+} // namespace Opaax
@@ -0,0 +1,99 @@
+#include "AssetPackWriter.h"
+
+#include "Core/OpaaxFile.h"
+#include "Core/Log/OpaaxLog.h"
+
+#include <bit>
+#include <cstring>
+
+namespace Opaax
+{
+    namespace
+    {
+        constexpr Uint64 AlignUp(Uint64 InValue) noexcept
+        {
+            return (InValue + AssetPackAlignment - 1) & ~(AssetPackAlignment - 1);
+        }
+    }
+
+    bool AssetPackWriter::Add(OpaaxStringID InID, EAssetPackFormat InFormat, TDynArray<Uint8>&& InBytes)
+    {
+        const Uint64 lKey = AssetPackKey(InID.ToString().CStr());
+        for (PendingBlob& lEntry : m_Entries)
+        {
+            if (lEntry.Key != lKey)
+            {
+                continue;
+            }
+            if (lEntry.ID != InID)
+            {
+                OPAAX_CORE_ERROR("AssetPackWriter: '{}' and '{}' hash to the same key {:#x} — rename one.",
+                    lEntry.ID, InID, lKey);
+                return false;
+            }
+            OPAAX_CORE_WARN("AssetPackWriter: '{}' added twice — keeping the last one.", InID);
+            lEntry.Format = InFormat;
+            lEntry.Bytes  = Move(InBytes);
+            return true;
+        }
+        m_Entries.push_back({ lKey, InID, InFormat, Move(InBytes) });
+        return true;
+    }
+
+    bool AssetPackWriter::Write(const char* InAbsPath) const
+    {
+        if (m_Entries.empty())
+        {
+            OPAAX_CORE_ERROR("AssetPackWriter: nothing to write to '{}'.", InAbsPath);
+            return false;
+        }
+
+        // At most half full keeps probe chains short; power of two for the mask.
+        const Uint32 lCapacity = std::bit_ceil(static_cast<Uint32>(m_Entries.size()) * 2u);
+
+        TDynArray<AssetPackTocEntry> lToc(lCapacity);
+        TDynArray<Uint64>            lOffsets;   // parallel to m_Entries
+        lOffsets.reserve(m_Entries.size());
+
+        Uint64 lCursor = AlignUp(sizeof(AssetPackHeader));
+        for (const PendingBlob& lEntry : m_Entries)
+        {
+            Uint32 lBucket = static_cast<Uint32>(lEntry.Key) & (lCapacity - 1);
+            while (lToc[lBucket].Key != 0) { lBucket = (lBucket + 1) & (lCapacity - 1); }
+
+            lToc[lBucket].Key    = lEntry.Key;
+            lToc[lBucket].Format = static_cast<Uint32>(lEntry.Format);
+            lToc[lBucket].Offset = lCursor;
+            lToc[lBucket].Size   = lEntry.Bytes.size();
+            lOffsets.push_back(lCursor);
+            lCursor = AlignUp(lCursor + lEntry.Bytes.size());
+        }
+
+        AssetPackHeader lHeader;
+        lHeader.EntryCount  = static_cast<Uint32>(m_Entries.size());
+        lHeader.TocCapacity = lCapacity;
+        lHeader.TocOffset   = lCursor;
+        lHeader.FileSize    = lCursor + lCapacity * sizeof(AssetPackTocEntry);
+
+        // Zero-filled, so alignment padding is deterministic — identical inputs cook identical packs.
+        TDynArray<Uint8> lFile(static_cast<size_t>(lHeader.FileSize), 0);
+        std::memcpy(lFile.data(), &lHeader, sizeof(lHeader));
+        for (size_t i = 0; i < m_Entries.size(); ++i)
+        {
+            const TDynArray<Uint8>& lBytes = m_Entries[i].Bytes;
+            if (!lBytes.empty()) { std::memcpy(lFile.data() + lOffsets[i], lBytes.data(), lBytes.size()); }
+        }
+        std::memcpy(lFile.data() + lHeader.TocOffset, lToc.data(), lCapacity * sizeof(AssetPackTocEntry));
+
+        if (!OpaaxFile::WriteBinaryAtomic(InAbsPath, lFile.data(), lFile.size()))
+        {
+            OPAAX_CORE_ERROR("AssetPackWriter: failed to write '{}'.", InAbsPath);
+            return false;
+        }
+
+        OPAAX_CORE_INFO("AssetPackWriter: wrote {} asset(s), {} KiB -> '{}'",
+            lHeader.EntryCount, lHeader.FileSize / 1024u, InAbsPath);
+        return true;
+    }
+
+} // namespace Opaax
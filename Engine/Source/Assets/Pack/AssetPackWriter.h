@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Assets/Pack/AssetPack.h"
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxStringID.hpp"
+
+namespace Opaax
+{
+    /**
+     * @class AssetPackWriter
+     *
+     * Collects cooked blobs in memory, then writes them as one pack (AssetPack.h layout):
+     * 64-byte-aligned blobs followed by the hashed TOC. The file is published atomically,
+     * so a running game never maps a half-written pack. Offline / tool side only.
+     */
+    class OPAAX_API AssetPackWriter
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /**
+         * Queue a blob under InID. A second Add for the same ID replaces the first (warned); an ID
+         * whose AssetPackKey collides with a different queued ID is refused (logged, false).
+         */
+        bool Add(OpaaxStringID InID, EAssetPackFormat InFormat, TDynArray<Uint8>&& InBytes);
+
+        /** Lay out and write the pack to InAbsPath. False (logged) on an empty pack or I/O failure. */
+        bool Write(const char* InAbsPath) const;
+
+        FORCEINLINE Uint32 GetCount() const noexcept { return static_cast<Uint32>(m_Entries.size()); }
+
+    private:
+        struct PendingBlob
+        {
+            Uint64           Key    = 0;   // AssetPackKey(ID)
+            OpaaxStringID    ID;
+            EAssetPackFormat Format = EAssetPackFormat::Source;
+            TDynArray<Uint8> Bytes;
+        };
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        TDynArray<PendingBlob> m_Entries;
+    };
+
+} // namespace Opaax
@@ -0,0 +1,113 @@
+#include "PackFileSystem.h"
+
+#include "Core/OpaaxMappedFile.h"
+#include "Core/Log/OpaaxLog.h"
+
+#include <bit>
+
+namespace Opaax
+{
+    struct PackFileSystem::MountedPack
+    {
+        OpaaxString              Path;
+        OpaaxMappedFile          File;
+        const AssetPackTocEntry* Toc         = nullptr;   // into File
+        Uint32                   TocCapacity = 0;
+    };
+
+    TDynArray<UniquePtr<PackFileSystem::MountedPack>> PackFileSystem::s_Packs;
+
+    bool PackFileSystem::Mount(const OpaaxString& InAbsPath)
+    {
+        UniquePtr<MountedPack> lPack = MakeUnique<MountedPack>();
+        lPack->Path = InAbsPath;
+        if (!lPack->File.Open(InAbsPath.CStr()))
+        {
+            OPAAX_CORE_ERROR("PackFileSystem: cannot open pack '{}'", InAbsPath);
+            return false;
+        }
+
+        // Validate everything Find will trust: header, TOC bounds, every blob's bounds + alignment.
+        const Uint8* lBase = lPack->File.GetData();
+        const Uint64 lSize = lPack->File.GetSize();
+        if (lSize < sizeof(AssetPackHeader))
+        {
+            OPAAX_CORE_ERROR("PackFileSystem: '{}' is too small to be a pack", InAbsPath);
+            return false;
+        }
+
+        const auto* lHeader = reinterpret_cast<const AssetPackHeader*>(lBase);
+        if (lHeader->Magic != AssetPackMagic || lHeader->Version != AssetPackVersion)
+        {
+            OPAAX_CORE_ERROR("PackFileSystem: '{}' is not a v{} pack (magic {:#x}, version {})",
+                InAbsPath, AssetPackVersion, lHeader->Magic, lHeader->Version);
+            return false;
+        }
+
+        const Uint64 lTocBytes = static_cast<Uint64>(lHeader->TocCapacity) * sizeof(AssetPackTocEntry);
+        if (lHeader->FileSize != lSize || !std::has_single_bit(lHeader->TocCapacity)
+            || lHeader->TocOffset % AssetPackAlignment != 0 || lHeader->TocOffset > lSize
+            || lTocBytes > lSize - lHeader->TocOffset)
+        {
+            OPAAX_CORE_ERROR("PackFileSystem: '{}' has a truncated or corrupt table of contents", InAbsPath);
+            return false;
+        }
+
+        lPack->Toc         = reinterpret_cast<const AssetPackTocEntry*>(lBase + lHeader->TocOffset);
+        lPack->TocCapacity = lHeader->TocCapacity;
+
+        Uint32 lEntries = 0;
+        for (Uint32 i = 0; i < lPack->TocCapacity; ++i)
+        {
+            const AssetPackTocEntry& lEntry = lPack->Toc[i];
+            if (lEntry.Key == 0) { continue; }
+
+            ++lEntries;
+            if (lEntry.Offset % AssetPackAlignment != 0 || lEntry.Offset > lHeader->TocOffset
+                || lEntry.Size > lHeader->TocOffset - lEntry.Offset)
+            {
+                OPAAX_CORE_ERROR("PackFileSystem: '{}' entry {:#x} points outside the pack", InAbsPath, lEntry.Key);
+                return false;
+            }
+        }
+        if (lEntries != lHeader->EntryCount)
+        {
+            OPAAX_CORE_ERROR("PackFileSystem: '{}' lists {} entries, TOC holds {}", InAbsPath, lHeader->EntryCount, lEntries);
+            return false;
+        }
+
+        OPAAX_CORE_INFO("PackFileSystem: mounted '{}' ({} assets, {} KiB)", InAbsPath, lEntries, lSize / 1024u);
+        s_Packs.push_back(Move(lPack));
+        return true;
+    }
+
+    void PackFileSystem::UnmountAll() noexcept
+    {
+        s_Packs.clear();
+    }
+
+    AssetPackBlob PackFileSystem::Find(OpaaxStringID InCanonicalID) noexcept
+    {
+        if (!InCanonicalID.IsValid() || s_Packs.empty()) { return {}; }
+
+        // Keyed by the ID string, not its intern index — the cooker interned in a different order.
+        const Uint64 lKey = AssetPackKey(InCanonicalID.ToString().CStr());
+
+        for (auto lIt = s_Packs.rbegin(); lIt != s_Packs.rend(); ++lIt)
+        {
+            const MountedPack& lPack = **lIt;
+            if (const AssetPackTocEntry* lEntry = AssetPackFindEntry(lPack.Toc, lPack.TocCapacity, lKey))
+            {
+                return { lPack.File.GetData() + lEntry->Offset, lEntry->Size,
+                         static_cast<EAssetPackFormat>(lEntry->Format) };
+            }
+        }
+        return {};
+    }
+
+    Uint32 PackFileSystem::GetMountCount() noexcept
+    {
+        return static_cast<Uint32>(s_Packs.size());
+    }
+
+} // namespace Opaax
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Assets/Pack/AssetPack.h"
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxString.hpp"
+#include "Core/OpaaxStringID.hpp"
+
+namespace Opaax
+{
+    /**
+     * @class PackFileSystem
+     *
+     * Runtime side of cooked asset packs (AssetPack.h). Mount memory-maps a pack and validates
+     * its header + TOC; Find hands loaders a zero-copy AssetPackBlob straight out of the
+     * mapping, keyed by the asset's canonical ID. Nothing is read until a blob is touched —
+     * the OS pages it in.
+     *
+     * Several packs may be mounted; the most recently mounted wins, so a patch pack shadows
+     * the base one. Mount / UnmountAll are main-thread, outside any load; Find is read-only
+     * and safe from asset workers. CoreEngineApp mounts assets.pack (engine.config.json) at
+     * startup and unmounts after AssetRegistry::Shutdown.
+     *
+     * Usage:
+     *  PackFileSystem::Mount(OpaaxPath::ToAbsolute("Assets.opak"));
+     *  if (const AssetPackBlob lBlob = PackFileSystem::Find(lCanonicalID)) { ... lBlob.Data ... }
+     */
+    class OPAAX_API PackFileSystem
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /** Map InAbsPath and add it on top of the mounted packs. False (logged) if missing or malformed. */
+        static bool Mount(const OpaaxString& InAbsPath);
+
+        /** Unmap every pack. Every AssetPackBlob handed out before is dangling afterwards. */
+        static void UnmountAll() noexcept;
+
+        /** The cooked blob for InCanonicalID, or an empty blob if no mounted pack has it. */
+        static AssetPackBlob Find(OpaaxStringID InCanonicalID) noexcept;
+
+        static Uint32 GetMountCount() noexcept;
+
+    private:
+        struct MountedPack;
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        static TDynArray<UniquePtr<MountedPack>> s_Packs;   // mount order; Find walks it backwards
+    };
+
+} // namespace Opaax
@@ -0,0 +1,318 @@
+#include "TextureCook.h"
+
+#include "Core/Log/OpaaxLog.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace Opaax
+{
+    namespace
+    {
+        FORCEINLINE Uint16 PackRGB565(Int32 InR, Int32 InG, Int32 InB)
+        {
+            return static_cast<Uint16>(((InR >> 3) << 11) | ((InG >> 2) << 5) | (InB >> 3));
+        }
+
+        // Expand back to 8 bits the way the hardware does (bit replication), so palette
+        // distances are measured against what will actually be sampled.
+        FORCEINLINE void UnpackRGB565(Uint16 InColor, Int32 OutRGB[3])
+        {
+            const Int32 lR = (InColor >> 11) & 31;
+            const Int32 lG = (InColor >> 5) & 63;
+            const Int32 lB = InColor & 31;
+            OutRGB[0] = (lR << 3) | (lR >> 2);
+            OutRGB[1] = (lG << 2) | (lG >> 4);
+            OutRGB[2] = (lB << 3) | (lB >> 2);
+        }
+
+        FORCEINLINE void WriteLE16(Uint8* OutBytes, Uint16 InValue)
+        {
+            OutBytes[0] = static_cast<Uint8>(InValue & 0xFF);
+            OutBytes[1] = static_cast<Uint8>(InValue >> 8);
+        }
+
+        // 4-colour BC1 block (the colour half of BC3 too): endpoints from the inset bounding box.
+        void EncodeColorBlock(const Uint8* InTexels, Uint8* OutBlock)
+        {
+            Int32 lMin[3] = { 255, 255, 255 };
+            Int32 lMax[3] = { 0, 0, 0 };
+            for (Uint32 i = 0; i < 16; ++i)
+            {
+                for (Uint32 c = 0; c < 3; ++c)
+                {
+                    lMin[c] = std::min<Int32>(lMin[c], InTexels[i * 4 + c]);
+                    lMax[c] = std::max<Int32>(lMax[c], InTexels[i * 4 + c]);
+                }
+            }
+
+            // Pull both ends in by 1/16 of the range — the palette then straddles the block's
+            // colours instead of sitting on its outliers.
+            for (Uint32 c = 0; c < 3; ++c)
+            {
+                const Int32 lInset = (lMax[c] - lMin[c]) >> 4;
+                lMin[c] += lInset;
+                lMax[c] -= lInset;
+            }
+
+            Uint16 lColor0 = PackRGB565(lMax[0], lMax[1], lMax[2]);
+            Uint16 lColor1 = PackRGB565(lMin[0], lMin[1], lMin[2]);
+            if (lColor0 < lColor1) { std::swap(lColor0, lColor1); }   // color0 > color1 = 4-colour mode
+
+            WriteLE16(OutBlock + 0, lColor0);
+            WriteLE16(OutBlock + 2, lColor1);
+
+            Uint32 lIndices = 0;
+            if (lColor0 != lColor1)
+            {
+                Int32 lPalette[4][3];
+                UnpackRGB565(lColor0, lPalette[0]);
+                UnpackRGB565(lColor1, lPalette[1]);
+                for (Uint32 c = 0; c < 3; ++c)
+                {
+                    lPalette[2][c] = (2 * lPalette[0][c] + lPalette[1][c]) / 3;
+                    lPalette[3][c] = (lPalette[0][c] + 2 * lPalette[1][c]) / 3;
+                }
+
+                for (Uint32 i = 0; i < 16; ++i)
+                {
+                    Uint32 lBest     = 0;
+                    Int32  lBestDist = INT32_MAX;
+                    for (Uint32 p = 0; p < 4; ++p)
+                    {
+                        const Int32 lDR   = InTexels[i * 4 + 0] - lPalette[p][0];
+                        const Int32 lDG   = InTexels[i * 4 + 1] - lPalette[p][1];
+                        const Int32 lDB   = InTexels[i * 4 + 2] - lPalette[p][2];
+                        const Int32 lDist = lDR * lDR + lDG * lDG + lDB * lDB;
+                        if (lDist < lBestDist) { lBestDist = lDist; lBest = p; }
+                    }
+                    lIndices |= lBest << (i * 2);
+                }
+            }
+
+            OutBlock[4] = static_cast<Uint8>(lIndices);
+            OutBlock[5] = static_cast<Uint8>(lIndices >> 8);
+            OutBlock[6] = static_cast<Uint8>(lIndices >> 16);
+            OutBlock[7] = static_cast<Uint8>(lIndices >> 24);
+        }
+
+        // BC3 alpha half: alpha0 = max > alpha1 = min selects the 8-value ramp, 3-bit indices.
+        void EncodeAlphaBlock(const Uint8* InTexels, Uint8* OutBlock)
+        {
+            Int32 lMin = 255;
+            Int32 lMax = 0;
+            for (Uint32 i = 0; i < 16; ++i)
+            {
+                lMin = std::min<Int32>(lMin, InTexels[i * 4 + 3]);
+                lMax = std::max<Int32>(lMax, InTexels[i * 4 + 3]);
+            }
+
+            OutBlock[0] = static_cast<Uint8>(lMax);
+            OutBlock[1] = static_cast<Uint8>(lMin);
+
+            Uint64 lIndices = 0;
+            if (lMax != lMin)
+            {
+                Int32 lPalette[8];
+                lPalette[0] = lMax;
+                lPalette[1] = lMin;
+                for (Int32 p = 2; p < 8; ++p)
+                {
+                    lPalette[p] = ((8 - p) * lMax + (p - 1) * lMin) / 7;
+                }
+
+                for (Uint32 i = 0; i < 16; ++i)
+                {
+                    Uint64 lBest     = 0;
+                    Int32  lBestDist = INT32_MAX;
+                    for (Uint32 p = 0; p < 8; ++p)
+                    {
+                        const Int32 lDist = std::abs(InTexels[i * 4 + 3] - lPalette[p]);
+                        if (lDist < lBestDist) { lBestDist = lDist; lBest = p; }
+                    }
+                    lIndices |= lBest << (i * 3);
+                }
+            }
+
+            for (Uint32 b = 0; b < 6; ++b)
+            {
+                OutBlock[2 + b] = static_cast<Uint8>(lIndices >> (b * 8));
+            }
+        }
+
+        // Next level down: 2x2 box filter, edge texels clamped so odd extents stay in bounds.
+        void Downsample(const Uint8* InSrc, Uint32 InWidth, Uint32 InHeight,
+                        Uint32 InDstWidth, Uint32 InDstHeight, Uint8* OutDst)
+        {
+            for (Uint32 y = 0; y < InDstHeight; ++y)
+            {
+                const Uint32 lY0 = std::min(y * 2, InHeight - 1);
+                const Uint32 lY1 = std::min(y * 2 + 1, InHeight - 1);
+                for (Uint32 x = 0; x < InDstWidth; ++x)
+                {
+                    const Uint32 lX0 = std::min(x * 2, InWidth - 1);
+                    const Uint32 lX1 = std::min(x * 2 + 1, InWidth - 1);
+                    for (Uint32 c = 0; c < 4; ++c)
+                    {
+                        const Uint32 lSum = InSrc[(lY0 * InWidth + lX0) * 4 + c] + InSrc[(lY0 * InWidth + lX1) * 4 + c]
+                                          + InSrc[(lY1 * InWidth + lX0) * 4 + c] + InSrc[(lY1 * InWidth + lX1) * 4 + c];
+                        OutDst[(y * InDstWidth + x) * 4 + c] = static_cast<Uint8>((lSum + 2) / 4);
+                    }
+                }
+            }
+        }
+
+        // Append one RGBA8 level to OutBlob in InFormat.
+        void EmitLevel(const Uint8* InRGBA, Uint32 InWidth, Uint32 InHeight, ETextureFormat InFormat,
+                       TDynArray<Uint8>& OutBlob)
+        {
+            const size_t lStart = OutBlob.size();
+            OutBlob.resize(lStart + static_cast<size_t>(GetTextureLevelSize(InFormat, InWidth, InHeight)));
+            Uint8* lDst = OutBlob.data() + lStart;
+
+            if (!IsBlockCompressed(InFormat))
+            {
+                std::memcpy(lDst, InRGBA, static_cast<size_t>(InWidth) * InHeight * 4u);
+                return;
+            }
+
+            const Uint32 lBlockBytes = InFormat == ETextureFormat::BC1 ? 8u : 16u;
+            Uint8        lTexels[16 * 4];
+            for (Uint32 lBY = 0; lBY < InHeight; lBY += 4)
+            {
+                for (Uint32 lBX = 0; lBX < InWidth; lBX += 4)
+                {
+                    // Gather the 4x4 block, repeating the last row / column past the edge.
+                    for (Uint32 y = 0; y < 4; ++y)
+                    {
+                        const Uint32 lY = std::min(lBY + y, InHeight - 1);
+                        for (Uint32 x = 0; x < 4; ++x)
+                        {
+                            const Uint32 lX = std::min(lBX + x, InWidth - 1);
+                            std::memcpy(&lTexels[(y * 4 + x) * 4], &InRGBA[(lY * InWidth + lX) * 4], 4);
+                        }
+                    }
+
+                    if (InFormat == ETextureFormat::BC1) { TextureCook::EncodeBC1Block(lTexels, lDst); }
+                    else                                 { TextureCook::EncodeBC3Block(lTexels, lDst); }
+                    lDst += lBlockBytes;
+                }
+            }
+        }
+    }
+
+    void TextureCook::EncodeBC1Block(const Uint8* InTexels, Uint8* OutBlock)
+    {
+        EncodeColorBlock(InTexels, OutBlock);
+    }
+
+    void TextureCook::EncodeBC3Block(const Uint8* InTexels, Uint8* OutBlock)
+    {
+        EncodeAlphaBlock(InTexels, OutBlock);
+        EncodeColorBlock(InTexels, OutBlock + 8);
+    }
+
+    bool TextureCook::Cook(const Uint8* InRGBA, Uint32 InWidth, Uint32 InHeight,
+                           const TextureCookSettings& InSettings, TDynArray<Uint8>& OutBlob)
+    {
+        OutBlob.clear();
+        if (!InRGBA || InWidth == 0 || InHeight == 0)
+        {
+            OPAAX_CORE_ERROR("TextureCook: empty image");
+            return false;
+        }
+
+        const size_t lTexels = static_cast<size_t>(InWidth) * InHeight;
+        TDynArray<Uint8> lLevel(InRGBA, InRGBA + lTexels * 4u);
+
+        bool lOpaque = true;
+        for (size_t i = 0; i < lTexels; ++i)
+        {
+            Uint8* lTexel = &lLevel[i * 4];
+            lOpaque = lOpaque && lTexel[3] == 255;
+
+            // Before filtering: averaging premultiplied texels is what keeps transparent
+            // neighbours from bleeding their (meaningless) colour into the mips.
+            if (InSettings.bPremultiplyAlpha)
+            {
+                for (Uint32 c = 0; c < 3; ++c)
+                {
+                    lTexel[c] = static_cast<Uint8>((lTexel[c] * lTexel[3] + 127) / 255);
+                }
+            }
+        }
+
+        const ETextureFormat lFormat = !InSettings.bCompress ? ETextureFormat::RGBA8
+                                     : lOpaque               ? ETextureFormat::BC1
+                                                             : ETextureFormat::BC3;
+
+        Uint32 lMipCount = 1;
+        if (InSettings.bGenerateMips)
+        {
+            while (lMipCount < MaxTextureMips && (InWidth >> lMipCount | InHeight >> lMipCount) != 0) { ++lMipCount; }
+        }
+
+        AssetPackTextureHeader lHeader;
+        lHeader.Width    = InWidth;
+        lHeader.Height   = InHeight;
+        lHeader.Format   = static_cast<Uint8>(lFormat);
+        lHeader.MipCount = static_cast<Uint8>(lMipCount);
+        lHeader.Flags    = InSettings.bPremultiplyAlpha ? AssetPackTextureFlag_Premultiplied : 0;
+
+        OutBlob.resize(sizeof(lHeader));
+        std::memcpy(OutBlob.data(), &lHeader, sizeof(lHeader));
+
+        TDynArray<Uint8> lNext;
+        Uint32 lWidth  = InWidth;
+        Uint32 lHeight = InHeight;
+        for (Uint32 lMip = 0; lMip < lMipCount; ++lMip)
+        {
+            EmitLevel(lLevel.data(), lWidth, lHeight, lFormat, OutBlob);
+            if (lMip + 1 == lMipCount) { break; }
+
+            const Uint32 lNextWidth  = GetTextureMipExtent(InWidth, lMip + 1);
+            const Uint32 lNextHeight = GetTextureMipExtent(InHeight, lMip + 1);
+            lNext.resize(static_cast<size_t>(lNextWidth) * lNextHeight * 4u);
+            Downsample(lLevel.data(), lWidth, lHeight, lNextWidth, lNextHeight, lNext.data());
+            lLevel.swap(lNext);
+            lWidth  = lNextWidth;
+            lHeight = lNextHeight;
+        }
+        return true;
+    }
+
+    bool TextureCook::Read(const AssetPackBlob& InBlob, TextureDesc& OutDesc, bool& OutPremultiplied)
+    {
+        if (!InBlob || InBlob.Format != EAssetPackFormat::CookedTexture || InBlob.Size < sizeof(AssetPackTextureHeader))
+        {
+            return false;
+        }
+
+        AssetPackTextureHeader lHeader;
+        std::memcpy(&lHeader, InBlob.Data, sizeof(lHeader));
+        if (lHeader.Width == 0 || lHeader.Height == 0 || lHeader.MipCount == 0 || lHeader.MipCount > MaxTextureMips
+            || lHeader.Format > static_cast<Uint8>(ETextureFormat::BC3))
+        {
+            return false;
+        }
+
+        OutDesc          = TextureDesc{};
+        OutDesc.Format   = static_cast<ETextureFormat>(lHeader.Format);
+        OutDesc.Width    = lHeader.Width;
+        OutDesc.Height   = lHeader.Height;
+        OutDesc.MipCount = lHeader.MipCount;
+        OutPremultiplied = (lHeader.Flags & AssetPackTextureFlag_Premultiplied) != 0;
+
+        Uint64 lOffset = sizeof(AssetPackTextureHeader);
+        for (Uint32 lMip = 0; lMip < OutDesc.MipCount; ++lMip)
+        {
+            OutDesc.Mips[lMip] = InBlob.Data + lOffset;
+            lOffset += GetTextureLevelSize(OutDesc.Format, GetTextureMipExtent(OutDesc.Width, lMip),
+                                           GetTextureMipExtent(OutDesc.Height, lMip));
+        }
+        return lOffset == InBlob.Size;
+    }
+
+} // namespace Opaax
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Assets/Pack/AssetPack.h"
+#include "Core/EngineAPI.h"
+#include "RHI/Texture.h"
+
+namespace Opaax
+{
+    /**
+     * @struct TextureCookSettings
+     * What the cooker does to a texture before it is packed. Defaults keep the pixels exact.
+     */
+    struct TextureCookSettings
+    {
+        bool bGenerateMips     = true;    // box-filtered chain down to 1x1
+        bool bCompress         = false;   // BC1 when fully opaque, BC3 otherwise
+        bool bPremultiplyAlpha = false;   // rgb *= a before filtering (draw with EBlendMode::PremultipliedAlpha)
+    };
+
+    /**
+     * @class TextureCook
+     *
+     * Offline half of the cooked texture path: RGBA8 in, an EAssetPackFormat::CookedTexture blob
+     * out (AssetPackTextureHeader + every level in its GPU format), so the runtime hands the
+     * mapped bytes straight to ITexture2D::Create(TextureDesc) — no decode, no mip generation.
+     *
+     * The BC1 / BC3 encoder is a plain range fit (bounding-box endpoints, nearest palette index):
+     * fast and dependency-free, not the best quality an offline encoder could reach.
+     */
+    class OPAAX_API TextureCook
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /**
+         * Cook InWidth x InHeight RGBA8 texels (rows bottom-up) into OutBlob, replacing its contents.
+         * False (logged) on an empty image.
+         */
+        static bool Cook(const Uint8* InRGBA, Uint32 InWidth, Uint32 InHeight,
+                         const TextureCookSettings& InSettings, TDynArray<Uint8>& OutBlob);
+
+        /**
+         * View a CookedTexture blob as a TextureDesc pointing into it (valid while the blob is).
+         * False if it is another format or its size does not match its header.
+         */
+        static bool Read(const AssetPackBlob& InBlob, TextureDesc& OutDesc, bool& OutPremultiplied);
+
+        // One 4x4 block of RGBA8 texels (row-major) -> 8 bytes of BC1 / 16 bytes of BC3.
+        static void EncodeBC1Block(const Uint8* InTexels, Uint8* OutBlock);
+        static void EncodeBC3Block(const Uint8* InTexels, Uint8* OutBlock);
+    };
+
+} // namespace Opaax
@@ -1,6 +1,7 @@
 #include "EngineConfig.h"
 
 #include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxPath.h"
 
 #include <filesystem>
 #include <fstream>
@@ -16,11 +17,22 @@ namespace Opaax
     Uint32      EngineConfig::s_WindowHeight          = 720;
     OpaaxString EngineConfig::s_EngineAssetsRoot      = OpaaxString("Engine/Assets");
     OpaaxString EngineConfig::s_EngineManifestRelPath = OpaaxString("Engine/Assets/AssetManifest.json");
+    OpaaxString EngineConfig::s_CacheRelPath          = OpaaxString("Intermediate/Cache");
+    OpaaxString EngineConfig::s_AssetPackRelPath      = {};
+    Uint32      EngineConfig::s_AssetCacheBudgetMB    = 0;
+    Uint32      EngineConfig::s_AssetCacheEvictFrames = 300;
     OpaaxString EngineConfig::s_LogLevel              = OpaaxString("trace");
     OpaaxString EngineConfig::s_RenderBackend         = OpaaxString("OpenGL");
     bool        EngineConfig::s_RenderInterpolation   = true;
     bool        EngineConfig::s_RenderStats           = false;
     Uint32      EngineConfig::s_VulkanFrameRing       = 64;
+    Uint32      EngineConfig::s_VulkanFrameArenaKB    = 4096;
+    Uint32      EngineConfig::s_TextureBudgetMB       = 0;
+    Uint32      EngineConfig::s_TextureEvictFrames    = 600;
+    bool        EngineConfig::s_ParallelPassRecording = false;
+    Uint32      EngineConfig::s_NullFrameLimit        = 0;
+    bool        EngineConfig::s_NullRecordCommands    = false;
+    bool        EngineConfig::s_FontDistanceField     = false;
     OpaaxString EngineConfig::s_PhysicsBackend        = OpaaxString("Box2D");
     bool        EngineConfig::s_PhysicsWorldBoundsEnabled  = false;
     Vector2F    EngineConfig::s_PhysicsWorldBoundsMin      = { -100000.f, -100000.f };
@@ -51,14 +63,25 @@ namespace Opaax
             };
             lRoot["assets"] = {
                 { "engineRoot",     s_EngineAssetsRoot.CStr()      },
-                { "engineManifest", s_EngineManifestRelPath.CStr() }
+                { "engineManifest", s_EngineManifestRelPath.CStr() },
+                { "cacheDir",       s_CacheRelPath.CStr()          },
+                { "pack",           s_AssetPackRelPath.CStr()      },
+                { "cacheBudgetMB",  s_AssetCacheBudgetMB           },
+                { "cacheEvictFrames", s_AssetCacheEvictFrames      }
             };
             lRoot["log"]    = { { "level",   s_LogLevel.CStr()      } };
             lRoot["render"]  = {
                 { "backend",        s_RenderBackend.CStr() },
                 { "interpolation",  s_RenderInterpolation  },
                 { "stats",          s_RenderStats          },
-                { "vulkanFrameRing", s_VulkanFrameRing     }
+                { "vulkanFrameRing", s_VulkanFrameRing     },
+                { "vulkanFrameArenaKB", s_VulkanFrameArenaKB },
+                { "textureBudgetMB", s_TextureBudgetMB     },
+                { "textureEvictFrames", s_TextureEvictFrames },
+                { "parallelPassRecording", s_ParallelPassRecording },
+                { "nullFrameLimit",  s_NullFrameLimit      },
+                { "nullRecordCommands", s_NullRecordCommands },
+                { "fontDistanceField", s_FontDistanceField }
             };
             lRoot["physics"] = {
                 { "backend", s_PhysicsBackend.CStr() },
@@ -139,6 +162,22 @@ namespace Opaax
             {
                 s_EngineManifestRelPath = OpaaxString(lA["engineManifest"].get<std::string>().c_str());
             }
+            if (lA.contains("cacheDir")       && lA["cacheDir"].is_string())
+            {
+                s_CacheRelPath = OpaaxString(lA["cacheDir"].get<std::string>().c_str());
+            }
+            if (lA.contains("pack")           && lA["pack"].is_string())
+            {
+                s_AssetPackRelPath = OpaaxString(lA["pack"].get<std::string>().c_str());
+            }
+            if (lA.contains("cacheBudgetMB")  && lA["cacheBudgetMB"].is_number_unsigned())
+            {
+                s_AssetCacheBudgetMB = lA["cacheBudgetMB"].get<Uint32>();
+            }
+            if (lA.contains("cacheEvictFrames") && lA["cacheEvictFrames"].is_number_unsigned())
+            {
+                s_AssetCacheEvictFrames = lA["cacheEvictFrames"].get<Uint32>();
+            }
         }
 
         if (lRoot.contains("log") && lRoot["log"].is_object())
@@ -169,6 +208,34 @@ namespace Opaax
             {
                 s_VulkanFrameRing = lR["vulkanFrameRing"].get<Uint32>();
             }
+            if (lR.contains("vulkanFrameArenaKB") && lR["vulkanFrameArenaKB"].is_number_unsigned())
+            {
+                s_VulkanFrameArenaKB = lR["vulkanFrameArenaKB"].get<Uint32>();
+            }
+            if (lR.contains("textureBudgetMB") && lR["textureBudgetMB"].is_number_unsigned())
+            {
+                s_TextureBudgetMB = lR["textureBudgetMB"].get<Uint32>();
+            }
+            if (lR.contains("textureEvictFrames") && lR["textureEvictFrames"].is_number_unsigned())
+            {
+                s_TextureEvictFrames = lR["textureEvictFrames"].get<Uint32>();
+            }
+            if (lR.contains("parallelPassRecording") && lR["parallelPassRecording"].is_boolean())
+            {
+                s_ParallelPassRecording = lR["parallelPassRecording"].get<bool>();
+            }
+            if (lR.contains("nullFrameLimit") && lR["nullFrameLimit"].is_number_unsigned())
+            {
+                s_NullFrameLimit = lR["nullFrameLimit"].get<Uint32>();
+            }
+            if (lR.contains("nullRecordCommands") && lR["nullRecordCommands"].is_boolean())
+            {
+                s_NullRecordCommands = lR["nullRecordCommands"].get<bool>();
+            }
+            if (lR.contains("fontDistanceField") && lR["fontDistanceField"].is_boolean())
+            {
+                s_FontDistanceField = lR["fontDistanceField"].get<bool>();
+            }
         }
 
         if (lRoot.contains("physics") && lRoot["physics"].is_object())
@@ -209,6 +276,18 @@ namespace Opaax
         return true;
     }
 
+    OpaaxString EngineConfig::CacheDirectory(const char* InSubDir)
+    {
+        if (s_CacheRelPath.IsEmpty() || (OpaaxPath::GetBasePath().IsEmpty() && !OpaaxPath::HasProjectRoot()))
+        {
+            return {};
+        }
+        OpaaxString lDir = OpaaxPath::ToAbsolute(s_CacheRelPath);
+        lDir += "/";
+        lDir += InSubDir;
+        return lDir;
+    }
+
     bool EngineConfig::Save()
     {
         if (s_LoadedPath.IsEmpty())
@@ -243,14 +322,25 @@ namespace Opaax
             };
             lRoot["assets"] = {
                 { "engineRoot",     s_EngineAssetsRoot.CStr()      },
-                { "engineManifest", s_EngineManifestRelPath.CStr() }
+                { "engineManifest", s_EngineManifestRelPath.CStr() },
+                { "cacheDir",       s_CacheRelPath.CStr()          },
+                { "pack",           s_AssetPackRelPath.CStr()      },
+                { "cacheBudgetMB",  s_AssetCacheBudgetMB           },
+                { "cacheEvictFrames", s_AssetCacheEvictFrames      }
             };
             lRoot["log"]    = { { "level",   s_LogLevel.CStr()      } };
             lRoot["render"]  = {
                 { "backend",        s_RenderBackend.CStr() },
                 { "interpolation",  s_RenderInterpolation  },
                 { "stats",          s_RenderStats          },
-                { "vulkanFrameRing", s_VulkanFrameRing     }
+                { "vulkanFrameRing", s_VulkanFrameRing     },
+                { "vulkanFrameArenaKB", s_VulkanFrameArenaKB },
+                { "textureBudgetMB", s_TextureBudgetMB     },
+                { "textureEvictFrames", s_TextureEvictFrames },
+                { "parallelPassRecording", s_ParallelPassRecording },
+                { "nullFrameLimit",  s_NullFrameLimit      },
+                { "nullRecordCommands", s_NullRecordCommands },
+                { "fontDistanceField", s_FontDistanceField }
             };
             lRoot["physics"] = {
                 { "backend", s_PhysicsBackend.CStr() },
@@ -53,11 +53,29 @@ namespace Opaax
         static const OpaaxString& EngineAssetsRoot()      noexcept { return s_EngineAssetsRoot; }
         static const OpaaxString& EngineManifestRelPath() noexcept { return s_EngineManifestRelPath; }
 
+        // Root for derived, rebuildable data (baked font atlases, ...), relative to the project root.
+        // Safe to delete at any time. Empty disables every on-disk cache.
+        static const OpaaxString& CacheRelPath()          noexcept { return s_CacheRelPath; }
+
+        // Absolute <CacheRelPath>/<InSubDir> (e.g. "Fonts", "Vulkan"), or empty when caching is
+        // disabled or OpaaxPath is not initialised yet (tools/benchmarks — would otherwise root at "/").
+        static OpaaxString        CacheDirectory(const char* InSubDir);
+
+        // Cooked asset pack (OpaaxAssetCook output), relative to the project root. Mounted at
+        // startup when set and present; its assets are read from the mapping instead of loose files.
+        static const OpaaxString& AssetPackRelPath()      noexcept { return s_AssetPackRelPath; }
+
+        // AssetRegistry cache budget in MiB (default 0 = unlimited). Over budget, assets with no
+        // live handle for AssetCacheEvictFrames frames are freed (least recently referenced first)
+        // and read back from disk on their next Load.
+        static Uint32             AssetCacheBudgetMB()    noexcept { return s_AssetCacheBudgetMB; }
+        static Uint32             AssetCacheEvictFrames() noexcept { return s_AssetCacheEvictFrames; }
+
         // ---- Logging --------------------------------------------------------
         static const OpaaxString& LogLevel() noexcept { return s_LogLevel; }
 
         // ---- Render ---------------------------------------------------------
-        // Graphics backend name ("OpenGL" today). Kept as a string here so Core/Config
+        // Graphics backend name ("OpenGL" | "Vulkan" | "Null"). Kept as a string here so Core/Config
         // carries no dependency on RHI — RHI maps this to its EBackend enum.
         static const OpaaxString& RenderBackend() noexcept { return s_RenderBackend; }
 
@@ -74,11 +92,37 @@ namespace Opaax
         // milestone — this flag is the startup default until then.
         static bool                RenderStats() noexcept { return s_RenderStats; }
 
-        // Vulkan per-frame descriptor/UBO ring depth (default 64). Bounds how many Renderer2D batch
-        // flushes one frame can record before the ring fails loud (it never wraps onto a referenced
-        // descriptor set). OpenGL ignores it.
+        // Vulkan per-frame descriptor ring depth (default 64). Descriptor sets are allocated in
+        // pages of this size and chain on demand, so it only pre-sizes the batch count. OpenGL
+        // ignores it.
         static Uint32              VulkanFrameRing() noexcept { return s_VulkanFrameRing; }
 
+        // Vulkan per-frame linear allocator page size in KiB (default 4096). Dynamic vertex + UBO
+        // data for a frame is sub-allocated from it; a frame that outgrows a page chains another,
+        // so this only pre-sizes. OpenGL ignores it.
+        static Uint32              VulkanFrameArenaKB() noexcept { return s_VulkanFrameArenaKB; }
+
+        // GPU budget for disk-loaded textures in MiB (default 0 = unlimited). Over budget, textures
+        // not drawn for TextureEvictFrames frames drop their GPU copy (least recently drawn first)
+        // and re-upload from disk the next time they are drawn.
+        static Uint32              TextureBudgetMB() noexcept { return s_TextureBudgetMB; }
+        static Uint32              TextureEvictFrames() noexcept { return s_TextureEvictFrames; }
+
+        // Record render passes that allow it on job workers into secondary command buffers, replayed
+        // in pass order (default off). Only on backends with secondary recorders (Vulkan, Null).
+        static bool                ParallelPassRecording() noexcept { return s_ParallelPassRecording; }
+
+        // Null (headless) backend: frames to run before the context requests close (default 0 =
+        // run until killed) — lets CI/benchmarks run a scene for a fixed frame count.
+        static Uint32              NullFrameLimit() noexcept { return s_NullFrameLimit; }
+
+        // Null backend: keep the full per-frame command list, not just counters (default off).
+        static bool                NullRecordCommands() noexcept { return s_NullRecordCommands; }
+
+        // Bake fonts loaded through the registry as signed distance fields (default off): one atlas
+        // stays sharp at every DrawParams::Scale, so mixed-size UI shares a single font texture.
+        static bool                FontDistanceField() noexcept { return s_FontDistanceField; }
+
         // ---- Physics --------------------------------------------------------
         // Physics backend name ("Box2D" today). String here so Core/Config carries no
         // dependency on Physics — Physics maps this to its EPhysicsBackend enum.
@@ -101,11 +145,22 @@ namespace Opaax
         static Uint32      s_WindowHeight;
         static OpaaxString s_EngineAssetsRoot;
         static OpaaxString s_EngineManifestRelPath;
+        static OpaaxString s_CacheRelPath;
+        static OpaaxString s_AssetPackRelPath;
+        static Uint32      s_AssetCacheBudgetMB;
+        static Uint32      s_AssetCacheEvictFrames;
         static OpaaxString s_LogLevel;
         static OpaaxString s_RenderBackend;
         static bool        s_RenderInterpolation;
         static bool        s_RenderStats;
         static Uint32      s_VulkanFrameRing;
+        static Uint32      s_VulkanFrameArenaKB;
+        static Uint32      s_TextureBudgetMB;
+        static Uint32      s_TextureEvictFrames;
+        static bool        s_ParallelPassRecording;
+        static Uint32      s_NullFrameLimit;
+        static bool        s_NullRecordCommands;
+        static bool        s_FontDistanceField;
         static OpaaxString s_PhysicsBackend;
         static bool        s_PhysicsWorldBoundsEnabled;
         static Vector2F    s_PhysicsWorldBoundsMin;
@@ -16,6 +16,7 @@
 #include "Assets/Loader/ShaderLoader.h"
 #include "Assets/Loader/TextureLoader.h"
 #include "Assets/Loader/CollisionProfileLoader.h"
+#include "Assets/Pack/PackFileSystem.h"
 #include "Physics/Collision/CollisionProfile.h"
 #include "Renderer/Text/FontAsset.h"
 #include "RHI/RenderCommand.h"
@@ -25,6 +26,7 @@
 #include "Editor/EditorSubsystem.h"
 #include "Event/OpaaxEventDispatcher.hpp"
 #include "Input/InputSubsystem.h"
+#include "IO/IOSubsystem.h"
 #include "Jobs/JobSubsystem.h"
 #include "Log/OpaaxLog.h"
 #include "Container/TPolymorphicList.hpp"
@@ -32,6 +34,7 @@
 #include "Renderer/Renderer2D.h"
 #include "Renderer/RenderSubsystem.h"
 #include "Renderer/ShaderAsset.h"
+#include "Renderer/TextureResidency.h"
 #include "Renderer/Systems/WorldSubsystem.h"
 #include "RHI/RenderCommand.h"
 #include "Scene/Scene.h"
@@ -223,7 +226,7 @@ void CoreEngineApp::Initialize()
 
     AssetLoaderRegistry::Register<Texture2D>(MakeUnique<TextureLoader>());
     AssetLoaderRegistry::Register<SceneAsset>(MakeUnique<SceneLoader>());
-    AssetLoaderRegistry::Register<FontAsset>(MakeUnique<FontLoader>());
+    AssetLoaderRegistry::Register<FontAsset>(MakeUnique<FontLoader>(this));   // bakes on JobSubsystem
     AssetLoaderRegistry::Register<ShaderAsset>(MakeUnique<ShaderLoader>());
     AssetLoaderRegistry::Register<CollisionProfile>(MakeUnique<CollisionProfileLoader>());
 
@@ -253,12 +256,26 @@ void CoreEngineApp::Initialize()
 
     AssetManifest::LoadFile(lEngineManifest);
     AssetManifest::LoadFile(lProjectManifest);
+
+    // Cooked pack (OpaaxAssetCook): loaders read packed assets from the mapping from here on.
+    // Absent (dev / editor runs) just means loose files, as before.
+    if (!EngineConfig::AssetPackRelPath().IsEmpty())
+    {
+        const OpaaxString lPack = OpaaxPath::ToAbsolute(EngineConfig::AssetPackRelPath());
+        std::error_code   lPackEc;
+        if (std::filesystem::exists(lPack.CStr(), lPackEc)) { PackFileSystem::Mount(lPack); }
+        else { OPAAX_CORE_WARN("CoreEngineApp: asset pack '{}' not found — loading loose files.", lPack); }
+    }
     
     // JobSubsystem registered FIRST — its per-frame drain (Update) then runs at the
     // start of every frame, and reverse-order shutdown joins its workers LAST, after
     // every other subsystem has stopped issuing jobs.
     m_EngineSubsystemManager.RegisterSubsystem<JobSubsystem>(this);
 
+    // IOSubsystem right behind it: read completions drain second thing in the frame (their
+    // decode jobs go straight to the workers), and its IO threads stop just before the workers.
+    m_EngineSubsystemManager.RegisterSubsystem<IOSubsystem>(this);
+
     m_EngineSubsystemManager.RegisterSubsystem<RenderSubsystem>(this);
 
     // World subsystem owns the world-render-system list (replaces the DLL-broken static
@@ -299,6 +316,12 @@ void CoreEngineApp::Startup()
     m_EngineSubsystemManager.StartupAll();
     m_GameSubsystemMgr.StartupAll();
 
+    // Workers are up — AssetRegistry::LoadAsync decodes on them from here on.
+    AssetRegistry::SetJobSystem(GetSubsystem<JobSubsystem>());
+    AssetRegistry::SetIOSystem(GetSubsystem<IOSubsystem>());   // LoadAsync file reads go through IO
+    AssetRegistry::SetCacheBudget(static_cast<Uint64>(EngineConfig::AssetCacheBudgetMB()) * 1024ull * 1024ull,
+                                  EngineConfig::AssetCacheEvictFrames());
+
     OnStartup();
 
 #if OPAAX_WITH_EDITOR
@@ -417,6 +440,8 @@ void CoreEngineApp::Run()
         // Frame bracket — backend-neutral. OpenGL: near-empty. Vulkan: acquire+record / submit.
         RenderCommand::BeginFrame();
         Renderer2D::NewFrame();   // publish last frame's render stats, zero the accumulator
+        TextureResidency::NewFrame();   // advance the draw clock, evict idle textures when over budget
+        AssetRegistry::UpdateCache();   // account assets per type, evict handle-free ones when over budget
         OnRender(lAlpha);
         m_EngineSubsystemManager.RenderAll(lAlpha);
         RenderCommand::EndFrame();
@@ -452,6 +477,9 @@ void CoreEngineApp::Shutdown()
     // A texture outliving its device makes Vulkan/VMA assert; on OpenGL it leaked silently.
     AssetRegistry::Shutdown();
 
+    // Every packed asset (and any blob a loader still viewed) died with the registry.
+    PackFileSystem::UnmountAll();
+
     // World-render systems (WorldSubsystem) and overlay systems (RenderSubsystem) are each cleared by
     // their owning subsystem's Shutdown during the reverse-order teardown below — while the render device
     // is still alive — so any GPU resource a system owns is freed before the device dies.
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "IOTypes.h"
+
+namespace Opaax
+{
+    /**
+     * @struct IORead
+     * One physical read, after coalescing. IOSubsystem owns it from queueing to FinishRead; the
+     * backend only fills Bytes / Status in between.
+     */
+    struct IORead
+    {
+        OpaaxString       AbsPath;
+        Uint64            Offset   = 0;
+        Uint64            Size     = IOWholeFile;
+        EIOPriority       Priority = EIOPriority::Normal;
+
+        // Backend output.
+        TDynArray<Uint8>  Bytes;
+        EIOStatus         Status   = EIOStatus::Pending;
+    };
+
+    /**
+     * @class IIOReadSource
+     * IOSubsystem's side of the backend contract. Both calls are thread-safe.
+     */
+    class IIOReadSource
+    {
+    public:
+        virtual ~IIOReadSource() = default;
+
+        /** Next queued read, highest priority first; nullptr when the queue is empty or stopping. */
+        virtual IORead* PopRead() = 0;
+
+        /** The backend is done with InRead (Status set, Bytes filled on Ok). Do not touch it afterwards. */
+        virtual void FinishRead(IORead* InRead) = 0;
+    };
+
+    /**
+     * @class IIOBackend
+     *
+     * Executes the reads IOSubsystem queues. A backend owns its own thread(s): it pops reads from
+     * the source whenever it has room, and finishes each exactly once.
+     */
+    class IIOBackend
+    {
+    public:
+        virtual ~IIOBackend() = default;
+
+        virtual const char* GetName() const noexcept = 0;
+
+        /** Start the backend's thread(s). False if it cannot run here — IOSubsystem falls back. */
+        virtual bool Startup(IIOReadSource& InSource) = 0;
+
+        /** Reads were queued (any thread). */
+        virtual void Notify() = 0;
+
+        /** Stop popping, finish every read already popped, join. Queued reads stay in the source. */
+        virtual void Shutdown() = 0;
+    };
+
+    /**
+     * Clamp InOutRead's range to a file of InFileSize bytes (IOWholeFile = to the end). False if
+     * Offset lies past the end.
+     */
+    inline bool IOClampReadRange(IORead& InOutRead, Uint64 InFileSize) noexcept
+    {
+        if (InOutRead.Offset > InFileSize) { return false; }
+        const Uint64 lAvailable = InFileSize - InOutRead.Offset;
+        InOutRead.Size = (InOutRead.Size == IOWholeFile || InOutRead.Size > lAvailable) ? lAvailable : InOutRead.Size;
+        return true;
+    }
+
+    /**
+     * Blocking read of InOutRead's range on the calling thread (open, size, positional reads until
+     * done). Shared by the thread-pool backend and IOSubsystem's no-backend inline path.
+     */
+    void IOReadBlocking(IORead& InOutRead);
+
+} // namespace Opaax
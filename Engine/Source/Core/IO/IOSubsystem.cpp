@@ -0,0 +1,323 @@
+#include "IOSubsystem.h"
+
+#include "IOThreadPoolBackend.h"
+#include "IOUringBackend.h"
+
+#include "Core/Log/OpaaxLog.h"
+
+#include <string_view>
+
+namespace Opaax
+{
+    size_t IOSubsystem::ReadKeyHash::operator()(const ReadKey& InKey) const noexcept
+    {
+        size_t lHash = std::hash<std::string_view>{}(std::string_view(InKey.Path.CStr()));
+        lHash ^= std::hash<Uint64>{}(InKey.Offset) + 0x9e3779b97f4a7c15ull + (lHash << 6) + (lHash >> 2);
+        lHash ^= std::hash<Uint64>{}(InKey.Size)   + 0x9e3779b97f4a7c15ull + (lHash << 6) + (lHash >> 2);
+        return lHash;
+    }
+
+    IOSubsystem::~IOSubsystem()
+    {
+        // The backend's threads call back into this object — stop them while it is still whole.
+        if (m_Backend) { Shutdown(); }
+    }
+
+    // =============================================================================
+    // Lifecycle
+    // =============================================================================
+
+    bool IOSubsystem::Startup()
+    {
+#if OPAAX_HAS_IO_URING
+        if (!m_bForceThreadPool)
+        {
+            UniquePtr<IIOBackend> lUring = MakeUnique<IOUringBackend>(m_QueueDepth);
+            if (lUring->Startup(*this)) { m_Backend = Move(lUring); }
+        }
+#endif
+
+        if (!m_Backend)
+        {
+            m_Backend = MakeUnique<IOThreadPoolBackend>(m_ThreadCount);
+            m_Backend->Startup(*this);
+        }
+
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            m_bAccepting = true;
+        }
+
+        OPAAX_CORE_INFO("IOSubsystem::Startup — {} backend", m_Backend->GetName());
+        return true;
+    }
+
+    void IOSubsystem::Update(double /*DeltaTime*/)
+    {
+        DrainCompleted();
+    }
+
+    void IOSubsystem::Shutdown()
+    {
+        if (!m_Backend) { return; }
+
+        // PopRead returns nothing from here on; the backend lands what it already popped.
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            m_bAccepting = false;
+        }
+        m_Backend->Shutdown();
+
+        // Whatever is left never reached the backend.
+        TDynArray<UniquePtr<PendingRead>> lCancelled;
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            for (auto& [lKey, lRead] : m_Reads) { lCancelled.push_back(Move(lRead)); }
+            m_Reads.clear();
+            m_Queued.clear();
+            for (TQueue<Uint64>& lQueue : m_Queues) { lQueue = {}; }
+        }
+        for (UniquePtr<PendingRead>& lRead : lCancelled)
+        {
+            lRead->Status = EIOStatus::Cancelled;
+            CompleteRead(*lRead, lRead->Waiters);
+        }
+
+        {
+            LockGuard<Mutex> lLock(m_CompletedMutex);
+            if (!m_Completed.empty())
+            {
+                OPAAX_CORE_WARN("IOSubsystem::Shutdown — {} completion callback(s) never drained", m_Completed.size());
+            }
+            m_Completed.clear();
+        }
+
+        OPAAX_CORE_INFO("IOSubsystem::Shutdown — {} backend stopped ({} cancelled)",
+                        m_Backend->GetName(), lCancelled.size());
+        m_Backend.reset();
+    }
+
+    // =============================================================================
+    // Requests
+    // =============================================================================
+
+    IORequestHandle IOSubsystem::Read(IOReadRequest InRequest)
+    {
+        IORequestHandle lHandle;
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            if (m_bAccepting)
+            {
+                lHandle = EnqueueLocked(Move(InRequest));
+                m_Backend->Notify();
+                return lHandle;
+            }
+        }
+
+        // No backend running — serve it here.
+        IORead lRead;
+        lRead.AbsPath = InRequest.AbsPath;
+        lRead.Offset  = InRequest.Offset;
+        lRead.Size    = InRequest.Size;
+        IOReadBlocking(lRead);
+
+        SharedPtr<IORequestState> lState = MakeShared<IORequestState>();
+        TDynArray<Waiter> lWaiters;
+        lWaiters.push_back(Waiter{ lState, Move(InRequest.OnComplete), EIOCompletionThread::IO });
+        CompleteRead(lRead, lWaiters);
+
+        return IORequestHandle{ Move(lState) };
+    }
+
+    TDynArray<IORequestHandle> IOSubsystem::ReadBatch(TDynArray<IOReadRequest> InRequests)
+    {
+        TDynArray<IORequestHandle> lHandles;
+        lHandles.reserve(InRequests.size());
+
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            if (m_bAccepting)
+            {
+                for (IOReadRequest& lRequest : InRequests) { lHandles.push_back(EnqueueLocked(Move(lRequest))); }
+                m_Backend->Notify();
+                return lHandles;
+            }
+        }
+
+        for (IOReadRequest& lRequest : InRequests) { lHandles.push_back(Read(Move(lRequest))); }
+        return lHandles;
+    }
+
+    void IOSubsystem::Wait(const IORequestHandle& InHandle)
+    {
+        const SharedPtr<IORequestState>& lState = InHandle.GetState();
+        if (!lState) { return; }
+
+        UniqueLock<Mutex> lLock(m_DoneMutex);
+        m_DoneCV.wait(lLock, [&lState] { return lState->bDone.load(std::memory_order_acquire); });
+    }
+
+    IOStats IOSubsystem::GetStats() const
+    {
+        LockGuard<Mutex> lLock(m_Mutex);
+        IOStats lStats = m_Stats;
+        lStats.Queued  = static_cast<Uint32>(m_Queued.size());
+        return lStats;
+    }
+
+    // =============================================================================
+    // IIOReadSource
+    // =============================================================================
+
+    IORead* IOSubsystem::PopRead()
+    {
+        LockGuard<Mutex> lLock(m_Mutex);
+        if (!m_bAccepting) { return nullptr; }
+
+        for (TQueue<Uint64>& lQueue : m_Queues)
+        {
+            while (!lQueue.empty())
+            {
+                const Uint64 lTicket = lQueue.front();
+                lQueue.pop();
+
+                auto lIt = m_Queued.find(lTicket);
+                if (lIt == m_Queued.end()) { continue; }   // bumped to a higher queue
+
+                PendingRead* lRead = lIt->second;
+                m_Queued.erase(lIt);
+                lRead->Ticket = 0;
+                ++m_Stats.InFlight;
+                return lRead;
+            }
+        }
+        return nullptr;
+    }
+
+    void IOSubsystem::FinishRead(IORead* InRead)
+    {
+        PendingRead* lPending = static_cast<PendingRead*>(InRead);
+
+        // Unlink first: a request arriving from now on starts a fresh read rather than joining
+        // one whose waiters were already collected.
+        UniquePtr<PendingRead> lOwned;
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            auto lIt = m_Reads.find(lPending->Key);
+            OPAAX_CORE_ASSERT(lIt != m_Reads.end() && lIt->second.get() == lPending)
+            lOwned = Move(lIt->second);
+            m_Reads.erase(lIt);
+
+            --m_Stats.InFlight;
+            ++m_Stats.Reads;
+            if (lPending->Status == EIOStatus::Ok) { m_Stats.BytesRead += lPending->Bytes.size(); }
+            else                                   { ++m_Stats.Failed; }
+        }
+
+        CompleteRead(*lOwned, lOwned->Waiters);
+    }
+
+    // =============================================================================
+    // Internal
+    // =============================================================================
+
+    IORequestHandle IOSubsystem::EnqueueLocked(IOReadRequest&& InRequest)
+    {
+        ++m_Stats.Requests;
+
+        SharedPtr<IORequestState> lState = MakeShared<IORequestState>();
+        Waiter lWaiter{ lState, Move(InRequest.OnComplete), InRequest.CompleteOn };
+
+        ReadKey lKey{ InRequest.AbsPath, InRequest.Offset, InRequest.Size };
+        auto lIt = m_Reads.find(lKey);
+        if (lIt != m_Reads.end())
+        {
+            PendingRead& lRead = *lIt->second;
+            lRead.Waiters.push_back(Move(lWaiter));
+            ++m_Stats.Coalesced;
+
+            // Still queued behind lower-priority work: move it up.
+            if (lRead.Ticket != 0 && InRequest.Priority < lRead.Priority)
+            {
+                m_Queued.erase(lRead.Ticket);
+                lRead.Priority = InRequest.Priority;
+                PushLocked(lRead);
+            }
+            return IORequestHandle{ Move(lState) };
+        }
+
+        UniquePtr<PendingRead> lRead = MakeUnique<PendingRead>();
+        lRead->AbsPath  = InRequest.AbsPath;
+        lRead->Offset   = InRequest.Offset;
+        lRead->Size     = InRequest.Size;
+        lRead->Priority = InRequest.Priority;
+        lRead->Key      = lKey;
+        lRead->Waiters.push_back(Move(lWaiter));
+
+        PushLocked(*lRead);
+        m_Reads.emplace(Move(lKey), Move(lRead));
+
+        return IORequestHandle{ Move(lState) };
+    }
+
+    void IOSubsystem::PushLocked(PendingRead& InRead)
+    {
+        InRead.Ticket = m_NextTicket++;
+        m_Queues[static_cast<Uint32>(InRead.Priority)].push(InRead.Ticket);
+        m_Queued.emplace(InRead.Ticket, &InRead);
+    }
+
+    void IOSubsystem::CompleteRead(IORead& InRead, TDynArray<Waiter>& InWaiters)
+    {
+        IOReadResult lResult;
+        lResult.Status = InRead.Status;
+        if (InRead.Status == EIOStatus::Ok)
+        {
+            lResult.Bytes = MakeShared<const TDynArray<Uint8>>(Move(InRead.Bytes));
+        }
+
+        // Callbacks first — IO ones run, Main ones are queued — so a completed handle always
+        // means its callback has run or will run in the next drain.
+        for (Waiter& lWaiter : InWaiters)
+        {
+            lWaiter.State->Result = lResult;
+            if (!lWaiter.OnComplete) { continue; }
+
+            if (lWaiter.CompleteOn == EIOCompletionThread::IO)
+            {
+                lWaiter.OnComplete(lResult);
+                continue;
+            }
+
+            LockGuard<Mutex> lLock(m_CompletedMutex);
+            m_Completed.push_back([lCallback = Move(lWaiter.OnComplete), lResult]
+            {
+                lCallback(lResult);
+            });
+        }
+
+        // Flip the done-flags under m_DoneMutex so a concurrent Wait can't miss the notify.
+        {
+            LockGuard<Mutex> lLock(m_DoneMutex);
+            for (Waiter& lWaiter : InWaiters) { lWaiter.State->bDone.store(true, std::memory_order_release); }
+        }
+        m_DoneCV.notify_all();
+    }
+
+    void IOSubsystem::DrainCompleted()
+    {
+        TDynArray<TFunction<void()>> lCallbacks;
+        {
+            LockGuard<Mutex> lLock(m_CompletedMutex);
+            if (m_Completed.empty()) { return; }
+            lCallbacks.swap(m_Completed);
+        }
+
+        // Invoke outside the lock so a callback may safely Read more.
+        for (TFunction<void()>& lCallback : lCallbacks)
+        {
+            if (lCallback) { lCallback(); }
+        }
+    }
+
+} // namespace Opaax
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Core/Systems/EngineSubsystem.h"
+#include "Core/OpaaxTypes.h"
+
+#include "IOBackend.h"
+#include "IOTypes.h"
+
+namespace Opaax
+{
+    /**
+     * @class IOSubsystem
+     *
+     * Engine-owned asynchronous file reads. Read queues [Offset, Offset + Size) of a file and
+     * returns at once; the bytes arrive on an IO-only backend, so a loader can keep hundreds of
+     * reads in flight without a single JobSubsystem worker blocked on the disk:
+     *   - io_uring on Linux (IOUringBackend) — one thread, up to SetQueueDepth reads in the kernel,
+     *   - elsewhere, or when the kernel refuses io_uring, a small pread thread pool (IOThreadPoolBackend).
+     *
+     * Priorities — queued reads start High first, then Normal, then Low. A request joining a queued
+     * read of higher priority bumps it.
+     * Coalescing — a request for the same path and range as a read still queued or in flight shares
+     * that read (and its bytes) instead of issuing another.
+     * Completion — every request gets its IORequestHandle completed; its optional OnComplete runs on
+     * the main thread during Update (the per-frame drain, as JobSubsystem) or, with
+     * EIOCompletionThread::IO, on the IO thread the moment the read lands. A handle reports complete
+     * only once its callback has run (IO) or been queued for the drain (Main); an IO-thread callback
+     * must not Wait on its own handle.
+     *
+     * Before Startup and after Shutdown, Read serves requests inline on the calling thread, callbacks
+     * included. Reads still queued at Shutdown complete Cancelled.
+     *
+     * Thread-safe: Read / ReadBatch / Wait / GetStats may be called from any thread. Registered
+     * right after JobSubsystem, so its drain runs early in the frame and it shuts down late.
+     */
+    class OPAAX_API IOSubsystem final : public EngineSubsystemBase, private IIOReadSource
+    {
+    public:
+        OPAAX_SUBSYSTEM_TYPE(IOSubsystem)
+
+        // =============================================================================
+        // CTORs - DTOR
+        // =============================================================================
+    public:
+        IOSubsystem() = default;
+        explicit IOSubsystem(CoreEngineApp* InEngineApp) : EngineSubsystemBase(InEngineApp) {}
+        ~IOSubsystem() override;
+
+        IOSubsystem(const IOSubsystem&)            = delete;
+        IOSubsystem& operator=(const IOSubsystem&) = delete;
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /** Queue one read. @return a handle to poll / Wait on; its result holds the bytes. */
+        IORequestHandle Read(IOReadRequest InRequest);
+
+        /**
+         * Queue several reads under one lock and wake the backend once — the way to issue a
+         * batch (a scene's dependencies, a streaming cell). Handles come back in request order.
+         */
+        TDynArray<IORequestHandle> ReadBatch(TDynArray<IOReadRequest> InRequests);
+
+        /**
+         * Block until the read behind InHandle has landed. No-op for a null/complete handle.
+         * Main-thread callbacks still wait for the next Update.
+         */
+        void Wait(const IORequestHandle& InHandle);
+
+        // =============================================================================
+        // Get - Set
+        // =============================================================================
+    public:
+        IOStats     GetStats() const;
+        const char* GetBackendName() const noexcept { return m_Backend ? m_Backend->GetName() : "Inline"; }
+
+        /** Reads the io_uring backend keeps in the kernel at once. Set BEFORE Startup. Defaults to 256. */
+        void SetQueueDepth(Uint32 InDepth) noexcept { m_QueueDepth = InDepth; }
+
+        /** Threads of the pread fallback. Set BEFORE Startup. Defaults to 4. */
+        void SetThreadCount(Uint32 InCount) noexcept { m_ThreadCount = InCount; }
+
+        /** Skip io_uring even where it is available (tests, profiling the fallback). Set BEFORE Startup. */
+        void SetForceThreadPool(bool bInForce) noexcept { m_bForceThreadPool = bInForce; }
+
+        // =============================================================================
+        // Override
+        // =============================================================================
+        //~Begin EngineSubsystemBase Interface
+    public:
+        bool Startup()                override;
+        void Update(double DeltaTime) override;
+        void Shutdown()               override;
+
+        bool IsPlayOnly() const noexcept override { return false; }
+        //~End EngineSubsystemBase Interface
+
+        //~Begin IIOReadSource Interface
+    private:
+        IORead* PopRead() override;
+        void    FinishRead(IORead* InRead) override;
+        //~End IIOReadSource Interface
+
+        // =============================================================================
+        // Internal
+        // =============================================================================
+    private:
+        struct Waiter
+        {
+            SharedPtr<IORequestState>            State;
+            TFunction<void(const IOReadResult&)> OnComplete;
+            EIOCompletionThread                  CompleteOn = EIOCompletionThread::Main;
+        };
+
+        // Coalescing key: path + requested range (before the backend clamps it).
+        struct ReadKey
+        {
+            OpaaxString Path;
+            Uint64      Offset = 0;
+            Uint64      Size   = IOWholeFile;
+
+            bool operator==(const ReadKey& InOther) const noexcept
+            {
+                return Offset == InOther.Offset && Size == InOther.Size && Path == InOther.Path;
+            }
+        };
+
+        struct ReadKeyHash
+        {
+            size_t operator()(const ReadKey& InKey) const noexcept;
+        };
+
+        // One physical read and everyone waiting on it. The backend sees only the IORead base.
+        struct PendingRead : IORead
+        {
+            ReadKey           Key;
+            TDynArray<Waiter> Waiters;
+            Uint64            Ticket = 0;   // current queue ticket; 0 once popped
+        };
+
+        /** Add InRequest to the queue / an existing read. Caller holds m_Mutex. */
+        IORequestHandle EnqueueLocked(IOReadRequest&& InRequest);
+
+        /** Put InRead in its priority queue under a fresh ticket. Caller holds m_Mutex. */
+        void PushLocked(PendingRead& InRead);
+
+        /** Fire / queue every waiter's callback with InRead's outcome, then complete their handles. Any thread, no lock held. */
+        void CompleteRead(IORead& InRead, TDynArray<Waiter>& InWaiters);
+
+        /** Invoke queued main-thread completion callbacks. Main thread only. */
+        void DrainCompleted();
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        UniquePtr<IIOBackend> m_Backend;
+
+        // Queue + coalescing state. Priority queues hold tickets; a ticket no longer in
+        // m_Queued was bumped to a higher queue (or popped) and is skipped.
+        mutable Mutex                                              m_Mutex;
+        UnorderedMap<ReadKey, UniquePtr<PendingRead>, ReadKeyHash> m_Reads;
+        TQueue<Uint64>                                             m_Queues[static_cast<Uint32>(EIOPriority::Count)];
+        UnorderedMap<Uint64, PendingRead*>                         m_Queued;
+        Uint64                                                     m_NextTicket = 1;
+        bool                                                       m_bAccepting = false;
+        IOStats                                                    m_Stats;
+
+        // Main-thread callbacks awaiting the drain.
+        TDynArray<TFunction<void()>> m_Completed;
+        Mutex                        m_CompletedMutex;
+
+        // Backs Wait — notified each time reads land.
+        Mutex             m_DoneMutex;
+        ConditionVariable m_DoneCV;
+
+        Uint32 m_QueueDepth       = 256;
+        Uint32 m_ThreadCount      = 4;
+        bool   m_bForceThreadPool = false;
+    };
+
+} // namespace Opaax
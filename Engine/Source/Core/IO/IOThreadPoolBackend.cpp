@@ -0,0 +1,188 @@
+#include "IOThreadPoolBackend.h"
+
+#if defined(OPAAX_PLATFORM_WINDOWS)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+
+namespace Opaax
+{
+    namespace
+    {
+        // Per-call cap — keeps each read inside a 32-bit length on every platform.
+        constexpr Uint64 k_MaxChunk = 1ull << 30;
+    }
+
+    // =============================================================================
+    // Blocking read
+    // =============================================================================
+
+    void IOReadBlocking(IORead& InOutRead)
+    {
+        InOutRead.Bytes.clear();
+        InOutRead.Status = EIOStatus::Failed;
+
+#if defined(OPAAX_PLATFORM_WINDOWS)
+        HANDLE lFile = CreateFileA(InOutRead.AbsPath.CStr(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (lFile == INVALID_HANDLE_VALUE)
+        {
+            const DWORD lError = GetLastError();
+            if (lError == ERROR_FILE_NOT_FOUND || lError == ERROR_PATH_NOT_FOUND) { InOutRead.Status = EIOStatus::NotFound; }
+            return;
+        }
+
+        LARGE_INTEGER lSize{};
+        if (!GetFileSizeEx(lFile, &lSize) || !IOClampReadRange(InOutRead, static_cast<Uint64>(lSize.QuadPart)))
+        {
+            CloseHandle(lFile);
+            return;
+        }
+
+        InOutRead.Bytes.resize(static_cast<size_t>(InOutRead.Size));
+        Uint64 lDone   = 0;
+        bool   bFailed = false;
+        while (lDone < InOutRead.Size)
+        {
+            // ReadFile with an OVERLAPPED offset on a synchronous handle = pread.
+            const Uint64 lAt    = InOutRead.Offset + lDone;
+            OVERLAPPED   lAtPos{};
+            lAtPos.Offset     = static_cast<DWORD>(lAt & 0xFFFFFFFFull);
+            lAtPos.OffsetHigh = static_cast<DWORD>(lAt >> 32);
+
+            DWORD lGot = 0;
+            const DWORD lWant = static_cast<DWORD>(std::min(InOutRead.Size - lDone, k_MaxChunk));
+            if (!ReadFile(lFile, InOutRead.Bytes.data() + lDone, lWant, &lGot, &lAtPos))
+            {
+                // Hitting the end is a short read, not an error.
+                bFailed = GetLastError() != ERROR_HANDLE_EOF;
+                break;
+            }
+            if (lGot == 0) { break; }
+            lDone += lGot;
+        }
+        CloseHandle(lFile);
+#else
+        const int lFd = ::open(InOutRead.AbsPath.CStr(), O_RDONLY | O_CLOEXEC);
+        if (lFd < 0)
+        {
+            if (errno == ENOENT || errno == ENOTDIR) { InOutRead.Status = EIOStatus::NotFound; }
+            return;
+        }
+
+        struct stat lStat{};
+        if (::fstat(lFd, &lStat) != 0 || !IOClampReadRange(InOutRead, static_cast<Uint64>(lStat.st_size)))
+        {
+            ::close(lFd);
+            return;
+        }
+
+        InOutRead.Bytes.resize(static_cast<size_t>(InOutRead.Size));
+        Uint64 lDone   = 0;
+        bool   bFailed = false;
+        while (lDone < InOutRead.Size)
+        {
+            const size_t  lWant = static_cast<size_t>(std::min(InOutRead.Size - lDone, k_MaxChunk));
+            const ssize_t lGot  = ::pread(lFd, InOutRead.Bytes.data() + lDone, lWant,
+                                          static_cast<off_t>(InOutRead.Offset + lDone));
+            if (lGot < 0 && errno == EINTR) { continue; }
+            if (lGot < 0)                   { bFailed = true; break; }
+            if (lGot == 0)                  { break; }
+            lDone += static_cast<Uint64>(lGot);
+        }
+        ::close(lFd);
+#endif
+
+        // An error fails the read, as on io_uring; a short count only means the file shrank
+        // under us — hand back what was there.
+        if (bFailed)
+        {
+            InOutRead.Bytes.clear();
+            return;
+        }
+        InOutRead.Bytes.resize(static_cast<size_t>(lDone));
+        InOutRead.Status = EIOStatus::Ok;
+    }
+
+    // =============================================================================
+    // Lifecycle
+    // =============================================================================
+
+    bool IOThreadPoolBackend::Startup(IIOReadSource& InSource)
+    {
+        m_Source    = &InSource;
+        m_bStopping = false;
+
+        m_Threads.reserve(m_ThreadCount);
+        for (Uint32 i = 0; i < m_ThreadCount; ++i)
+        {
+            m_Threads.emplace_back([this] { ThreadLoop(); });
+        }
+        return true;
+    }
+
+    void IOThreadPoolBackend::Notify()
+    {
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            ++m_Signals;
+        }
+        m_CV.notify_all();
+    }
+
+    void IOThreadPoolBackend::Shutdown()
+    {
+        if (m_Threads.empty()) { return; }
+
+        {
+            LockGuard<Mutex> lLock(m_Mutex);
+            m_bStopping = true;
+        }
+        m_CV.notify_all();
+
+        for (Thread& lThread : m_Threads)
+        {
+            if (lThread.joinable()) { lThread.join(); }
+        }
+        m_Threads.clear();
+    }
+
+    // =============================================================================
+    // Internal
+    // =============================================================================
+
+    void IOThreadPoolBackend::ThreadLoop()
+    {
+        for (;;)
+        {
+            Uint64 lSeen = 0;
+            {
+                LockGuard<Mutex> lLock(m_Mutex);
+                if (m_bStopping) { return; }
+                lSeen = m_Signals;
+            }
+
+            while (IORead* lRead = m_Source->PopRead())
+            {
+                IOReadBlocking(*lRead);
+                m_Source->FinishRead(lRead);
+            }
+
+            UniqueLock<Mutex> lLock(m_Mutex);
+            m_CV.wait(lLock, [this, lSeen] { return m_bStopping || m_Signals != lSeen; });
+        }
+    }
+
+} // namespace Opaax
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "IOBackend.h"
+
+namespace Opaax
+{
+    /**
+     * @class IOThreadPoolBackend
+     *
+     * Portable IOSubsystem backend: a few dedicated IO threads, each popping one read at a time
+     * and serving it with blocking positional reads (pread / ReadFile at an offset). Reads in
+     * flight = thread count. Used where io_uring is not compiled in or the kernel refuses it.
+     *
+     * The threads are IO-only, so blocking on the disk never holds a JobSubsystem worker.
+     */
+    class IOThreadPoolBackend final : public IIOBackend
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit IOThreadPoolBackend(Uint32 InThreadCount) : m_ThreadCount(InThreadCount > 0 ? InThreadCount : 1) {}
+        ~IOThreadPoolBackend() override { Shutdown(); }
+
+        IOThreadPoolBackend(const IOThreadPoolBackend&)            = delete;
+        IOThreadPoolBackend& operator=(const IOThreadPoolBackend&) = delete;
+
+        // =============================================================================
+        // Override
+        // =============================================================================
+        //~ Begin IIOBackend interface
+    public:
+        const char* GetName() const noexcept override { return "ThreadPool"; }
+        bool        Startup(IIOReadSource& InSource) override;
+        void        Notify() override;
+        void        Shutdown() override;
+        //~ End IIOBackend interface
+
+        // =============================================================================
+        // Internal
+        // =============================================================================
+    private:
+        void ThreadLoop();
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        IIOReadSource*    m_Source      = nullptr;
+        Uint32            m_ThreadCount = 1;
+        TDynArray<Thread> m_Threads;
+
+        // Wake-up for idle threads. m_Signals counts Notify calls so none is lost between a
+        // thread finding the source empty and going to sleep.
+        Mutex             m_Mutex;
+        ConditionVariable m_CV;
+        Uint64            m_Signals   = 0;
+        bool              m_bStopping = false;
+    };
+
+} // namespace Opaax
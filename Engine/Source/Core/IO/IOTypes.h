@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxString.hpp"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    // =============================================================================
+    // Enums
+    // =============================================================================
+
+    /** Dispatch order of queued reads — every High read is started before any Normal one. */
+    enum class EIOPriority : Uint8
+    {
+        High = 0,   // needed this frame (a Load<T> waiting, streaming the visible set)
+        Normal,     // LoadAsync
+        Low,        // prefetch
+        Count
+    };
+
+    /** Where a request's completion callback runs. */
+    enum class EIOCompletionThread : Uint8
+    {
+        Main = 0,   // during IOSubsystem::Update (the per-frame drain)
+        IO          // on the IO thread, as soon as the read lands — keep it short (hand off to a job)
+    };
+
+    enum class EIOStatus : Uint8
+    {
+        Pending = 0,
+        Ok,
+        NotFound,
+        Failed,
+        Cancelled   // still queued at IOSubsystem::Shutdown
+    };
+
+    // Size value meaning "from Offset to the end of the file".
+    static constexpr Uint64 IOWholeFile = ~0ull;
+
+    // =============================================================================
+    // Request / result
+    // =============================================================================
+
+    /**
+     * @struct IOReadResult
+     * Bytes are shared by every request coalesced into the same physical read — never mutate them.
+     */
+    struct IOReadResult
+    {
+        SharedPtr<const TDynArray<Uint8>> Bytes;               // null unless Ok
+        EIOStatus                         Status = EIOStatus::Pending;
+
+        FORCEINLINE bool         IsOk()    const noexcept { return Status == EIOStatus::Ok; }
+        FORCEINLINE const Uint8* GetData() const noexcept { return Bytes ? Bytes->data() : nullptr; }
+        FORCEINLINE Uint64       GetSize() const noexcept { return Bytes ? Bytes->size() : 0u; }
+    };
+
+    /**
+     * @struct IOReadRequest
+     * One read of [Offset, Offset + Size) from an absolute path. Requests for the same range of
+     * the same path that overlap in time share one physical read.
+     */
+    struct IOReadRequest
+    {
+        OpaaxString                          AbsPath;
+        Uint64                               Offset     = 0;
+        Uint64                               Size       = IOWholeFile;
+        EIOPriority                          Priority   = EIOPriority::Normal;
+        EIOCompletionThread                  CompleteOn = EIOCompletionThread::Main;
+        TFunction<void(const IOReadResult&)> OnComplete;   // optional
+    };
+
+    // =============================================================================
+    // IORequestState / IORequestHandle
+    // =============================================================================
+
+    /**
+     * @struct IORequestState
+     * Shared between IOSubsystem and every handle to one request. Result is written once, before
+     * bDone is released; read it only after IsComplete().
+     */
+    struct IORequestState
+    {
+        Atomic<bool> bDone{ false };
+        IOReadResult Result;
+    };
+
+    /**
+     * @class IORequestHandle
+     * Copyable observer of one IOSubsystem read, in the mold of JobHandle. A null handle reports
+     * complete with an empty (Pending) result.
+     */
+    class OPAAX_API IORequestHandle
+    {
+        // =============================================================================
+        // CTORs
+        // =============================================================================
+    public:
+        IORequestHandle() = default;
+        explicit IORequestHandle(SharedPtr<IORequestState> InState) : m_State(Move(InState)) {}
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        bool IsComplete() const noexcept
+        {
+            return !m_State || m_State->bDone.load(std::memory_order_acquire);
+        }
+
+        bool IsValid() const noexcept { return static_cast<bool>(m_State); }
+
+        /** The read's outcome — only meaningful once IsComplete(). */
+        const IOReadResult& GetResult() const noexcept
+        {
+            static const IOReadResult s_Empty;
+            return IsComplete() && m_State ? m_State->Result : s_Empty;
+        }
+
+        // =============================================================================
+        // Get - Set
+        // =============================================================================
+    public:
+        const SharedPtr<IORequestState>& GetState() const noexcept { return m_State; }
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        SharedPtr<IORequestState> m_State;
+    };
+
+    /**
+     * @struct IOStats
+     * IOSubsystem counters. Requests = Reads + Coalesced once everything has landed.
+     */
+    struct IOStats
+    {
+        Uint64 Requests  = 0;   // accepted by Read / ReadBatch
+        Uint64 Coalesced = 0;   // joined a read already queued or in flight
+        Uint64 Reads     = 0;   // physical reads finished (any status)
+        Uint64 Failed    = 0;   // physical reads that did not end Ok
+        Uint64 BytesRead = 0;
+        Uint32 Queued    = 0;   // waiting for the backend
+        Uint32 InFlight  = 0;   // handed to the backend, not finished
+    };
+
+} // namespace Opaax
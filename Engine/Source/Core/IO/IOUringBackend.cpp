@@ -0,0 +1,428 @@
+#include "IOUringBackend.h"
+
+#if OPAAX_HAS_IO_URING
+
+#include "Core/Log/OpaaxLog.h"
+
+#include <linux/io_uring.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+
+// Same numbers on every architecture since 5.1 — only missing from old libc headers.
+#ifndef __NR_io_uring_setup
+    #define __NR_io_uring_setup    425
+    #define __NR_io_uring_enter    426
+    #define __NR_io_uring_register 427
+#endif
+
+namespace Opaax
+{
+    namespace
+    {
+        // user_data of the armed eventfd read; slot indices never get near it.
+        constexpr Uint64 k_WakeTag = ~0ull;
+
+        // Per-SQE cap — IORING_OP_READ takes a 32-bit length.
+        constexpr Uint64 k_MaxChunk = 1ull << 30;
+
+        // Keeps io_uring_setup under IORING_MAX_ENTRIES on every kernel.
+        constexpr Uint32 k_MaxDepth = 4096;
+
+        FORCEINLINE Uint32 LoadAcquire(const Uint32* InPtr) noexcept
+        {
+            return std::atomic_ref<const Uint32>(*InPtr).load(std::memory_order_acquire);
+        }
+
+        FORCEINLINE void StoreRelease(Uint32* InPtr, Uint32 InValue) noexcept
+        {
+            std::atomic_ref<Uint32>(*InPtr).store(InValue, std::memory_order_release);
+        }
+
+        void* MapRing(int InRingFd, size_t InSize, off_t InOffset)
+        {
+            void* lPtr = ::mmap(nullptr, InSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, InRingFd, InOffset);
+            return lPtr == MAP_FAILED ? nullptr : lPtr;
+        }
+    }
+
+    // =============================================================================
+    // Lifecycle
+    // =============================================================================
+
+    bool IOUringBackend::Startup(IIOReadSource& InSource)
+    {
+        m_Source    = &InSource;
+        m_bStopping = false;
+
+        if (!SetupRing())
+        {
+            TeardownRing();
+            return false;
+        }
+
+        m_Thread = Thread([this] { ThreadLoop(); });
+        return true;
+    }
+
+    void IOUringBackend::Notify()
+    {
+        if (m_WakeFd < 0) { return; }
+
+        const Uint64 lOne = 1;
+        [[maybe_unused]] const ssize_t lWritten = ::write(m_WakeFd, &lOne, sizeof(lOne));
+
+        // Also counted for the blocking mode, so a switch to it can never lose a wake-up.
+        {
+            LockGuard<Mutex> lLock(m_WakeMutex);
+            ++m_Signals;
+        }
+        m_WakeCV.notify_one();
+    }
+
+    void IOUringBackend::Shutdown()
+    {
+        if (!m_Thread.joinable()) { return; }
+
+        m_bStopping = true;
+        Notify();
+        m_Thread.join();
+
+        TeardownRing();
+    }
+
+    // =============================================================================
+    // Ring setup
+    // =============================================================================
+
+    bool IOUringBackend::SetupRing()
+    {
+        io_uring_params lParams{};
+        // One entry over the depth for the armed wake read.
+        const Uint32 lEntries = std::min(m_Depth, k_MaxDepth) + 1;
+
+        m_RingFd = static_cast<int>(::syscall(__NR_io_uring_setup, lEntries, &lParams));
+        if (m_RingFd < 0)
+        {
+            OPAAX_CORE_WARN("IOUringBackend — io_uring_setup failed ({}), falling back", std::strerror(errno));
+            return false;
+        }
+
+        // IORING_OP_READ (5.6) is the only opcode used; the probe itself fails on older kernels.
+        {
+            constexpr Uint32 lProbeOps = 256;
+            TDynArray<Uint8> lProbeStorage(sizeof(io_uring_probe) + lProbeOps * sizeof(io_uring_probe_op), 0);
+            io_uring_probe*  lProbe = reinterpret_cast<io_uring_probe*>(lProbeStorage.data());
+
+            const long lResult = ::syscall(__NR_io_uring_register, m_RingFd, IORING_REGISTER_PROBE, lProbe, lProbeOps);
+            if (lResult < 0 || lProbe->last_op < IORING_OP_READ ||
+                !(lProbe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED))
+            {
+                OPAAX_CORE_WARN("IOUringBackend — kernel lacks IORING_OP_READ, falling back");
+                return false;
+            }
+        }
+
+        m_SqRingSize = lParams.sq_off.array + lParams.sq_entries * sizeof(Uint32);
+        m_CqRingSize = lParams.cq_off.cqes  + lParams.cq_entries * sizeof(io_uring_cqe);
+
+        // 5.4+: both rings live in one mapping.
+        const bool lSingleMap = (lParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (lSingleMap) { m_SqRingSize = m_CqRingSize = std::max(m_SqRingSize, m_CqRingSize); }
+
+        m_SqRing = MapRing(m_RingFd, m_SqRingSize, IORING_OFF_SQ_RING);
+        if (!m_SqRing) { return false; }
+
+        if (lSingleMap) { m_CqRing = m_SqRing; }
+        else
+        {
+            m_CqRing = MapRing(m_RingFd, m_CqRingSize, IORING_OFF_CQ_RING);
+            if (!m_CqRing) { return false; }
+        }
+
+        m_SqesSize = lParams.sq_entries * sizeof(io_uring_sqe);
+        m_Sqes     = static_cast<io_uring_sqe*>(MapRing(m_RingFd, m_SqesSize, IORING_OFF_SQES));
+        if (!m_Sqes) { return false; }
+
+        Uint8* lSq = static_cast<Uint8*>(m_SqRing);
+        m_SqHead  = reinterpret_cast<Uint32*>(lSq + lParams.sq_off.head);
+        m_SqTail  = reinterpret_cast<Uint32*>(lSq + lParams.sq_off.tail);
+        m_SqMask  = reinterpret_cast<Uint32*>(lSq + lParams.sq_off.ring_mask);
+        m_SqArray = reinterpret_cast<Uint32*>(lSq + lParams.sq_off.array);
+
+        Uint8* lCq = static_cast<Uint8*>(m_CqRing);
+        m_CqHead = reinterpret_cast<Uint32*>(lCq + lParams.cq_off.head);
+        m_CqTail = reinterpret_cast<Uint32*>(lCq + lParams.cq_off.tail);
+        m_CqMask = reinterpret_cast<Uint32*>(lCq + lParams.cq_off.ring_mask);
+        m_Cqes   = reinterpret_cast<io_uring_cqe*>(lCq + lParams.cq_off.cqes);
+
+        // SQE i always sits at ring index i, so the indirection array is filled once.
+        for (Uint32 i = 0; i < lParams.sq_entries; ++i) { m_SqArray[i] = i; }
+        m_SqLocalTail = *m_SqTail;
+
+        m_WakeFd = ::eventfd(0, EFD_CLOEXEC);
+        if (m_WakeFd < 0) { return false; }
+
+        // Each slot has at most one SQE out, so the ring (and the 2x CQ ring) can never overflow.
+        const Uint32 lSlots = std::min(m_Depth, lParams.sq_entries - 1);
+        m_Slots.assign(lSlots, Slot{});
+        m_FreeSlots.clear();
+        m_FreeSlots.reserve(lSlots);
+        for (Uint32 i = lSlots; i > 0; --i) { m_FreeSlots.push_back(i - 1); }
+
+        return true;
+    }
+
+    void IOUringBackend::TeardownRing()
+    {
+        if (m_Sqes)                                  { ::munmap(m_Sqes, m_SqesSize); }
+        if (m_CqRing && m_CqRing != m_SqRing)        { ::munmap(m_CqRing, m_CqRingSize); }
+        if (m_SqRing)                                { ::munmap(m_SqRing, m_SqRingSize); }
+        if (m_RingFd >= 0)                           { ::close(m_RingFd); }
+        if (m_WakeFd >= 0)                           { ::close(m_WakeFd); }
+
+        m_Sqes   = nullptr;
+        m_CqRing = nullptr;
+        m_SqRing = nullptr;
+        m_RingFd = -1;
+        m_WakeFd = -1;
+
+        m_Slots.clear();
+        m_FreeSlots.clear();
+        m_Orphaned.clear();
+    }
+
+    // =============================================================================
+    // IO thread
+    // =============================================================================
+
+    void IOUringBackend::ThreadLoop()
+    {
+        QueueWakeRead();
+
+        while (!m_bRingBroken)
+        {
+            if (!m_bStopping)
+            {
+                while (!m_FreeSlots.empty())
+                {
+                    IORead* lRead = m_Source->PopRead();
+                    if (!lRead) { break; }
+                    StartRead(lRead);
+                }
+            }
+
+            if (m_bStopping && m_FreeSlots.size() == m_Slots.size()) { return; }
+
+            if (!SubmitAndWait())
+            {
+                BreakRing();
+                break;
+            }
+
+            // Completions may queue follow-up SQEs (short reads, the wake re-arm); they go
+            // out with the next io_uring_enter.
+            Uint32       lHead = *m_CqHead;
+            const Uint32 lTail = LoadAcquire(m_CqTail);
+            while (lHead != lTail)
+            {
+                const io_uring_cqe lCqe = m_Cqes[lHead & *m_CqMask];
+                ++lHead;
+                OnCompletion(lCqe);
+            }
+            StoreRelease(m_CqHead, lHead);
+        }
+
+        // The ring is unusable: keep serving on this thread with blocking reads, the way a
+        // one-thread IOThreadPoolBackend would.
+        for (;;)
+        {
+            Uint64 lSeen = 0;
+            {
+                LockGuard<Mutex> lLock(m_WakeMutex);
+                if (m_bStopping) { return; }
+                lSeen = m_Signals;
+            }
+
+            while (IORead* lRead = m_Source->PopRead())
+            {
+                IOReadBlocking(*lRead);
+                m_Source->FinishRead(lRead);
+            }
+
+            UniqueLock<Mutex> lLock(m_WakeMutex);
+            m_WakeCV.wait(lLock, [this, lSeen] { return m_bStopping || m_Signals != lSeen; });
+        }
+    }
+
+    void IOUringBackend::StartRead(IORead* InRead)
+    {
+        const int lFd = ::open(InRead->AbsPath.CStr(), O_RDONLY | O_CLOEXEC);
+        if (lFd < 0)
+        {
+            InRead->Status = (errno == ENOENT || errno == ENOTDIR) ? EIOStatus::NotFound : EIOStatus::Failed;
+            m_Source->FinishRead(InRead);
+            return;
+        }
+
+        struct stat lStat{};
+        if (::fstat(lFd, &lStat) != 0 || !IOClampReadRange(*InRead, static_cast<Uint64>(lStat.st_size)))
+        {
+            ::close(lFd);
+            InRead->Status = EIOStatus::Failed;
+            m_Source->FinishRead(InRead);
+            return;
+        }
+
+        InRead->Bytes.resize(static_cast<size_t>(InRead->Size));
+        if (InRead->Size == 0)
+        {
+            ::close(lFd);
+            InRead->Status = EIOStatus::Ok;
+            m_Source->FinishRead(InRead);
+            return;
+        }
+
+        const Uint32 lSlot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+        m_Slots[lSlot] = Slot{ InRead, lFd, 0 };
+        QueueChunk(lSlot);
+    }
+
+    void IOUringBackend::QueueChunk(Uint32 InSlot)
+    {
+        const Slot& lSlot = m_Slots[InSlot];
+        IORead&     lRead = *lSlot.Read;
+
+        io_uring_sqe* lSqe = NextSqe();
+        lSqe->opcode    = IORING_OP_READ;
+        lSqe->fd        = lSlot.Fd;
+        lSqe->addr      = reinterpret_cast<Uint64>(lRead.Bytes.data() + lSlot.Done);
+        lSqe->len       = static_cast<Uint32>(std::min(lRead.Size - lSlot.Done, k_MaxChunk));
+        lSqe->off       = lRead.Offset + lSlot.Done;
+        lSqe->user_data = InSlot;
+    }
+
+    void IOUringBackend::QueueWakeRead()
+    {
+        io_uring_sqe* lSqe = NextSqe();
+        lSqe->opcode    = IORING_OP_READ;
+        lSqe->fd        = m_WakeFd;
+        lSqe->addr      = reinterpret_cast<Uint64>(&m_WakeValue);
+        lSqe->len       = sizeof(m_WakeValue);
+        lSqe->user_data = k_WakeTag;
+    }
+
+    void IOUringBackend::OnCompletion(const io_uring_cqe& InCqe)
+    {
+        if (InCqe.user_data == k_WakeTag)
+        {
+            // Nothing to do with the value — the wake-up itself was the point.
+            if (!m_bStopping) { QueueWakeRead(); }
+            return;
+        }
+
+        const Uint32 lIndex = static_cast<Uint32>(InCqe.user_data);
+        Slot&        lSlot  = m_Slots[lIndex];
+
+        if (InCqe.res < 0)
+        {
+            if (InCqe.res == -EINTR || InCqe.res == -EAGAIN) { QueueChunk(lIndex); }
+            else                                             { FinishSlot(lIndex, EIOStatus::Failed); }
+            return;
+        }
+
+        if (InCqe.res == 0)
+        {
+            // The file shrank under us — hand back what was there, as the blocking path does.
+            lSlot.Read->Bytes.resize(static_cast<size_t>(lSlot.Done));
+            FinishSlot(lIndex, EIOStatus::Ok);
+            return;
+        }
+
+        lSlot.Done += static_cast<Uint64>(InCqe.res);
+        if (lSlot.Done >= lSlot.Read->Size) { FinishSlot(lIndex, EIOStatus::Ok); }
+        else                                { QueueChunk(lIndex); }
+    }
+
+    void IOUringBackend::FinishSlot(Uint32 InSlot, EIOStatus InStatus)
+    {
+        Slot&   lSlot = m_Slots[InSlot];
+        IORead* lRead = lSlot.Read;
+
+        ::close(lSlot.Fd);
+        lSlot = Slot{};
+        m_FreeSlots.push_back(InSlot);
+
+        lRead->Status = InStatus;
+        if (InStatus != EIOStatus::Ok) { lRead->Bytes.clear(); }
+        m_Source->FinishRead(lRead);
+    }
+
+    void IOUringBackend::BreakRing()
+    {
+        OPAAX_CORE_ERROR("IOUringBackend — io_uring_enter failed ({}), serving reads with blocking IO",
+                         std::strerror(errno));
+        m_bRingBroken = true;
+
+        // Reads still in the kernel may yet land in their buffers; keep those alive until
+        // teardown and fail the reads themselves.
+        for (Uint32 i = 0; i < static_cast<Uint32>(m_Slots.size()); ++i)
+        {
+            Slot& lSlot = m_Slots[i];
+            if (!lSlot.Read) { continue; }
+
+            m_Orphaned.push_back(Move(lSlot.Read->Bytes));
+            FinishSlot(i, EIOStatus::Failed);
+        }
+    }
+
+    // =============================================================================
+    // Submission
+    // =============================================================================
+
+    io_uring_sqe* IOUringBackend::NextSqe()
+    {
+        // Never full: each slot has at most one SQE out, plus the wake read.
+        OPAAX_CORE_ASSERT(m_SqLocalTail - LoadAcquire(m_SqHead) <= *m_SqMask)
+
+        io_uring_sqe* lSqe = &m_Sqes[m_SqLocalTail & *m_SqMask];
+        std::memset(lSqe, 0, sizeof(*lSqe));
+        ++m_SqLocalTail;
+        ++m_ToSubmit;
+        return lSqe;
+    }
+
+    bool IOUringBackend::SubmitAndWait()
+    {
+        StoreRelease(m_SqTail, m_SqLocalTail);
+
+        for (;;)
+        {
+            const long lResult = ::syscall(__NR_io_uring_enter, m_RingFd, m_ToSubmit, 1u,
+                                           IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (lResult >= 0)
+            {
+                m_ToSubmit -= std::min(m_ToSubmit, static_cast<Uint32>(lResult));
+                return true;
+            }
+
+            // Interrupted before submitting anything: try again. Busy / CQ pressure: reap first.
+            if (errno == EINTR)                     { continue; }
+            if (errno == EAGAIN || errno == EBUSY)  { return true; }
+            return false;
+        }
+    }
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_IO_URING
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "IOBackend.h"
+
+#if OPAAX_HAS_IO_URING
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace Opaax
+{
+    /**
+     * @class IOUringBackend
+     *
+     * Linux IOSubsystem backend on io_uring, driven through the raw syscalls (no liburing). One IO
+     * thread owns the ring: it opens each popped file, queues IORING_OP_READ for its range and
+     * keeps up to the queue depth in flight, so hundreds of reads cost one thread and a handful of
+     * io_uring_enter calls per batch. A short read is re-queued for the remainder.
+     *
+     * The thread blocks in io_uring_enter only. An eventfd read stays armed in the ring, so Notify
+     * (a write to that eventfd) completes it and wakes the thread like any other completion. Should
+     * io_uring_enter ever fail for good, the thread keeps serving with blocking reads instead.
+     *
+     * Startup fails — and IOSubsystem falls back to IOThreadPoolBackend — when the kernel refuses
+     * io_uring (pre-5.6, seccomp / container policy) or lacks IORING_OP_READ.
+     */
+    class IOUringBackend final : public IIOBackend
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit IOUringBackend(Uint32 InQueueDepth) : m_Depth(InQueueDepth > 0 ? InQueueDepth : 1) {}
+        ~IOUringBackend() override { Shutdown(); }
+
+        IOUringBackend(const IOUringBackend&)            = delete;
+        IOUringBackend& operator=(const IOUringBackend&) = delete;
+
+        // =============================================================================
+        // Override
+        // =============================================================================
+        //~ Begin IIOBackend interface
+    public:
+        const char* GetName() const noexcept override { return "io_uring"; }
+        bool        Startup(IIOReadSource& InSource) override;
+        void        Notify() override;
+        void        Shutdown() override;
+        //~ End IIOBackend interface
+
+        // =============================================================================
+        // Internal
+        // =============================================================================
+    private:
+        // One read in flight: the file it reads from and how much of its range has landed.
+        struct Slot
+        {
+            IORead* Read = nullptr;
+            int     Fd   = -1;
+            Uint64  Done = 0;
+        };
+
+        bool SetupRing();
+        void TeardownRing();
+
+        void ThreadLoop();
+
+        // Open + size InRead and queue its first chunk; finishes it at once on an error or an empty range.
+        void StartRead(IORead* InRead);
+        void QueueChunk(Uint32 InSlot);
+        void QueueWakeRead();
+        void OnCompletion(const io_uring_cqe& InCqe);
+        void FinishSlot(Uint32 InSlot, EIOStatus InStatus);
+
+        // io_uring_enter failed for good: fail the reads in flight, switch to blocking reads.
+        void BreakRing();
+
+        io_uring_sqe* NextSqe();
+        bool          SubmitAndWait();
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        IIOReadSource* m_Source = nullptr;
+        Uint32         m_Depth  = 1;
+        Thread         m_Thread;
+        Atomic<bool>   m_bStopping{ false };
+
+        int            m_RingFd  = -1;
+        int            m_WakeFd  = -1;
+        Uint64         m_WakeValue = 0;   // eventfd read target; lives as long as the ring
+
+        // Mapped rings (see io_uring_setup(2)).
+        void*          m_SqRing     = nullptr;
+        size_t         m_SqRingSize = 0;
+        void*          m_CqRing     = nullptr;
+        size_t         m_CqRingSize = 0;
+        io_uring_sqe*  m_Sqes       = nullptr;
+        size_t         m_SqesSize   = 0;
+
+        Uint32*        m_SqHead  = nullptr;
+        Uint32*        m_SqTail  = nullptr;
+        Uint32*        m_SqMask  = nullptr;
+        Uint32*        m_SqArray = nullptr;
+        Uint32*        m_CqHead  = nullptr;
+        Uint32*        m_CqTail  = nullptr;
+        Uint32*        m_CqMask  = nullptr;
+        io_uring_cqe*  m_Cqes    = nullptr;
+
+        Uint32            m_SqLocalTail = 0;   // published to m_SqTail on submit
+        Uint32            m_ToSubmit    = 0;
+        TDynArray<Slot>   m_Slots;
+        TDynArray<Uint32> m_FreeSlots;
+
+        // Blocking mode after BreakRing (IO thread only), woken through m_Signals like the pool.
+        bool                        m_bRingBroken = false;
+        TDynArray<TDynArray<Uint8>> m_Orphaned;   // buffers of reads the kernel may still write
+        Mutex                       m_WakeMutex;
+        ConditionVariable           m_WakeCV;
+        Uint64                      m_Signals = 0;
+    };
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_IO_URING
@@ -0,0 +1,68 @@
+#include "OpaaxFile.h"
+
+#include "Core/Log/OpaaxLog.h"
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+
+namespace Opaax
+{
+    bool OpaaxFile::ReadBinary(const char* InPath, TDynArray<Uint8>& OutBytes)
+    {
+        OutBytes.clear();
+
+        std::ifstream lFile(InPath, std::ios::binary | std::ios::ate);
+        if (!lFile)
+        {
+            return false;
+        }
+
+        const std::streamsize lSize = lFile.tellg();
+        if (lSize <= 0)
+        {
+            return false;
+        }
+        lFile.seekg(0, std::ios::beg);
+
+        OutBytes.resize(static_cast<size_t>(lSize));
+        if (!lFile.read(reinterpret_cast<char*>(OutBytes.data()), lSize))
+        {
+            OutBytes.clear();
+            return false;
+        }
+        return true;
+    }
+
+    bool OpaaxFile::WriteBinaryAtomic(const char* InPath, const void* InData, size_t InSize)
+    {
+        const std::filesystem::path lPath(InPath);
+
+        std::error_code lEc;
+        std::filesystem::create_directories(lPath.parent_path(), lEc);
+
+        // Unique temp name per thread — two workers writing the same target must not interleave.
+        std::filesystem::path lTmp = lPath;
+        lTmp += "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+        {
+            std::ofstream lFile(lTmp, std::ios::binary | std::ios::trunc);
+            if (!lFile || !lFile.write(static_cast<const char*>(InData), static_cast<std::streamsize>(InSize)))
+            {
+                OPAAX_CORE_WARN("OpaaxFile: cannot write '{}'", lTmp.string());
+                return false;
+            }
+        }
+
+        std::filesystem::rename(lTmp, lPath, lEc);
+        if (lEc)
+        {
+            OPAAX_CORE_WARN("OpaaxFile: cannot publish '{}': {}", lPath.string(), lEc.message());
+            std::filesystem::remove(lTmp, lEc);
+            return false;
+        }
+        return true;
+    }
+
+} // namespace Opaax
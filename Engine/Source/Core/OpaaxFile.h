@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    /**
+     * @class OpaaxFile
+     *
+     * Whole-file binary I/O for engine-written data (derived caches, cooked blobs).
+     * Paths are absolute — resolve them through OpaaxPath / EngineConfig first.
+     * Thread-safe: no shared state, so asset workers may call it directly.
+     */
+    class OPAAX_API OpaaxFile
+    {
+    public:
+        /** Read all of InPath into OutBytes. False (OutBytes cleared) if missing, empty or unreadable. */
+        static bool ReadBinary(const char* InPath, TDynArray<Uint8>& OutBytes);
+
+        /**
+         * Write InSize bytes to InPath via a sibling temp file + rename, creating parent
+         * directories. Readers (or another process) never observe a partially written file.
+         */
+        static bool WriteBinaryAtomic(const char* InPath, const void* InData, size_t InSize);
+    };
+
+} // namespace Opaax
@@ -26,6 +26,33 @@ namespace Opaax
         {
             return Hash(String.CStr());
         }
+
+        // Binary-safe variant over a byte span (file contents, blobs) — embedded zeros included.
+        static Uint32 HashBytes(const void* InData, size_t InSize, Uint32 HashValue = FNV1a_OffsetBasis) noexcept
+        {
+            const unsigned char* lBytes = static_cast<const unsigned char*>(InData);
+            for (size_t i = 0; i < InSize; ++i)
+            {
+                HashValue ^= static_cast<Uint32>(lBytes[i]);
+                HashValue *= FNV1a_Prime;
+            }
+            return HashValue;
+        }
+ 
+        // FNV-1a 64-bit — for keys that persist outside the process (pack TOCs, caches on disk),
+        // where the 32-bit variant would collide too readily.
+        static constexpr Uint64 FNV1a64_Prime       = 1099511628211ull;
+        static constexpr Uint64 FNV1a64_OffsetBasis = 14695981039346656037ull;
+
+        static constexpr Uint64 Hash64(const char* Str, Uint64 HashValue = FNV1a64_OffsetBasis) noexcept
+        {
+            while (*Str)
+            {
+                HashValue ^= static_cast<Uint64>(static_cast<unsigned char>(*Str++));
+                HashValue *= FNV1a64_Prime;
+            }
+            return HashValue;
+        }
  
         // operator() overloads required by std::unordered_map / std::unordered_set
         Uint32 operator()(const OpaaxString& String) const noexcept { return Hash(String.CStr()); }
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Core/OpaaxTypes.h"
+
+#include <algorithm>
+
+namespace Opaax
+{
+    // =============================================================================
+    // LRU eviction policy (pure)
+    // =============================================================================
+
+    /**
+     * Floor on every caller's idle window. Whatever the configured window, an item is never
+     * evicted within this many frames of its last use: a frame in flight may still read it
+     * (Vulkan keeps up to OPAAX_FRAMES_IN_FLIGHT frames queued), and anything retired alongside
+     * the eviction must outlive those frames too.
+     */
+    inline constexpr Uint32 LruMinIdleFrames = 4;
+
+    /**
+     * One resident, evictable item as the policy sees it.
+     */
+    struct LruCandidate
+    {
+        Uint64 Bytes;           // bytes freed by evicting it
+        Uint64 LastUsedFrame;   // frame it was last used in
+    };
+
+    //------------------------------------------------------------------------------
+    /**
+     * Pick items to evict so resident bytes fall to InBudgetBytes.
+     *
+     * Only candidates idle for at least InMinIdleFrames are eligible; they go least recently
+     * used first (larger first on a tie), and selection stops as soon as the budget is met. If
+     * the idle set is not enough, the budget stays exceeded — an item used recently is never
+     * evicted, so the policy cannot thrash a working set larger than the budget.
+     *
+     * Pure: knows nothing of what the items are. TextureResidency budgets GPU texture copies with
+     * it, AssetRegistry its asset cache.
+     *
+     * @param InCandidates    resident evictable items
+     * @param InCount         number of candidates
+     * @param InResidentBytes bytes currently resident (>= sum of candidate bytes)
+     * @param InBudgetBytes   target; 0 = unlimited (nothing selected)
+     * @param InFrame         current frame
+     * @param InMinIdleFrames frames an item must go unused before it is eligible (callers clamp
+     *                        it to LruMinIdleFrames)
+     * @param OutEvict        [out] candidate indices to evict, in eviction order. Cleared, not
+     *                        shrunk — callers keep it and their candidate array across frames so
+     *                        a steady-state pass allocates nothing.
+     * @return bytes freed by the selection
+     */
+    //------------------------------------------------------------------------------
+    inline Uint64 SelectLruEvictions(const LruCandidate* InCandidates,
+                                     Uint32              InCount,
+                                     Uint64              InResidentBytes,
+                                     Uint64              InBudgetBytes,
+                                     Uint64              InFrame,
+                                     Uint32              InMinIdleFrames,
+                                     TDynArray<Uint32>&  OutEvict)
+    {
+        OutEvict.clear();
+        if (InBudgetBytes == 0 || InResidentBytes <= InBudgetBytes) { return 0; }
+
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            const LruCandidate& lC = InCandidates[i];
+            if (lC.LastUsedFrame <= InFrame && InFrame - lC.LastUsedFrame >= InMinIdleFrames)
+            {
+                OutEvict.push_back(i);
+            }
+        }
+
+        std::sort(OutEvict.begin(), OutEvict.end(), [InCandidates](Uint32 InA, Uint32 InB)
+        {
+            const LruCandidate& lA = InCandidates[InA];
+            const LruCandidate& lB = InCandidates[InB];
+            if (lA.LastUsedFrame != lB.LastUsedFrame) { return lA.LastUsedFrame < lB.LastUsedFrame; }
+            if (lA.Bytes != lB.Bytes)                 { return lA.Bytes > lB.Bytes; }
+            return InA < InB;
+        });
+
+        Uint64 lFreed = 0;
+        size_t lKeep  = 0;
+        for (; lKeep < OutEvict.size() && InResidentBytes - lFreed > InBudgetBytes; ++lKeep)
+        {
+            lFreed += InCandidates[OutEvict[lKeep]].Bytes;
+        }
+        OutEvict.resize(lKeep);
+        return lFreed;
+    }
+
+} // namespace Opaax
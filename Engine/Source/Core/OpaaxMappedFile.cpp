@@ -0,0 +1,131 @@
+#include "OpaaxMappedFile.h"
+
+#include "Core/Log/OpaaxLog.h"
+
+#if defined(OPAAX_PLATFORM_WINDOWS)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <utility>
+
+namespace Opaax
+{
+    OpaaxMappedFile::~OpaaxMappedFile()
+    {
+        Close();
+    }
+
+    OpaaxMappedFile::OpaaxMappedFile(OpaaxMappedFile&& Other) noexcept
+        : m_Data(std::exchange(Other.m_Data, nullptr))
+        , m_Size(std::exchange(Other.m_Size, 0))
+        , m_Mapping(std::exchange(Other.m_Mapping, nullptr))
+    {
+    }
+
+    OpaaxMappedFile& OpaaxMappedFile::operator=(OpaaxMappedFile&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Close();
+            m_Data    = std::exchange(Other.m_Data, nullptr);
+            m_Size    = std::exchange(Other.m_Size, 0);
+            m_Mapping = std::exchange(Other.m_Mapping, nullptr);
+        }
+        return *this;
+    }
+
+    bool OpaaxMappedFile::Open(const char* InAbsPath)
+    {
+        Close();
+
+#if defined(OPAAX_PLATFORM_WINDOWS)
+        HANDLE lFile = CreateFileA(InAbsPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (lFile == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER lSize{};
+        if (!GetFileSizeEx(lFile, &lSize) || lSize.QuadPart <= 0)
+        {
+            CloseHandle(lFile);
+            return false;
+        }
+
+        // The mapping keeps the file alive; the file handle itself is no longer needed.
+        HANDLE lMapping = CreateFileMappingA(lFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(lFile);
+        if (!lMapping)
+        {
+            OPAAX_CORE_WARN("OpaaxMappedFile: cannot map '{}' (error {})", InAbsPath, GetLastError());
+            return false;
+        }
+
+        const void* lView = MapViewOfFile(lMapping, FILE_MAP_READ, 0, 0, 0);
+        if (!lView)
+        {
+            OPAAX_CORE_WARN("OpaaxMappedFile: cannot view '{}' (error {})", InAbsPath, GetLastError());
+            CloseHandle(lMapping);
+            return false;
+        }
+
+        m_Data    = static_cast<const Uint8*>(lView);
+        m_Size    = static_cast<Uint64>(lSize.QuadPart);
+        m_Mapping = lMapping;
+#else
+        const int lFd = ::open(InAbsPath, O_RDONLY);
+        if (lFd < 0)
+        {
+            return false;
+        }
+
+        struct stat lStat{};
+        if (::fstat(lFd, &lStat) != 0 || lStat.st_size <= 0)
+        {
+            ::close(lFd);
+            return false;
+        }
+
+        // The mapping holds its own reference to the file; the descriptor can go right away.
+        void* lView = ::mmap(nullptr, static_cast<size_t>(lStat.st_size), PROT_READ, MAP_PRIVATE, lFd, 0);
+        ::close(lFd);
+        if (lView == MAP_FAILED)
+        {
+            OPAAX_CORE_WARN("OpaaxMappedFile: cannot map '{}'", InAbsPath);
+            return false;
+        }
+
+        m_Data = static_cast<const Uint8*>(lView);
+        m_Size = static_cast<Uint64>(lStat.st_size);
+#endif
+        return true;
+    }
+
+    void OpaaxMappedFile::Close() noexcept
+    {
+        if (!m_Data) { return; }
+
+#if defined(OPAAX_PLATFORM_WINDOWS)
+        UnmapViewOfFile(m_Data);
+        CloseHandle(static_cast<HANDLE>(m_Mapping));
+#else
+        ::munmap(const_cast<Uint8*>(m_Data), static_cast<size_t>(m_Size));
+#endif
+        m_Data    = nullptr;
+        m_Size    = 0;
+        m_Mapping = nullptr;
+    }
+
+} // namespace Opaax
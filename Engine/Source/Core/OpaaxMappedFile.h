@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    /**
+     * @class OpaaxMappedFile
+     *
+     * Read-only memory mapping of a whole file (MapViewOfFile / mmap). GetData() stays valid
+     * until Close() or destruction, and the OS pages it in on demand — no read, no copy.
+     * Move-only. Open / Close are not synchronised; reading the mapped bytes from any thread is.
+     */
+    class OPAAX_API OpaaxMappedFile
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        OpaaxMappedFile() = default;
+        ~OpaaxMappedFile();
+
+        OpaaxMappedFile(const OpaaxMappedFile&)            = delete;
+        OpaaxMappedFile& operator=(const OpaaxMappedFile&) = delete;
+
+        OpaaxMappedFile(OpaaxMappedFile&& Other) noexcept;
+        OpaaxMappedFile& operator=(OpaaxMappedFile&& Other) noexcept;
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /** Map InAbsPath read-only (closing any previous mapping). False if missing, empty or unmappable. */
+        bool Open(const char* InAbsPath);
+        void Close() noexcept;
+
+        FORCEINLINE bool         IsOpen()  const noexcept { return m_Data != nullptr; }
+        FORCEINLINE const Uint8* GetData() const noexcept { return m_Data; }
+        FORCEINLINE Uint64       GetSize() const noexcept { return m_Size; }
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        const Uint8* m_Data    = nullptr;
+        Uint64       m_Size    = 0;
+        void*        m_Mapping = nullptr;   // Windows file-mapping handle; unused on POSIX
+    };
+
+} // namespace Opaax
@@ -45,7 +45,8 @@ namespace Opaax
             return lID;
         }
 
-        const OpaaxString& Get(Uint32 Index) const noexcept
+        // By value — the copy is made under the lock; a GetOrAdd on another thread may grow m_Strings.
+        OpaaxString Get(Uint32 Index) const
         {
             std::shared_lock lLock(m_Mutex);
             return (Index < m_Strings.size()) ? m_Strings[Index] : m_Strings[OpaaxGlobal::ID_None];
@@ -7,6 +7,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
@@ -27,9 +28,11 @@
 //               Atomic<T>                            (std::atomic<T>)
 //   Threading:  Thread                               (std::thread)
 //               Mutex                                (std::mutex)
+//               SharedMutex                          (std::shared_mutex)
 //               ConditionVariable                    (std::condition_variable)
 //               LockGuard<T>                          (std::lock_guard<T>)
 //               UniqueLock<T>                         (std::unique_lock<T>)
+//               SharedLock<T>                         (std::shared_lock<T>)
 //               TQueue<T>                            (std::queue<T>)
 //   Misc:       Move(arg)                            (std::move)
 //
@@ -118,6 +121,7 @@ namespace Opaax
     // =============================================================================
     using Thread            = std::thread;
     using Mutex             = std::mutex;
+    using SharedMutex       = std::shared_mutex;
     using ConditionVariable = std::condition_variable;
 
     template<typename T>
@@ -126,6 +130,9 @@ namespace Opaax
     template<typename T>
     using UniqueLock = std::unique_lock<T>;
 
+    template<typename T>
+    using SharedLock = std::shared_lock<T>;
+
     template<typename T>
     using TQueue = std::queue<T>;
 
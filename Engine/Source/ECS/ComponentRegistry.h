@@ -2,6 +2,7 @@
 
 #include <Entt/entt/single_include/entt/entt.hpp>
 
+#include "Assets/IAsset.hpp"
 #include "Core/EngineAPI.h"
 #include "Core/OpaaxTypes.h"
 #include "Core/OpaaxStringID.hpp"
@@ -38,6 +39,10 @@ namespace Opaax
         virtual json Save(const World& InWorld, EntityID InEntity) const                = 0;
         virtual void Load(World& InWorld, EntityID InEntity, const json& InJson) const  = 0;
 
+        // Append the assets this entity's component resolves on Load (scene dependency list).
+        virtual void CollectDependencies(const World& InWorld, EntityID InEntity,
+                                         TDynArray<AssetDependency>& OutDeps) const    = 0;
+
 #if OPAAX_WITH_EDITOR
         // Optional per-type custom drawer. When null, ComponentRegistry::DrawAll
         // falls back to a generic read-only renderer that walks the component's
@@ -95,6 +100,19 @@ namespace Opaax
             lComp.Deserialize(InJson);
         }
 
+        // Opt-in: only types declaring CollectAssetDependencies(TDynArray<AssetDependency>&) contribute.
+        void CollectDependencies([[maybe_unused]] const World& InWorld, [[maybe_unused]] EntityID InEntity,
+                                 [[maybe_unused]] TDynArray<AssetDependency>& OutDeps) const override
+        {
+            if constexpr (requires(const T& InComp) { InComp.CollectAssetDependencies(OutDeps); })
+            {
+                if (const T* lComp = InWorld.GetComponent<T>(InEntity))
+                {
+                    lComp->CollectAssetDependencies(OutDeps);
+                }
+            }
+        }
+
 #if OPAAX_WITH_EDITOR
         Editor::IComponentDrawer* GetCustomDrawer() const override { return m_CustomDrawer.get(); }
 
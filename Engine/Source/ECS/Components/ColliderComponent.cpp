@@ -59,3 +59,11 @@ void Opaax::ECS::ColliderComponent::DeserializeImplementation(const json& Json)
     if (Json.contains("friction"))    { Friction    = Json["friction"].get<float>(); }
     if (Json.contains("restitution")) { Restitution = Json["restitution"].get<float>(); }
 }
+
+void Opaax::ECS::ColliderComponent::CollectAssetDependencies(TDynArray<AssetDependency>& OutDeps) const
+{
+    if (Profile.IsValid())
+    {
+        OutDeps.push_back({ Profile.GetID(), AssetType::CollisionProfile });
+    }
+}
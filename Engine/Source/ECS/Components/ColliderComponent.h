@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Assets/AssetHandle.hpp"
+#include "Assets/IAsset.hpp"
 #include "Core/Component/OpaaxComponent.h"
 #include "Core/OpaaxMathTypes.h"
 #include "Physics/PhysicsTypes.h"
@@ -52,6 +53,9 @@ namespace Opaax::ECS
         json Serialize() const override;
         //~ End OpaaxComponentBase Interface
 
+        // Assets Deserialize resolves — recorded in the scene's dependency list for prefetch.
+        void CollectAssetDependencies(TDynArray<AssetDependency>& OutDeps) const;
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -195,3 +195,11 @@ void Opaax::ECS::MoverComponent::DeserializeImplementation(const json& Json)
         ModeParams[lMode.GetId()] = Move(lParams);
     }
 }
+
+void Opaax::ECS::MoverComponent::CollectAssetDependencies(TDynArray<AssetDependency>& OutDeps) const
+{
+    if (Profile.IsValid())
+    {
+        OutDeps.push_back({ Profile.GetID(), AssetType::CollisionProfile });
+    }
+}
@@ -5,6 +5,7 @@
 #include "Core/OpaaxStringID.hpp"
 
 #include "Assets/AssetHandle.hpp"
+#include "Assets/IAsset.hpp"
 #include "ECS/Components/MoverTypes.h"
 #include "Physics/PhysicsTypes.h"
 #include "Physics/Collision/CollisionChannel.h"
@@ -63,6 +64,9 @@ namespace Opaax::ECS
         json Serialize() const override;
         //~ End OpaaxComponentBase Interface
 
+        // Assets Deserialize resolves — recorded in the scene's dependency list for prefetch.
+        void CollectAssetDependencies(TDynArray<AssetDependency>& OutDeps) const;
+
         // =============================================================================
         // Helpers
         // =============================================================================
@@ -66,3 +66,11 @@ void Opaax::ECS::SpriteComponent::DeserializeImplementation(const json& Json)
         OrderInLayer = Json["order"].get<Int16>();
     }
 }
+
+void Opaax::ECS::SpriteComponent::CollectAssetDependencies(TDynArray<AssetDependency>& OutDeps) const
+{
+    if (Texture.IsValid())
+    {
+        OutDeps.push_back({ Texture.GetID(), AssetType::Texture2D });
+    }
+}
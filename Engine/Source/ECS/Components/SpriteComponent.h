@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Assets/AssetHandle.hpp"
+#include "Assets/IAsset.hpp"
 #include "Core/OpaaxMathTypes.h"
 #include "Core/Component/OpaaxComponent.h"
 #include "Renderer/RenderLayer.h"
@@ -48,6 +49,9 @@ namespace Opaax::ECS
         json Serialize() const override;
         //~ End OpaaxComponentBase Interface
 
+        // Assets Deserialize resolves — recorded in the scene's dependency list for prefetch.
+        void CollectAssetDependencies(TDynArray<AssetDependency>& OutDeps) const;
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -26,7 +26,7 @@ namespace Opaax::Editor
         const auto lHandle = AssetRegistry::Load<Texture2D>(InID);
         if (!lHandle.IsValid()) { return; }
 
-        const Texture2D* lTex = lHandle.Get();
+        Texture2D* lTex = lHandle.Get();
 
         constexpr float lMaxSize = 128.f;
         const float lW      = static_cast<float>(lTex->GetWidth());
@@ -41,7 +41,8 @@ namespace Opaax::Editor
         // V-swap UVs (0,1)-(1,0): the texture buffer is bottom-up (stb_image's global
         // set_flip_vertically_on_load(1)) — same storage on both backends, so the UVs are
         // backend-agnostic. The ImGui handle comes from the backend seam (GL name / Vulkan set).
-        const Uint64 lTexID = InUIBackend.GetTextureID(*lTex->GetRHITexture());
+        ITexture2D*  lRHI   = lTex->AcquireRHITexture();   // a previewed texture counts as drawn
+        const Uint64 lTexID = lRHI ? InUIBackend.GetTextureID(*lRHI) : 0;
         if (lTexID != 0)
         {
             ImGui::Image(
@@ -64,9 +65,10 @@ namespace Opaax::Editor
         if (!AssetRegistry::IsLoaded(InID)) { return false; }
 
         const auto lHandle = AssetRegistry::Load<Texture2D>(InID);
-        if (!lHandle.IsValid() || !lHandle.Get()->GetRHITexture()) { return false; }
+        ITexture2D* lRHI = lHandle.IsValid() ? lHandle.Get()->AcquireRHITexture() : nullptr;
+        if (!lRHI) { return false; }
 
-        OutThumb.Handle = InUIBackend.GetTextureID(*lHandle.Get()->GetRHITexture());
+        OutThumb.Handle = InUIBackend.GetTextureID(*lRHI);
         // V-swap (0,1)-(1,0): stb_image's global flip makes the buffer bottom-up (see DrawPreview).
         OutThumb.UV0 = { 0.f, 1.f };
         OutThumb.UV1 = { 1.f, 0.f };
@@ -9,6 +9,7 @@
 #include "Core/CoreEngineApp.h"
 #include "Core/OpaaxPath.h"
 #include "Core/Window.h"
+#include "Core/Jobs/JobSubsystem.h"
 #include "Scene/SceneManager.h"
 #include "Scene/SceneSerializer.h"
 #include "Core/Log/OpaaxLog.h"
@@ -103,6 +104,7 @@ namespace Opaax
         RegisterAssetTypeActions();
         RegisterComponentDrawers();
 
+        m_AssetBrowserPanel.SetJobSystem(GetEngineApp()->GetSubsystem<JobSubsystem>());
         m_AssetBrowserPanel.Startup();
 
         // Editor event bus: panels register handlers here. Tokens stored as panel
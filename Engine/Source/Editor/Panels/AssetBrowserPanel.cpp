@@ -337,14 +337,17 @@ namespace Opaax::Editor
             lConfig.RootDir         = lTarget.RootDir;
             lConfig.ManifestAbsPath = OpaaxPath::ToAbsolute(lTarget.ManifestRelPath);
             lConfig.bFlagMissing    = true;
+            lConfig.CacheAbsPath    = AssetScanner::DefaultCachePath(lConfig.RootDir);
+            lConfig.Jobs            = m_Jobs;
 
             m_LastScanResult = AssetScanner::Scan(lConfig);
 
-            OPAAX_CORE_INFO("AssetBrowserPanel: scan '{}' — +{} new, {} existing, {} missing",
+            OPAAX_CORE_INFO("AssetBrowserPanel: scan '{}' — +{} new, {} existing, {} missing, {} unchanged",
                 lTarget.RootDir,
                 m_LastScanResult.Added,
                 m_LastScanResult.Existing,
-                m_LastScanResult.Missing);
+                m_LastScanResult.Missing,
+                m_LastScanResult.Cached);
         }
 
         // Refresh the on-disk folder cache so the tree shows folders (including empty ones),
@@ -863,9 +866,9 @@ namespace Opaax::Editor
         DrawFolderColorContextMenu(InFullPath);
 
         Uint64 lIconTex = 0;
-        if (ResolveFolderIcon() && m_FolderIcon.Get()->GetRHITexture())
+        if (ResolveFolderIcon())
         {
-            lIconTex = InUIBackend.GetTextureID(*m_FolderIcon.Get()->GetRHITexture());
+            if (ITexture2D* lRHI = m_FolderIcon.Get()->AcquireRHITexture()) { lIconTex = InUIBackend.GetTextureID(*lRHI); }
         }
 
         const Uint32 lColor = GetFolderColor(InFullPath);
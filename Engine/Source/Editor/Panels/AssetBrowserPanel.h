@@ -15,6 +15,7 @@ namespace Opaax
 {
     class SceneManager;
     class IEditorUIBackend;
+    class JobSubsystem;
 }
 
 namespace Opaax::Editor
@@ -75,6 +76,9 @@ namespace Opaax::Editor
         // Public for the OnSceneSavedEvent subscriber + the manual Refresh toolbar button.
         void RunScan();
 
+        // Worker pool the scan enumerates directories on (EditorSubsystem sets it before Startup).
+        void SetJobSystem(JobSubsystem* InJobs) noexcept { m_Jobs = InJobs; }
+
         // Primary entry point — called directly by EditorSubsystem (mirrors HierarchyPanel pattern).
         // The SceneManager is needed to mark the currently loaded scene as such in the list; the
         // UI backend resolves per-backend ImGui texture handles for asset thumbnails.
@@ -132,6 +136,7 @@ namespace Opaax::Editor
         AssetBrowserFilter       m_Filter;
         AssetScanner::ScanResult m_LastScanResult;
         bool                     m_bScanned = false;
+        JobSubsystem*            m_Jobs     = nullptr;   // non-owning; null = scan on the main thread only
 
         // On-disk folder structure (root-relative, e.g. "Textures", "Scenes/Sub"), refreshed every
         // RunScan. Seeds the tree skeleton so empty folders show even without any asset inside them.
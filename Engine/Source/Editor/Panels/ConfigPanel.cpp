@@ -5,6 +5,7 @@
 #include <cstdio>
 #include <imgui.h>
 
+#include "Assets/AssetRegistry.h"
 #include "Core/Config/EngineConfig.h"
 #include "Core/Log/OpaaxLog.h"
 
@@ -47,6 +48,45 @@ namespace Opaax::Editor
                               "Off = pixel-locked at the raw fixed-step pose. Takes effect immediately.");
         }
 
+        // -------------------------------------------------------------------------
+        // Asset cache — AssetRegistry counters as of this frame's UpdateCache.
+        // -------------------------------------------------------------------------
+        ImGui::Dummy(ImVec2(0.f, 6.f));
+        ImGui::SeparatorText("Asset cache (live)");
+
+        const AssetCacheStats& lCache = AssetRegistry::GetCacheStats();
+        char lCacheBuf[128];
+        std::snprintf(lCacheBuf, sizeof(lCacheBuf), "%.2f / %.0f MiB  (%u assets, %u unreferenced)",
+                      static_cast<double>(lCache.ResidentBytes) / (1024.0 * 1024.0),
+                      static_cast<double>(lCache.BudgetBytes)   / (1024.0 * 1024.0),
+                      lCache.ResidentCount, lCache.EvictableCount);
+        InfoRow("Resident", lCacheBuf, lCache.BudgetBytes ? nullptr : "0 = unlimited");
+        std::snprintf(lCacheBuf, sizeof(lCacheBuf), "%u  (%u re-loaded)", lCache.Evictions, lCache.Reloads);
+        InfoRow("Evictions", lCacheBuf);
+
+        if (ImGui::BeginTable("##AssetCache", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp))
+        {
+            ImGui::TableSetupColumn("Type");
+            ImGui::TableSetupColumn("Count");
+            ImGui::TableSetupColumn("KiB");
+            ImGui::TableSetupColumn("Evicted");
+            ImGui::TableSetupColumn("Re-loaded");
+            ImGui::TableHeadersRow();
+            for (Uint8 i = 0; i < static_cast<Uint8>(AssetType::Count); ++i)
+            {
+                const AssetTypeCacheStats& lType = lCache.PerType[i];
+                if (lType.ResidentCount == 0 && lType.Evictions == 0) { continue; }
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(g_AssetTypeIDs[i].ToString().CStr());
+                ImGui::TableNextColumn(); ImGui::Text("%u", lType.ResidentCount);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f", static_cast<double>(lType.ResidentBytes) / 1024.0);
+                ImGui::TableNextColumn(); ImGui::Text("%u", lType.Evictions);
+                ImGui::TableNextColumn(); ImGui::Text("%u", lType.Reloads);
+            }
+            ImGui::EndTable();
+        }
+
         // -------------------------------------------------------------------------
         // Read-only — consumed once at startup, shown as info.
         // -------------------------------------------------------------------------
@@ -68,6 +108,9 @@ namespace Opaax::Editor
         InfoRow("Log level",      EngineConfig::LogLevel().CStr(),          "restart");
         InfoRow("Engine assets",  EngineConfig::EngineAssetsRoot().CStr());
         InfoRow("Asset manifest", EngineConfig::EngineManifestRelPath().CStr());
+        std::snprintf(lBuf, sizeof(lBuf), "%u MiB, %u idle frames",
+                      EngineConfig::AssetCacheBudgetMB(), EngineConfig::AssetCacheEvictFrames());
+        InfoRow("Asset cache budget", lBuf, "restart");
 
         ImGui::Dummy(ImVec2(0.f, 4.f));
         InfoRow("World bounds", EngineConfig::PhysicsWorldBoundsEnabled() ? "enabled" : "disabled",
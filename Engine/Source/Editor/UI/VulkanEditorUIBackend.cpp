@@ -71,6 +71,7 @@ namespace Opaax
         lInfo.QueueFamily         = m_Device->GetGraphicsQueueFamily();
         lInfo.Queue               = m_Device->GetGraphicsQueue();
         lInfo.DescriptorPool      = m_DescriptorPool;
+        lInfo.PipelineCache       = m_Device->GetPipelineCache();   // shared with the engine's pipelines
         lInfo.MinImageCount       = OPAAX_FRAMES_IN_FLIGHT;
         lInfo.ImageCount          = OPAAX_FRAMES_IN_FLIGHT;
         lInfo.UseDynamicRendering = true;
@@ -48,17 +48,20 @@ namespace Opaax
 
 		OPAAX_CORE_INFO("Creating window {0} ({1}, {2})", Props.Title, Props.Width, Props.Height);
 
+		// Backend chosen from engine config — drives init hints, window hints + context creation.
+		const EBackend lBackend = RenderAPI::BackendFromString(EngineConfig::RenderBackend());
+
 		if (!s_GLFWInitialized)
 		{
+			// MUST run before glfwInit (e.g. the null platform for the headless backend).
+			IGraphicsContext::ApplyInitHints(lBackend);
+
 			int bSuccess = glfwInit();
 			OPAAX_CORE_ASSERT(bSuccess)
 			glfwSetErrorCallback(GLFWErrorCallback);
 			s_GLFWInitialized = true;
 		}
 
-		// Backend chosen from engine config — drives window hints + context creation.
-		const EBackend lBackend = RenderAPI::BackendFromString(EngineConfig::RenderBackend());
-
 		// MUST run before glfwCreateWindow (e.g. GLFW_NO_API for Vulkan). No-op for OpenGL.
 		IGraphicsContext::ApplyWindowHints(lBackend);
 
@@ -4,14 +4,16 @@
 // The single neutral translation unit that knows every graphics backend. All
 // backend-selecting factories live here so no backend's TU ever includes another's:
 //   - RenderAPI::Create / BackendFromString / BackendToString
-//   - IGraphicsContext::Create / ApplyWindowHints
+//   - IGraphicsContext::Create / ApplyInitHints / ApplyWindowHints
 //   - every resource I*::Create (IVertexArray, IVertexBuffer, IIndexBuffer, ITexture2D,
-//     IShader, IUniformBuffer, IPipeline, IBindGroup, IFramebuffer)
+//     IShader, IUniformBuffer, IPipeline, IBindGroup, IFramebuffer, ITimestampQueryPool)
 //
 // Each factory dispatches on the active backend: IGraphicsContext::Create/ApplyWindowHints
 // take it as a parameter; the resource factories read RenderAPI::GetBackend() (set by
 // RenderAPI::Create, which always runs before any resource is created in Renderer2D::Init).
 //
+// The Null backend (headless: CPU stubs + NullCommandStream counters) is always built.
+//
 // Vulkan cases are wrapped #if OPAAX_HAS_VULKAN — absent the SDK, "Vulkan" selection falls
 // back to OpenGL (logged).
 // =============================================================================
@@ -25,6 +27,7 @@
 #include "RHI/Pipeline.h"
 #include "RHI/BindGroup.h"
 #include "RHI/Framebuffer.h"
+#include "RHI/QueryPool.h"
 
 #include "RHI/OpenGL/OpenGLRenderAPI.h"
 #include "RHI/OpenGL/OpenGLContext.h"
@@ -36,6 +39,11 @@
 #include "RHI/OpenGL/OpenGLPipeline.h"
 #include "RHI/OpenGL/OpenGLBindGroup.h"
 #include "RHI/OpenGL/OpenGLFramebuffer.h"
+#include "RHI/OpenGL/OpenGLQueryPool.h"
+
+#include "RHI/Null/NullRenderAPI.h"
+#include "RHI/Null/NullContext.h"
+#include "RHI/Null/NullResources.h"
 
 #if OPAAX_HAS_VULKAN
     #include "RHI/Vulkan/VulkanContext.h"
@@ -48,6 +56,7 @@
     #include "RHI/Vulkan/VulkanPipeline.h"
     #include "RHI/Vulkan/VulkanBindGroup.h"
     #include "RHI/Vulkan/VulkanFramebuffer.h"
+    #include "RHI/Vulkan/VulkanQueryPool.h"
 #endif
 
 #include "Core/Log/OpaaxLog.h"
@@ -71,6 +80,7 @@ namespace Opaax
         switch (InBackend)
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLRenderAPI>();
+            case EBackend::Null:   return MakeUnique<NullRenderAPI>();
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanRenderAPI>();
 #endif
@@ -85,6 +95,7 @@ namespace Opaax
     EBackend RenderAPI::BackendFromString(const OpaaxString& InName)
     {
         if (InName == "OpenGL") { return EBackend::OpenGL; }
+        if (InName == "Null")   { return EBackend::Null;   }
 
         if (InName == "Vulkan")
         {
@@ -107,6 +118,7 @@ namespace Opaax
         {
             case EBackend::OpenGL: return "OpenGL";
             case EBackend::Vulkan: return "Vulkan";
+            case EBackend::Null:   return "Null";
         }
         return "Unknown";
     }
@@ -120,6 +132,8 @@ namespace Opaax
         {
             case EBackend::OpenGL:
                 return MakeUnique<OpenGLContext>(static_cast<GLFWwindow*>(InNativeWindow));
+            case EBackend::Null:
+                return MakeUnique<NullContext>(static_cast<GLFWwindow*>(InNativeWindow));
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan:
                 return MakeUnique<VulkanContext>(static_cast<GLFWwindow*>(InNativeWindow));
@@ -131,6 +145,16 @@ namespace Opaax
         return nullptr;
     }
 
+    void IGraphicsContext::ApplyInitHints(EBackend InBackend)
+    {
+        // Null: GLFW's null platform — no display server needed, windows are bookkeeping only.
+        // Every other backend keeps GLFW's automatic platform selection.
+        if (InBackend == EBackend::Null)
+        {
+            glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        }
+    }
+
     void IGraphicsContext::ApplyWindowHints(EBackend InBackend)
     {
         switch (InBackend)
@@ -143,6 +167,12 @@ namespace Opaax
             case EBackend::Vulkan:
                 glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
                 break;
+
+            // Null: no client API and never shown (headless CI / benchmarks).
+            case EBackend::Null:
+                glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+                glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+                break;
         }
     }
 
@@ -155,6 +185,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLVertexArray>();
+            case EBackend::Null:   return MakeUnique<NullVertexArray>();
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanVertexArray>();
 #endif
@@ -168,6 +199,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLVertexBuffer>(InSize);
+            case EBackend::Null:   return MakeUnique<NullVertexBuffer>(InSize);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanVertexBuffer>(InSize);
 #endif
@@ -181,6 +213,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLVertexBuffer>(InVertices, InSize);
+            case EBackend::Null:   return MakeUnique<NullVertexBuffer>(InVertices, InSize);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanVertexBuffer>(InVertices, InSize);
 #endif
@@ -194,6 +227,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLIndexBuffer>(InIndices, InCount);
+            case EBackend::Null:   return MakeUnique<NullIndexBuffer>(InIndices, InCount);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanIndexBuffer>(InIndices, InCount);
 #endif
@@ -207,6 +241,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLTexture2D>(InPath);
+            case EBackend::Null:   return MakeUnique<NullTexture2D>(InPath);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanTexture2D>(InPath);
 #endif
@@ -220,6 +255,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLTexture2D>(InWidth, InHeight);
+            case EBackend::Null:   return MakeUnique<NullTexture2D>(InWidth, InHeight);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanTexture2D>(InWidth, InHeight);
 #endif
@@ -233,6 +269,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLTexture2D>(InData, InWidth, InHeight, InChannels);
+            case EBackend::Null:   return MakeUnique<NullTexture2D>(InData, InWidth, InHeight, InChannels);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanTexture2D>(InData, InWidth, InHeight, InChannels);
 #endif
@@ -241,11 +278,26 @@ namespace Opaax
         OPAAX_CORE_ERROR("ITexture2D::Create — backend not available."); return nullptr;
     }
 
+    UniquePtr<ITexture2D> ITexture2D::Create(const TextureDesc& InDesc)
+    {
+        switch (RenderAPI::GetBackend())
+        {
+            case EBackend::OpenGL: return MakeUnique<OpenGLTexture2D>(InDesc);
+            case EBackend::Null:   return MakeUnique<NullTexture2D>(InDesc);
+#if OPAAX_HAS_VULKAN
+            case EBackend::Vulkan: return MakeUnique<VulkanTexture2D>(InDesc);
+#endif
+            default: break;
+        }
+        OPAAX_CORE_ERROR("ITexture2D::Create — backend not available."); return nullptr;
+    }
+
     UniquePtr<IShader> IShader::Create(const ShaderDesc& InDesc)
     {
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLShader>(InDesc);
+            case EBackend::Null:   return MakeUnique<NullShader>(InDesc);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanShader>(InDesc);
 #endif
@@ -259,6 +311,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLUniformBuffer>(InSize, InBinding);
+            case EBackend::Null:   return MakeUnique<NullUniformBuffer>(InSize, InBinding);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanUniformBuffer>(InSize, InBinding);
 #endif
@@ -272,6 +325,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLPipeline>(InDesc);
+            case EBackend::Null:   return MakeUnique<NullPipeline>(InDesc);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanPipeline>(InDesc);
 #endif
@@ -285,6 +339,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLBindGroup>(InLayout);
+            case EBackend::Null:   return MakeUnique<NullBindGroup>(InLayout);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanBindGroup>(InLayout);
 #endif
@@ -298,6 +353,7 @@ namespace Opaax
         switch (RenderAPI::GetBackend())
         {
             case EBackend::OpenGL: return MakeUnique<OpenGLFramebuffer>(InSpec);
+            case EBackend::Null:   return MakeUnique<NullFramebuffer>(InSpec);
 #if OPAAX_HAS_VULKAN
             case EBackend::Vulkan: return MakeUnique<VulkanFramebuffer>(InSpec);
 #endif
@@ -306,4 +362,18 @@ namespace Opaax
         OPAAX_CORE_ERROR("IFramebuffer::Create — backend not available."); return nullptr;
     }
 
+    UniquePtr<ITimestampQueryPool> ITimestampQueryPool::Create(Uint32 InCapacity)
+    {
+        switch (RenderAPI::GetBackend())
+        {
+            case EBackend::OpenGL: return MakeUnique<OpenGLTimestampQueryPool>(InCapacity);
+            case EBackend::Null:   return MakeUnique<NullTimestampQueryPool>(InCapacity);
+#if OPAAX_HAS_VULKAN
+            case EBackend::Vulkan: return MakeUnique<VulkanTimestampQueryPool>(InCapacity);
+#endif
+            default: break;
+        }
+        OPAAX_CORE_ERROR("ITimestampQueryPool::Create — backend not available."); return nullptr;
+    }
+
 } // namespace Opaax
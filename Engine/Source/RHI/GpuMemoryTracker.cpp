@@ -0,0 +1,110 @@
+#include "GpuMemoryTracker.h"
+
+#include <algorithm>
+
+namespace Opaax
+{
+    namespace
+    {
+        constexpr Uint32 k_CategoryCount = GpuMemoryStats::CategoryCount;
+
+        std::atomic<Uint64> s_Bytes[k_CategoryCount]       = {};
+        std::atomic<Uint32> s_Allocations[k_CategoryCount] = {};
+        std::atomic<Uint64> s_DeviceUsage{ 0 };
+        std::atomic<Uint64> s_DeviceBudget{ 0 };
+
+        std::mutex                   s_AssetMutex;
+        UnorderedMap<Uint32, Uint64> s_AssetBytes;
+    }
+
+    const char* ToString(EGpuMemoryCategory InCategory) noexcept
+    {
+        switch (InCategory)
+        {
+            case EGpuMemoryCategory::Texture:       return "Texture";
+            case EGpuMemoryCategory::VertexBuffer:  return "VertexBuffer";
+            case EGpuMemoryCategory::IndexBuffer:   return "IndexBuffer";
+            case EGpuMemoryCategory::UniformBuffer: return "UniformBuffer";
+            case EGpuMemoryCategory::RenderTarget:  return "RenderTarget";
+            case EGpuMemoryCategory::Transient:     return "Transient";
+            case EGpuMemoryCategory::Staging:       return "Staging";
+            default:                                return "Unknown";
+        }
+    }
+
+    void GpuMemoryTracker::Allocate(EGpuMemoryCategory InCategory, Uint64 InBytes) noexcept
+    {
+        const Uint32 lIndex = static_cast<Uint32>(InCategory);
+        if (lIndex >= k_CategoryCount) { return; }
+
+        s_Bytes[lIndex].fetch_add(InBytes, std::memory_order_relaxed);
+        s_Allocations[lIndex].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void GpuMemoryTracker::Free(EGpuMemoryCategory InCategory, Uint64 InBytes) noexcept
+    {
+        const Uint32 lIndex = static_cast<Uint32>(InCategory);
+        if (lIndex >= k_CategoryCount) { return; }
+
+        s_Bytes[lIndex].fetch_sub(InBytes, std::memory_order_relaxed);
+        s_Allocations[lIndex].fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void GpuMemoryTracker::SetAssetBytes(Uint32 InAssetID, Uint64 InBytes)
+    {
+        std::scoped_lock lLock(s_AssetMutex);
+        if (InBytes == 0) { s_AssetBytes.erase(InAssetID); }
+        else              { s_AssetBytes[InAssetID] = InBytes; }
+    }
+
+    Uint64 GpuMemoryTracker::GetAssetBytes(Uint32 InAssetID)
+    {
+        std::scoped_lock lLock(s_AssetMutex);
+        const auto lIt = s_AssetBytes.find(InAssetID);
+        return lIt != s_AssetBytes.end() ? lIt->second : 0;
+    }
+
+    void GpuMemoryTracker::GetAssetBreakdown(TDynArray<std::pair<Uint32, Uint64>>& OutAssets)
+    {
+        {
+            std::scoped_lock lLock(s_AssetMutex);
+            OutAssets.assign(s_AssetBytes.begin(), s_AssetBytes.end());
+        }
+        std::sort(OutAssets.begin(), OutAssets.end(),
+                  [](const auto& InA, const auto& InB) { return InA.second > InB.second; });
+    }
+
+    void GpuMemoryTracker::SetDeviceMemory(Uint64 InUsage, Uint64 InBudget) noexcept
+    {
+        s_DeviceUsage.store(InUsage, std::memory_order_relaxed);
+        s_DeviceBudget.store(InBudget, std::memory_order_relaxed);
+    }
+
+    GpuMemoryStats GpuMemoryTracker::GetStats() noexcept
+    {
+        GpuMemoryStats lStats;
+        for (Uint32 i = 0; i < k_CategoryCount; ++i)
+        {
+            lStats.Bytes[i]       = s_Bytes[i].load(std::memory_order_relaxed);
+            lStats.Allocations[i] = s_Allocations[i].load(std::memory_order_relaxed);
+        }
+        lStats.DeviceUsage  = s_DeviceUsage.load(std::memory_order_relaxed);
+        lStats.DeviceBudget = s_DeviceBudget.load(std::memory_order_relaxed);
+        return lStats;
+    }
+
+    void GpuMemoryTracker::Reset()
+    {
+        for (Uint32 i = 0; i < k_CategoryCount; ++i)
+        {
+            s_Bytes[i].store(0, std::memory_order_relaxed);
+            s_Allocations[i].store(0, std::memory_order_relaxed);
+        }
+        s_DeviceUsage.store(0, std::memory_order_relaxed);
+        s_DeviceBudget.store(0, std::memory_order_relaxed);
+
+        std::scoped_lock lLock(s_AssetMutex);
+        s_AssetBytes.clear();
+    }
+
+} // namespace Opaax
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    // =============================================================================
+    // EGpuMemoryCategory
+    // =============================================================================
+    // What a tracked GPU allocation is for. Transient = per-frame dynamic data (Vulkan frame
+    // allocator pages); Staging = upload staging memory.
+    enum class EGpuMemoryCategory : Uint8
+    {
+        Texture,
+        VertexBuffer,
+        IndexBuffer,
+        UniformBuffer,
+        RenderTarget,
+        Transient,
+        Staging,
+
+        Count
+    };
+
+    OPAAX_API const char* ToString(EGpuMemoryCategory InCategory) noexcept;
+
+    /**
+     * Snapshot of GpuMemoryTracker. Bytes/Allocations are the engine's own bookkeeping per
+     * category; DeviceUsage/DeviceBudget are what the driver reports for device-local memory
+     * (VMA heap budgets on Vulkan, 0 on backends that cannot query it).
+     */
+    struct GpuMemoryStats
+    {
+        static constexpr Uint32 CategoryCount = static_cast<Uint32>(EGpuMemoryCategory::Count);
+
+        Uint64 Bytes[CategoryCount]       = {};
+        Uint32 Allocations[CategoryCount] = {};
+        Uint64 DeviceUsage  = 0;
+        Uint64 DeviceBudget = 0;
+
+        Uint64 GetBytes(EGpuMemoryCategory InCategory) const noexcept { return Bytes[static_cast<Uint32>(InCategory)]; }
+
+        Uint64 GetTotalBytes() const noexcept
+        {
+            Uint64 lTotal = 0;
+            for (Uint64 lBytes : Bytes) { lTotal += lBytes; }
+            return lTotal;
+        }
+    };
+
+    // =============================================================================
+    // GpuMemoryTracker
+    // =============================================================================
+    /**
+     * @class GpuMemoryTracker
+     *
+     * Process-wide accounting of GPU memory the engine holds. Backend resources report their
+     * allocations per category (OpenGL from the sizes it passes to glTextureStorage / glBufferData,
+     * Vulkan from the VMA allocation size) and Texture2D attributes its bytes to its asset ID, so
+     * "which textures cost what" is answerable without a GPU debugger. Same static shape as
+     * NullCommandStream — resources are built by the parameterless BackendFactory and have no
+     * handle to a device object to report to.
+     *
+     * Category counters are atomics (Allocate/Free are safe from any thread). The per-asset table
+     * takes a mutex; it changes only on texture load / evict / destroy.
+     */
+    class OPAAX_API GpuMemoryTracker
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        static void Allocate(EGpuMemoryCategory InCategory, Uint64 InBytes) noexcept;
+        static void Free(EGpuMemoryCategory InCategory, Uint64 InBytes) noexcept;
+
+        // Bytes currently attributed to an asset (Texture2D's GPU copy). 0 drops the entry.
+        static void   SetAssetBytes(Uint32 InAssetID, Uint64 InBytes);
+        static Uint64 GetAssetBytes(Uint32 InAssetID);
+
+        // Copy of the per-asset table, largest first — for tooling / the stats overlay.
+        static void GetAssetBreakdown(TDynArray<std::pair<Uint32, Uint64>>& OutAssets);
+
+        // Driver-reported device-local usage / budget (Vulkan refreshes this every frame).
+        static void SetDeviceMemory(Uint64 InUsage, Uint64 InBudget) noexcept;
+
+        static GpuMemoryStats GetStats() noexcept;
+
+        // Drop everything (backend teardown / tests).
+        static void Reset();
+    };
+
+} // namespace Opaax
@@ -22,6 +22,34 @@ namespace Opaax
         Load
     };
 
+    // =============================================================================
+    // CommandStateStats
+    // =============================================================================
+    // Redundant-state filtering counters for one frame: pipeline / vertex-array binds, texture-unit
+    // binds and descriptor writes that reached the API vs. the ones skipped because the bound state
+    // already matched.
+    struct CommandStateStats
+    {
+        Uint32 Issued  = 0;
+        Uint32 Skipped = 0;
+    };
+
+    // =============================================================================
+    // DrawIndexedIndirectCommand
+    // =============================================================================
+    // One indexed draw of an indirect submission. Field order and size match both GL's
+    // DrawElementsIndirectCommand and VkDrawIndexedIndirectCommand, so backends copy the
+    // array into their indirect buffer as-is.
+    struct DrawIndexedIndirectCommand
+    {
+        Uint32 IndexCount    = 0;
+        Uint32 InstanceCount = 1;
+        Uint32 FirstIndex    = 0;
+        Int32  VertexOffset  = 0;   // added to every index (base vertex)
+        Uint32 FirstInstance = 0;
+    };
+    static_assert(sizeof(DrawIndexedIndirectCommand) == 20, "must match the GL / Vulkan indirect layout");
+
     // =============================================================================
     // ICommandBuffer
     // =============================================================================
@@ -35,7 +63,9 @@ namespace Opaax
      * call appends to the live VkCommandBuffer.
      *
      * Render targets, pipelines, bind groups and vertex arrays are created through
-     * their own factories; the command buffer only binds + draws with them.
+     * their own factories; the command buffer only binds + draws with them. Backends
+     * track what is bound within a pass and drop binds that would not change anything,
+     * so callers may rebind every batch without paying for it.
      */
     class OPAAX_API ICommandBuffer
     {
@@ -65,6 +95,37 @@ namespace Opaax
         virtual void BindVertexArray(IVertexArray& InVertexArray) = 0;
 
         virtual void DrawIndexed(Uint32 InIndexCount) = 0;
+
+        /**
+         * Submit InCount indexed draws with the currently bound state in one call (GL
+         * glMultiDrawElementsIndirect, Vulkan vkCmdDrawIndexedIndirect). The commands are
+         * copied into a backend-owned indirect buffer, so InCommands may be reused at once.
+         * Only valid when SupportsDrawIndirect() — callers fall back to DrawIndexed per batch.
+         */
+        virtual bool SupportsDrawIndirect() const = 0;
+        virtual void DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount) = 0;
+
+        // =============================================================================
+        // Secondary recording
+        // =============================================================================
+    public:
+        /**
+         * Replay a secondary recorder into this (the frame's) command buffer. InSecondary is one of
+         * IRenderAPI::GetSecondaryCommandBuffer's, recorded this frame — possibly on another thread —
+         * with exactly one BeginRenderPass/EndRenderPass bracket. The secondary only captures that
+         * bracket's target / load op / clear color; the pass is opened here, the recorded commands
+         * run inside it, and it is closed again. Recording must have finished before the call.
+         * Backends without secondary recording (OpenGL) log an error and draw nothing.
+         */
+        virtual void ExecuteSecondary(ICommandBuffer& InSecondary) = 0;
+
+        // =============================================================================
+        // Stats
+        // =============================================================================
+    public:
+        // Issued vs. skipped state changes since the frame began. Backends that do no
+        // filtering report zeros.
+        virtual CommandStateStats GetStateStats() const { return {}; }
     };
 
 } // namespace Opaax
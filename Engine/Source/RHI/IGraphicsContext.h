@@ -42,6 +42,13 @@ namespace Opaax
          */
         static UniquePtr<IGraphicsContext> Create(EBackend InBackend, void* InNativeWindow);
 
+        /**
+         * Apply backend-specific GLFW init hints. MUST run before glfwInit.
+         * Null: GLFW_PLATFORM_NULL (no display server). Others: no-op.
+         * @param InBackend selected graphics backend
+         */
+        static void ApplyInitHints(EBackend InBackend);
+
         /**
          * Apply backend-specific GLFW window hints. MUST run before glfwCreateWindow.
          * OpenGL: no-op (driver default, behavior-preserving). Vulkan: GLFW_NO_API.
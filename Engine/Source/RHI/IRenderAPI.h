@@ -48,6 +48,15 @@ namespace Opaax
         // The frame's recorder, valid between BeginFrame and EndFrame.
         virtual ICommandBuffer& GetCommandBuffer() = 0;
 
+        /**
+         * Secondary recorders for parallel pass recording (RenderPipeline). Each may be recorded on
+         * its own thread between BeginFrame and EndFrame, one thread per recorder, then replayed in
+         * order through the frame's command buffer (ICommandBuffer::ExecuteSecondary). A count of 0
+         * means the backend records on one thread only (OpenGL — the context lives on the render thread).
+         */
+        virtual Uint32          GetSecondaryCommandBufferCount() const        { return 0; }
+        virtual ICommandBuffer* GetSecondaryCommandBuffer(Uint32 /*InIndex*/) { return nullptr; }
+
         // Global viewport set (window-resize path; per-pass viewport rides BeginRenderPass).
         virtual void SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height) = 0;
 
@@ -57,6 +66,14 @@ namespace Opaax
          * (glFinish); an explicit backend (Vulkan) waits the device idle.
          */
         virtual void WaitIdle() = 0;
+
+        /**
+         * Per-frame transient GPU memory (dynamic vertex / uniform data) handed out so far this
+         * frame, and the capacity currently reserved for it, in bytes. 0 on backends that write
+         * dynamic data in place (OpenGL, Null) — Vulkan reports its VulkanFrameAllocator.
+         */
+        virtual Uint64 GetFrameMemoryUsed()     const { return 0; }
+        virtual Uint64 GetFrameMemoryCapacity() const { return 0; }
     };
 
 } // namespace Opaax
@@ -0,0 +1,116 @@
+#include "NullCommandBuffer.h"
+
+#include "NullCommandStream.h"
+#include "Renderer/RenderTarget.hpp"
+#include "Core/Log/OpaaxLog.h"
+
+namespace Opaax
+{
+    namespace
+    {
+        FORCEINLINE Uint64 AddressOf(const void* InPtr) noexcept
+        {
+            return static_cast<Uint64>(reinterpret_cast<uintptr_t>(InPtr));
+        }
+    }
+
+    void NullCommandBuffer::Record(ENullCommand InType, Uint64 InArg)
+    {
+        if (!m_bSecondary)
+        {
+            NullCommandStream::Record(InType, InArg);
+        }
+        else if (NullCommandStream::IsRecording())
+        {
+            m_LocalCommands.push_back({ InType, InArg });
+        }
+    }
+
+    void NullCommandBuffer::BeginRenderPass(IRenderTarget& InTarget, ELoadOp InLoadOp, const Vector4F& /*InClearColor*/)
+    {
+        // Keep the target's Bind/Unbind bracket — an editor FBO target still expects it.
+        m_CurrentTarget = &InTarget;
+        InTarget.Bind();
+
+        ++Counters().RenderPasses;
+        Record(ENullCommand::BeginRenderPass, InLoadOp == ELoadOp::Clear ? 1u : 0u);
+    }
+
+    void NullCommandBuffer::EndRenderPass()
+    {
+        if (m_CurrentTarget)
+        {
+            m_CurrentTarget->Unbind();
+            m_CurrentTarget = nullptr;
+        }
+        Record(ENullCommand::EndRenderPass, 0u);
+    }
+
+    void NullCommandBuffer::SetViewport(Uint32 /*X*/, Uint32 /*Y*/, Uint32 Width, Uint32 Height)
+    {
+        Record(ENullCommand::SetViewport, (static_cast<Uint64>(Width) << 32) | Height);
+    }
+
+    void NullCommandBuffer::BindPipeline(IPipeline& InPipeline)
+    {
+        NullFrameCounters& lC = Counters();
+        ++lC.PipelineBinds;
+        if (m_CurrentPipeline != &InPipeline) { ++lC.PipelineChanges; m_CurrentPipeline = &InPipeline; }
+        Record(ENullCommand::BindPipeline, AddressOf(&InPipeline));
+    }
+
+    void NullCommandBuffer::BindBindGroup(IBindGroup& InBindGroup)
+    {
+        // A bind group's contents change between draws (Renderer2D rewrites its textures), so a
+        // same-object re-bind is not necessarily redundant — counted as a bind, not a change.
+        NullFrameCounters& lC = Counters();
+        ++lC.BindGroupBinds;
+        if (m_CurrentBindGroup != &InBindGroup) { ++lC.BindGroupChanges; m_CurrentBindGroup = &InBindGroup; }
+        Record(ENullCommand::BindBindGroup, AddressOf(&InBindGroup));
+    }
+
+    void NullCommandBuffer::BindVertexArray(IVertexArray& InVertexArray)
+    {
+        NullFrameCounters& lC = Counters();
+        ++lC.VertexArrayBinds;
+        if (m_CurrentVertexArray != &InVertexArray) { ++lC.VertexArrayChanges; m_CurrentVertexArray = &InVertexArray; }
+        Record(ENullCommand::BindVertexArray, AddressOf(&InVertexArray));
+    }
+
+    void NullCommandBuffer::DrawIndexed(Uint32 InIndexCount)
+    {
+        NullFrameCounters& lC = Counters();
+        ++lC.DrawCalls;
+        lC.IndicesDrawn += InIndexCount;
+        Record(ENullCommand::DrawIndexed, InIndexCount);
+    }
+
+    void NullCommandBuffer::DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount)
+    {
+        NullFrameCounters& lC = Counters();
+        ++lC.DrawCalls;
+        lC.IndirectDraws += InCount;
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            lC.IndicesDrawn += static_cast<Uint64>(InCommands[i].IndexCount) * InCommands[i].InstanceCount;
+        }
+        Record(ENullCommand::DrawIndexedIndirect, InCount);
+    }
+
+    void NullCommandBuffer::ExecuteSecondary(ICommandBuffer& InSecondary)
+    {
+        // Backend invariant: the null API only hands out NullCommandBuffer secondaries.
+        auto& lSecondary = static_cast<NullCommandBuffer&>(InSecondary);
+        if (m_bSecondary || !lSecondary.m_bSecondary)
+        {
+            OPAAX_CORE_ERROR("NullCommandBuffer: ExecuteSecondary needs a primary recorder and a secondary argument.");
+            return;
+        }
+
+        NullCommandStream::Merge(lSecondary.m_Local, lSecondary.m_LocalCommands);
+        lSecondary.ResetFrameState();
+
+        // The secondary's binds were not made on this recorder — nothing here is known bound.
+        ResetFrameState();
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "RHI/ICommandBuffer.h"
+#include "RHI/Null/NullCommandStream.h"
+
+namespace Opaax
+{
+    class IRenderTarget;
+
+    /**
+     * @class NullCommandBuffer
+     *
+     * Headless ICommandBuffer. Executes nothing; counts every call into NullCommandStream
+     * (and appends it to the command list while recording). Tracks the last bound pipeline /
+     * bind group / vertex array so bind *changes* are told apart from redundant re-binds.
+     * NullRenderAPI reuses one instance per frame and calls ResetFrameState in BeginFrame.
+     *
+     * A secondary instance (NullRenderAPI's parallel-recording recorders) counts into its own
+     * counters + list instead, so it can record on a worker thread; the primary's ExecuteSecondary
+     * merges them into NullCommandStream in call order and clears the secondary.
+     */
+    class OPAAX_API NullCommandBuffer final : public ICommandBuffer
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit NullCommandBuffer(bool InSecondary = false) : m_bSecondary(InSecondary) {}
+        ~NullCommandBuffer() override = default;
+
+        // =============================================================================
+        // Function
+        // =============================================================================
+    public:
+        // Forget the bound objects (a new frame starts with nothing bound).
+        void ResetFrameState() noexcept
+        {
+            m_CurrentTarget      = nullptr;
+            m_CurrentPipeline    = nullptr;
+            m_CurrentBindGroup   = nullptr;
+            m_CurrentVertexArray = nullptr;
+            m_Local              = NullFrameCounters{};
+            m_LocalCommands.clear();
+        }
+
+        bool IsSecondary() const noexcept { return m_bSecondary; }
+
+        // Counters not yet merged into the stream (secondary only; always zero on a primary).
+        const NullFrameCounters& GetLocalCounters() const noexcept { return m_Local; }
+
+    private:
+        NullFrameCounters& Counters() noexcept { return m_bSecondary ? m_Local : NullCommandStream::Counters(); }
+        void               Record(ENullCommand InType, Uint64 InArg);
+
+        // =============================================================================
+        // Override
+        // =============================================================================
+        //~Begin ICommandBuffer interface
+    public:
+        void BeginRenderPass(IRenderTarget& InTarget, ELoadOp InLoadOp, const Vector4F& InClearColor) override;
+        void EndRenderPass() override;
+
+        void SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height) override;
+
+        void BindPipeline(IPipeline& InPipeline)          override;
+        void BindBindGroup(IBindGroup& InBindGroup)       override;
+        void BindVertexArray(IVertexArray& InVertexArray) override;
+
+        void DrawIndexed(Uint32 InIndexCount) override;
+
+        // Modelled as a multi-draw-capable device, so headless runs exercise the grouped path.
+        bool SupportsDrawIndirect() const override { return true; }
+        void DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount) override;
+
+        void ExecuteSecondary(ICommandBuffer& InSecondary) override;
+        //~End ICommandBuffer interface
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        IRenderTarget* m_CurrentTarget      = nullptr;
+        const void*    m_CurrentPipeline    = nullptr;
+        const void*    m_CurrentBindGroup   = nullptr;
+        const void*    m_CurrentVertexArray = nullptr;
+
+        bool                   m_bSecondary = false;
+        NullFrameCounters      m_Local;           // secondary: counted here until merged
+        TDynArray<NullCommand> m_LocalCommands;   // secondary: recorded here (while recording is on)
+    };
+}
@@ -0,0 +1,75 @@
+#include "NullCommandStream.h"
+
+#include <mutex>
+#include <utility>
+
+namespace Opaax
+{
+    namespace
+    {
+        std::mutex s_Mutex;   // s_Commands + the upload counters (workers upload mid-recording)
+    }
+
+    bool                   NullCommandStream::s_Recording  = false;
+    NullFrameCounters      NullCommandStream::s_Current    = {};
+    NullFrameCounters      NullCommandStream::s_Last       = {};
+    TDynArray<NullCommand> NullCommandStream::s_Commands;
+    TDynArray<NullCommand> NullCommandStream::s_LastCommands;
+    Uint64                 NullCommandStream::s_FrameCount = 0;
+
+    void NullCommandStream::BeginFrame()
+    {
+        std::scoped_lock lLock(s_Mutex);
+        s_Last    = s_Current;
+        s_Current = NullFrameCounters{};
+
+        // Swap keeps both vectors' capacity — recording reallocates only while the frame grows.
+        std::swap(s_LastCommands, s_Commands);
+        s_Commands.clear();
+
+        ++s_FrameCount;
+    }
+
+    void NullCommandStream::Record(ENullCommand InType, Uint64 InArg)
+    {
+        if (s_Recording)
+        {
+            std::scoped_lock lLock(s_Mutex);
+            s_Commands.push_back({ InType, InArg });
+        }
+    }
+
+    void NullCommandStream::Upload(Uint64 InBytes)
+    {
+        std::scoped_lock lLock(s_Mutex);
+        ++s_Current.Uploads;
+        s_Current.BytesUploaded += InBytes;
+        if (s_Recording)
+        {
+            s_Commands.push_back({ ENullCommand::Upload, InBytes });
+        }
+    }
+
+    void NullCommandStream::Merge(const NullFrameCounters& InCounters, const TDynArray<NullCommand>& InCommands)
+    {
+        std::scoped_lock lLock(s_Mutex);
+        s_Current.Add(InCounters);
+        ++s_Current.SecondaryExecutes;
+        if (s_Recording)
+        {
+            s_Commands.push_back({ ENullCommand::ExecuteSecondary, static_cast<Uint64>(InCommands.size()) });
+            s_Commands.insert(s_Commands.end(), InCommands.begin(), InCommands.end());
+        }
+    }
+
+    void NullCommandStream::Reset()
+    {
+        std::scoped_lock lLock(s_Mutex);
+        s_Current    = NullFrameCounters{};
+        s_Last       = NullFrameCounters{};
+        s_Commands.clear();
+        s_LastCommands.clear();
+        s_FrameCount = 0;
+    }
+
+} // namespace Opaax
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    // =============================================================================
+    // ENullCommand
+    // =============================================================================
+    // One recorded operation on the null backend. NullCommand::Arg meaning per type is noted.
+    enum class ENullCommand : Uint8
+    {
+        BeginRenderPass,   // Arg: 1 = clear, 0 = load
+        EndRenderPass,     // Arg: 0
+        SetViewport,       // Arg: (Width << 32) | Height
+        BindPipeline,      // Arg: pipeline address
+        BindBindGroup,     // Arg: bind group address
+        BindVertexArray,   // Arg: vertex array address
+        DrawIndexed,       // Arg: index count
+        Upload,            // Arg: byte count (vertex/index/uniform/texture data)
+        DrawIndexedIndirect, // Arg: draw count in the submission
+        ExecuteSecondary     // Arg: commands replayed from the secondary (its list follows)
+    };
+
+    struct NullCommand
+    {
+        ENullCommand Type = ENullCommand::DrawIndexed;
+        Uint64       Arg  = 0;
+    };
+
+    /**
+     * Per-frame counters of everything the null backend was asked to do. "Binds" counts every bind
+     * call; "Changes" only those that bound a different object than the one already bound — the gap
+     * is redundant state the renderer could have skipped.
+     */
+    struct NullFrameCounters
+    {
+        Uint32 RenderPasses       = 0;
+        Uint32 DrawCalls          = 0;   // submissions: one per DrawIndexed / DrawIndexedIndirect
+        Uint32 IndirectDraws      = 0;   // draws packed into DrawIndexedIndirect submissions
+        Uint64 IndicesDrawn       = 0;
+        Uint32 Uploads            = 0;
+        Uint64 BytesUploaded      = 0;
+        Uint32 PipelineBinds      = 0;
+        Uint32 PipelineChanges    = 0;
+        Uint32 BindGroupBinds     = 0;
+        Uint32 BindGroupChanges   = 0;
+        Uint32 VertexArrayBinds   = 0;
+        Uint32 VertexArrayChanges = 0;
+        Uint32 SecondaryExecutes  = 0;   // secondary recorders replayed into the frame
+
+        void Add(const NullFrameCounters& InOther) noexcept
+        {
+            RenderPasses       += InOther.RenderPasses;
+            DrawCalls          += InOther.DrawCalls;
+            IndirectDraws      += InOther.IndirectDraws;
+            IndicesDrawn       += InOther.IndicesDrawn;
+            Uploads            += InOther.Uploads;
+            BytesUploaded      += InOther.BytesUploaded;
+            PipelineBinds      += InOther.PipelineBinds;
+            PipelineChanges    += InOther.PipelineChanges;
+            BindGroupBinds     += InOther.BindGroupBinds;
+            BindGroupChanges   += InOther.BindGroupChanges;
+            VertexArrayBinds   += InOther.VertexArrayBinds;
+            VertexArrayChanges += InOther.VertexArrayChanges;
+            SecondaryExecutes  += InOther.SecondaryExecutes;
+        }
+    };
+
+    // =============================================================================
+    // NullCommandStream
+    // =============================================================================
+    /**
+     * @class NullCommandStream
+     *
+     * Process-wide sink for the null backend's command stream. Stub resources (buffer/texture
+     * uploads) are built by the parameterless BackendFactory and have no handle to the render API,
+     * so they report here — the same static shape as VulkanFrameContext.
+     *
+     * Counters are always kept (a few adds per call). The full command list is kept only while
+     * recording is on (render.nullRecordCommands, or SetRecording) — it grows with the frame.
+     * NullRenderAPI::BeginFrame calls BeginFrame, which publishes the frame just finished:
+     * GetLastFrame / GetLastCommands read that published copy.
+     *
+     * Record / Upload / Merge take a lock: stub resources upload from job workers while passes
+     * record in parallel. Secondary NullCommandBuffers keep their own counters + list and Merge
+     * them in at ExecuteSecondary, so the published stream stays in pass order.
+     */
+    class OPAAX_API NullCommandStream
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        static void BeginFrame();
+
+        static void SetRecording(bool InEnabled) noexcept { s_Recording = InEnabled; }
+        static bool IsRecording()                noexcept { return s_Recording; }
+
+        // Append a command (list only while recording). Counters are the caller's job — see Counters().
+        static void Record(ENullCommand InType, Uint64 InArg);
+
+        // Count + record a data upload.
+        static void Upload(Uint64 InBytes);
+
+        // Append a secondary recorder's counters + command list, in order (ExecuteSecondary).
+        static void Merge(const NullFrameCounters& InCounters, const TDynArray<NullCommand>& InCommands);
+
+        // In-flight frame's counters (mutable — the command buffer bumps them directly).
+        static NullFrameCounters& Counters() noexcept { return s_Current; }
+
+        static const NullFrameCounters&      GetLastFrame()    noexcept { return s_Last; }
+        static const TDynArray<NullCommand>& GetLastCommands() noexcept { return s_LastCommands; }
+        static Uint64                        GetFrameCount()   noexcept { return s_FrameCount; }
+
+        // Drop everything (backend teardown / between benchmark runs).
+        static void Reset();
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        static bool                   s_Recording;
+        static NullFrameCounters      s_Current;
+        static NullFrameCounters      s_Last;
+        static TDynArray<NullCommand> s_Commands;
+        static TDynArray<NullCommand> s_LastCommands;
+        static Uint64                 s_FrameCount;
+    };
+
+} // namespace Opaax
@@ -0,0 +1,42 @@
+#include "NullContext.h"
+
+#include "Core/Config/EngineConfig.h"
+#include "Core/Log/OpaaxLog.h"
+
+#include <GLFW/glfw3.h>
+
+namespace Opaax
+{
+    // NOTE: IGraphicsContext::Create + ApplyInitHints/ApplyWindowHints (backend dispatch) live in
+    //   RHI/BackendFactory.cpp.
+
+    NullContext::NullContext(GLFWwindow* InWindow)
+        : m_Window(InWindow)
+    {
+    }
+
+    bool NullContext::Init()
+    {
+        m_FrameLimit = EngineConfig::NullFrameLimit();
+        if (m_FrameLimit > 0)
+        {
+            OPAAX_CORE_INFO("NullContext: headless, closing after {} frames (render.nullFrameLimit).", m_FrameLimit);
+        }
+        else
+        {
+            OPAAX_CORE_INFO("NullContext: headless, no frame limit.");
+        }
+        return true;
+    }
+
+    void NullContext::SwapBuffers()
+    {
+        ++m_Frames;
+        if (m_FrameLimit > 0 && m_Frames == m_FrameLimit && m_Window)
+        {
+            OPAAX_CORE_INFO("NullContext: frame limit {} reached — requesting close.", m_FrameLimit);
+            glfwSetWindowShouldClose(m_Window, GLFW_TRUE);
+        }
+    }
+
+} // namespace Opaax
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "RHI/IGraphicsContext.h"
+
+struct GLFWwindow;
+
+namespace Opaax
+{
+    /**
+     * @class NullContext
+     *
+     * Windowless IGraphicsContext for the null backend. GLFW runs on its null platform
+     * (IGraphicsContext::ApplyInitHints), so the window is a bookkeeping object with no OS
+     * surface and no client API — this context has nothing to make current or present.
+     *
+     * SwapBuffers counts frames; when render.nullFrameLimit is non-zero it flags the window to
+     * close after that many frames so headless CI/benchmark runs terminate on their own.
+     */
+    class OPAAX_API NullContext final : public IGraphicsContext
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit NullContext(GLFWwindow* InWindow);
+
+        // =============================================================================
+        // Overrides
+        // =============================================================================
+
+        //~Begin IGraphicsContext interface
+    public:
+        bool Init()                   override;
+        void SwapBuffers()            override;
+        void SetVSync(bool /*InEnabled*/) override {}
+        //~End IGraphicsContext interface
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        GLFWwindow* m_Window     = nullptr;   // may be null (no window at all)
+        Uint32      m_FrameLimit = 0;
+        Uint32      m_Frames     = 0;
+    };
+
+} // namespace Opaax
@@ -0,0 +1,37 @@
+#include "NullRenderAPI.h"
+
+#include "NullCommandStream.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/Log/OpaaxLog.h"
+
+namespace Opaax
+{
+    // NOTE: the RenderAPI / resource Create factory dispatch lives in RHI/BackendFactory.cpp.
+
+    void NullRenderAPI::Init(IGraphicsContext& /*InContext*/)
+    {
+        NullCommandStream::Reset();
+        NullCommandStream::SetRecording(EngineConfig::NullRecordCommands());
+
+        OPAAX_CORE_INFO("NullRenderAPI: headless backend initialized (command recording {}).",
+                        NullCommandStream::IsRecording() ? "on" : "off");
+    }
+
+    void NullRenderAPI::BeginFrame()
+    {
+        NullCommandStream::BeginFrame();
+        m_CommandBuffer.ResetFrameState();
+        for (NullCommandBuffer& lSecondary : m_Secondaries) { lSecondary.ResetFrameState(); }
+    }
+
+    ICommandBuffer* NullRenderAPI::GetSecondaryCommandBuffer(Uint32 InIndex)
+    {
+        return InIndex < SecondaryCount ? &m_Secondaries[InIndex] : nullptr;
+    }
+
+    void NullRenderAPI::SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height)
+    {
+        m_CommandBuffer.SetViewport(X, Y, Width, Height);
+    }
+
+} // namespace Opaax
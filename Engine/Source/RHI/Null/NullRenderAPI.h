@@ -0,0 +1,48 @@
+#pragma once
+
+#include "RHI/IRenderAPI.h"
+#include "RHI/Null/NullCommandBuffer.h"
+
+namespace Opaax
+{
+    /**
+     * @class NullRenderAPI
+     *
+     * Headless IRenderAPI — no device, no GPU work. Owns one NullCommandBuffer; BeginFrame
+     * publishes the previous frame's NullCommandStream counters and clears the bound-state
+     * tracking. Lets the full frame loop (Renderer2D, passes, demo scenes) run on GPU-less CI
+     * and be measured on the CPU side alone.
+     *
+     * Also owns SecondaryCount secondary NullCommandBuffers, so parallel pass recording
+     * (render.parallelPassRecording) runs — and is tested — without a GPU.
+     */
+    class OPAAX_API NullRenderAPI final : public IRenderAPI
+    {
+    public:
+        static constexpr Uint32 SecondaryCount = 4;
+
+        // =============================================================================
+        // Override
+        // =============================================================================
+        //~Begin IRenderAPI interface
+    public:
+        void            Init(IGraphicsContext& InContext)                            override;
+        void            BeginFrame()                                                 override;
+        void            EndFrame()                                                   override {}
+        ICommandBuffer& GetCommandBuffer()                                           override { return m_CommandBuffer; }
+        void            SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height) override;
+        void            WaitIdle()                                                   override {}
+        Uint32          GetSecondaryCommandBufferCount() const                       override { return SecondaryCount; }
+        ICommandBuffer* GetSecondaryCommandBuffer(Uint32 InIndex)                    override;
+        //~End IRenderAPI interface
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        NullCommandBuffer m_CommandBuffer;
+        NullCommandBuffer m_Secondaries[SecondaryCount] = { NullCommandBuffer(true), NullCommandBuffer(true),
+                                                            NullCommandBuffer(true), NullCommandBuffer(true) };
+    };
+
+} // namespace Opaax
@@ -0,0 +1,78 @@
+#include "NullResources.h"
+
+#include "NullCommandStream.h"
+#include "Core/Log/OpaaxLog.h"
+
+// stb_image implementation is compiled once in OpenGLTexture2D.cpp — header only here.
+#include <stb/stb_image.h>
+
+namespace Opaax
+{
+    // NOTE: every Create factory dispatch lives in RHI/BackendFactory.cpp.
+
+    // =============================================================================
+    // Buffers
+    // =============================================================================
+    NullVertexBuffer::NullVertexBuffer(const float* /*InVertices*/, Uint32 InSize)
+    {
+        NullCommandStream::Upload(InSize);
+    }
+
+    void NullVertexBuffer::SetData(const void* /*InData*/, Uint32 InSize)
+    {
+        NullCommandStream::Upload(InSize);
+    }
+
+    NullIndexBuffer::NullIndexBuffer(const Uint32* /*InIndices*/, Uint32 InCount)
+        : m_Count(InCount)
+    {
+        NullCommandStream::Upload(static_cast<Uint64>(InCount) * sizeof(Uint32));
+    }
+
+    void NullUniformBuffer::SetData(const void* /*InData*/, Uint32 InSize, Uint32 /*InOffset*/)
+    {
+        NullCommandStream::Upload(InSize);
+    }
+
+    // =============================================================================
+    // Texture
+    // =============================================================================
+    NullTexture2D::NullTexture2D(const char* InPath)
+    {
+        int lWidth = 0, lHeight = 0, lChannels = 0;
+        if (!stbi_info(InPath, &lWidth, &lHeight, &lChannels))
+        {
+            OPAAX_CORE_ERROR("NullTexture2D: failed to read '{}' — {}", InPath, stbi_failure_reason());
+            return;
+        }
+        m_Width  = static_cast<Uint32>(lWidth);
+        m_Height = static_cast<Uint32>(lHeight);
+        m_Loaded = true;
+        NullCommandStream::Upload(static_cast<Uint64>(m_Width) * m_Height * 4u);
+    }
+
+    NullTexture2D::NullTexture2D(Uint32 InWidth, Uint32 InHeight)
+        : m_Width(InWidth), m_Height(InHeight), m_Loaded(true)
+    {
+        NullCommandStream::Upload(static_cast<Uint64>(m_Width) * m_Height * 4u);
+    }
+
+    NullTexture2D::NullTexture2D(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels)
+        : m_Width(InWidth), m_Height(InHeight), m_Loaded(InData != nullptr)
+    {
+        NullCommandStream::Upload(static_cast<Uint64>(m_Width) * m_Height * static_cast<Uint64>(InChannels));
+    }
+
+    NullTexture2D::NullTexture2D(const TextureDesc& InDesc)
+        : m_Width(InDesc.Width), m_Height(InDesc.Height), m_Format(InDesc.Format), m_MipCount(InDesc.MipCount)
+        , m_Loaded(InDesc.Mips[0] != nullptr)
+    {
+        Uint64 lBytes = 0;
+        for (Uint32 lMip = 0; lMip < InDesc.MipCount; ++lMip)
+        {
+            lBytes += GetTextureLevelSize(InDesc.Format, GetTextureMipExtent(m_Width, lMip), GetTextureMipExtent(m_Height, lMip));
+        }
+        NullCommandStream::Upload(lBytes);
+    }
+
+} // namespace Opaax
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "RHI/Buffer.h"
+#include "RHI/UniformBuffer.h"
+#include "RHI/Texture.h"
+#include "RHI/Shader.h"
+#include "RHI/Pipeline.h"
+#include "RHI/BindGroup.h"
+#include "RHI/Framebuffer.h"
+#include "RHI/QueryPool.h"
+
+// =============================================================================
+// Null backend resources
+// =============================================================================
+// CPU stubs for every resource factory. They own no GPU memory and keep only what the neutral
+// layers read back (layouts, index counts, texture sizes). Data uploads are counted into
+// NullCommandStream so bytes-per-frame stays measurable headless.
+// =============================================================================
+
+namespace Opaax
+{
+    class OPAAX_API NullVertexBuffer final : public IVertexBuffer
+    {
+    public:
+        explicit NullVertexBuffer(Uint32 /*InSize*/) {}
+        NullVertexBuffer(const float* InVertices, Uint32 InSize);
+
+        //~Begin IVertexBuffer interface
+    public:
+        void Bind()   const override {}
+        void Unbind() const override {}
+
+        void                SetData(const void* InData, Uint32 InSize) override;
+        void                SetLayout(const BufferLayout& InLayout)    override { m_Layout = InLayout; }
+        const BufferLayout& GetLayout() const                          override { return m_Layout; }
+        //~End IVertexBuffer interface
+
+    private:
+        BufferLayout m_Layout;
+    };
+
+    class OPAAX_API NullIndexBuffer final : public IIndexBuffer
+    {
+    public:
+        NullIndexBuffer(const Uint32* InIndices, Uint32 InCount);
+
+        //~Begin IIndexBuffer interface
+    public:
+        void   Bind()     const override {}
+        void   Unbind()   const override {}
+        Uint32 GetCount() const override { return m_Count; }
+        //~End IIndexBuffer interface
+
+    private:
+        Uint32 m_Count = 0;
+    };
+
+    class OPAAX_API NullVertexArray final : public IVertexArray
+    {
+        //~Begin IVertexArray interface
+    public:
+        void Bind()   const override {}
+        void Unbind() const override {}
+
+        void AddVertexBuffer(UniquePtr<IVertexBuffer> InVBO) override { m_VertexBuffers.push_back(Move(InVBO)); }
+        void SetIndexBuffer(UniquePtr<IIndexBuffer>   InIBO) override { m_IndexBuffer = Move(InIBO); }
+
+        const TDynArray<UniquePtr<IVertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+        const IIndexBuffer*                        GetIndexBuffer()   const override { return m_IndexBuffer.get(); }
+        //~End IVertexArray interface
+
+    private:
+        TDynArray<UniquePtr<IVertexBuffer>> m_VertexBuffers;
+        UniquePtr<IIndexBuffer>             m_IndexBuffer;
+    };
+
+    class OPAAX_API NullUniformBuffer final : public IUniformBuffer
+    {
+    public:
+        NullUniformBuffer(Uint32 /*InSize*/, Uint32 /*InBinding*/) {}
+
+        //~Begin IUniformBuffer interface
+    public:
+        void SetData(const void* InData, Uint32 InSize, Uint32 InOffset = 0) override;
+        //~End IUniformBuffer interface
+    };
+
+    /**
+     * @class NullTexture2D
+     *
+     * Keeps only the size and layout. The path overload reads the image header (stbi_info) — no
+     * decode — so layout code that queries GetWidth/GetHeight behaves as on a real backend. Format
+     * and mip count are what a real backend would have allocated (RGBA8, one level, unless cooked).
+     */
+    class OPAAX_API NullTexture2D final : public ITexture2D
+    {
+    public:
+        explicit NullTexture2D(const char* InPath);
+        NullTexture2D(Uint32 InWidth, Uint32 InHeight);
+        NullTexture2D(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
+        explicit NullTexture2D(const TextureDesc& InDesc);
+
+        //~Begin ITexture2D interface
+    public:
+        void Bind(Uint32 /*InSlot*/ = 0) const override {}
+        void Unbind()                    const override {}
+
+        Uint32 GetWidth()      const noexcept override { return m_Width;  }
+        Uint32 GetHeight()     const noexcept override { return m_Height; }
+        Uint32 GetRendererID() const noexcept override { return 0u; }
+        bool   IsLoaded()      const noexcept override { return m_Loaded; }
+        //~End ITexture2D interface
+
+        ETextureFormat GetFormat()   const noexcept { return m_Format;   }
+        Uint32         GetMipCount() const noexcept { return m_MipCount; }
+
+    private:
+        Uint32         m_Width    = 0;
+        Uint32         m_Height   = 0;
+        ETextureFormat m_Format   = ETextureFormat::RGBA8;
+        Uint32         m_MipCount = 1;
+        bool           m_Loaded   = false;
+    };
+
+    class OPAAX_API NullShader final : public IShader
+    {
+    public:
+        explicit NullShader(const ShaderDesc& /*InDesc*/) {}
+
+        //~Begin IShader interface
+    public:
+        void Bind()   const override {}
+        void Unbind() const override {}
+
+        void SetInt      (const char*, Int32)                   override {}
+        void SetIntArray (const char*, const Int32*, Uint32)    override {}
+        void SetFloat    (const char*, float)                   override {}
+        void SetFloat2   (const char*, const Vector2F&)         override {}
+        void SetFloat3   (const char*, const Vector3F&)         override {}
+        void SetFloat4   (const char*, const Vector4F&)         override {}
+        void SetMat4     (const char*, const Matrix44F&)        override {}
+        //~End IShader interface
+    };
+
+    class OPAAX_API NullPipeline final : public IPipeline
+    {
+    public:
+        explicit NullPipeline(const PipelineDesc& /*InDesc*/) {}
+    };
+
+    class OPAAX_API NullBindGroup final : public IBindGroup
+    {
+    public:
+        explicit NullBindGroup(const BindGroupLayout& /*InLayout*/) {}
+
+        //~Begin IBindGroup interface
+    public:
+        void SetUniformBuffer(IUniformBuffer& /*InUniformBuffer*/) override {}
+        void SetTexture(Uint32 /*InSlot*/, ITexture2D& /*InTexture*/) override {}
+        //~End IBindGroup interface
+    };
+
+    class OPAAX_API NullFramebuffer final : public IFramebuffer
+    {
+    public:
+        explicit NullFramebuffer(const FramebufferSpec& InSpec)
+            : m_Width(InSpec.Width), m_Height(InSpec.Height) {}
+
+        //~Begin IFramebuffer interface
+    public:
+        void Bind()   override {}
+        void Unbind() override {}
+
+        void Resize(Uint32 InWidth, Uint32 InHeight) override
+        {
+            if (InWidth == 0 || InHeight == 0) { return; }
+            m_Width  = InWidth;
+            m_Height = InHeight;
+        }
+
+        Uint32 GetColorAttachmentID() const noexcept override { return 0u; }
+        Uint32 GetWidth()             const noexcept override { return m_Width;  }
+        Uint32 GetHeight()            const noexcept override { return m_Height; }
+        //~End IFramebuffer interface
+
+    private:
+        Uint32 m_Width  = 1;
+        Uint32 m_Height = 1;
+    };
+
+    // No GPU, no timestamps: every query reads back 0 and IsSupported is false.
+    class OPAAX_API NullTimestampQueryPool final : public ITimestampQueryPool
+    {
+    public:
+        explicit NullTimestampQueryPool(Uint32 /*InCapacity*/) {}
+
+        //~Begin ITimestampQueryPool interface
+    public:
+        void   BeginFrame(ICommandBuffer& /*InCmd*/)                   override {}
+        Uint32 WriteTimestamp(ICommandBuffer& /*InCmd*/)               override { return InvalidQuery; }
+        double GetElapsedMicros(Uint32 /*InBegin*/, Uint32 /*InEnd*/) const override { return 0.0; }
+        bool   IsSupported() const                                     override { return false; }
+        //~End ITimestampQueryPool interface
+    };
+
+} // namespace Opaax
@@ -1,6 +1,7 @@
 #include "OpenGLBindGroup.h"
 
-#include "RHI/Texture.h"
+#include "OpenGLTexture2D.h"
+#include "RHI/ICommandBuffer.h"   // CommandStateStats
 #include "RHI/UniformBuffer.h"
 
 namespace Opaax
@@ -25,12 +26,26 @@ namespace Opaax
         }
     }
 
-    void OpenGLBindGroup::Bind() const
+    void OpenGLBindGroup::Bind(TDynArray<Uint64>& InOutBoundUnits, CommandStateStats& InOutStats) const
     {
         // UBO already bound to its binding point at construction (OpenGLUniformBuffer) — no-op here.
+        if (InOutBoundUnits.size() < m_Textures.size()) { InOutBoundUnits.resize(m_Textures.size(), 0); }
+
         for (Uint32 i = 0; i < static_cast<Uint32>(m_Textures.size()); ++i)
         {
-            if (m_Textures[i]) { m_Textures[i]->Bind(i); }
+            if (!m_Textures[i]) { continue; }
+
+            // Backend invariant: the active backend's factory only produces OpenGLTexture2D here.
+            const Uint64 lID = static_cast<const OpenGLTexture2D*>(m_Textures[i])->GetUniqueID();
+            if (InOutBoundUnits[i] == lID)
+            {
+                ++InOutStats.Skipped;
+                continue;
+            }
+
+            m_Textures[i]->Bind(i);
+            InOutBoundUnits[i] = lID;
+            ++InOutStats.Issued;
         }
     }
 }
@@ -7,6 +7,7 @@ namespace Opaax
 {
     class IUniformBuffer;
     class ITexture2D;
+    struct CommandStateStats;
 
     /**
      * @class OpenGLBindGroup
@@ -15,6 +16,9 @@ namespace Opaax
      * texture units when the command buffer binds it (Bind). The UBO is bound to its binding
      * point at construction by OpenGLUniformBuffer, so it needs no per-bind work here — the
      * pointer is kept for parity with a descriptor-set backend (Vulkan).
+     *
+     * Texture units are global GL state, so the command buffer owns the record of what each unit
+     * holds and passes it in; Bind only touches units whose texture differs.
      */
     class OPAAX_API OpenGLBindGroup final : public IBindGroup
     {
@@ -38,9 +42,9 @@ namespace Opaax
         // Function
         // =============================================================================
     public:
-        // Backend-internal: called by OpenGLCommandBuffer::BindBindGroup. Binds each set
-        // texture to its unit.
-        void Bind() const;
+        // Backend-internal: called by OpenGLCommandBuffer::BindBindGroup. Binds each set texture
+        // whose unique ID differs from InOutBoundUnits[unit] (0 = unknown) and updates the record.
+        void Bind(TDynArray<Uint64>& InOutBoundUnits, CommandStateStats& InOutStats) const;
 
         // =============================================================================
         // Members
@@ -3,6 +3,8 @@
 #define GLAD_APIENTRY
 #include <glad/glad.h>
 
+#include "RHI/GpuMemoryTracker.h"
+
 namespace Opaax
 {
     // NOTE: the I*::Create factory dispatch lives in RHI/BackendFactory.cpp.
@@ -11,23 +13,28 @@ namespace Opaax
     // OpenGLVertexBuffer
 
     OpenGLVertexBuffer::OpenGLVertexBuffer(Uint32 InSize)
+        : m_Size(InSize)
     {
         glCreateBuffers(1, &m_RendererID);
         glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
         // GL_DYNAMIC_DRAW — data changes every frame (batch vertex upload)
         glBufferData(GL_ARRAY_BUFFER, InSize, nullptr, GL_DYNAMIC_DRAW);
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::VertexBuffer, m_Size);
     }
     
     OpenGLVertexBuffer::OpenGLVertexBuffer(const float* InVertices, Uint32 InSize)
+        : m_Size(InSize)
     {
         glCreateBuffers(1, &m_RendererID);
         glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
         glBufferData(GL_ARRAY_BUFFER, InSize, InVertices, GL_STATIC_DRAW);
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::VertexBuffer, m_Size);
     }
 
     OpenGLVertexBuffer::~OpenGLVertexBuffer()
     {
         glDeleteBuffers(1, &m_RendererID);
+        GpuMemoryTracker::Free(EGpuMemoryCategory::VertexBuffer, m_Size);
     }
 
     void OpenGLVertexBuffer::Bind() const
@@ -51,6 +58,7 @@ namespace Opaax
     // OpenGLIndexBuffer
 
     OpenGLIndexBuffer::OpenGLIndexBuffer(const Uint32* InIndices, Uint32 InCount)
+        : m_Count(InCount)
     {
         // NOTE: GL_ELEMENT_ARRAY_BUFFER must be bound to a VAO to be remembered.
         //   We bind here during construction — the VAO must already be bound.
@@ -60,11 +68,13 @@ namespace Opaax
                      static_cast<GLsizeiptr>(InCount * sizeof(Uint32)),
                      InIndices,
                      GL_STATIC_DRAW);
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::IndexBuffer, static_cast<Uint64>(InCount) * sizeof(Uint32));
     }
     
     OpenGLIndexBuffer::~OpenGLIndexBuffer()
     {
         glDeleteBuffers(1, &m_RendererID);
+        GpuMemoryTracker::Free(EGpuMemoryCategory::IndexBuffer, static_cast<Uint64>(m_Count) * sizeof(Uint32));
     }
     
     void OpenGLIndexBuffer::Bind() const
@@ -4,15 +4,37 @@
 #include "OpenGLBindGroup.h"
 #include "RHI/Buffer.h"
 #include "Renderer/RenderTarget.hpp"
+#include "Core/Log/OpaaxLog.h"
 
 #define GLAD_APIENTRY
 #include <glad/glad.h>
 
+#include <algorithm>
+
 namespace Opaax
 {
+    OpenGLCommandBuffer::~OpenGLCommandBuffer()
+    {
+        if (m_IndirectBuffer) { glDeleteBuffers(1, &m_IndirectBuffer); }
+    }
+
+    void OpenGLCommandBuffer::ResetFrame() noexcept
+    {
+        m_StateStats = {};
+        InvalidateState();
+    }
+
+    void OpenGLCommandBuffer::InvalidateState() noexcept
+    {
+        m_BoundPipeline    = nullptr;
+        m_BoundVertexArray = nullptr;
+        std::fill(m_BoundTextureUnits.begin(), m_BoundTextureUnits.end(), 0);
+    }
+
     void OpenGLCommandBuffer::BeginRenderPass(IRenderTarget& InTarget, ELoadOp InLoadOp, const Vector4F& InClearColor)
     {
         m_CurrentTarget = &InTarget;
+        InvalidateState();
         InTarget.Bind();
 
         // Per-pass viewport = the target's full size (FBO bind also sets it, but the backbuffer
@@ -43,22 +65,63 @@ namespace Opaax
 
     void OpenGLCommandBuffer::BindPipeline(IPipeline& InPipeline)
     {
+        if (m_BoundPipeline == &InPipeline)
+        {
+            ++m_StateStats.Skipped;
+            return;
+        }
+
         // Backend invariant: the active backend's factory only produces OpenGLPipeline here.
         static_cast<OpenGLPipeline&>(InPipeline).Apply();
+        m_BoundPipeline = &InPipeline;
+        ++m_StateStats.Issued;
     }
 
     void OpenGLCommandBuffer::BindBindGroup(IBindGroup& InBindGroup)
     {
-        static_cast<OpenGLBindGroup&>(InBindGroup).Bind();
+        static_cast<OpenGLBindGroup&>(InBindGroup).Bind(m_BoundTextureUnits, m_StateStats);
     }
 
     void OpenGLCommandBuffer::BindVertexArray(IVertexArray& InVertexArray)
     {
+        if (m_BoundVertexArray == &InVertexArray)
+        {
+            ++m_StateStats.Skipped;
+            return;
+        }
+
         InVertexArray.Bind();
+        m_BoundVertexArray = &InVertexArray;
+        ++m_StateStats.Issued;
     }
 
     void OpenGLCommandBuffer::DrawIndexed(Uint32 InIndexCount)
     {
         glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(InIndexCount), GL_UNSIGNED_INT, nullptr);
     }
+
+    bool OpenGLCommandBuffer::SupportsDrawIndirect() const
+    {
+        // Core since GL 4.3 (the loader only carries the core entry point).
+        return GLAD_GL_VERSION_4_3 != 0;
+    }
+
+    void OpenGLCommandBuffer::DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount)
+    {
+        if (InCount == 0) { return; }
+
+        if (m_IndirectBuffer == 0) { glCreateBuffers(1, &m_IndirectBuffer); }
+
+        // Re-specify (orphan) every call: the driver hands back fresh storage instead of stalling on
+        // the previous multi-draw still reading it.
+        glNamedBufferData(m_IndirectBuffer, static_cast<GLsizeiptr>(InCount * sizeof(DrawIndexedIndirectCommand)),
+                          InCommands, GL_STREAM_DRAW);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_IndirectBuffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(InCount), 0);
+    }
+
+    void OpenGLCommandBuffer::ExecuteSecondary(ICommandBuffer& /*InSecondary*/)
+    {
+        OPAAX_CORE_ERROR("OpenGLCommandBuffer: ExecuteSecondary is not supported — GL records on the render thread only.");
+    }
 }
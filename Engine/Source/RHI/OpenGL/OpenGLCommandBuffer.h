@@ -13,6 +13,10 @@ namespace Opaax
      * away (there is no record/submit step — OpenGLRenderAPI reuses one instance per frame).
      * BeginRenderPass binds the target's framebuffer + sets the viewport + optionally clears;
      * the bind + DrawIndexed calls translate straight to GL state-set + glDrawElements.
+     *
+     * Binds are filtered against a shadow of the last bound pipeline, vertex array and per-unit
+     * texture; the shadow is dropped at every BeginRenderPass (framebuffer setup and editor/ImGui
+     * code touch GL state between passes) and at frame start.
      */
     class OPAAX_API OpenGLCommandBuffer final : public ICommandBuffer
     {
@@ -20,8 +24,11 @@ namespace Opaax
         // CTOR - DTOR
         // =============================================================================
     public:
-        OpenGLCommandBuffer()           = default;
-        ~OpenGLCommandBuffer() override = default;
+        OpenGLCommandBuffer() = default;
+        ~OpenGLCommandBuffer() override;
+
+        // Called by OpenGLRenderAPI::BeginFrame: zero the stats and forget the bound state.
+        void ResetFrame() noexcept;
 
         // =============================================================================
         // Override
@@ -38,12 +45,32 @@ namespace Opaax
         void BindVertexArray(IVertexArray& InVertexArray) override;
 
         void DrawIndexed(Uint32 InIndexCount) override;
+
+        bool SupportsDrawIndirect() const override;
+        void DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount) override;
+
+        // GL has no secondary recorders (OpenGLRenderAPI reports none) — logs an error.
+        void ExecuteSecondary(ICommandBuffer& InSecondary) override;
+
+        CommandStateStats GetStateStats() const override { return m_StateStats; }
         //~End ICommandBuffer interface
 
+    private:
+        void InvalidateState() noexcept;
+
         // =============================================================================
         // Members
         // =============================================================================
     private:
         IRenderTarget* m_CurrentTarget = nullptr;   // bound between BeginRenderPass/EndRenderPass
+
+        // Shadow of the bound GL state (null / 0 = unknown, always rebinds).
+        const IPipeline*    m_BoundPipeline    = nullptr;
+        const IVertexArray* m_BoundVertexArray = nullptr;
+        TDynArray<Uint64>   m_BoundTextureUnits;          // OpenGLTexture2D unique ID per unit
+
+        CommandStateStats   m_StateStats;
+
+        Uint32              m_IndirectBuffer = 0;         // GL_DRAW_INDIRECT_BUFFER, created on first use
     };
 }
@@ -1,6 +1,7 @@
 #include "OpenGLFramebuffer.h"
 
 #include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
 
 #define GLAD_APIENTRY
 #include <glad/glad.h>
@@ -33,6 +34,7 @@ namespace Opaax
         if (m_ColorTexture) { glDeleteTextures(1, &m_ColorTexture);  m_ColorTexture = 0; }
         if (m_DepthRBO)     { glDeleteRenderbuffers(1, &m_DepthRBO); m_DepthRBO     = 0; }
         if (m_FBO)          { glDeleteFramebuffers(1, &m_FBO);       m_FBO          = 0; }
+        if (m_GpuBytes)     { GpuMemoryTracker::Free(EGpuMemoryCategory::RenderTarget, m_GpuBytes); m_GpuBytes = 0; }
     }
 
     void OpenGLFramebuffer::Invalidate()
@@ -73,6 +75,10 @@ namespace Opaax
         }
 
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        // RGBA8 color + optional D24S8 depth — 4 bytes per pixel each.
+        m_GpuBytes = static_cast<Uint64>(m_Width) * m_Height * (m_DepthStencil ? 8u : 4u);
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::RenderTarget, m_GpuBytes);
     }
 
     void OpenGLFramebuffer::Bind()
@@ -61,5 +61,6 @@ namespace Opaax
         Uint32 m_Width        = 1;
         Uint32 m_Height       = 1;
         bool   m_DepthStencil = true;
+        Uint64 m_GpuBytes     = 0;    // color + depth storage, reported to GpuMemoryTracker
     };
 }
@@ -0,0 +1,83 @@
+#include "OpenGLQueryPool.h"
+
+#include "Core/Log/OpaaxLog.h"
+
+#define GLAD_APIENTRY
+#include <glad/glad.h>
+
+namespace Opaax
+{
+    // NOTE: the ITimestampQueryPool::Create factory dispatch lives in RHI/BackendFactory.cpp.
+
+    OpenGLTimestampQueryPool::OpenGLTimestampQueryPool(Uint32 InCapacity)
+        : m_Capacity(InCapacity)
+    {
+        // A zero-bit timestamp counter means the driver exposes the query but never advances it.
+        GLint lBits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &lBits);
+        if (lBits == 0 || m_Capacity == 0)
+        {
+            OPAAX_CORE_WARN("OpenGLTimestampQueryPool: GL_TIMESTAMP unsupported — GPU pass timings disabled.");
+            m_Capacity = 0;
+            return;
+        }
+
+        m_Queries.resize(static_cast<size_t>(FrameLatency) * m_Capacity);
+        glGenQueries(static_cast<GLsizei>(m_Queries.size()), m_Queries.data());
+        m_Resolved.resize(m_Capacity);
+    }
+
+    OpenGLTimestampQueryPool::~OpenGLTimestampQueryPool()
+    {
+        if (!m_Queries.empty())
+        {
+            glDeleteQueries(static_cast<GLsizei>(m_Queries.size()), m_Queries.data());
+        }
+    }
+
+    void OpenGLTimestampQueryPool::BeginFrame(ICommandBuffer& /*InCmd*/)
+    {
+        if (m_Capacity == 0) { return; }
+
+        m_Slot = (m_Slot + 1u) % FrameLatency;
+
+        // Collect the set about to be overwritten. Results land in order, so the last query being
+        // available implies the whole set is.
+        const Uint32 lCount = m_Written[m_Slot];
+        if (lCount > 0)
+        {
+            const Uint32* lSet = m_Queries.data() + static_cast<size_t>(m_Slot) * m_Capacity;
+
+            GLuint lAvailable = GL_FALSE;
+            glGetQueryObjectuiv(lSet[lCount - 1u], GL_QUERY_RESULT_AVAILABLE, &lAvailable);
+            if (lAvailable == GL_TRUE)
+            {
+                for (Uint32 i = 0; i < lCount; ++i)
+                {
+                    GLuint64 lNs = 0;
+                    glGetQueryObjectui64v(lSet[i], GL_QUERY_RESULT, &lNs);
+                    m_Resolved[i] = static_cast<Uint64>(lNs);
+                }
+                m_ResolvedCount = lCount;
+            }
+        }
+        m_Written[m_Slot] = 0;
+    }
+
+    Uint32 OpenGLTimestampQueryPool::WriteTimestamp(ICommandBuffer& /*InCmd*/)
+    {
+        if (m_Capacity == 0 || m_Written[m_Slot] >= m_Capacity) { return InvalidQuery; }
+
+        const Uint32 lIndex = m_Written[m_Slot]++;
+        glQueryCounter(m_Queries[static_cast<size_t>(m_Slot) * m_Capacity + lIndex], GL_TIMESTAMP);
+        return lIndex;
+    }
+
+    double OpenGLTimestampQueryPool::GetElapsedMicros(Uint32 InBegin, Uint32 InEnd) const
+    {
+        if (InBegin >= m_ResolvedCount || InEnd >= m_ResolvedCount) { return 0.0; }
+        if (m_Resolved[InEnd] < m_Resolved[InBegin])                { return 0.0; }
+        return static_cast<double>(m_Resolved[InEnd] - m_Resolved[InBegin]) / 1000.0;
+    }
+
+} // namespace Opaax
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "RHI/QueryPool.h"
+
+namespace Opaax
+{
+    /**
+     * @class OpenGLTimestampQueryPool
+     *
+     * ITimestampQueryPool over GL_TIMESTAMP query objects (glQueryCounter, core since 3.3).
+     * GL has no frames-in-flight, so the pool keeps its own ring of FrameLatency query sets;
+     * BeginFrame reads back the set it is about to reuse only if the driver reports it
+     * available (GL_QUERY_RESULT_AVAILABLE) — otherwise the previous reading is kept. Never
+     * blocks the CPU.
+     */
+    class OPAAX_API OpenGLTimestampQueryPool final : public ITimestampQueryPool
+    {
+        // =============================================================================
+        // Constants
+        // =============================================================================
+    public:
+        static constexpr Uint32 FrameLatency = 3u;   // query sets in the ring
+
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit OpenGLTimestampQueryPool(Uint32 InCapacity);
+        ~OpenGLTimestampQueryPool() override;
+
+        // =============================================================================
+        // Copy - Delete
+        // =============================================================================
+    public:
+        OpenGLTimestampQueryPool(const OpenGLTimestampQueryPool&)            = delete;
+        OpenGLTimestampQueryPool& operator=(const OpenGLTimestampQueryPool&) = delete;
+
+        // =============================================================================
+        // Override
+        // =============================================================================
+        //~Begin ITimestampQueryPool interface
+    public:
+        void   BeginFrame(ICommandBuffer& InCmd)                       override;
+        Uint32 WriteTimestamp(ICommandBuffer& InCmd)                   override;
+        double GetElapsedMicros(Uint32 InBegin, Uint32 InEnd) const    override;
+        bool   IsSupported() const                                     override { return m_Capacity > 0; }
+        //~End ITimestampQueryPool interface
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        Uint32            m_Capacity = 0;
+        TDynArray<Uint32> m_Queries;                  // FrameLatency * m_Capacity query names
+        Uint32            m_Written[FrameLatency] = {};
+        Uint32            m_Slot     = 0;
+
+        TDynArray<Uint64> m_Resolved;                 // ns, last collected set
+        Uint32            m_ResolvedCount = 0;
+    };
+
+} // namespace Opaax
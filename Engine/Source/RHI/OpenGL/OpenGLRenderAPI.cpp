@@ -22,8 +22,10 @@ namespace Opaax
 
     void OpenGLRenderAPI::BeginFrame()
     {
-        // OpenGL submits immediately to the current context — nothing to begin.
+        // OpenGL submits immediately to the current context — nothing to begin beyond dropping
+        // the command buffer's bound-state shadow (anything may have touched GL since).
         // NOTE: Vulkan acquires the swapchain image + begins the command buffer here.
+        m_CommandBuffer.ResetFrame();
     }
 
     void OpenGLRenderAPI::EndFrame()
@@ -3,11 +3,22 @@
 #include <glad/glad.h>
 #include "Core/Log/OpaaxLog.h"
 #include "Core/EngineAPI.h"
+#include "RHI/GpuMemoryTracker.h"
 
 // stb_image — implementation defined once here
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
 
+#include <atomic>
+
+// EXT_texture_compression_s3tc — universal on desktop GL, but not part of the core profile glad exposes.
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+    #define GL_COMPRESSED_RGB_S3TC_DXT1_EXT  0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+    #define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
 namespace Opaax
 {
     // NOTE: the ITexture2D::Create factory dispatch lives in RHI/BackendFactory.cpp.
@@ -46,6 +57,10 @@ namespace Opaax
                             static_cast<GLsizei>(InWidth), static_cast<GLsizei>(InHeight),
                             GL_RGBA, GL_UNSIGNED_BYTE, &lWhite);
 
+        m_Width    = InWidth;
+        m_Height   = InHeight;
+        m_GpuBytes = static_cast<Uint64>(InWidth) * InHeight * 4u;
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, m_GpuBytes);
         m_bLoaded = true;
     }
 
@@ -59,9 +74,20 @@ namespace Opaax
         Upload(InData, InWidth, InHeight, InChannels);
     }
 
+    OpenGLTexture2D::OpenGLTexture2D(const TextureDesc& InDesc)
+    {
+        if (!InDesc.Mips[0] || InDesc.MipCount == 0 || InDesc.MipCount > MaxTextureMips)
+        {
+            OPAAX_CORE_ERROR("OpenGLTexture2D: cooked upload received no levels");
+            return;
+        }
+        UploadCooked(InDesc);
+    }
+
     OpenGLTexture2D::~OpenGLTexture2D()
     {
         glDeleteTextures(1, &m_RendererID);
+        if (m_GpuBytes) { GpuMemoryTracker::Free(EGpuMemoryCategory::Texture, m_GpuBytes); }
     }
 
     void OpenGLTexture2D::Upload(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels)
@@ -110,9 +136,64 @@ namespace Opaax
             glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
         }
 
+        const Uint32 lBytesPerPixel = (InChannels == 4) ? 4u : (InChannels == 1) ? 1u : 3u;
+        m_GpuBytes = static_cast<Uint64>(InWidth) * InHeight * lBytesPerPixel;
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, m_GpuBytes);
+
         m_bLoaded = true;
     }
     
+    void OpenGLTexture2D::UploadCooked(const TextureDesc& InDesc)
+    {
+        m_Width  = InDesc.Width;
+        m_Height = InDesc.Height;
+
+        const GLenum lInternalFormat = (InDesc.Format == ETextureFormat::BC1) ? GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+                                     : (InDesc.Format == ETextureFormat::BC3) ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+                                     : GL_RGBA8;
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+        glTextureStorage2D(m_RendererID, static_cast<GLsizei>(InDesc.MipCount), lInternalFormat,
+                           static_cast<GLsizei>(m_Width), static_cast<GLsizei>(m_Height));
+
+        // Same sampling as Upload's RGBA path; the cooked chain adds trilinear minification.
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, InDesc.MipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S,     GL_REPEAT);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T,     GL_REPEAT);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAX_LEVEL,  static_cast<GLint>(InDesc.MipCount - 1));
+
+        m_GpuBytes = 0;
+        for (Uint32 lMip = 0; lMip < InDesc.MipCount; ++lMip)
+        {
+            const Uint32 lW     = GetTextureMipExtent(m_Width, lMip);
+            const Uint32 lH     = GetTextureMipExtent(m_Height, lMip);
+            const Uint64 lBytes = GetTextureLevelSize(InDesc.Format, lW, lH);
+            if (IsBlockCompressed(InDesc.Format))
+            {
+                glCompressedTextureSubImage2D(m_RendererID, static_cast<GLint>(lMip), 0, 0,
+                                              static_cast<GLsizei>(lW), static_cast<GLsizei>(lH),
+                                              lInternalFormat, static_cast<GLsizei>(lBytes), InDesc.Mips[lMip]);
+            }
+            else
+            {
+                glTextureSubImage2D(m_RendererID, static_cast<GLint>(lMip), 0, 0,
+                                    static_cast<GLsizei>(lW), static_cast<GLsizei>(lH),
+                                    GL_RGBA, GL_UNSIGNED_BYTE, InDesc.Mips[lMip]);
+            }
+            m_GpuBytes += lBytes;
+        }
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, m_GpuBytes);
+
+        m_bLoaded = true;
+    }
+
+    Uint64 OpenGLTexture2D::NextUniqueID() noexcept
+    {
+        static std::atomic<Uint64> s_NextUniqueID{ 1 };
+        return s_NextUniqueID.fetch_add(1, std::memory_order_relaxed);
+    }
+
     void OpenGLTexture2D::Bind(Uint32 InSlot) const { glBindTextureUnit(InSlot, m_RendererID); }
     void OpenGLTexture2D::Unbind() const { glBindTextureUnit(0, 0); }
 }
@@ -45,6 +45,13 @@ namespace Opaax
          */
         OpenGLTexture2D(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
 
+        /**
+         * Upload a pre-cooked texture (RGBA8 / BC1 / BC3 + its mip chain) as stored — no decode,
+         * no conversion, no glGenerateMipmap. Trilinear when more than one level is supplied.
+         * @param InDesc
+         */
+        explicit OpenGLTexture2D(const TextureDesc& InDesc);
+
         ~OpenGLTexture2D();
 
         // =============================================================================
@@ -64,6 +71,7 @@ namespace Opaax
         // =============================================================================
     private:
         void Upload(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
+        void UploadCooked(const TextureDesc& InDesc);
         
         // =============================================================================
         // Override
@@ -80,8 +88,16 @@ namespace Opaax
         FORCEINLINE Uint32 GetHeight()     const noexcept override { return m_Height;     }
         FORCEINLINE Uint32 GetRendererID() const noexcept override { return m_RendererID; }
         FORCEINLINE bool   IsLoaded()      const noexcept override { return m_bLoaded;    }
+        FORCEINLINE Uint64 GetGpuMemorySize() const noexcept override { return m_GpuBytes; }
         //~End ITexture2D interface
 
+        // Never reused (unlike GL names, which recycle after glDeleteTextures) — the command
+        // buffer keys its texture-unit cache on this.
+        FORCEINLINE Uint64 GetUniqueID()   const noexcept { return m_UniqueID; }
+
+    private:
+        static Uint64 NextUniqueID() noexcept;
+
         // =============================================================================
         // Operators
         // =============================================================================
@@ -99,6 +115,8 @@ namespace Opaax
         Uint32 m_Width      = 0;
         Uint32 m_Height     = 0;
         bool   m_bLoaded    = false;
+        Uint64 m_GpuBytes   = 0;    // storage size, reported to GpuMemoryTracker
+        Uint64 m_UniqueID   = NextUniqueID();
     };
  
 } // namespace Opaax
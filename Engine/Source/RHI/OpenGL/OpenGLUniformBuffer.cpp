@@ -3,21 +3,26 @@
 #define GLAD_APIENTRY
 #include <glad/glad.h>
 
+#include "RHI/GpuMemoryTracker.h"
+
 namespace Opaax
 {
     // NOTE: the IUniformBuffer::Create factory dispatch lives in RHI/BackendFactory.cpp.
 
     OpenGLUniformBuffer::OpenGLUniformBuffer(Uint32 InSize, Uint32 InBinding)
+        : m_Size(InSize)
     {
         glCreateBuffers(1, &m_RendererID);
         // GL_DYNAMIC_DRAW — rewritten every frame (e.g. camera view-projection).
         glNamedBufferData(m_RendererID, InSize, nullptr, GL_DYNAMIC_DRAW);
         glBindBufferBase(GL_UNIFORM_BUFFER, InBinding, m_RendererID);
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::UniformBuffer, m_Size);
     }
 
     OpenGLUniformBuffer::~OpenGLUniformBuffer()
     {
         glDeleteBuffers(1, &m_RendererID);
+        GpuMemoryTracker::Free(EGpuMemoryCategory::UniformBuffer, m_Size);
     }
 
     void OpenGLUniformBuffer::SetData(const void* InData, Uint32 InSize, Uint32 InOffset)
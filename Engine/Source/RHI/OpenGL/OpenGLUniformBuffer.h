@@ -46,6 +46,7 @@ namespace Opaax
         // =============================================================================
     private:
         Uint32 m_RendererID = 0;
+        Uint32 m_Size       = 0;    // bytes, reported to GpuMemoryTracker
     };
 
 } // namespace Opaax
@@ -14,7 +14,8 @@ namespace Opaax
     enum class EBlendMode
     {
         None,
-        Alpha   // src-alpha / one-minus-src-alpha (standard 2D transparency)
+        Alpha,                // src-alpha / one-minus-src-alpha (standard 2D transparency)
+        PremultipliedAlpha    // one / one-minus-src-alpha (textures cooked with --premultiply)
     };
 
     enum class EPrimitiveTopology
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    class ICommandBuffer;
+
+    // =============================================================================
+    // ITimestampQueryPool
+    // =============================================================================
+    /**
+     * @interface ITimestampQueryPool
+     *
+     * Backend-neutral GPU timestamp recorder (GL_TIMESTAMP query objects on OpenGL,
+     * vkCmdWriteTimestamp into a VkQueryPool on Vulkan). Holds a small ring of per-frame
+     * query slots: BeginFrame rotates to the next slot and first collects the results that
+     * slot held from an earlier frame, so readings are a few frames stale but never stall
+     * the CPU waiting on the GPU.
+     *
+     * Timestamps are indexed in write order within a frame; a caller that writes them in a
+     * stable order (e.g. RenderPipeline: begin/end per pass) reads pairs back by index.
+     *
+     * The concrete is selected by ITimestampQueryPool::Create in RHI/BackendFactory.cpp.
+     */
+    class OPAAX_API ITimestampQueryPool
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        virtual ~ITimestampQueryPool() = default;
+
+        // =============================================================================
+        // Statics
+        // =============================================================================
+
+        // Returned by WriteTimestamp when the frame's slot is full or timing is unsupported.
+        static constexpr Uint32 InvalidQuery = ~0u;
+
+        /**
+         * @param InCapacity timestamps per frame (e.g. 2 per render pass)
+         * @return owning query pool (IsSupported() is false when the device lacks timestamps)
+         */
+        static UniquePtr<ITimestampQueryPool> Create(Uint32 InCapacity);
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        // Open this frame's slot on InCmd: collect the slot's previous results, then reset it.
+        // Must be called outside any render pass, before the frame's first WriteTimestamp.
+        virtual void BeginFrame(ICommandBuffer& InCmd) = 0;
+
+        // Record a GPU timestamp once all prior work on InCmd completes. Returns its index in
+        // this frame, or InvalidQuery.
+        virtual Uint32 WriteTimestamp(ICommandBuffer& InCmd) = 0;
+
+        // GPU time between two timestamps of the most recently resolved frame, in microseconds.
+        // 0 when either index was not written/resolved.
+        virtual double GetElapsedMicros(Uint32 InBegin, Uint32 InEnd) const = 0;
+
+        virtual bool IsSupported() const = 0;
+    };
+
+} // namespace Opaax
@@ -13,7 +13,7 @@ namespace Opaax
     /**
      * @enum EBackend
      *
-     * Graphics backend selector. OpenGL + Vulkan exist today; DX12/DX11 are the intended
+     * Graphics backend selector. OpenGL + Vulkan + Null (headless) exist today; DX12/DX11 are the intended
      * future entries. Selection happens once, in RenderSubsystem::Startup. Vulkan is always
      * a valid enumerator (the value is backend-neutral); whether it can be *built* depends on
      * OPAAX_HAS_VULKAN — the factory falls back to OpenGL when it is selected without the SDK.
@@ -21,7 +21,8 @@ namespace Opaax
     enum class EBackend
     {
         OpenGL,
-        Vulkan
+        Vulkan,
+        Null     // headless: CPU stubs, no device (benchmarks / GPU-less CI)
     };
 
     // =============================================================================
@@ -40,7 +41,7 @@ namespace Opaax
     public:
         static UniquePtr<IRenderAPI> Create(EBackend InBackend);
 
-        // Map a config string ("OpenGL"/"Vulkan") to EBackend. Unknown -> OpenGL (logged).
+        // Map a config string ("OpenGL"/"Vulkan"/"Null") to EBackend. Unknown -> OpenGL (logged).
         // Keeps the enum + its names in RHI so Core/Config can stay backend-agnostic.
         static EBackend             BackendFromString(const OpaaxString& InName);
         static const char*          BackendToString(EBackend InBackend) noexcept;
@@ -39,6 +39,16 @@ namespace Opaax
         return s_API->GetCommandBuffer();
     }
 
+    Uint32 RenderCommand::GetSecondaryCommandBufferCount()
+    {
+        return s_API ? s_API->GetSecondaryCommandBufferCount() : 0;
+    }
+
+    ICommandBuffer* RenderCommand::GetSecondaryCommandBuffer(Uint32 InIndex)
+    {
+        return s_API ? s_API->GetSecondaryCommandBuffer(InIndex) : nullptr;
+    }
+
     void RenderCommand::SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height)
     {
         s_API->SetViewport(X, Y, Width, Height);
@@ -48,4 +58,14 @@ namespace Opaax
     {
         if (s_API) { s_API->WaitIdle(); }
     }
+
+    Uint64 RenderCommand::GetFrameMemoryUsed()
+    {
+        return s_API ? s_API->GetFrameMemoryUsed() : 0;
+    }
+
+    Uint64 RenderCommand::GetFrameMemoryCapacity()
+    {
+        return s_API ? s_API->GetFrameMemoryCapacity() : 0;
+    }
 }
@@ -50,12 +50,20 @@ namespace Opaax
         // work goes through this — see ICommandBuffer.
         static ICommandBuffer& GetCommandBuffer();
 
+        // Secondary recorders for parallel pass recording (0 / null when unsupported) — see IRenderAPI.
+        static Uint32          GetSecondaryCommandBufferCount();
+        static ICommandBuffer* GetSecondaryCommandBuffer(Uint32 InIndex);
+
         // Global viewport set (window-resize path).
         static void SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height);
 
         // Block until the GPU finishes all submitted work (teardown before destroying resources).
         static void WaitIdle();
 
+        // Transient per-frame GPU memory used / reserved (bytes; 0 when the backend has none).
+        static Uint64 GetFrameMemoryUsed();
+        static Uint64 GetFrameMemoryCapacity();
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -1,6 +1,7 @@
 #include "ShaderCompiler.h"
 
 #include "Core/Log/OpaaxLog.h"
+#include "RHI/SpirvCache.h"
 
 // OPAAX_HAS_GLSLANG is defined (0/1) by the engine build; treat absent as 0 for safety.
 #ifndef OPAAX_HAS_GLSLANG
@@ -11,6 +12,7 @@
 #include <glslang/Public/ShaderLang.h>
 #include <glslang/Public/ResourceLimits.h>
 #include <glslang/SPIRV/GlslangToSpv.h>
+#include <string>
 #include <vector>
 #endif
 
@@ -41,12 +43,32 @@ namespace Opaax
             }
             return EShLangVertex;
         }
+
+        // Everything besides stage/defines/source that shapes the output: glslang build and the
+        // fixed environment below. A toolchain upgrade therefore invalidates the whole cache.
+        const char* CompilerTag()
+        {
+            static const std::string s_Tag = std::string(GetGlslVersionString())
+                                           + " | glsl450 vulkan1.0 spv1.0";
+            return s_Tag.c_str();
+        }
     }
 
     TDynArray<Uint32> ShaderCompiler::CompileGLSLToSPIRV(EShaderStage       InStage,
                                                          const OpaaxString& InGlsl,
-                                                         const OpaaxString& InDebugName)
+                                                         const OpaaxString& InDebugName,
+                                                         const OpaaxString& InDefines)
     {
+        const std::string lCacheKey = SpirvCache::MakeKeyMaterial(static_cast<Uint32>(InStage),
+            InDefines.CStr(), InGlsl.CStr(), CompilerTag());
+
+        TDynArray<Uint32> lCached;
+        if (SpirvCache::Load(lCacheKey, lCached))
+        {
+            OPAAX_CORE_TRACE("ShaderCompiler: '{}' served from SPIR-V cache", InDebugName);
+            return lCached;
+        }
+
         EnsureGlslangInit();
 
         const EShLanguage lStage = ToEShLanguage(InStage);
@@ -54,6 +76,10 @@ namespace Opaax
 
         const char* lSrc = InGlsl.CStr();
         lShader.setStrings(&lSrc, 1);
+        if (!InDefines.IsEmpty())
+        {
+            lShader.setPreamble(InDefines.CStr());
+        }
 
         // Target Vulkan SPIR-V — the one artifact a future Vulkan backend consumes, and that
         // GL_ARB_gl_spirv accepts (requires the GLSL to use explicit bindings/locations).
@@ -84,7 +110,9 @@ namespace Opaax
         std::vector<unsigned int> lSpirv;
         glslang::GlslangToSpv(*lProgram.getIntermediate(lStage), lSpirv);
 
-        return TDynArray<Uint32>(lSpirv.begin(), lSpirv.end());
+        TDynArray<Uint32> lResult(lSpirv.begin(), lSpirv.end());
+        SpirvCache::Store(lCacheKey, lResult);
+        return lResult;
     }
 #else  // OPAAX_HAS_GLSLANG
 
@@ -92,7 +120,8 @@ namespace Opaax
     // fall back to the GLSL source path (OpenGL only; a Vulkan backend needs glslang).
     TDynArray<Uint32> ShaderCompiler::CompileGLSLToSPIRV(EShaderStage /*InStage*/,
                                                          const OpaaxString& /*InGlsl*/,
-                                                         const OpaaxString& /*InDebugName*/)
+                                                         const OpaaxString& /*InDebugName*/,
+                                                         const OpaaxString& /*InDefines*/)
     {
         return {};
     }
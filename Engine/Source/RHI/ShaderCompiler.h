@@ -24,6 +24,9 @@ namespace Opaax
      * Compiles Vulkan-flavored GLSL to SPIR-V via glslang. SPIR-V is the single portable
      * shader IR: OpenGL consumes it through GL_ARB_gl_spirv, Vulkan natively. Backend-
      * neutral — glslang types never leak past this TU.
+     *
+     * Results are memoised on disk through SpirvCache (keyed by stage, defines, source and
+     * glslang version), so a warm cache — e.g. after OpaaxShaderCook — never runs glslang.
      */
     class OPAAX_API ShaderCompiler
     {
@@ -33,11 +36,13 @@ namespace Opaax
          * @param InStage     vertex or fragment
          * @param InGlsl      stage GLSL source (Vulkan rules: explicit bindings/locations)
          * @param InDebugName label used in compile-error logs
+         * @param InDefines   optional preamble injected after #version (e.g. "#define FOO 1\n")
          * @return SPIR-V words, or an empty array on failure (logged fail-loud).
          */
         static TDynArray<Uint32> CompileGLSLToSPIRV(EShaderStage       InStage,
                                                     const OpaaxString& InGlsl,
-                                                    const OpaaxString& InDebugName);
+                                                    const OpaaxString& InDebugName,
+                                                    const OpaaxString& InDefines = {});
     };
 
 } // namespace Opaax
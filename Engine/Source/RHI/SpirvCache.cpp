@@ -0,0 +1,59 @@
+#include "SpirvCache.h"
+
+#include "Core/Config/EngineConfig.h"
+#include "Core/OpaaxFile.h"
+
+#include <cstdio>
+
+namespace Opaax
+{
+    namespace
+    {
+        // <keyhash>.spv under <cacheDir>/Shaders. Stage is part of the key material, so each
+        // (stage, defines, source, compiler) tuple gets its own file.
+        OpaaxString EntryPath(const std::string& InKeyMaterial)
+        {
+            OpaaxString lPath = EngineConfig::CacheDirectory("Shaders");
+            if (lPath.IsEmpty())
+            {
+                return lPath;
+            }
+
+            char lName[24];
+            std::snprintf(lName, sizeof(lName), "/%08x.spv", SpirvCache::HashKey(InKeyMaterial));
+            lPath += lName;
+            return lPath;
+        }
+    }
+
+    bool SpirvCache::Load(const std::string& InKeyMaterial, TDynArray<Uint32>& OutSpirv)
+    {
+        const OpaaxString lPath = EntryPath(InKeyMaterial);
+        if (lPath.IsEmpty())
+        {
+            return false;
+        }
+
+        TDynArray<Uint8> lBytes;
+        if (!OpaaxFile::ReadBinary(lPath.CStr(), lBytes))
+        {
+            return false;
+        }
+        // A mismatch here is usually an edited shader reusing the slot — silently a miss.
+        return Deserialize(lBytes.data(), lBytes.size(), InKeyMaterial, OutSpirv);
+    }
+
+    bool SpirvCache::Store(const std::string& InKeyMaterial, const TDynArray<Uint32>& InSpirv)
+    {
+        const OpaaxString lPath = EntryPath(InKeyMaterial);
+        if (lPath.IsEmpty() || InSpirv.empty())
+        {
+            return false;
+        }
+
+        TDynArray<Uint8> lBytes;
+        Serialize(InKeyMaterial, InSpirv, lBytes);
+        return OpaaxFile::WriteBinaryAtomic(lPath.CStr(), lBytes.data(), lBytes.size());
+    }
+
+} // namespace Opaax
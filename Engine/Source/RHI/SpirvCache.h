@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxHash.h"
+#include "Core/OpaaxString.hpp"
+#include "Core/OpaaxTypes.h"
+
+#include <cstring>
+#include <string>
+
+namespace Opaax
+{
+    // =============================================================================
+    // SPIR-V compile cache
+    //
+    // Content-addressed store for ShaderCompiler output. The key MATERIAL is every
+    // input that can change the SPIR-V — stage, defines preamble, GLSL source and
+    // the compiler fingerprint (glslang version + target env) — and is stored
+    // verbatim in the entry, so lookup compares it byte for byte: a hash collision
+    // or a compiler upgrade is a miss, never the wrong shader. The 32-bit hash only
+    // names the file. Trailing FNV-1a checksum rejects torn writes.
+    //
+    // Serialize/Deserialize are header-inline (unit-testable); the disk half lives
+    // in SpirvCache.cpp. Entries are written by ShaderCompiler on a miss and by the
+    // OpaaxShaderCook tool, which pre-warms every manifest shader.
+    // =============================================================================
+    namespace SpirvCache
+    {
+        static constexpr Uint32 Magic   = 0x5653504Fu;   // "OPSV"
+        static constexpr Uint32 Version = 1u;
+
+        /** Every compile input, flattened (NUL-separated) into one comparable string. */
+        inline std::string MakeKeyMaterial(Uint32 InStage, const char* InDefines, const char* InGlsl,
+                                           const char* InCompilerTag)
+        {
+            std::string lKey;
+            lKey.reserve(std::strlen(InGlsl) + 128);
+            lKey += std::to_string(InStage);
+            lKey += '\0';
+            lKey += InCompilerTag ? InCompilerTag : "";
+            lKey += '\0';
+            lKey += InDefines ? InDefines : "";
+            lKey += '\0';
+            lKey += InGlsl;
+            return lKey;
+        }
+
+        FORCEINLINE Uint32 HashKey(const std::string& InKeyMaterial) noexcept
+        {
+            return OpaaxHash::HashBytes(InKeyMaterial.data(), InKeyMaterial.size());
+        }
+
+        inline void Serialize(const std::string& InKeyMaterial, const TDynArray<Uint32>& InSpirv,
+                              TDynArray<Uint8>& OutBytes)
+        {
+            const Uint32 lHeader[4] = { Magic, Version,
+                                        static_cast<Uint32>(InKeyMaterial.size()),
+                                        static_cast<Uint32>(InSpirv.size()) };
+            const size_t lSpirvBytes = InSpirv.size() * sizeof(Uint32);
+
+            OutBytes.resize(sizeof(lHeader) + InKeyMaterial.size() + lSpirvBytes + sizeof(Uint32));
+            Uint8* lAt = OutBytes.data();
+            std::memcpy(lAt, lHeader, sizeof(lHeader));                      lAt += sizeof(lHeader);
+            std::memcpy(lAt, InKeyMaterial.data(), InKeyMaterial.size());    lAt += InKeyMaterial.size();
+            if (lSpirvBytes) { std::memcpy(lAt, InSpirv.data(), lSpirvBytes); lAt += lSpirvBytes; }
+
+            const Uint32 lSum = OpaaxHash::HashBytes(OutBytes.data(), OutBytes.size() - sizeof(Uint32));
+            std::memcpy(lAt, &lSum, sizeof(Uint32));
+        }
+
+        /** False (OutSpirv untouched) unless the blob is intact and its key material matches exactly. */
+        inline bool Deserialize(const Uint8* InBytes, size_t InSize, const std::string& InKeyMaterial,
+                                TDynArray<Uint32>& OutSpirv)
+        {
+            Uint32 lHeader[4] = {};
+            if (!InBytes || InSize < sizeof(lHeader) + sizeof(Uint32)) { return false; }
+
+            const size_t lBody = InSize - sizeof(Uint32);
+            Uint32 lSum = 0;
+            std::memcpy(&lSum, InBytes + lBody, sizeof(Uint32));
+            if (lSum != OpaaxHash::HashBytes(InBytes, lBody)) { return false; }
+
+            std::memcpy(lHeader, InBytes, sizeof(lHeader));
+            if (lHeader[0] != Magic || lHeader[1] != Version)                              { return false; }
+            if (lHeader[2] != InKeyMaterial.size() || lHeader[3] == 0)                     { return false; }
+            if (sizeof(lHeader) + size_t(lHeader[2]) + size_t(lHeader[3]) * sizeof(Uint32) != lBody) { return false; }
+
+            const Uint8* lKey = InBytes + sizeof(lHeader);
+            if (std::memcmp(lKey, InKeyMaterial.data(), InKeyMaterial.size()) != 0)       { return false; }
+
+            OutSpirv.resize(lHeader[3]);
+            std::memcpy(OutSpirv.data(), lKey + lHeader[2], size_t(lHeader[3]) * sizeof(Uint32));
+            return true;
+        }
+
+        /** Cached SPIR-V for InKeyMaterial from <cacheDir>/Shaders. False on miss / stale / corrupt / disabled. */
+        OPAAX_API bool Load(const std::string& InKeyMaterial, TDynArray<Uint32>& OutSpirv);
+
+        /** Persist InSpirv under InKeyMaterial (atomic replace). No-op when caching is disabled. */
+        OPAAX_API bool Store(const std::string& InKeyMaterial, const TDynArray<Uint32>& InSpirv);
+    }
+
+} // namespace Opaax
@@ -5,6 +5,58 @@
 
 namespace Opaax
 {
+    // =============================================================================
+    // Pre-cooked texture data
+    // =============================================================================
+
+    /**
+     * @enum ETextureFormat
+     * GPU storage format of a pre-cooked texture (TextureCook) — uploaded as-is, no conversion.
+     * BC1 is opaque RGB (4 bpp), BC3 is RGBA with an interpolated alpha block (8 bpp).
+     */
+    enum class ETextureFormat : Uint8
+    {
+        RGBA8,
+        BC1,
+        BC3
+    };
+
+    inline constexpr Uint32 MaxTextureMips = 16;   // 32768^2
+
+    FORCEINLINE constexpr bool IsBlockCompressed(ETextureFormat InFormat) noexcept
+    {
+        return InFormat != ETextureFormat::RGBA8;
+    }
+
+    // Bytes of one tightly packed level of InWidth x InHeight texels (4x4 blocks for BC).
+    FORCEINLINE constexpr Uint64 GetTextureLevelSize(ETextureFormat InFormat, Uint32 InWidth, Uint32 InHeight) noexcept
+    {
+        if (!IsBlockCompressed(InFormat)) { return static_cast<Uint64>(InWidth) * InHeight * 4u; }
+        const Uint64 lBlocks = static_cast<Uint64>((InWidth + 3u) / 4u) * ((InHeight + 3u) / 4u);
+        return lBlocks * (InFormat == ETextureFormat::BC1 ? 8u : 16u);
+    }
+
+    // Extent of level InMip for a base extent of InExtent (never below 1).
+    FORCEINLINE constexpr Uint32 GetTextureMipExtent(Uint32 InExtent, Uint32 InMip) noexcept
+    {
+        return (InExtent >> InMip) ? (InExtent >> InMip) : 1u;
+    }
+
+    /**
+     * @struct TextureDesc
+     * A complete, pre-cooked texture: MipCount levels, largest first, each Mips[i] pointing at
+     * GetTextureLevelSize(Format, mip extent) bytes. Rows bottom-up, like every other upload.
+     * The bytes are only read during ITexture2D::Create.
+     */
+    struct TextureDesc
+    {
+        ETextureFormat       Format   = ETextureFormat::RGBA8;
+        Uint32               Width    = 0;
+        Uint32               Height   = 0;
+        Uint32               MipCount = 1;
+        const unsigned char* Mips[MaxTextureMips] = {};
+    };
+
     /**
      * @interface ITexture2D
      *
@@ -38,6 +90,9 @@ namespace Opaax
         // Raw pixel bytes. Channels: 4 = RGBA8, 3 = RGB8, 1 = R8 coverage (alpha-swizzled).
         static UniquePtr<ITexture2D> Create(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
 
+        // Pre-cooked levels (TextureCook): uploaded in their stored format, with their mip chain.
+        static UniquePtr<ITexture2D> Create(const TextureDesc& InDesc);
+
         // =============================================================================
         // Functions
         // =============================================================================
@@ -52,5 +107,12 @@ namespace Opaax
         virtual Uint32 GetHeight()     const noexcept = 0;
         virtual Uint32 GetRendererID() const noexcept = 0;
         virtual bool   IsLoaded()      const noexcept = 0;
+
+        // Bytes of GPU memory the texture occupies (residency budgeting / GpuMemoryTracker).
+        // Default assumes RGBA8; backends that know better override.
+        virtual Uint64 GetGpuMemorySize() const noexcept
+        {
+            return IsLoaded() ? static_cast<Uint64>(GetWidth()) * GetHeight() * 4u : 0u;
+        }
     };
 }
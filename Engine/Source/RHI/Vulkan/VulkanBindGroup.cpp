@@ -8,9 +8,12 @@
 #include "VulkanUniformBuffer.h"
 #include "VulkanTexture2D.h"
 #include "RHI/Vulkan/VulkanSwapchain.h"   // OPAAX_FRAMES_IN_FLIGHT
+#include "RHI/ICommandBuffer.h"             // CommandStateStats
 #include "Core/Config/EngineConfig.h"
 #include "Core/Log/OpaaxLog.h"
 
+#include <algorithm>
+
 namespace Opaax
 {
     // NOTE: the IBindGroup::Create factory dispatch lives in RHI/BackendFactory.cpp.
@@ -26,48 +29,79 @@ namespace Opaax
 
         m_SetLayout = BuildSpriteDescriptorSetLayout(m_Device);
 
-        // Ring depth is config-tunable (render.vulkanFrameRing, default 64). Read once here — it sizes
-        // the pre-allocated set ring AND bounds the per-frame cursor in BindInto.
-        m_RingDepth = EngineConfig::VulkanFrameRing();
-        const Uint32 lSetCount = m_RingDepth * OPAAX_FRAMES_IN_FLIGHT;
+        // Page size is config-tunable (render.vulkanFrameRing). One page per frame slot up front —
+        // enough for every normal frame; AddPage chains more only when a frame outgrows it.
+        m_RingDepth = EngineConfig::VulkanFrameRing() > 0 ? EngineConfig::VulkanFrameRing() : 1u;
+        for (Uint32 lSlot = 0; lSlot < OPAAX_FRAMES_IN_FLIGHT; ++lSlot)
+        {
+            AddPage(lSlot);
+        }
+
+        m_DesiredImages.resize(m_TextureCount);
+        m_ImageInfos.resize(m_TextureCount);
+    }
+
+    VulkanBindGroup::~VulkanBindGroup()
+    {
+        // Destroying a pool frees its sets.
+        for (FrameRing& lRing : m_Rings)
+        {
+            for (VkDescriptorPool lPool : lRing.Pools) { vkDestroyDescriptorPool(m_Device, lPool, nullptr); }
+        }
+        if (m_SetLayout) { vkDestroyDescriptorSetLayout(m_Device, m_SetLayout, nullptr); }
+    }
+
+    bool VulkanBindGroup::AddPage(Uint32 InFrameSlot)
+    {
+        FrameRing& lRing = m_Rings[InFrameSlot];
 
-        // ---- Pool: enough for every ring set across both frames-in-flight ----
         VkDescriptorPoolSize lSizes[2]{};
         lSizes[0].type            = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        lSizes[0].descriptorCount = m_TextureCount * lSetCount;
-        lSizes[1].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        lSizes[1].descriptorCount = lSetCount;
+        lSizes[0].descriptorCount = m_TextureCount * m_RingDepth;
+        lSizes[1].type            = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        lSizes[1].descriptorCount = m_RingDepth;
 
         VkDescriptorPoolCreateInfo lPoolInfo{ VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO };
-        lPoolInfo.maxSets       = lSetCount;
+        lPoolInfo.maxSets       = m_RingDepth;
         lPoolInfo.poolSizeCount = 2;
         lPoolInfo.pPoolSizes    = lSizes;
-        if (vkCreateDescriptorPool(m_Device, &lPoolInfo, nullptr, &m_Pool) != VK_SUCCESS)
+
+        VkDescriptorPool lPool = VK_NULL_HANDLE;
+        if (vkCreateDescriptorPool(m_Device, &lPoolInfo, nullptr, &lPool) != VK_SUCCESS)
         {
             OPAAX_CORE_ERROR("VulkanBindGroup: descriptor pool creation failed.");
-            return;
+            return false;
         }
 
-        // ---- Pre-allocate all ring sets (same layout repeated) ----
-        TDynArray<VkDescriptorSetLayout> lLayouts(lSetCount, m_SetLayout);
+        TDynArray<VkDescriptorSetLayout> lLayouts(m_RingDepth, m_SetLayout);
         VkDescriptorSetAllocateInfo lAlloc{ VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO };
-        lAlloc.descriptorPool     = m_Pool;
-        lAlloc.descriptorSetCount = lSetCount;
+        lAlloc.descriptorPool     = lPool;
+        lAlloc.descriptorSetCount = m_RingDepth;
         lAlloc.pSetLayouts        = lLayouts.data();
 
-        m_Sets.resize(lSetCount);
-        if (vkAllocateDescriptorSets(m_Device, &lAlloc, m_Sets.data()) != VK_SUCCESS)
+        const size_t lFirst = lRing.Sets.size();
+        lRing.Sets.resize(lFirst + m_RingDepth);
+        if (vkAllocateDescriptorSets(m_Device, &lAlloc, lRing.Sets.data() + lFirst) != VK_SUCCESS)
         {
             OPAAX_CORE_ERROR("VulkanBindGroup: descriptor set allocation failed.");
-            m_Sets.clear();
+            lRing.Sets.resize(lFirst);
+            vkDestroyDescriptorPool(m_Device, lPool, nullptr);
+            return false;
         }
-    }
 
-    VulkanBindGroup::~VulkanBindGroup()
-    {
-        // Destroying the pool frees its sets.
-        if (m_Pool)      { vkDestroyDescriptorPool(m_Device, m_Pool, nullptr); }
-        if (m_SetLayout) { vkDestroyDescriptorSetLayout(m_Device, m_SetLayout, nullptr); }
+        lRing.Pools.push_back(lPool);
+        lRing.Shadows.resize(lRing.Sets.size());
+        for (size_t i = lFirst; i < lRing.Shadows.size(); ++i)
+        {
+            lRing.Shadows[i].Images.assign(m_TextureCount, ImageKey{});
+        }
+
+        if (lRing.Pools.size() > 1)
+        {
+            OPAAX_CORE_INFO("VulkanBindGroup: frame slot {} grew to {} descriptor sets ({} pages; "
+                            "raise render.vulkanFrameRing to pre-size).", InFrameSlot, lRing.Sets.size(), lRing.Pools.size());
+        }
+        return true;
     }
 
     void VulkanBindGroup::SetUniformBuffer(IUniformBuffer& InUniformBuffer)
@@ -83,9 +117,11 @@ namespace Opaax
         }
     }
 
-    void VulkanBindGroup::BindInto(VkCommandBuffer InCmd, VkPipelineLayout InPipelineLayout)
+    void VulkanBindGroup::BindInto(VkCommandBuffer InCmd, VkPipelineLayout InPipelineLayout, bool InStillBound,
+                                   CommandStateStats& InOutStats)
     {
-        if (m_Sets.empty() || !m_UBO) { return; }
+        // No camera block uploaded yet — nothing valid to point binding 1 at.
+        if (!m_UBO || m_UBO->GetBindBuffer() == VK_NULL_HANDLE) { return; }
 
         const Uint64 lGen = VulkanFrameContext::Generation();
         if (lGen != m_FrameGen)
@@ -93,59 +129,115 @@ namespace Opaax
             m_FrameGen   = lGen;
             m_RingCursor = 0;
         }
-        // Ring exhausted: FAIL LOUD, never wrap. Wrapping to slot 0 would rewrite a descriptor set
-        // this frame's command buffer already references (recorded, not yet executed) — a use-while-
-        // updated hazard. Instead skip this bind: the prior (valid) set stays bound, so the draw is
-        // visually wrong under extreme overflow but the GPU never reads a clobbered set. Raise
-        // render.vulkanFrameRing if a real scene legitimately needs more batches/frame.
-        if (m_RingCursor >= m_RingDepth)
+
+        const Uint32 lFrameSlot = VulkanFrameContext::FrameSlot();
+        FrameRing&   lRing      = m_Rings[lFrameSlot];
+
+        // What binding 0 should hold. Every slot references a live view (Renderer2D fills inactive
+        // slots with the white texture).
+        for (Uint32 i = 0; i < m_TextureCount; ++i)
+        {
+            const VulkanTexture2D* lTex = m_Textures[i];
+            m_DesiredImages[i] = lTex ? ImageKey{ lTex->GetUniqueID(), lTex->GetImageView(), lTex->GetSampler() }
+                                      : ImageKey{};
+            m_ImageInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            m_ImageInfos[i].imageView   = m_DesiredImages[i].View;
+            m_ImageInfos[i].sampler     = m_DesiredImages[i].Sampler;
+        }
+
+        const VkBuffer lUboBuffer     = m_UBO->GetBindBuffer();
+        const Uint32   lDynamicOffset = static_cast<Uint32>(m_UBO->GetCurrentByteOffset());
+
+        // ---- Same state as the set still bound: reuse it. A moved camera block only needs a rebind
+        //      with the new dynamic offset; otherwise the whole bind is redundant. ----
+        if (InStillBound && m_RingCursor > 0)
         {
-            OPAAX_CORE_ERROR("VulkanBindGroup: frame exceeded {} descriptor-ring slots — skipping bind "
-                             "(raise render.vulkanFrameRing).", m_RingDepth);
-            OPAAX_CORE_ASSERT(false)
+            const SetShadow& lLast = lRing.Shadows[m_RingCursor - 1];
+            if (lLast.Buffer == lUboBuffer
+                && std::equal(m_DesiredImages.begin(), m_DesiredImages.end(), lLast.Images.begin()))
+            {
+                InOutStats.Skipped += m_TextureCount + 1;   // every image slot + the UBO write
+                if (lDynamicOffset == m_LastDynamicOffset)
+                {
+                    ++InOutStats.Skipped;
+                    return;
+                }
+
+                VkDescriptorSet lLastSet = lRing.Sets[m_RingCursor - 1];
+                vkCmdBindDescriptorSets(InCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, InPipelineLayout,
+                                        0, 1, &lLastSet, 1, &lDynamicOffset);
+                m_LastDynamicOffset = lDynamicOffset;
+                ++InOutStats.Issued;
+                return;
+            }
+        }
+
+        // Out of sets for this frame: chain a page rather than wrap (wrapping would rewrite a set this
+        // frame's command buffer already references). Only an allocation failure skips the bind —
+        // the prior (valid) set stays bound.
+        if (m_RingCursor >= lRing.Sets.size() && !AddPage(lFrameSlot))
+        {
+            OPAAX_CORE_ERROR("VulkanBindGroup: could not grow the descriptor ring past {} sets — skipping bind.",
+                             lRing.Sets.size());
             return;
         }
 
-        const Uint32 lFrameSlot = VulkanFrameContext::FrameSlot();
-        const Uint32 lSetIndex  = lFrameSlot * m_RingDepth + m_RingCursor;
-        VkDescriptorSet lSet     = m_Sets[lSetIndex];
+        VkDescriptorSet lSet    = lRing.Sets[m_RingCursor];
+        SetShadow&      lShadow = lRing.Shadows[m_RingCursor];
+        m_Writes.clear();
 
-        // ---- Image infos (binding 0). Every slot references a live view (Renderer2D fills
-        //      inactive slots with the white texture) — no dangling descriptor. ----
-        TDynArray<VkDescriptorImageInfo> lImageInfos(m_TextureCount);
-        for (Uint32 i = 0; i < m_TextureCount; ++i)
+        // ---- Binding 0: only the texture slots that differ from what this set last held. The first
+        //      use of a set writes them all — no dangling descriptor. ----
+        m_DirtyRuns.clear();
+        const Uint32 lDirtySlots = CollectDirtyRuns(m_DesiredImages.data(), lShadow.Images.data(),
+                                                    m_TextureCount, m_DirtyRuns);
+        for (const DescriptorRun& lRun : m_DirtyRuns)
         {
-            VulkanTexture2D* lTex = m_Textures[i];
-            lImageInfos[i].imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-            lImageInfos[i].imageView   = lTex ? lTex->GetImageView() : VK_NULL_HANDLE;
-            lImageInfos[i].sampler     = lTex ? lTex->GetSampler()   : VK_NULL_HANDLE;
+            VkWriteDescriptorSet& lWrite = m_Writes.emplace_back();
+            lWrite.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            lWrite.dstSet          = lSet;
+            lWrite.dstBinding      = 0;
+            lWrite.dstArrayElement = lRun.First;
+            lWrite.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            lWrite.descriptorCount = lRun.Count;
+            lWrite.pImageInfo      = m_ImageInfos.data() + lRun.First;
         }
+        InOutStats.Issued  += lDirtySlots;
+        InOutStats.Skipped += m_TextureCount - lDirtySlots;
 
-        // ---- Buffer info (binding 1) — this pass's view-projection slot. ----
+        // ---- Binding 1 — the camera UBO's frame-allocator page. The block offset is dynamic, so the
+        //      descriptor only changes when the UBO lands on a different page (or frame slot). ----
         VkDescriptorBufferInfo lBufInfo{};
-        lBufInfo.buffer = m_UBO->GetBuffer(lFrameSlot);
-        lBufInfo.offset = m_UBO->GetCurrentByteOffset();
+        lBufInfo.buffer = lUboBuffer;
+        lBufInfo.offset = 0;
         lBufInfo.range  = m_UBO->GetBlockSize();
+        if (lShadow.Buffer != lBufInfo.buffer)
+        {
+            lShadow.Buffer = lBufInfo.buffer;
+
+            VkWriteDescriptorSet& lWrite = m_Writes.emplace_back();
+            lWrite.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            lWrite.dstSet          = lSet;
+            lWrite.dstBinding      = 1;
+            lWrite.descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            lWrite.descriptorCount = 1;
+            lWrite.pBufferInfo     = &lBufInfo;
+            ++InOutStats.Issued;
+        }
+        else
+        {
+            ++InOutStats.Skipped;
+        }
 
-        VkWriteDescriptorSet lWrites[2]{};
-        lWrites[0].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        lWrites[0].dstSet          = lSet;
-        lWrites[0].dstBinding      = 0;
-        lWrites[0].descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-        lWrites[0].descriptorCount = m_TextureCount;
-        lWrites[0].pImageInfo      = lImageInfos.data();
-
-        lWrites[1].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        lWrites[1].dstSet          = lSet;
-        lWrites[1].dstBinding      = 1;
-        lWrites[1].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-        lWrites[1].descriptorCount = 1;
-        lWrites[1].pBufferInfo     = &lBufInfo;
-
-        vkUpdateDescriptorSets(m_Device, 2, lWrites, 0, nullptr);
+        if (!m_Writes.empty())
+        {
+            vkUpdateDescriptorSets(m_Device, static_cast<Uint32>(m_Writes.size()), m_Writes.data(), 0, nullptr);
+        }
 
         vkCmdBindDescriptorSets(InCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, InPipelineLayout,
-                                0, 1, &lSet, 0, nullptr);
+                                0, 1, &lSet, 1, &lDynamicOffset);
+        m_LastDynamicOffset = lDynamicOffset;
+        ++InOutStats.Issued;
 
         ++m_RingCursor;
     }
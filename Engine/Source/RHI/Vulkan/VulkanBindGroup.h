@@ -5,6 +5,8 @@
 #if OPAAX_HAS_VULKAN
 
 #include "Core/OpaaxTypes.h"
+#include "RHI/Vulkan/VulkanDescriptorDiff.h"
+#include "RHI/Vulkan/VulkanSwapchain.h"   // OPAAX_FRAMES_IN_FLIGHT
 
 #include <vulkan/vulkan.h>
 
@@ -12,6 +14,7 @@ namespace Opaax
 {
     class VulkanUniformBuffer;
     class VulkanTexture2D;
+    struct CommandStateStats;
 
     // =============================================================================
     // VulkanBindGroup
@@ -23,10 +26,19 @@ namespace Opaax
      * only cache pointers (same shape as OpenGLBindGroup); the actual descriptor write + bind
      * happens in BindInto, called by VulkanCommandBuffer per flush.
      *
-     * Holds a RING of pre-allocated descriptor sets PER frame-in-flight: each flush updates +
-     * binds the NEXT set so a mid-frame texture change (multi-flush / world-then-overlay) does not
-     * clobber a draw already recorded but not yet executed. The UBO binding uses the uniform
-     * buffer's current ring offset, so a pass's descriptor points at that pass's view-projection.
+     * Holds a RING of descriptor sets PER frame-in-flight: each flush updates + binds the NEXT set
+     * so a mid-frame texture change (multi-flush / world-then-overlay) does not clobber a draw
+     * already recorded but not yet executed. The UBO binding is dynamic: the descriptor names the
+     * frame-allocator page and the bind passes the uniform buffer's current block offset, so a
+     * pass's draws read that pass's view-projection.
+     *
+     * The ring is a chain of pools ("pages") of render.vulkanFrameRing sets each. A frame that
+     * needs more sets than the slot owns chains another page instead of failing, so the batch
+     * count per frame is uncapped; pages are kept and the cursor rewinds at frame start. Each
+     * set remembers what it last received, so a rebind only writes the texture slots / UBO page
+     * that actually changed since that set was last used. When the set bound by the previous call
+     * is still bound and already holds the desired textures + page, it is reused: no ring advance,
+     * no writes, and no bind at all unless the camera block offset moved.
      */
     class VulkanBindGroup final : public IBindGroup
     {
@@ -53,25 +65,64 @@ namespace Opaax
         // =============================================================================
     public:
         // Update the next ring descriptor set with the cached UBO + textures, then bind it.
-        void BindInto(VkCommandBuffer InCmd, VkPipelineLayout InPipelineLayout);
+        // InStillBound: this group's last set is still bound at set 0 in the current pass.
+        void BindInto(VkCommandBuffer InCmd, VkPipelineLayout InPipelineLayout, bool InStillBound,
+                      CommandStateStats& InOutStats);
+
+    private:
+        // Chain one more page of m_RingDepth sets onto InFrameSlot's ring.
+        bool AddPage(Uint32 InFrameSlot);
 
         // =============================================================================
         // Members
         // =============================================================================
     private:
+        // What a set's binding-0 element currently holds. The texture's unique ID guards against a
+        // recycled view handle; view + sampler are what the descriptor actually stores.
+        struct ImageKey
+        {
+            Uint64      TextureID = 0;
+            VkImageView View      = VK_NULL_HANDLE;
+            VkSampler   Sampler   = VK_NULL_HANDLE;
+
+            bool operator==(const ImageKey& InOther) const noexcept
+            {
+                return TextureID == InOther.TextureID && View == InOther.View && Sampler == InOther.Sampler;
+            }
+        };
+
+        struct SetShadow
+        {
+            TDynArray<ImageKey> Images;                 // size = m_TextureCount, empty keys = never written
+            VkBuffer            Buffer = VK_NULL_HANDLE;   // UBO page; the block offset is dynamic
+        };
+
+        struct FrameRing
+        {
+            TDynArray<VkDescriptorPool> Pools;          // one per page
+            TDynArray<VkDescriptorSet>  Sets;           // flattened across pages, index = ring cursor
+            TDynArray<SetShadow>        Shadows;        // parallel to Sets
+        };
+
         VkDevice              m_Device     = VK_NULL_HANDLE;   // borrowed
-        VkDescriptorPool      m_Pool       = VK_NULL_HANDLE;
         VkDescriptorSetLayout m_SetLayout  = VK_NULL_HANDLE;
         Uint32                m_TextureCount = 0;
 
-        TDynArray<VkDescriptorSet> m_Sets;   // [frameSlot * RING + ringCursor]
+        FrameRing             m_Rings[OPAAX_FRAMES_IN_FLIGHT];
 
         VulkanUniformBuffer*           m_UBO = nullptr;
         TDynArray<VulkanTexture2D*>    m_Textures;   // size = m_TextureCount
 
-        Uint64 m_FrameGen   = ~0ull;
-        Uint32 m_RingCursor = 0;
-        Uint32 m_RingDepth  = 0;   // EngineConfig::VulkanFrameRing() — sizes m_Sets + bounds the cursor
+        // BindInto scratch, kept to avoid per-flush allocations.
+        TDynArray<ImageKey>              m_DesiredImages;
+        TDynArray<VkDescriptorImageInfo> m_ImageInfos;
+        TDynArray<DescriptorRun>         m_DirtyRuns;
+        TDynArray<VkWriteDescriptorSet>  m_Writes;
+
+        Uint64 m_FrameGen          = ~0ull;
+        Uint32 m_RingCursor        = 0;
+        Uint32 m_LastDynamicOffset = 0;    // camera block offset of the last bind
+        Uint32 m_RingDepth         = 0;    // EngineConfig::VulkanFrameRing() — sets per page
     };
 
 } // namespace Opaax
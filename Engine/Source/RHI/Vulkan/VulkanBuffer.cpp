@@ -3,7 +3,10 @@
 #if OPAAX_HAS_VULKAN
 
 #include "VulkanFrameContext.h"
+#include "VulkanFrameAllocator.h"
+#include "VulkanDevice.h"
 #include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
 
 #include <cstring>
 
@@ -44,30 +47,29 @@ namespace Opaax
     VulkanVertexBuffer::VulkanVertexBuffer(Uint32 InSize)
         : m_Allocator(VulkanFrameContext::Allocator()), m_Capacity(InSize)
     {
-        for (Uint32 i = 0; i < OPAAX_FRAMES_IN_FLIGHT; ++i)
-        {
-            CreateMappedBuffer(m_Allocator, InSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                               m_Buffers[i], m_Allocs[i], m_Mapped[i]);
-        }
+        // Dynamic path: storage comes from the frame allocator per SetData — nothing to create.
     }
 
     VulkanVertexBuffer::VulkanVertexBuffer(const float* InVertices, Uint32 InSize)
         : m_Allocator(VulkanFrameContext::Allocator()), m_Capacity(InSize), m_Static(true)
     {
         // Static path (not used by Renderer2D's dynamic batch VBO): one buffer, uploaded once.
+        void* lMapped = nullptr;
         if (CreateMappedBuffer(m_Allocator, InSize, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                               m_Buffers[0], m_Allocs[0], m_Mapped[0]) && m_Mapped[0] && InVertices)
+                               m_StaticBuffer, m_StaticAlloc, lMapped) && lMapped && InVertices)
         {
-            std::memcpy(m_Mapped[0], InVertices, InSize);
+            std::memcpy(lMapped, InVertices, InSize);
         }
+        if (m_StaticBuffer) { GpuMemoryTracker::Allocate(EGpuMemoryCategory::VertexBuffer, m_Capacity); }
+        m_BindBuffer = m_StaticBuffer;
     }
 
     VulkanVertexBuffer::~VulkanVertexBuffer()
     {
-        const Uint32 lCount = m_Static ? 1u : OPAAX_FRAMES_IN_FLIGHT;
-        for (Uint32 i = 0; i < lCount; ++i)
+        if (m_StaticBuffer)
         {
-            if (m_Buffers[i]) { vmaDestroyBuffer(m_Allocator, m_Buffers[i], m_Allocs[i]); }
+            vmaDestroyBuffer(m_Allocator, m_StaticBuffer, m_StaticAlloc);
+            GpuMemoryTracker::Free(EGpuMemoryCategory::VertexBuffer, m_Capacity);
         }
     }
 
@@ -75,31 +77,27 @@ namespace Opaax
     {
         if (m_Static) { return; }   // static buffers are write-once at construction
 
-        // New frame → reset the write cursor (the slot we are about to write completed its prior
-        // GPU use; its in-flight fence was waited in AcquireNextImage).
-        const Uint64 lGen = VulkanFrameContext::Generation();
-        if (lGen != m_FrameGen)
+        if (InSize > m_Capacity)
         {
-            m_FrameGen    = lGen;
-            m_WriteOffset = 0;
+            OPAAX_CORE_WARN("VulkanVertexBuffer: SetData of {} bytes exceeds the declared size {}.", InSize, m_Capacity);
         }
 
-        if (m_WriteOffset + InSize > m_Capacity)
-        {
-            OPAAX_CORE_ERROR("VulkanVertexBuffer: frame vertex data ({} + {}) exceeds capacity {} — "
-                             "wrapping (frame will render incorrectly). Raise MAX_QUADS or the ring.",
-                             static_cast<Uint64>(m_WriteOffset), InSize, m_Capacity);
-            m_WriteOffset = 0;
-        }
+        VulkanDevice*         lDevice     = VulkanFrameContext::Device();
+        VulkanFrameAllocator* lFrameAlloc = lDevice ? lDevice->GetFrameAllocator() : nullptr;
 
-        const Uint32 lSlot = VulkanFrameContext::FrameSlot();
-        if (m_Mapped[lSlot])
+        // Vertex offsets only need the attribute alignment; 16 keeps regions cache-line friendly.
+        VulkanFrameAllocation lRegion;
+        if (!lFrameAlloc || !lFrameAlloc->Allocate(InSize, 16, lRegion))
         {
-            std::memcpy(static_cast<Uint8*>(m_Mapped[lSlot]) + m_WriteOffset, InData, InSize);
+            OPAAX_CORE_ERROR("VulkanVertexBuffer: no frame memory for {} bytes — skipping the write "
+                             "(previous region stays bound).", InSize);
+            return;
         }
 
-        m_LastBindOffset = m_WriteOffset;
-        m_WriteOffset   += InSize;
+        if (lRegion.Mapped) { std::memcpy(lRegion.Mapped, InData, InSize); }
+
+        m_BindBuffer     = lRegion.Buffer;
+        m_LastBindOffset = lRegion.Offset;
     }
 
     // =============================================================================
@@ -117,11 +115,16 @@ namespace Opaax
         {
             std::memcpy(lMapped, InIndices, lSize);
         }
+        if (m_Buffer) { GpuMemoryTracker::Allocate(EGpuMemoryCategory::IndexBuffer, lSize); }
     }
 
     VulkanIndexBuffer::~VulkanIndexBuffer()
     {
-        if (m_Buffer) { vmaDestroyBuffer(m_Allocator, m_Buffer, m_Alloc); }
+        if (m_Buffer)
+        {
+            vmaDestroyBuffer(m_Allocator, m_Buffer, m_Alloc);
+            GpuMemoryTracker::Free(EGpuMemoryCategory::IndexBuffer, static_cast<Uint64>(m_Count) * sizeof(Uint32));
+        }
     }
 
 } // namespace Opaax
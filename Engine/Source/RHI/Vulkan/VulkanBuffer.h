@@ -4,8 +4,6 @@
 
 #if OPAAX_HAS_VULKAN
 
-#include "RHI/Vulkan/VulkanSwapchain.h"   // OPAAX_FRAMES_IN_FLIGHT
-
 #include <vulkan/vulkan.h>
 #include <vma/vk_mem_alloc.h>
 
@@ -17,14 +15,14 @@ namespace Opaax
     /**
      * @class VulkanVertexBuffer
      *
-     * Dynamic vertex buffer backed by one host-visible+mapped VMA allocation PER frame-in-flight
-     * (so a write never races a frame still reading the previous contents). Within a frame, a
-     * write OFFSET advances per SetData (per flush / per pass) — Renderer2D flushes the world then
-     * the overlay into the same logical buffer, and Vulkan executes both draws at submit, so each
-     * must occupy a distinct region. The offset resets when the frame generation changes.
+     * Dynamic vertex buffer with no storage of its own: every SetData sub-allocates a fresh region
+     * from the device's VulkanFrameAllocator (current frame-in-flight slot), so a write never races
+     * a frame still reading earlier contents. Renderer2D flushes the world then the overlay into the
+     * same logical buffer and Vulkan executes both draws at submit — each lands in its own region.
      *
-     * BindVertexArray (in VulkanCommandBuffer) reads GetBuffer(frameSlot) + GetLastBindOffset() to
-     * record vkCmdBindVertexBuffers at the region the matching SetData just wrote.
+     * BindVertexArray (in VulkanCommandBuffer) reads GetBindBuffer() + GetLastBindOffset() to record
+     * vkCmdBindVertexBuffers at the region the matching SetData just wrote. The static constructor
+     * keeps one dedicated buffer (written once, bound at offset 0).
      */
     class VulkanVertexBuffer final : public IVertexBuffer
     {
@@ -55,8 +53,8 @@ namespace Opaax
         // Get — consumed by VulkanCommandBuffer
         // =============================================================================
     public:
-        VkBuffer     GetBuffer(Uint32 InFrameSlot) const noexcept { return m_Buffers[InFrameSlot]; }
-        VkDeviceSize GetLastBindOffset()           const noexcept { return m_LastBindOffset; }
+        VkBuffer     GetBindBuffer()     const noexcept { return m_BindBuffer; }
+        VkDeviceSize GetLastBindOffset() const noexcept { return m_LastBindOffset; }
 
         // =============================================================================
         // Members
@@ -64,16 +62,14 @@ namespace Opaax
     private:
         BufferLayout m_Layout;
         VmaAllocator m_Allocator = nullptr;
-        Uint32       m_Capacity  = 0;
+        Uint32       m_Capacity  = 0;             // largest single SetData the batch VBO expects
         bool         m_Static    = false;
 
-        VkBuffer      m_Buffers[OPAAX_FRAMES_IN_FLIGHT] = {};
-        VmaAllocation m_Allocs [OPAAX_FRAMES_IN_FLIGHT] = {};
-        void*         m_Mapped [OPAAX_FRAMES_IN_FLIGHT] = {};
+        VkBuffer      m_StaticBuffer = VK_NULL_HANDLE;   // static path only
+        VmaAllocation m_StaticAlloc  = nullptr;
 
-        Uint64       m_FrameGen       = ~0ull;   // force a reset on the first SetData of a frame
-        VkDeviceSize m_WriteOffset    = 0;       // advancing cursor within the current frame
-        VkDeviceSize m_LastBindOffset = 0;       // offset the most recent SetData wrote at
+        VkBuffer     m_BindBuffer     = VK_NULL_HANDLE;  // frame-allocator page (or m_StaticBuffer)
+        VkDeviceSize m_LastBindOffset = 0;               // offset the most recent SetData wrote at
     };
 
     // =============================================================================
@@ -3,13 +3,18 @@
 #if OPAAX_HAS_VULKAN
 
 #include "VulkanSwapchain.h"
-#include "VulkanFrameContext.h"
 #include "VulkanFramebuffer.h"
 #include "VulkanPipeline.h"
 #include "VulkanBindGroup.h"
 #include "VulkanBuffer.h"
+#include "VulkanDevice.h"
+#include "VulkanFrameAllocator.h"
+#include "VulkanFrameContext.h"
 #include "RHI/Buffer.h"   // IVertexArray
 #include "Renderer/RenderTarget.hpp"
+#include "Core/Log/OpaaxLog.h"
+
+#include <cstring>
 
 namespace Opaax
 {
@@ -40,6 +45,71 @@ namespace Opaax
     {
         if (m_Cmd == VK_NULL_HANDLE) { return; }   // frame skipped — record nothing
 
+        if (m_bSecondary)
+        {
+            BeginSecondaryPass(InTarget, InLoadOp, InClearColor);
+            return;
+        }
+        BeginRendering(InTarget, InLoadOp, InClearColor, 0);
+    }
+
+    void VulkanCommandBuffer::BeginSecondaryPass(IRenderTarget& InTarget, ELoadOp InLoadOp,
+                                                 const Vector4F& InClearColor)
+    {
+        if (m_bPassOpen || m_bPassRecorded)
+        {
+            OPAAX_CORE_ERROR("VulkanCommandBuffer: a secondary recorder holds one pass per frame — pass dropped.");
+            return;
+        }
+
+        // Resolve the extent now (the viewport is recorded here, not inherited). Applying a pending
+        // editor resize is safe at this point too: no pass has recorded into the image yet.
+        VkExtent2D lExtent = m_Swapchain->GetExtent();
+        if (IFramebuffer* lFBBase = InTarget.GetFramebuffer())
+        {
+            auto& lFB = static_cast<VulkanFramebuffer&>(*lFBBase);
+            lFB.ApplyPendingResize();
+            lExtent = lFB.GetExtent();
+        }
+
+        // Offscreen targets are created in the swapchain format, so one inheritance fits both.
+        const VkFormat lFormat = VulkanFrameContext::ColorFormat();
+
+        VkCommandBufferInheritanceRenderingInfo lRendering{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO };
+        lRendering.colorAttachmentCount    = 1;
+        lRendering.pColorAttachmentFormats = &lFormat;
+        lRendering.rasterizationSamples    = VK_SAMPLE_COUNT_1_BIT;
+
+        VkCommandBufferInheritanceInfo lInheritance{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
+        lInheritance.pNext = &lRendering;
+
+        VkCommandBufferBeginInfo lBeginInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        lBeginInfo.flags            = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+                                    | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+        lBeginInfo.pInheritanceInfo = &lInheritance;
+        if (vkBeginCommandBuffer(m_Cmd, &lBeginInfo) != VK_SUCCESS)
+        {
+            OPAAX_CORE_ERROR("VulkanCommandBuffer: vkBeginCommandBuffer failed for a secondary recorder.");
+            return;
+        }
+
+        InvalidateState();
+        m_CurrentPipelineLayout = VK_NULL_HANDLE;
+        m_PassTarget     = &InTarget;
+        m_PassLoadOp     = InLoadOp;
+        m_PassClearColor = InClearColor;
+        m_bPassOpen      = true;
+
+        SetViewport(0, 0, lExtent.width, lExtent.height);
+    }
+
+    void VulkanCommandBuffer::BeginRendering(IRenderTarget& InTarget, ELoadOp InLoadOp,
+                                             const Vector4F& InClearColor, VkRenderingFlags InFlags)
+    {
+        InvalidateState();
+
+        const bool lInlineContents = (InFlags & VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT) == 0;
+
         // Offscreen target (editor ViewportPanel) — render into its image, then EndRenderPass hands
         // it to the sampler. Swapchain target (null framebuffer) falls through to the present path.
         if (IFramebuffer* lFBBase = InTarget.GetFramebuffer())
@@ -77,13 +147,14 @@ namespace Opaax
             lFbColor.clearValue.color = { { InClearColor.x, InClearColor.y, InClearColor.z, InClearColor.w } };
 
             VkRenderingInfo lFbInfo{ VK_STRUCTURE_TYPE_RENDERING_INFO };
+            lFbInfo.flags                = InFlags;
             lFbInfo.renderArea           = { { 0, 0 }, lFbExtent };
             lFbInfo.layerCount           = 1;
             lFbInfo.colorAttachmentCount = 1;
             lFbInfo.pColorAttachments    = &lFbColor;
 
             vkCmdBeginRendering(m_Cmd, &lFbInfo);
-            SetViewport(0, 0, lFbExtent.width, lFbExtent.height);
+            if (lInlineContents) { SetViewport(0, 0, lFbExtent.width, lFbExtent.height); }
             return;
         }
 
@@ -113,6 +184,7 @@ namespace Opaax
         lColor.clearValue.color = { { InClearColor.x, InClearColor.y, InClearColor.z, InClearColor.w } };
 
         VkRenderingInfo lInfo{ VK_STRUCTURE_TYPE_RENDERING_INFO };
+        lInfo.flags                = InFlags;
         lInfo.renderArea           = { { 0, 0 }, lExtent };
         lInfo.layerCount           = 1;
         lInfo.colorAttachmentCount = 1;
@@ -120,12 +192,23 @@ namespace Opaax
 
         vkCmdBeginRendering(m_Cmd, &lInfo);
 
-        SetViewport(0, 0, lExtent.width, lExtent.height);
+        if (lInlineContents) { SetViewport(0, 0, lExtent.width, lExtent.height); }
     }
 
     void VulkanCommandBuffer::EndRenderPass()
     {
         if (m_Cmd == VK_NULL_HANDLE) { return; }
+
+        if (m_bSecondary)
+        {
+            // The pass itself is opened / closed by the primary at ExecuteSecondary.
+            if (!m_bPassOpen) { return; }
+            vkEndCommandBuffer(m_Cmd);
+            m_bPassOpen     = false;
+            m_bPassRecorded = true;
+            return;
+        }
+
         vkCmdEndRendering(m_Cmd);
 
         if (m_CurrentFramebuffer)
@@ -167,38 +250,68 @@ namespace Opaax
     {
         if (m_Cmd == VK_NULL_HANDLE) { return; }
 
+        if (m_BoundPipeline == &InPipeline)
+        {
+            ++m_StateStats.Skipped;
+            return;
+        }
+
         // Backend invariant: the active backend's factory only produces VulkanPipeline here.
         auto& lPipeline = static_cast<VulkanPipeline&>(InPipeline);
         m_CurrentPipelineLayout = lPipeline.GetPipelineLayout();
         vkCmdBindPipeline(m_Cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, lPipeline.GetPipeline());
+
+        m_BoundPipeline  = &InPipeline;
+        m_BoundBindGroup = nullptr;   // a new layout may disturb set 0 — rebind it
+        ++m_StateStats.Issued;
     }
 
     void VulkanCommandBuffer::BindBindGroup(IBindGroup& InBindGroup)
     {
         if (m_Cmd == VK_NULL_HANDLE) { return; }
-        static_cast<VulkanBindGroup&>(InBindGroup).BindInto(m_Cmd, m_CurrentPipelineLayout);
+        static_cast<VulkanBindGroup&>(InBindGroup).BindInto(m_Cmd, m_CurrentPipelineLayout,
+                                                            m_BoundBindGroup == &InBindGroup, m_StateStats);
+        m_BoundBindGroup = &InBindGroup;
     }
 
     void VulkanCommandBuffer::BindVertexArray(IVertexArray& InVertexArray)
     {
         if (m_Cmd == VK_NULL_HANDLE) { return; }
 
-        const Uint32 lFrameSlot = VulkanFrameContext::FrameSlot();
-
-        // One interleaved vertex buffer (the batch VBO) at the offset its SetData just wrote.
+        // One interleaved vertex buffer (the batch VBO) at the frame-allocator region its SetData
+        // just wrote.
         const auto& lVertexBuffers = InVertexArray.GetVertexBuffers();
         if (!lVertexBuffers.empty())
         {
             auto* lVB = static_cast<VulkanVertexBuffer*>(lVertexBuffers[0].get());
-            VkBuffer     lBuffer = lVB->GetBuffer(lFrameSlot);
+            VkBuffer     lBuffer = lVB->GetBindBuffer();
             VkDeviceSize lOffset = lVB->GetLastBindOffset();
-            vkCmdBindVertexBuffers(m_Cmd, 0, 1, &lBuffer, &lOffset);
+            if (lBuffer == m_BoundVertexBuffer && lOffset == m_BoundVertexOffset)
+            {
+                ++m_StateStats.Skipped;
+            }
+            else if (lBuffer != VK_NULL_HANDLE)
+            {
+                vkCmdBindVertexBuffers(m_Cmd, 0, 1, &lBuffer, &lOffset);
+                m_BoundVertexBuffer = lBuffer;
+                m_BoundVertexOffset = lOffset;
+                ++m_StateStats.Issued;
+            }
         }
 
         if (const IIndexBuffer* lIBO = InVertexArray.GetIndexBuffer())
         {
-            auto* lIB = static_cast<const VulkanIndexBuffer*>(lIBO);
-            vkCmdBindIndexBuffer(m_Cmd, lIB->GetBuffer(), 0, VK_INDEX_TYPE_UINT32);
+            const VkBuffer lIndexBuffer = static_cast<const VulkanIndexBuffer*>(lIBO)->GetBuffer();
+            if (lIndexBuffer == m_BoundIndexBuffer)
+            {
+                ++m_StateStats.Skipped;
+            }
+            else
+            {
+                vkCmdBindIndexBuffer(m_Cmd, lIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+                m_BoundIndexBuffer = lIndexBuffer;
+                ++m_StateStats.Issued;
+            }
         }
     }
 
@@ -208,6 +321,60 @@ namespace Opaax
         vkCmdDrawIndexed(m_Cmd, InIndexCount, 1, 0, 0, 0);
     }
 
+    void VulkanCommandBuffer::DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount)
+    {
+        if (m_Cmd == VK_NULL_HANDLE || InCount == 0) { return; }
+
+        // The commands live in this frame's linear allocator, like the vertices they draw.
+        constexpr VkDeviceSize lStride = sizeof(VkDrawIndexedIndirectCommand);
+        static_assert(lStride == sizeof(DrawIndexedIndirectCommand), "indirect layouts diverged");
+
+        VulkanFrameAllocator* lFrameAlloc = m_Device ? m_Device->GetFrameAllocator() : nullptr;
+        VulkanFrameAllocation lRegion;
+        if (!lFrameAlloc || !lFrameAlloc->Allocate(lStride * InCount, 4, lRegion) || !lRegion.Mapped)
+        {
+            OPAAX_CORE_ERROR("VulkanCommandBuffer: no frame memory for {} indirect draws — skipping.", InCount);
+            return;
+        }
+        std::memcpy(lRegion.Mapped, InCommands, static_cast<size_t>(lStride * InCount));
+
+        if (m_Device->SupportsMultiDrawIndirect())
+        {
+            vkCmdDrawIndexedIndirect(m_Cmd, lRegion.Buffer, lRegion.Offset, InCount, static_cast<Uint32>(lStride));
+            return;
+        }
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            vkCmdDrawIndexedIndirect(m_Cmd, lRegion.Buffer, lRegion.Offset + lStride * i, 1, static_cast<Uint32>(lStride));
+        }
+    }
+
+    void VulkanCommandBuffer::ExecuteSecondary(ICommandBuffer& InSecondary)
+    {
+        if (m_Cmd == VK_NULL_HANDLE) { return; }
+
+        // Backend invariant: the Vulkan API only hands out VulkanCommandBuffer secondaries.
+        auto& lSecondary = static_cast<VulkanCommandBuffer&>(InSecondary);
+        if (m_bSecondary || !lSecondary.m_bSecondary)
+        {
+            OPAAX_CORE_ERROR("VulkanCommandBuffer: ExecuteSecondary needs a primary recorder and a secondary argument.");
+            return;
+        }
+        if (!lSecondary.m_bPassRecorded || lSecondary.m_Cmd == VK_NULL_HANDLE) { return; }   // nothing recorded
+
+        BeginRendering(*lSecondary.m_PassTarget, lSecondary.m_PassLoadOp, lSecondary.m_PassClearColor,
+                       VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT);
+
+        const VkCommandBuffer lSecondaryCmd = lSecondary.m_Cmd;
+        vkCmdExecuteCommands(m_Cmd, 1, &lSecondaryCmd);
+
+        EndRenderPass();
+
+        // Bound state after vkCmdExecuteCommands is undefined — the next pass starts from scratch.
+        m_CurrentPipelineLayout = VK_NULL_HANDLE;
+        lSecondary.m_bPassRecorded = false;
+    }
+
     void VulkanCommandBuffer::FinishFrame()
     {
         if (m_Cmd == VK_NULL_HANDLE) { return; }
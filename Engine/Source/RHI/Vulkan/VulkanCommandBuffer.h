@@ -27,6 +27,17 @@ namespace Opaax
      * BindPipeline / BindBindGroup / BindVertexArray / DrawIndexed record into the live
      * VkCommandBuffer (Phase 3). BindPipeline caches the bound pipeline's layout so the bind group
      * has it for vkCmdBindDescriptorSets.
+     *
+     * Binds are filtered against a shadow of the pipeline, vertex/index buffers and bind group last
+     * recorded in the current pass; the shadow is dropped at each BeginRenderPass and frame.
+     *
+     * A secondary instance (Setup with InSecondary) wraps a VK_COMMAND_BUFFER_LEVEL_SECONDARY buffer
+     * from its own command pool, so a job worker can record into it. Its BeginRenderPass only
+     * captures the target / load op / clear color and begins the buffer with dynamic-rendering
+     * inheritance (swapchain color format); its EndRenderPass ends the buffer. The primary's
+     * ExecuteSecondary then opens the captured pass with SECONDARY_COMMAND_BUFFERS contents, does
+     * the layout transitions, runs vkCmdExecuteCommands and closes the pass — one pass per secondary
+     * per frame.
      */
     class VulkanCommandBuffer final : public ICommandBuffer
     {
@@ -34,10 +45,11 @@ namespace Opaax
         // Setup (called by VulkanRenderAPI)
         // =============================================================================
     public:
-        void Setup(VulkanDevice* InDevice, VulkanSwapchain* InSwapchain) noexcept
+        void Setup(VulkanDevice* InDevice, VulkanSwapchain* InSwapchain, bool InSecondary = false) noexcept
         {
-            m_Device    = InDevice;
-            m_Swapchain = InSwapchain;
+            m_Device     = InDevice;
+            m_Swapchain  = InSwapchain;
+            m_bSecondary = InSecondary;
         }
 
         // Retarget to this frame's command buffer (resets per-frame layout tracking).
@@ -46,6 +58,11 @@ namespace Opaax
             m_Cmd                   = InCmd;
             m_ColorAcquired         = false;
             m_CurrentPipelineLayout = VK_NULL_HANDLE;
+            m_StateStats            = {};
+            m_bPassOpen             = false;
+            m_bPassRecorded         = false;
+            m_PassTarget            = nullptr;
+            InvalidateState();
         }
 
         // Transition the image to PRESENT_SRC if any pass ran. Called before vkEndCommandBuffer.
@@ -70,8 +87,34 @@ namespace Opaax
         void BindBindGroup(IBindGroup& InBindGroup)       override;
         void BindVertexArray(IVertexArray& InVertexArray) override;
         void DrawIndexed(Uint32 InIndexCount)             override;
+
+        bool SupportsDrawIndirect() const override { return true; }
+        void DrawIndexedIndirect(const DrawIndexedIndirectCommand* InCommands, Uint32 InCount) override;
+
+        void ExecuteSecondary(ICommandBuffer& InSecondary) override;
+
+        CommandStateStats GetStateStats() const override { return m_StateStats; }
         //~End ICommandBuffer interface
 
+    private:
+        // Open dynamic rendering on InTarget (layout transition + vkCmdBeginRendering). With
+        // VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT only vkCmdExecuteCommands may follow,
+        // so the viewport is left to the secondary.
+        void BeginRendering(IRenderTarget& InTarget, ELoadOp InLoadOp, const Vector4F& InClearColor,
+                            VkRenderingFlags InFlags);
+
+        // Secondary: capture the pass bracket and begin the buffer with rendering inheritance.
+        void BeginSecondaryPass(IRenderTarget& InTarget, ELoadOp InLoadOp, const Vector4F& InClearColor);
+
+        void InvalidateState() noexcept
+        {
+            m_BoundPipeline     = nullptr;
+            m_BoundBindGroup    = nullptr;
+            m_BoundVertexBuffer = VK_NULL_HANDLE;
+            m_BoundVertexOffset = 0;
+            m_BoundIndexBuffer  = VK_NULL_HANDLE;
+        }
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -86,6 +129,23 @@ namespace Opaax
         VulkanFramebuffer* m_CurrentFramebuffer = nullptr;
 
         VkPipelineLayout m_CurrentPipelineLayout = VK_NULL_HANDLE;   // last bound, for descriptor binding
+
+        // Shadow of what the current pass has bound (null = unknown, always rebinds).
+        const IPipeline*  m_BoundPipeline     = nullptr;
+        const IBindGroup* m_BoundBindGroup    = nullptr;   // its set is still bound at set 0
+        VkBuffer          m_BoundVertexBuffer = VK_NULL_HANDLE;
+        VkDeviceSize      m_BoundVertexOffset = 0;
+        VkBuffer          m_BoundIndexBuffer  = VK_NULL_HANDLE;
+
+        CommandStateStats m_StateStats;
+
+        // Secondary recording — the captured pass bracket ExecuteSecondary replays.
+        bool           m_bSecondary     = false;
+        bool           m_bPassOpen      = false;   // between BeginRenderPass and EndRenderPass
+        bool           m_bPassRecorded  = false;   // a complete pass is waiting for ExecuteSecondary
+        IRenderTarget* m_PassTarget     = nullptr;
+        ELoadOp        m_PassLoadOp     = ELoadOp::Load;
+        Vector4F       m_PassClearColor = Vector4F(0.f);
     };
 
 } // namespace Opaax
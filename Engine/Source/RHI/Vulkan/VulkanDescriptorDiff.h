@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    // =============================================================================
+    // Descriptor write diffing (pure)
+    //
+    // Ring descriptor sets are reused frame after frame, and a frame's batch sequence usually
+    // repeats (same atlases in the same order). VulkanBindGroup keeps a shadow copy of what each
+    // set last received and rewrites only the array elements that changed — typically none. Kept
+    // vulkan.h-free (templated on the element key) so it is unit-testable in the pure test target.
+    // =============================================================================
+
+    /** A contiguous run of changed array elements -> one VkWriteDescriptorSet. */
+    struct DescriptorRun
+    {
+        Uint32 First = 0;
+        Uint32 Count = 0;
+    };
+
+    /**
+     * Compare InDesired against InOutShadow element by element, append one run per contiguous
+     * block of differences to OutRuns (clear it first), and bring the shadow up to date.
+     * @return number of elements that changed.
+     */
+    template<typename T>
+    Uint32 CollectDirtyRuns(const T* InDesired, T* InOutShadow, Uint32 InCount, TDynArray<DescriptorRun>& OutRuns)
+    {
+        Uint32 lChanged = 0;
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            if (InOutShadow[i] == InDesired[i])
+            {
+                continue;
+            }
+
+            InOutShadow[i] = InDesired[i];
+            ++lChanged;
+            if (!OutRuns.empty() && OutRuns.back().First + OutRuns.back().Count == i)
+            {
+                ++OutRuns.back().Count;
+            }
+            else
+            {
+                OutRuns.push_back({ i, 1u });
+            }
+        }
+        return lChanged;
+    }
+
+} // namespace Opaax
@@ -16,9 +16,10 @@ namespace Opaax
         lBindings[0].descriptorCount = OPAAX_VULKAN_SPRITE_SAMPLER_COUNT;
         lBindings[0].stageFlags      = VK_SHADER_STAGE_FRAGMENT_BIT;
 
-        // binding 1 : the camera UBO (vertex).
+        // binding 1 : the camera UBO (vertex). Dynamic — the block's frame-allocator offset rides
+        // vkCmdBindDescriptorSets, so a new camera block never needs a descriptor write.
         lBindings[1].binding         = 1;
-        lBindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        lBindings[1].descriptorType  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         lBindings[1].descriptorCount = 1;
         lBindings[1].stageFlags      = VK_SHADER_STAGE_VERTEX_BIT;
 
@@ -10,7 +10,7 @@ namespace Opaax
 {
     // The engine has exactly one sprite pipeline, so its descriptor-set shape is fixed and shared:
     //   binding 0 : sampler2D[N] (fragment)   — matches Sprite.glsl + MAX_TEXTURE_SLOTS
-    //   binding 1 : camera UBO    (vertex)     — matches the binding=1 move in Sprite.glsl
+    //   binding 1 : camera UBO    (vertex)     — matches the binding=1 move in Sprite.glsl; dynamic offset
     inline constexpr Uint32 OPAAX_VULKAN_SPRITE_SAMPLER_COUNT = 16;
 
     // Build THE canonical sprite descriptor-set layout. VulkanPipeline (for its pipeline layout)
@@ -5,11 +5,18 @@
 // NOTE: VMA_IMPLEMENTATION lives in its own TU (VulkanVMA.cpp) — defining it here would be
 //   swallowed by vk_mem_alloc.h's include guard (VulkanDevice.h already pulled the header).
 
+#include "VulkanPipelineCacheBlob.h"
+#include "VulkanUploadManager.h"
+#include "VulkanFrameAllocator.h"
+#include "Core/Config/EngineConfig.h"
 #include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxFile.h"
 
 #include <VkBootstrap.h>
 #include <GLFW/glfw3.h>
 
+#include <cstring>
+
 namespace Opaax
 {
     namespace
@@ -89,6 +96,12 @@ namespace Opaax
         vkb::PhysicalDevice lVkbPhys = lPhysRet.value();
         m_PhysicalDevice = lVkbPhys.physical_device;
 
+        // Optional: several indirect draws per vkCmdDrawIndexedIndirect. Without it the command
+        // buffer issues one indirect draw per command (still no rebinding between them).
+        VkPhysicalDeviceFeatures lOptional{};
+        lOptional.multiDrawIndirect = VK_TRUE;
+        m_MultiDrawIndirect = lVkbPhys.enable_features_if_present(lOptional);
+
         // ---- Logical device + queues ----------------------------------------
         vkb::DeviceBuilder lDeviceBuilder{ lVkbPhys };
         auto lDevRet = lDeviceBuilder.build();
@@ -123,10 +136,17 @@ namespace Opaax
             OPAAX_CORE_ERROR("VulkanDevice: VMA allocator creation failed.");
             m_Allocator = nullptr;
         }
+        else
+        {
+            m_Uploads        = MakeUnique<VulkanUploadManager>(*this);
+            m_FrameAllocator = MakeUnique<VulkanFrameAllocator>(*this);
+        }
 
         VkPhysicalDeviceProperties lProps{};
         vkGetPhysicalDeviceProperties(m_PhysicalDevice, &lProps);
 
+        CreatePipelineCache(lProps);
+
         OPAAX_CORE_INFO("====================  Render Backend  ====================");
         OPAAX_CORE_INFO("  API .............. Vulkan {}.{}.{}",
                         VK_API_VERSION_MAJOR(lProps.apiVersion),
@@ -138,6 +158,8 @@ namespace Opaax
         OPAAX_CORE_INFO("  Queues ........... graphics family {} ({})", m_GraphicsQueueFamily,
                         (m_PresentQueue == m_GraphicsQueue) ? "present shared" : "present separate");
         OPAAX_CORE_INFO("  VMA .............. {}", m_Allocator ? "ready" : "FAILED");
+        OPAAX_CORE_INFO("  Pipeline cache ... {}", !m_PipelineCache   ? "FAILED"
+                                                  : m_PipelineCacheWarm ? "warm (loaded from disk)" : "cold");
         OPAAX_CORE_INFO("==========================================================");
     }
 
@@ -181,8 +203,106 @@ namespace Opaax
         vkDestroyCommandPool(m_Device, lPool, nullptr);
     }
 
+    void VulkanDevice::CreatePipelineCache(const VkPhysicalDeviceProperties& InProps)
+    {
+        m_VendorID      = InProps.vendorID;
+        m_DeviceID      = InProps.deviceID;
+        m_DriverVersion = InProps.driverVersion;
+        std::memcpy(m_PipelineCacheUUID, InProps.pipelineCacheUUID, VK_UUID_SIZE);
+
+        const OpaaxString lDir = EngineConfig::CacheDirectory("Vulkan");
+        if (!lDir.IsEmpty())
+        {
+            m_PipelineCachePath = lDir;
+            m_PipelineCachePath += "/PipelineCache.bin";
+        }
+
+        VulkanPipelineCacheIdentity lIdentity;
+        lIdentity.VendorID      = m_VendorID;
+        lIdentity.DeviceID      = m_DeviceID;
+        lIdentity.DriverVersion = m_DriverVersion;
+        std::memcpy(lIdentity.CacheUUID, m_PipelineCacheUUID, VK_UUID_SIZE);
+
+        // A blob from another GPU/driver is simply ignored — the cache starts cold and is
+        // overwritten at shutdown.
+        TDynArray<Uint8> lBytes;
+        const Uint8*     lData = nullptr;
+        size_t           lSize = 0;
+        if (!m_PipelineCachePath.IsEmpty() && OpaaxFile::ReadBinary(m_PipelineCachePath.CStr(), lBytes)
+            && !VulkanPipelineCacheBlob::Unwrap(lBytes.data(), lBytes.size(), lIdentity, lData, lSize))
+        {
+            OPAAX_CORE_WARN("VulkanDevice: ignoring pipeline cache '{}' (other device/driver or corrupt).",
+                            m_PipelineCachePath.CStr());
+            lData = nullptr;
+            lSize = 0;
+        }
+
+        VkPipelineCacheCreateInfo lInfo{ VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+        lInfo.initialDataSize = lSize;
+        lInfo.pInitialData    = lData;
+        if (vkCreatePipelineCache(m_Device, &lInfo, nullptr, &m_PipelineCache) != VK_SUCCESS && lData)
+        {
+            // Driver refused the data despite the header match — retry empty.
+            lInfo.initialDataSize = 0;
+            lInfo.pInitialData    = nullptr;
+            lData                 = nullptr;
+            vkCreatePipelineCache(m_Device, &lInfo, nullptr, &m_PipelineCache);
+        }
+        m_PipelineCacheWarm = (m_PipelineCache != VK_NULL_HANDLE) && (lData != nullptr);
+    }
+
+    void VulkanDevice::SavePipelineCache()
+    {
+        if (m_PipelineCreateCount > 0)
+        {
+            OPAAX_CORE_INFO("VulkanDevice: {} pipeline(s) created in {:.2f} ms total (cache {}).",
+                            m_PipelineCreateCount, m_PipelineCreateMicros / 1000.0,
+                            m_PipelineCacheWarm ? "warm" : "cold");
+        }
+        if (!m_PipelineCache || m_PipelineCachePath.IsEmpty())
+        {
+            return;
+        }
+
+        size_t lSize = 0;
+        if (vkGetPipelineCacheData(m_Device, m_PipelineCache, &lSize, nullptr) != VK_SUCCESS || lSize == 0)
+        {
+            return;
+        }
+        TDynArray<Uint8> lData(lSize);
+        if (vkGetPipelineCacheData(m_Device, m_PipelineCache, &lSize, lData.data()) != VK_SUCCESS)
+        {
+            return;
+        }
+
+        VulkanPipelineCacheIdentity lIdentity;
+        lIdentity.VendorID      = m_VendorID;
+        lIdentity.DeviceID      = m_DeviceID;
+        lIdentity.DriverVersion = m_DriverVersion;
+        std::memcpy(lIdentity.CacheUUID, m_PipelineCacheUUID, VK_UUID_SIZE);
+
+        TDynArray<Uint8> lBlob;
+        VulkanPipelineCacheBlob::Wrap(lIdentity, lData.data(), lSize, lBlob);
+        if (OpaaxFile::WriteBinaryAtomic(m_PipelineCachePath.CStr(), lBlob.data(), lBlob.size()))
+        {
+            OPAAX_CORE_INFO("VulkanDevice: saved pipeline cache ({} bytes) to '{}'.", lSize, m_PipelineCachePath.CStr());
+        }
+    }
+
     VulkanDevice::~VulkanDevice()
     {
+        // Drains in-flight upload batches and frees the staging ring / frame pages — needs the allocator.
+        m_Uploads.reset();
+        m_FrameAllocator.reset();
+
+        // Persist before the device goes — every pipeline has been destroyed by now, but their
+        // compiled state stays in the cache object.
+        if (m_PipelineCache)
+        {
+            SavePipelineCache();
+            vkDestroyPipelineCache(m_Device, m_PipelineCache, nullptr);
+        }
+
         // Reverse order of creation.
         if (m_Allocator)      { vmaDestroyAllocator(m_Allocator); }
         if (m_Device)         { vkDestroyDevice(m_Device, nullptr); }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/OpaaxString.hpp"
 #include "Core/OpaaxTypes.h"
 
 #if OPAAX_HAS_VULKAN
@@ -11,6 +12,9 @@ struct GLFWwindow;
 
 namespace Opaax
 {
+    class VulkanUploadManager;
+    class VulkanFrameAllocator;
+
     // =============================================================================
     // VulkanDevice
     // =============================================================================
@@ -49,15 +53,43 @@ namespace Opaax
         Uint32           GetGraphicsQueueFamily() const noexcept { return m_GraphicsQueueFamily; }
         VmaAllocator     GetAllocator()          const noexcept { return m_Allocator; }
 
+        // Device-wide pipeline cache shared by every pipeline (engine + editor ImGui). Seeded from
+        // <cache>/Vulkan/PipelineCache.bin when that file matches this GPU + driver; written back
+        // at device teardown. VK_NULL_HANDLE only if creation failed (pipelines still build).
+        VkPipelineCache  GetPipelineCache()      const noexcept { return m_PipelineCache; }
+        bool             IsPipelineCacheWarm()   const noexcept { return m_PipelineCacheWarm; }
+
+        // multiDrawIndirect was present and enabled (drawCount > 1 in vkCmdDrawIndexedIndirect).
+        bool             SupportsMultiDrawIndirect() const noexcept { return m_MultiDrawIndirect; }
+
+        // Batched, fence-retired texture uploads (see VulkanUploadManager). Null only if the device
+        // failed to build.
+        VulkanUploadManager* GetUploads()        const noexcept { return m_Uploads.get(); }
+
+        // Per-frame linear allocator for dynamic vertex / UBO data (see VulkanFrameAllocator).
+        // Null only if the device failed to build.
+        VulkanFrameAllocator* GetFrameAllocator() const noexcept { return m_FrameAllocator.get(); }
+
         // =============================================================================
         // Functions
         // =============================================================================
     public:
         // Record + submit a one-shot transient command buffer on the graphics queue and wait
-        // idle. Used for outside-the-frame-loop GPU work (texture staging copies). Synchronous —
-        // not for per-frame draw work.
+        // idle. Synchronous full-queue stall — texture data goes through GetUploads() instead;
+        // keep this for rare setup work that must complete before returning.
         void ImmediateSubmit(const TFunction<void(VkCommandBuffer)>& InRecord) const;
 
+        // Accumulate vkCreateGraphicsPipelines wall time (summarised when the cache is saved).
+        void RecordPipelineCreate(double InMicros) noexcept
+        {
+            ++m_PipelineCreateCount;
+            m_PipelineCreateMicros += InMicros;
+        }
+
+    private:
+        void CreatePipelineCache(const VkPhysicalDeviceProperties& InProps);
+        void SavePipelineCache();
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -71,6 +103,20 @@ namespace Opaax
         VkQueue                  m_PresentQueue        = VK_NULL_HANDLE;
         Uint32                   m_GraphicsQueueFamily = 0;
         VmaAllocator             m_Allocator           = nullptr;
+        bool                     m_MultiDrawIndirect   = false;
+
+        VkPipelineCache          m_PipelineCache       = VK_NULL_HANDLE;
+        bool                     m_PipelineCacheWarm   = false;
+        OpaaxString              m_PipelineCachePath;                  // empty = not persisted
+        Uint32                   m_VendorID            = 0;
+        Uint32                   m_DeviceID            = 0;
+        Uint32                   m_DriverVersion       = 0;
+        Uint8                    m_PipelineCacheUUID[VK_UUID_SIZE] = {};
+        Uint32                   m_PipelineCreateCount  = 0;
+        double                   m_PipelineCreateMicros = 0.0;
+
+        UniquePtr<VulkanUploadManager>  m_Uploads;
+        UniquePtr<VulkanFrameAllocator> m_FrameAllocator;
     };
 
 } // namespace Opaax
@@ -0,0 +1,120 @@
+#include "VulkanFrameAllocator.h"
+
+#if OPAAX_HAS_VULKAN
+
+#include "VulkanDevice.h"
+#include "VulkanFrameContext.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
+
+namespace Opaax
+{
+    VulkanFrameAllocator::VulkanFrameAllocator(VulkanDevice& InDevice)
+        : m_Device(InDevice)
+    {
+        VkPhysicalDeviceProperties lProps{};
+        vkGetPhysicalDeviceProperties(m_Device.GetPhysicalDevice(), &lProps);
+        if (lProps.limits.minUniformBufferOffsetAlignment > 0)
+        {
+            m_UniformAlignment = lProps.limits.minUniformBufferOffsetAlignment;
+        }
+
+        // Page size is config-tunable (render.vulkanFrameArenaKB). One page per slot up front —
+        // enough for every normal frame; Allocate chains more only when a frame outgrows it.
+        const VkDeviceSize lPageSize = static_cast<VkDeviceSize>(EngineConfig::VulkanFrameArenaKB() > 0
+                                                                     ? EngineConfig::VulkanFrameArenaKB() : 1u) * 1024ull;
+        for (Uint32 lSlot = 0; lSlot < OPAAX_FRAMES_IN_FLIGHT; ++lSlot)
+        {
+            m_Arenas[lSlot] = VulkanFrameArena(lPageSize);
+            AddPage(lSlot, lPageSize);
+        }
+    }
+
+    VulkanFrameAllocator::~VulkanFrameAllocator()
+    {
+        // The device waits idle before teardown, so no page is still read by the GPU.
+        for (Uint32 lSlot = 0; lSlot < OPAAX_FRAMES_IN_FLIGHT; ++lSlot)
+        {
+            for (Page& lPage : m_Pages[lSlot]) { vmaDestroyBuffer(m_Device.GetAllocator(), lPage.Buffer, lPage.Alloc); }
+            GpuMemoryTracker::Free(EGpuMemoryCategory::Transient, m_Arenas[lSlot].GetCapacity());
+        }
+
+        if (m_PeakUsed > 0)
+        {
+            OPAAX_CORE_INFO("VulkanFrameAllocator: peak {:.2f} KiB of dynamic data in one frame ({} page(s) per slot).",
+                            static_cast<double>(m_PeakUsed) / 1024.0, m_Arenas[0].GetPageCount());
+        }
+    }
+
+    bool VulkanFrameAllocator::AddPage(Uint32 InSlot, VkDeviceSize InSize)
+    {
+        VkBufferCreateInfo lInfo{ VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+        lInfo.size  = InSize;
+        lInfo.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT
+                    | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
+        VmaAllocationCreateInfo lAllocCI{};
+        lAllocCI.usage = VMA_MEMORY_USAGE_AUTO;
+        lAllocCI.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT
+                       | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        Page              lPage;
+        VmaAllocationInfo lOut{};
+        if (vmaCreateBuffer(m_Device.GetAllocator(), &lInfo, &lAllocCI, &lPage.Buffer, &lPage.Alloc, &lOut) != VK_SUCCESS)
+        {
+            OPAAX_CORE_ERROR("VulkanFrameAllocator: vmaCreateBuffer failed ({} bytes).", static_cast<Uint64>(InSize));
+            return false;
+        }
+        lPage.Mapped = static_cast<Uint8*>(lOut.pMappedData);
+
+        m_Pages[InSlot].push_back(lPage);
+        m_Arenas[InSlot].AddPage(InSize);
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Transient, InSize);
+
+        if (m_Pages[InSlot].size() > 1)
+        {
+            OPAAX_CORE_INFO("VulkanFrameAllocator: frame slot {} grew to {} page(s), {} KiB "
+                            "(raise render.vulkanFrameArenaKB to pre-size).",
+                            InSlot, m_Pages[InSlot].size(), m_Arenas[InSlot].GetCapacity() / 1024ull);
+        }
+        return true;
+    }
+
+    bool VulkanFrameAllocator::Allocate(VkDeviceSize InSize, VkDeviceSize InAlign, VulkanFrameAllocation& OutAllocation)
+    {
+        std::scoped_lock lLock(m_Mutex);
+
+        // New frame → rewind this slot (its in-flight fence was waited in AcquireNextImage).
+        const Uint64 lGen = VulkanFrameContext::Generation();
+        if (lGen != m_FrameGen)
+        {
+            m_FrameGen = lGen;
+            m_Slot     = VulkanFrameContext::FrameSlot();
+            m_Arenas[m_Slot].Reset();
+        }
+
+        VulkanFrameArena& lArena = m_Arenas[m_Slot];
+
+        Uint32 lPage   = 0;
+        Uint64 lOffset = 0;
+        if (!lArena.Allocate(InSize, InAlign, lPage, lOffset))
+        {
+            if (!AddPage(m_Slot, lArena.RequiredPageSize(InSize)) || !lArena.Allocate(InSize, InAlign, lPage, lOffset))
+            {
+                return false;
+            }
+        }
+
+        const Page& lTarget = m_Pages[m_Slot][lPage];
+        OutAllocation.Buffer = lTarget.Buffer;
+        OutAllocation.Offset = lOffset;
+        OutAllocation.Mapped = lTarget.Mapped ? lTarget.Mapped + lOffset : nullptr;
+
+        if (lArena.GetUsed() > m_PeakUsed) { m_PeakUsed = lArena.GetUsed(); }
+        return true;
+    }
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_VULKAN
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Core/OpaaxTypes.h"
+
+#if OPAAX_HAS_VULKAN
+
+#include "VulkanFrameArena.h"
+#include "RHI/Vulkan/VulkanSwapchain.h"   // OPAAX_FRAMES_IN_FLIGHT
+
+#include <vulkan/vulkan.h>
+#include <vma/vk_mem_alloc.h>
+
+#include <mutex>
+
+namespace Opaax
+{
+    class VulkanDevice;
+
+    // One sub-allocation: bind Buffer at Offset; write through Mapped (already offset).
+    struct VulkanFrameAllocation
+    {
+        VkBuffer     Buffer = VK_NULL_HANDLE;
+        VkDeviceSize Offset = 0;
+        Uint8*       Mapped = nullptr;
+    };
+
+    // =============================================================================
+    // VulkanFrameAllocator
+    // =============================================================================
+    /**
+     * @class VulkanFrameAllocator
+     *
+     * The one home for per-frame dynamic GPU data — batch vertices, camera UBO blocks, indirect
+     * draw commands, future instance data. Each frame-in-flight slot owns a chain of large
+     * host-visible, persistently mapped buffers (usage VERTEX | INDEX | UNIFORM | INDIRECT);
+     * Allocate bumps a cursor through them with the requested alignment, and callers bind the
+     * returned buffer at the returned offset (vertex offset, indirect offset, or the dynamic
+     * offset of a UNIFORM_BUFFER_DYNAMIC descriptor).
+     *
+     * The slot's cursor rewinds when VulkanFrameContext's generation changes — by then that slot's
+     * in-flight fence has been waited, so nothing the GPU still reads is overwritten. A frame that
+     * outgrows its pages chains another (render.vulkanFrameArenaKB each) instead of wrapping.
+     *
+     * Allocate is locked — with parallel pass recording, secondary recorders on job workers carve
+     * their vertex / UBO / indirect data out of the same slot. Owned by VulkanDevice.
+     */
+    class VulkanFrameAllocator
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit VulkanFrameAllocator(VulkanDevice& InDevice);
+        ~VulkanFrameAllocator();
+
+        VulkanFrameAllocator(const VulkanFrameAllocator&)            = delete;
+        VulkanFrameAllocator& operator=(const VulkanFrameAllocator&) = delete;
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        // Carve InSize bytes aligned to InAlign (power of two) out of the current frame slot.
+        // False only if a new page could not be created (logged).
+        bool Allocate(VkDeviceSize InSize, VkDeviceSize InAlign, VulkanFrameAllocation& OutAllocation);
+
+        // minUniformBufferOffsetAlignment — the alignment for blocks bound as dynamic UBOs.
+        VkDeviceSize GetUniformAlignment() const noexcept { return m_UniformAlignment; }
+
+        // Bytes handed out this frame (incl. alignment pad) / reserved, for the current slot.
+        Uint64 GetFrameUsed()     const { std::scoped_lock lLock(m_Mutex); return m_Arenas[m_Slot].GetUsed(); }
+        Uint64 GetFrameCapacity() const { std::scoped_lock lLock(m_Mutex); return m_Arenas[m_Slot].GetCapacity(); }
+
+    private:
+        struct Page
+        {
+            VkBuffer      Buffer = VK_NULL_HANDLE;
+            VmaAllocation Alloc  = nullptr;
+            Uint8*        Mapped = nullptr;
+        };
+
+        bool AddPage(Uint32 InSlot, VkDeviceSize InSize);
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        VulkanDevice&     m_Device;
+        VkDeviceSize      m_UniformAlignment = 1;
+        mutable std::mutex m_Mutex;                           // Allocate + the usage getters
+
+        VulkanFrameArena  m_Arenas[OPAAX_FRAMES_IN_FLIGHT];
+        TDynArray<Page>   m_Pages [OPAAX_FRAMES_IN_FLIGHT];   // parallel to each arena's page chain
+
+        Uint64            m_FrameGen = ~0ull;
+        Uint32            m_Slot     = 0;
+        Uint64            m_PeakUsed = 0;                     // across the run, logged at teardown
+    };
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_VULKAN
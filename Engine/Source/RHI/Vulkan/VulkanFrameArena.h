@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    // =============================================================================
+    // VulkanFrameArena (pure)
+    // =============================================================================
+    /**
+     * @class VulkanFrameArena
+     *
+     * Offset bookkeeping for one frame slot of the per-frame linear allocator — no Vulkan handles,
+     * so it is unit-testable in the pure test target. VulkanFrameAllocator owns the VkBuffers (one
+     * per page) and drives this.
+     *
+     * Allocations bump a cursor through a chain of pages. When the current page cannot hold a
+     * request the cursor moves to the next page large enough; when none is, Allocate fails and the
+     * caller appends a page (AddPage) and retries. Reset() rewinds to page 0 at frame start —
+     * pages are kept, so a steady frame allocates nothing after warm-up.
+     */
+    class VulkanFrameArena
+    {
+    public:
+        explicit VulkanFrameArena(Uint64 InPageSize = 0) noexcept : m_PageSize(InPageSize) {}
+
+        Uint64 GetPageSize()  const noexcept { return m_PageSize; }
+        Uint32 GetPageCount() const noexcept { return static_cast<Uint32>(m_Pages.size()); }
+        Uint64 GetCapacity()  const noexcept { return m_Capacity; }
+        Uint64 GetUsed()      const noexcept { return m_Used; }       // this frame, incl. alignment pad
+
+        // Size to pass to AddPage when Allocate(InSize) failed: the default page, or larger for an
+        // oversized request.
+        Uint64 RequiredPageSize(Uint64 InSize) const noexcept { return InSize > m_PageSize ? InSize : m_PageSize; }
+
+        void AddPage(Uint64 InSize)
+        {
+            m_Pages.push_back(InSize);
+            m_Capacity += InSize;
+        }
+
+        /**
+         * Reserve InSize bytes aligned to InAlign (power of two). False when no remaining page can
+         * hold it — AddPage(RequiredPageSize(InSize)) then retry.
+         */
+        bool Allocate(Uint64 InSize, Uint64 InAlign, Uint32& OutPage, Uint64& OutOffset) noexcept
+        {
+            if (InSize == 0) { return false; }
+
+            for (; m_Page < m_Pages.size(); ++m_Page, m_Offset = 0)
+            {
+                const Uint64 lAligned = AlignUp(m_Offset, InAlign);
+                if (lAligned + InSize <= m_Pages[m_Page])
+                {
+                    m_Used   += (lAligned - m_Offset) + InSize;
+                    m_Offset  = lAligned + InSize;
+                    OutPage   = m_Page;
+                    OutOffset = lAligned;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** New frame for this slot: rewind to the first page. */
+        void Reset() noexcept
+        {
+            m_Page   = 0;
+            m_Offset = 0;
+            m_Used   = 0;
+        }
+
+    private:
+        static Uint64 AlignUp(Uint64 InValue, Uint64 InAlign) noexcept
+        {
+            return InAlign > 1 ? (InValue + InAlign - 1) & ~(InAlign - 1) : InValue;
+        }
+
+        Uint64            m_PageSize = 0;
+        TDynArray<Uint64> m_Pages;             // byte size of each page, in chain order
+        Uint64            m_Capacity = 0;
+        size_t            m_Page     = 0;      // current page
+        Uint64            m_Offset   = 0;      // next free byte in the current page
+        Uint64            m_Used     = 0;
+    };
+
+} // namespace Opaax
@@ -10,10 +10,10 @@ namespace Opaax
 {
     class VulkanDevice;
 
-    // Per-frame ring depth for dynamic UBO slots + descriptor sets: the max number of distinct
-    // Renderer2D Begin/Flush cycles in one frame (each needs its own UBO region + descriptor set
-    // because Vulkan defers execution to submit). Target 2D games use ~2 (world + overlay); 64 is
-    // generous headroom. Overflow logs + wraps (best-effort) — see the resource SetData paths.
+    // Default per-frame descriptor-set ring depth: distinct Renderer2D flushes in one frame (each
+    // needs its own descriptor set because Vulkan defers execution to submit). Target 2D games use
+    // ~2 (world + overlay); 64 is generous headroom. Dynamic vertex/UBO data no longer rides a ring
+    // — it comes from VulkanFrameAllocator.
     inline constexpr Uint32 OPAAX_VULKAN_FRAME_RING = 64;
 
     // =============================================================================
@@ -6,6 +6,7 @@
 #include "VulkanFrameContext.h"
 #include "RHI/RenderCommand.h"
 #include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
 
 namespace Opaax
 {
@@ -42,6 +43,7 @@ namespace Opaax
     {
         if (m_ImageView) { vkDestroyImageView(m_Device, m_ImageView, nullptr); m_ImageView = VK_NULL_HANDLE; }
         if (m_Image)     { vmaDestroyImage(m_Allocator, m_Image, m_Alloc);     m_Image = VK_NULL_HANDLE; m_Alloc = nullptr; }
+        if (m_GpuBytes)  { GpuMemoryTracker::Free(EGpuMemoryCategory::RenderTarget, m_GpuBytes); m_GpuBytes = 0; }
     }
 
     void VulkanFramebuffer::Invalidate()
@@ -67,6 +69,11 @@ namespace Opaax
                 OPAAX_CORE_ERROR("VulkanFramebuffer: vmaCreateImage failed ({}x{}).", m_Width, m_Height);
                 return;
             }
+
+            VmaAllocationInfo lAllocInfo{};
+            vmaGetAllocationInfo(m_Allocator, m_Alloc, &lAllocInfo);
+            m_GpuBytes = lAllocInfo.size;
+            GpuMemoryTracker::Allocate(EGpuMemoryCategory::RenderTarget, m_GpuBytes);
         }
 
         // ---- View ----
@@ -101,6 +108,8 @@ namespace Opaax
     void VulkanFramebuffer::Resize(Uint32 InWidth, Uint32 InHeight)
     {
         if (InWidth == 0 || InHeight == 0)              { return; }
+
+        std::scoped_lock lLock(m_ResizeMutex);
         if (InWidth == m_Width && InHeight == m_Height) { m_PendingResize = false; return; }
 
         // Store only — the actual destroy/recreate happens at the next offscreen pass start
@@ -112,6 +121,7 @@ namespace Opaax
 
     void VulkanFramebuffer::ApplyPendingResize()
     {
+        std::scoped_lock lLock(m_ResizeMutex);
         if (!m_PendingResize) { return; }
         m_PendingResize = false;
 
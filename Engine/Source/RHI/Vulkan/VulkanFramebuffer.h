@@ -7,6 +7,8 @@
 #include <vulkan/vulkan.h>
 #include <vma/vk_mem_alloc.h>
 
+#include <mutex>
+
 namespace Opaax
 {
     // =============================================================================
@@ -62,6 +64,8 @@ namespace Opaax
         // of the offscreen pass (before any draw records into the image). Resize() only stores the
         // pending size: destroying the image during the editor's Draw would orphan the world-pass
         // draws this frame's command buffer already recorded into it. WaitIdle-guards the destroy.
+        // Locked: with parallel pass recording the first pass to open the target applies it, on
+        // whichever job worker records that pass.
         void ApplyPendingResize();
 
         // =============================================================================
@@ -97,6 +101,7 @@ namespace Opaax
 
         VkImage       m_Image     = VK_NULL_HANDLE;
         VmaAllocation m_Alloc     = nullptr;
+        Uint64        m_GpuBytes  = 0;   // color image allocation, reported to GpuMemoryTracker
         VkImageView   m_ImageView = VK_NULL_HANDLE;
         VkSampler     m_Sampler   = VK_NULL_HANDLE;
 
@@ -107,6 +112,7 @@ namespace Opaax
         Uint32 m_Height = 1;
 
         // Deferred resize (applied at the next offscreen pass start, not during Draw).
+        std::mutex m_ResizeMutex;
         bool   m_PendingResize = false;
         Uint32 m_PendingWidth  = 1;
         Uint32 m_PendingHeight = 1;
@@ -9,6 +9,8 @@
 #include "RHI/Shader.h"
 #include "Core/Log/OpaaxLog.h"
 
+#include <chrono>
+
 namespace Opaax
 {
     // NOTE: the IPipeline::Create factory dispatch lives in RHI/BackendFactory.cpp.
@@ -34,6 +36,8 @@ namespace Opaax
 
     VulkanPipeline::VulkanPipeline(const PipelineDesc& InDesc)
     {
+        const auto lStart = std::chrono::steady_clock::now();
+
         VulkanDevice* lDevice = VulkanFrameContext::Device();
         OPAAX_CORE_ASSERT(lDevice)
         m_Device = lDevice->GetDevice();
@@ -104,14 +108,15 @@ namespace Opaax
         VkPipelineMultisampleStateCreateInfo lMultisample{ VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO };
         lMultisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
 
-        // ---- Blend (standard 2D alpha) ----
+        // ---- Blend (standard 2D alpha, or premultiplied: colour already scaled by alpha) ----
         VkPipelineColorBlendAttachmentState lBlendAttach{};
         lBlendAttach.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT
                                     | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-        if (InDesc.Blend == EBlendMode::Alpha)
+        if (InDesc.Blend != EBlendMode::None)
         {
             lBlendAttach.blendEnable         = VK_TRUE;
-            lBlendAttach.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+            lBlendAttach.srcColorBlendFactor = InDesc.Blend == EBlendMode::PremultipliedAlpha ? VK_BLEND_FACTOR_ONE
+                                                                                              : VK_BLEND_FACTOR_SRC_ALPHA;
             lBlendAttach.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
             lBlendAttach.colorBlendOp        = VK_BLEND_OP_ADD;
             lBlendAttach.srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE;
@@ -155,13 +160,16 @@ namespace Opaax
         lInfo.pDynamicState       = &lDynamic;
         lInfo.layout              = m_PipelineLayout;
 
-        if (vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &lInfo, nullptr, &m_Pipeline) != VK_SUCCESS)
+        if (vkCreateGraphicsPipelines(m_Device, lDevice->GetPipelineCache(), 1, &lInfo, nullptr, &m_Pipeline) != VK_SUCCESS)
         {
             OPAAX_CORE_ERROR("VulkanPipeline: vkCreateGraphicsPipelines failed for '{}'.", InDesc.DebugName);
             return;
         }
 
-        OPAAX_CORE_INFO("VulkanPipeline: '{}' baked.", InDesc.DebugName);
+        const double lMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - lStart).count();
+        lDevice->RecordPipelineCreate(lMicros);
+        OPAAX_CORE_INFO("VulkanPipeline: '{}' baked in {:.2f} ms (pipeline cache {}).", InDesc.DebugName,
+                        lMicros / 1000.0, lDevice->IsPipelineCacheWarm() ? "warm" : "cold");
     }
 
     VulkanPipeline::~VulkanPipeline()
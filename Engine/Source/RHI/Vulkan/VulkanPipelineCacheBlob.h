@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxHash.h"
+#include "Core/OpaaxTypes.h"
+
+#include <cstring>
+
+namespace Opaax
+{
+    // =============================================================================
+    // Persisted VkPipelineCache blob (pure)
+    //
+    // vkGetPipelineCacheData output wrapped in our own header so a file written by
+    // another GPU, driver build or engine version is rejected BEFORE it reaches
+    // vkCreatePipelineCache (drivers are supposed to ignore foreign data, some
+    // don't). The payload's own VkPipelineCacheHeaderVersionOne is cross-checked
+    // too, and a trailing FNV-1a checksum rejects torn writes.
+    //
+    // Deliberately vulkan.h-free (layouts restated below) so it is unit-testable
+    // in the pure test target.
+    // =============================================================================
+
+    /**
+     * @struct VulkanPipelineCacheIdentity
+     * Device identity a cache blob is valid for (VkPhysicalDeviceProperties fields).
+     */
+    struct VulkanPipelineCacheIdentity
+    {
+        Uint32 VendorID      = 0u;
+        Uint32 DeviceID      = 0u;
+        Uint32 DriverVersion = 0u;
+        Uint8  CacheUUID[16] = {};   // pipelineCacheUUID
+    };
+
+    namespace VulkanPipelineCacheBlob
+    {
+        static constexpr Uint32 Magic   = 0x4243504Fu;   // "OPCB"
+        static constexpr Uint32 Version = 1u;
+
+        // Our header: Magic, Version, VendorID, DeviceID, DriverVersion, UUID[16], PayloadSize.
+        static constexpr size_t HeaderSize  = sizeof(Uint32) * 6 + 16;
+        // VkPipelineCacheHeaderVersionOne: headerSize, headerVersion, vendorID, deviceID, UUID[16].
+        static constexpr size_t VkHeaderSize = sizeof(Uint32) * 4 + 16;
+
+        namespace Detail
+        {
+            FORCEINLINE Uint32 ReadU32(const Uint8* InAt) noexcept
+            {
+                Uint32 lValue = 0;
+                std::memcpy(&lValue, InAt, sizeof(Uint32));
+                return lValue;
+            }
+
+            FORCEINLINE void WriteU32(Uint8* OutAt, Uint32 InValue) noexcept
+            {
+                std::memcpy(OutAt, &InValue, sizeof(Uint32));
+            }
+        }
+
+        /** Header + InData + checksum into OutBytes. */
+        inline void Wrap(const VulkanPipelineCacheIdentity& InIdentity, const void* InData, size_t InSize,
+                         TDynArray<Uint8>& OutBytes)
+        {
+            using namespace Detail;
+            OutBytes.assign(HeaderSize + InSize + sizeof(Uint32), 0);
+
+            Uint8* lAt = OutBytes.data();
+            WriteU32(lAt +  0, Magic);
+            WriteU32(lAt +  4, Version);
+            WriteU32(lAt +  8, InIdentity.VendorID);
+            WriteU32(lAt + 12, InIdentity.DeviceID);
+            WriteU32(lAt + 16, InIdentity.DriverVersion);
+            std::memcpy(lAt + 20, InIdentity.CacheUUID, 16);
+            WriteU32(lAt + 36, static_cast<Uint32>(InSize));
+            if (InSize > 0) { std::memcpy(lAt + HeaderSize, InData, InSize); }
+
+            WriteU32(lAt + HeaderSize + InSize, OpaaxHash::HashBytes(lAt, HeaderSize + InSize));
+        }
+
+        /**
+         * Validate a blob written by Wrap against the running device. On success OutData/OutSize
+         * point at the driver payload inside InBytes (feed to VkPipelineCacheCreateInfo).
+         */
+        inline bool Unwrap(const Uint8* InBytes, size_t InSize, const VulkanPipelineCacheIdentity& InIdentity,
+                           const Uint8*& OutData, size_t& OutSize)
+        {
+            using namespace Detail;
+            if (!InBytes || InSize < HeaderSize + sizeof(Uint32)) { return false; }
+
+            const size_t lPayload = InSize - HeaderSize - sizeof(Uint32);
+            if (ReadU32(InBytes) != Magic || ReadU32(InBytes + 4) != Version)               { return false; }
+            if (ReadU32(InBytes + 8)  != InIdentity.VendorID
+                || ReadU32(InBytes + 12) != InIdentity.DeviceID
+                || ReadU32(InBytes + 16) != InIdentity.DriverVersion
+                || std::memcmp(InBytes + 20, InIdentity.CacheUUID, 16) != 0)                { return false; }
+            if (ReadU32(InBytes + 36) != lPayload)                                          { return false; }
+            if (ReadU32(InBytes + HeaderSize + lPayload) != OpaaxHash::HashBytes(InBytes, HeaderSize + lPayload))
+            {
+                return false;
+            }
+
+            // The driver's own header must agree as well (and be version one).
+            const Uint8* lVk = InBytes + HeaderSize;
+            if (lPayload < VkHeaderSize
+                || ReadU32(lVk) < VkHeaderSize || ReadU32(lVk + 4) != 1u
+                || ReadU32(lVk + 8) != InIdentity.VendorID || ReadU32(lVk + 12) != InIdentity.DeviceID
+                || std::memcmp(lVk + 16, InIdentity.CacheUUID, 16) != 0)
+            {
+                return false;
+            }
+
+            OutData = lVk;
+            OutSize = lPayload;
+            return true;
+        }
+    }
+
+} // namespace Opaax
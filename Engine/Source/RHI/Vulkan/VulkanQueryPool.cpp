@@ -0,0 +1,110 @@
+#include "VulkanQueryPool.h"
+
+#if OPAAX_HAS_VULKAN
+
+#include "VulkanCommandBuffer.h"
+#include "VulkanDevice.h"
+#include "VulkanFrameContext.h"
+#include "Core/Log/OpaaxLog.h"
+
+namespace Opaax
+{
+    // NOTE: the ITimestampQueryPool::Create factory dispatch lives in RHI/BackendFactory.cpp.
+
+    VulkanTimestampQueryPool::VulkanTimestampQueryPool(Uint32 InCapacity)
+        : m_Capacity(InCapacity)
+    {
+        VulkanDevice* lDevice = VulkanFrameContext::Device();
+        OPAAX_CORE_ASSERT(lDevice)
+        m_Device = lDevice->GetDevice();
+
+        // Timestamps need graphics-queue support (timestampValidBits) — absent on some mobile/virtual
+        // adapters. Report unsupported rather than writing garbage.
+        VkPhysicalDeviceProperties lProps{};
+        vkGetPhysicalDeviceProperties(lDevice->GetPhysicalDevice(), &lProps);
+
+        Uint32 lFamilyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(lDevice->GetPhysicalDevice(), &lFamilyCount, nullptr);
+        TDynArray<VkQueueFamilyProperties> lFamilies(lFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(lDevice->GetPhysicalDevice(), &lFamilyCount, lFamilies.data());
+
+        const Uint32 lFamily    = lDevice->GetGraphicsQueueFamily();
+        const Uint32 lValidBits = lFamily < lFamilyCount ? lFamilies[lFamily].timestampValidBits : 0u;
+        if (lValidBits == 0 || m_Capacity == 0)
+        {
+            OPAAX_CORE_WARN("VulkanTimestampQueryPool: graphics queue has no timestamp support — "
+                            "GPU pass timings disabled.");
+            return;
+        }
+
+        m_NsPerTick = static_cast<double>(lProps.limits.timestampPeriod);
+        m_ValidMask = lValidBits >= 64u ? ~0ull : ((1ull << lValidBits) - 1ull);
+
+        VkQueryPoolCreateInfo lInfo{ VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        lInfo.queryType  = VK_QUERY_TYPE_TIMESTAMP;
+        lInfo.queryCount = m_Capacity * OPAAX_FRAMES_IN_FLIGHT;
+        if (vkCreateQueryPool(m_Device, &lInfo, nullptr, &m_Pool) != VK_SUCCESS)
+        {
+            OPAAX_CORE_ERROR("VulkanTimestampQueryPool: vkCreateQueryPool failed.");
+            m_Pool = VK_NULL_HANDLE;
+            return;
+        }
+
+        m_Scratch.resize(m_Capacity);
+        m_Resolved.resize(m_Capacity);
+    }
+
+    VulkanTimestampQueryPool::~VulkanTimestampQueryPool()
+    {
+        if (m_Pool) { vkDestroyQueryPool(m_Device, m_Pool, nullptr); }
+    }
+
+    void VulkanTimestampQueryPool::BeginFrame(ICommandBuffer& InCmd)
+    {
+        // Backend invariant: the active backend's command buffer is a VulkanCommandBuffer.
+        VkCommandBuffer lCmd = static_cast<VulkanCommandBuffer&>(InCmd).GetVkCommandBuffer();
+        m_Active = (m_Pool != VK_NULL_HANDLE) && (lCmd != VK_NULL_HANDLE);
+        if (!m_Active) { return; }   // unsupported, or a skipped frame (no acquire, nothing recorded)
+
+        m_Slot = VulkanFrameContext::FrameSlot();
+        const Uint32 lFirst = m_Slot * m_Capacity;
+
+        // The slot's fence was waited in AcquireNextImage, so its queries are final.
+        const Uint32 lCount = m_Written[m_Slot];
+        if (lCount > 0)
+        {
+            const VkResult lRes = vkGetQueryPoolResults(m_Device, m_Pool, lFirst, lCount,
+                                                        sizeof(Uint64) * lCount, m_Scratch.data(),
+                                                        sizeof(Uint64), VK_QUERY_RESULT_64_BIT);
+            if (lRes == VK_SUCCESS)
+            {
+                for (Uint32 i = 0; i < lCount; ++i) { m_Resolved[i] = m_Scratch[i] & m_ValidMask; }
+                m_ResolvedCount = lCount;
+            }
+        }
+
+        // Reset must be recorded outside a render pass — RenderPipeline calls this before any pass.
+        vkCmdResetQueryPool(lCmd, m_Pool, lFirst, m_Capacity);
+        m_Written[m_Slot] = 0;
+    }
+
+    Uint32 VulkanTimestampQueryPool::WriteTimestamp(ICommandBuffer& InCmd)
+    {
+        if (!m_Active || m_Written[m_Slot] >= m_Capacity) { return InvalidQuery; }
+
+        VkCommandBuffer lCmd   = static_cast<VulkanCommandBuffer&>(InCmd).GetVkCommandBuffer();
+        const Uint32    lIndex = m_Written[m_Slot]++;
+        vkCmdWriteTimestamp(lCmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_Pool, m_Slot * m_Capacity + lIndex);
+        return lIndex;
+    }
+
+    double VulkanTimestampQueryPool::GetElapsedMicros(Uint32 InBegin, Uint32 InEnd) const
+    {
+        if (InBegin >= m_ResolvedCount || InEnd >= m_ResolvedCount) { return 0.0; }
+        if (m_Resolved[InEnd] < m_Resolved[InBegin])                { return 0.0; }
+        return static_cast<double>(m_Resolved[InEnd] - m_Resolved[InBegin]) * m_NsPerTick / 1000.0;
+    }
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_VULKAN
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "RHI/QueryPool.h"
+
+#if OPAAX_HAS_VULKAN
+
+#include "RHI/Vulkan/VulkanSwapchain.h"   // OPAAX_FRAMES_IN_FLIGHT
+
+#include <vulkan/vulkan.h>
+
+namespace Opaax
+{
+    // =============================================================================
+    // VulkanTimestampQueryPool
+    // =============================================================================
+    /**
+     * @class VulkanTimestampQueryPool
+     *
+     * ITimestampQueryPool over one VK_QUERY_TYPE_TIMESTAMP pool partitioned per
+     * frame-in-flight. BeginFrame runs after VulkanRenderAPI::BeginFrame, i.e. after the slot's
+     * in-flight fence was waited — so the slot's previous results are final and read back
+     * without VK_QUERY_RESULT_WAIT_BIT — then vkCmdResetQueryPool's the slot range on the live
+     * command buffer. Ticks convert to ns via limits.timestampPeriod.
+     */
+    class VulkanTimestampQueryPool final : public ITimestampQueryPool
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit VulkanTimestampQueryPool(Uint32 InCapacity);
+        ~VulkanTimestampQueryPool() override;
+
+        VulkanTimestampQueryPool(const VulkanTimestampQueryPool&)            = delete;
+        VulkanTimestampQueryPool& operator=(const VulkanTimestampQueryPool&) = delete;
+
+        // =============================================================================
+        // Overrides
+        // =============================================================================
+
+        //~Begin ITimestampQueryPool interface
+    public:
+        void   BeginFrame(ICommandBuffer& InCmd)                    override;
+        Uint32 WriteTimestamp(ICommandBuffer& InCmd)                override;
+        double GetElapsedMicros(Uint32 InBegin, Uint32 InEnd) const override;
+        bool   IsSupported() const                                  override { return m_Pool != VK_NULL_HANDLE; }
+        //~End ITimestampQueryPool interface
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        VkDevice    m_Device   = VK_NULL_HANDLE;
+        VkQueryPool m_Pool     = VK_NULL_HANDLE;
+        Uint32      m_Capacity = 0;                            // queries per frame slot
+        double      m_NsPerTick = 1.0;                         // limits.timestampPeriod
+        Uint64      m_ValidMask = ~0ull;                       // queue family timestampValidBits
+
+        Uint32      m_Written[OPAAX_FRAMES_IN_FLIGHT] = {};
+        Uint32      m_Slot     = 0;
+        bool        m_Active   = false;                        // false on a skipped frame
+
+        TDynArray<Uint64> m_Scratch;                           // raw ticks, one slot
+        TDynArray<Uint64> m_Resolved;                          // ticks (masked), last collected slot
+        Uint32            m_ResolvedCount = 0;
+    };
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_VULKAN
@@ -5,7 +5,10 @@
 #include "VulkanContext.h"
 #include "VulkanDevice.h"
 #include "VulkanFrameContext.h"
+#include "VulkanUploadManager.h"
+#include "VulkanFrameAllocator.h"
 #include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
 
 namespace Opaax
 {
@@ -21,6 +24,13 @@ namespace Opaax
                 // Destroying the pool frees its command buffers too.
                 vkDestroyCommandPool(m_Device->GetDevice(), m_CommandPool, nullptr);
             }
+            for (auto& lSlotPools : m_SecondaryPools)
+            {
+                for (VkCommandPool lPool : lSlotPools)
+                {
+                    if (lPool) { vkDestroyCommandPool(m_Device->GetDevice(), lPool, nullptr); }
+                }
+            }
         }
     }
 
@@ -32,6 +42,7 @@ namespace Opaax
         m_Swapchain = &lContext.GetSwapchain();
 
         m_CmdBuffer.Setup(m_Device, m_Swapchain);
+        for (VulkanCommandBuffer& lSecondary : m_Secondaries) { lSecondary.Setup(m_Device, m_Swapchain, true); }
 
         // Resources (built by the factory, written from neutral Renderer2D) reach the device +
         // current frame slot through this static — there is one device + swapchain.
@@ -58,6 +69,34 @@ namespace Opaax
             return;
         }
 
+        // ---- Secondary recorders: one transient pool + buffer per (frame slot, recorder) ----
+        VkCommandPoolCreateInfo lSecondaryPoolInfo{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        lSecondaryPoolInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        lSecondaryPoolInfo.queueFamilyIndex = m_Device->GetGraphicsQueueFamily();
+        for (Uint32 lSlot = 0; lSlot < OPAAX_FRAMES_IN_FLIGHT; ++lSlot)
+        {
+            for (Uint32 i = 0; i < SecondaryCount; ++i)
+            {
+                if (vkCreateCommandPool(m_Device->GetDevice(), &lSecondaryPoolInfo, nullptr,
+                                        &m_SecondaryPools[lSlot][i]) != VK_SUCCESS)
+                {
+                    OPAAX_CORE_ERROR("VulkanRenderAPI: failed to create secondary command pool.");
+                    return;
+                }
+
+                VkCommandBufferAllocateInfo lSecondaryAlloc{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+                lSecondaryAlloc.commandPool        = m_SecondaryPools[lSlot][i];
+                lSecondaryAlloc.level              = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+                lSecondaryAlloc.commandBufferCount = 1;
+                if (vkAllocateCommandBuffers(m_Device->GetDevice(), &lSecondaryAlloc,
+                                             &m_SecondaryBuffers[lSlot][i]) != VK_SUCCESS)
+                {
+                    OPAAX_CORE_ERROR("VulkanRenderAPI: failed to allocate secondary command buffers.");
+                    return;
+                }
+            }
+        }
+
         OPAAX_CORE_INFO("VulkanRenderAPI: initialized ({} frames in flight).", OPAAX_FRAMES_IN_FLIGHT);
     }
 
@@ -69,6 +108,7 @@ namespace Opaax
             // Frame skipped (swapchain recreated). The neutral passes still run Begin/EndRenderPass
             // between BeginFrame and EndFrame, so null the recorder to make that recording a no-op.
             m_CmdBuffer.SetCurrent(VK_NULL_HANDLE);
+            for (VulkanCommandBuffer& lSecondary : m_Secondaries) { lSecondary.SetCurrent(VK_NULL_HANDLE); }
             return;
         }
 
@@ -87,10 +127,52 @@ namespace Opaax
         vkBeginCommandBuffer(lCmd, &lBeginInfo);
 
         m_CmdBuffer.SetCurrent(lCmd);
+
+        // The slot's fence was waited in AcquireNextImage — its secondaries are free to reuse.
+        for (Uint32 i = 0; i < SecondaryCount; ++i)
+        {
+            VkCommandBuffer lSecondaryCmd = m_SecondaryBuffers[m_FrameSlot][i];
+            if (lSecondaryCmd) { vkResetCommandPool(m_Device->GetDevice(), m_SecondaryPools[m_FrameSlot][i], 0); }
+            m_Secondaries[i].SetCurrent(lSecondaryCmd);
+        }
+
+        PublishDeviceMemory();
+    }
+
+    void VulkanRenderAPI::PublishDeviceMemory() const
+    {
+        // VMA's per-heap budgets (driver-reported with VK_EXT_memory_budget, estimated otherwise);
+        // device-local heaps only — host heaps hold staging / frame pages already tracked by category.
+        const VkPhysicalDeviceMemoryProperties* lMemProps = nullptr;
+        vmaGetMemoryProperties(m_Device->GetAllocator(), &lMemProps);
+        if (!lMemProps) { return; }
+
+        VmaBudget lBudgets[VK_MAX_MEMORY_HEAPS]{};
+        vmaGetHeapBudgets(m_Device->GetAllocator(), lBudgets);
+
+        Uint64 lUsage  = 0;
+        Uint64 lBudget = 0;
+        for (Uint32 i = 0; i < lMemProps->memoryHeapCount; ++i)
+        {
+            if (lMemProps->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                lUsage  += lBudgets[i].usage;
+                lBudget += lBudgets[i].budget;
+            }
+        }
+        GpuMemoryTracker::SetDeviceMemory(lUsage, lBudget);
     }
 
     void VulkanRenderAPI::EndFrame()
     {
+        // Submit every texture upload queued since the last frame in one batch, AHEAD of the frame
+        // that may sample them (same queue: submission order + the batch's barriers order them).
+        // Also on a skipped frame, so uploads never sit unsubmitted.
+        if (VulkanUploadManager* lUploads = m_Device->GetUploads())
+        {
+            lUploads->Flush();
+        }
+
         if (!m_FrameActive) { return; }
 
         VkCommandBuffer lCmd = m_CommandBuffers[m_FrameSlot];
@@ -125,6 +207,11 @@ namespace Opaax
         return m_CmdBuffer;
     }
 
+    ICommandBuffer* VulkanRenderAPI::GetSecondaryCommandBuffer(Uint32 InIndex)
+    {
+        return InIndex < SecondaryCount ? &m_Secondaries[InIndex] : nullptr;
+    }
+
     void VulkanRenderAPI::SetViewport(Uint32 /*X*/, Uint32 /*Y*/, Uint32 Width, Uint32 Height)
     {
         // No live command buffer outside a frame — a window resize means recreate the swapchain.
@@ -138,6 +225,18 @@ namespace Opaax
         if (m_Device && m_Device->GetDevice()) { vkDeviceWaitIdle(m_Device->GetDevice()); }
     }
 
+    Uint64 VulkanRenderAPI::GetFrameMemoryUsed() const
+    {
+        const VulkanFrameAllocator* lFrameAlloc = m_Device ? m_Device->GetFrameAllocator() : nullptr;
+        return lFrameAlloc ? lFrameAlloc->GetFrameUsed() : 0;
+    }
+
+    Uint64 VulkanRenderAPI::GetFrameMemoryCapacity() const
+    {
+        const VulkanFrameAllocator* lFrameAlloc = m_Device ? m_Device->GetFrameAllocator() : nullptr;
+        return lFrameAlloc ? lFrameAlloc->GetFrameCapacity() : 0;
+    }
+
 } // namespace Opaax
 
 #endif // OPAAX_HAS_VULKAN
@@ -24,11 +24,18 @@ namespace Opaax
      * IRenderAPI for Vulkan. Borrows the VulkanDevice + VulkanSwapchain the context owns
      * (Init downcasts the IGraphicsContext). Owns the command pool + one primary command
      * buffer per frame-in-flight. BeginFrame acquires the next image + opens recording;
-     * EndFrame ends + submits (wait image-available, signal render-finished + the in-flight
-     * fence); present stays in the context (SwapBuffers).
+     * EndFrame flushes pending texture uploads, then ends + submits (wait image-available,
+     * signal render-finished + the in-flight fence); present stays in the context (SwapBuffers).
+     *
+     * Also owns SecondaryCount secondary recorders for parallel pass recording. Each has its own
+     * command pool per frame-in-flight (a pool may only be used from one thread at a time), reset
+     * wholesale in BeginFrame once the slot's fence has been waited.
      */
     class VulkanRenderAPI final : public IRenderAPI
     {
+    public:
+        static constexpr Uint32 SecondaryCount = 4;
+
         // =============================================================================
         // CTOR - DTOR
         // =============================================================================
@@ -48,8 +55,16 @@ namespace Opaax
         ICommandBuffer& GetCommandBuffer()                                           override;
         void            SetViewport(Uint32 X, Uint32 Y, Uint32 Width, Uint32 Height) override;
         void            WaitIdle()                                                   override;
+        Uint32          GetSecondaryCommandBufferCount() const                       override { return SecondaryCount; }
+        ICommandBuffer* GetSecondaryCommandBuffer(Uint32 InIndex)                    override;
+        Uint64          GetFrameMemoryUsed()                                   const override;
+        Uint64          GetFrameMemoryCapacity()                               const override;
         //~End IRenderAPI interface
 
+    private:
+        // Feed VMA's device-local heap usage / budget to GpuMemoryTracker (once per frame).
+        void PublishDeviceMemory() const;
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -61,6 +76,11 @@ namespace Opaax
         VkCommandBuffer m_CommandBuffers[OPAAX_FRAMES_IN_FLIGHT] = {};
 
         VulkanCommandBuffer m_CmdBuffer;          // ICommandBuffer wrapper, retargeted each frame
+
+        VkCommandPool       m_SecondaryPools  [OPAAX_FRAMES_IN_FLIGHT][SecondaryCount] = {};
+        VkCommandBuffer     m_SecondaryBuffers[OPAAX_FRAMES_IN_FLIGHT][SecondaryCount] = {};
+        VulkanCommandBuffer m_Secondaries[SecondaryCount];   // wrappers, retargeted each frame
+
         bool                m_FrameActive = false;
         Uint32              m_FrameSlot   = 0;     // command buffer index for the active frame
     };
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Core/OpaaxTypes.h"
+
+#include <cstddef>
+
+namespace Opaax
+{
+    // =============================================================================
+    // VulkanStagingRing (pure)
+    // =============================================================================
+    /**
+     * @class VulkanStagingRing
+     *
+     * Offset bookkeeping for the persistent upload staging buffer — no Vulkan handles, so it is
+     * unit-testable in the pure test target. VulkanUploadManager owns the VkBuffer and drives this.
+     *
+     * Allocations are carved linearly from a circular range. Close(Serial) stamps everything
+     * allocated since the previous Close with the upload batch that will read it; once that batch's
+     * fence signals, Retire(Serial) hands the range back. Space wasted skipping the end of the
+     * buffer on wrap-around is charged to the allocation that wrapped and freed with it.
+     */
+    class VulkanStagingRing
+    {
+        struct Marker
+        {
+            Uint64 Serial;
+            Uint64 Head;        // m_Head when the batch closed — the new tail once it retires
+            Uint64 Allocated;   // m_Allocated at close
+        };
+
+    public:
+        explicit VulkanStagingRing(Uint64 InCapacity = 0) noexcept : m_Capacity(InCapacity) {}
+
+        Uint64 GetCapacity() const noexcept { return m_Capacity; }
+        Uint64 GetUsed()     const noexcept { return m_Allocated - m_Freed; }
+        bool   IsEmpty()     const noexcept { return GetUsed() == 0; }
+
+        /**
+         * Reserve InSize bytes aligned to InAlign (power of two). False when the free range cannot
+         * hold it right now — the caller flushes/retires and retries, or uses a dedicated buffer
+         * when InSize exceeds the capacity outright.
+         */
+        bool Allocate(Uint64 InSize, Uint64 InAlign, Uint64& OutOffset) noexcept
+        {
+            if (InSize == 0 || InSize > m_Capacity) { return false; }
+
+            if (IsEmpty())
+            {
+                // Nothing live — restart at 0 so a big upload gets the whole buffer. Pending markers
+                // (closed batches that allocated nothing since) all sit at the current head.
+                m_Head = m_Tail = 0;
+                for (Marker& lMarker : m_Markers) { lMarker.Head = 0; }
+            }
+            else if (GetUsed() == m_Capacity)
+            {
+                return false;   // head == tail and full
+            }
+
+            const Uint64 lAligned = AlignUp(m_Head, InAlign);
+            if (m_Head >= m_Tail)
+            {
+                // Free: [head, capacity) then [0, tail).
+                if (lAligned + InSize <= m_Capacity)
+                {
+                    return Commit(lAligned, lAligned + InSize, OutOffset);
+                }
+                if (InSize <= m_Tail)
+                {
+                    return Commit(0, InSize, OutOffset);
+                }
+                return false;
+            }
+
+            // Wrapped: free is [head, tail).
+            if (lAligned + InSize <= m_Tail)
+            {
+                return Commit(lAligned, lAligned + InSize, OutOffset);
+            }
+            return false;
+        }
+
+        /** Everything allocated since the last Close belongs to upload batch InSerial. */
+        void Close(Uint64 InSerial)
+        {
+            m_Markers.push_back({ InSerial, m_Head, m_Allocated });
+        }
+
+        /** Free every range whose batch serial is <= InCompletedSerial (its fence has signalled). */
+        void Retire(Uint64 InCompletedSerial) noexcept
+        {
+            size_t lPopped = 0;
+            for (; lPopped < m_Markers.size() && m_Markers[lPopped].Serial <= InCompletedSerial; ++lPopped)
+            {
+                m_Tail  = m_Markers[lPopped].Head;
+                m_Freed = m_Markers[lPopped].Allocated;
+            }
+            m_Markers.erase(m_Markers.begin(), m_Markers.begin() + static_cast<std::ptrdiff_t>(lPopped));
+        }
+
+    private:
+        static Uint64 AlignUp(Uint64 InValue, Uint64 InAlign) noexcept
+        {
+            return InAlign > 1 ? (InValue + InAlign - 1) & ~(InAlign - 1) : InValue;
+        }
+
+        // Charge everything between the old and new head (alignment pad, or the skipped end of the
+        // buffer on wrap) so used bytes always equal the circular distance tail -> head.
+        bool Commit(Uint64 InOffset, Uint64 InNewHead, Uint64& OutOffset) noexcept
+        {
+            m_Allocated += (InNewHead > m_Head) ? (InNewHead - m_Head) : (m_Capacity - m_Head) + InNewHead;
+            m_Head       = InNewHead;
+            OutOffset    = InOffset;
+            return true;
+        }
+
+        Uint64              m_Capacity  = 0;
+        Uint64              m_Head      = 0;   // next write offset
+        Uint64              m_Tail      = 0;   // oldest live byte
+        Uint64              m_Allocated = 0;   // monotonic, bytes charged
+        Uint64              m_Freed     = 0;   // monotonic, bytes retired
+        TDynArray<Marker>   m_Markers;
+    };
+
+} // namespace Opaax
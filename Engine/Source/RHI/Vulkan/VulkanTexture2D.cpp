@@ -4,18 +4,26 @@
 
 #include "VulkanFrameContext.h"
 #include "VulkanDevice.h"
+#include "VulkanUploadManager.h"
 #include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
 
 // stb_image — STB_IMAGE_IMPLEMENTATION is defined once in OpenGLTexture2D.cpp (always compiled);
 // here we only call into it.
 #include <stb/stb_image.h>
 
+#include <atomic>
 #include <cstring>
 
 namespace Opaax
 {
     // NOTE: the ITexture2D::Create factory dispatch lives in RHI/BackendFactory.cpp.
 
+    namespace
+    {
+        std::atomic<Uint64> s_NextUniqueID{ 1 };
+    }
+
     VulkanTexture2D::VulkanTexture2D(const char* InPath)
         : m_Allocator(VulkanFrameContext::Allocator())
     {
@@ -54,37 +62,40 @@ namespace Opaax
         Upload(InData, InWidth, InHeight, InChannels);
     }
 
-    VulkanTexture2D::~VulkanTexture2D()
+    VulkanTexture2D::VulkanTexture2D(const TextureDesc& InDesc)
+        : m_Allocator(VulkanFrameContext::Allocator())
     {
-        if (m_Sampler)   { vkDestroySampler(m_Device, m_Sampler, nullptr); }
-        if (m_ImageView) { vkDestroyImageView(m_Device, m_ImageView, nullptr); }
-        if (m_Image)     { vmaDestroyImage(m_Allocator, m_Image, m_Alloc); }
+        if (!InDesc.Mips[0] || InDesc.MipCount == 0 || InDesc.MipCount > MaxTextureMips)
+        {
+            OPAAX_CORE_ERROR("VulkanTexture2D: cooked upload received an empty mip chain");
+            return;
+        }
+        UploadCooked(InDesc);
     }
 
-    namespace
+    VulkanTexture2D::~VulkanTexture2D()
     {
-        void TransitionForCopy(VkCommandBuffer InCmd, VkImage InImage,
-                               VkImageLayout InOld, VkImageLayout InNew,
-                               VkPipelineStageFlags InSrc, VkPipelineStageFlags InDst,
-                               VkAccessFlags InSrcAccess, VkAccessFlags InDstAccess)
-        {
-            VkImageMemoryBarrier lBarrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
-            lBarrier.oldLayout           = InOld;
-            lBarrier.newLayout           = InNew;
-            lBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            lBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
-            lBarrier.image               = InImage;
-            lBarrier.subresourceRange    = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
-            lBarrier.srcAccessMask       = InSrcAccess;
-            lBarrier.dstAccessMask       = InDstAccess;
-            vkCmdPipelineBarrier(InCmd, InSrc, InDst, 0, 0, nullptr, 0, nullptr, 1, &lBarrier);
+        // The copy into m_Image may still be pending (or not even submitted yet) — let it land
+        // before the image goes. Usually already complete, so this is a serial compare.
+        if (m_UploadSerial)
+        {
+            if (VulkanDevice* lDevice = VulkanFrameContext::Device(); lDevice && lDevice->GetUploads())
+            {
+                lDevice->GetUploads()->Wait(m_UploadSerial);
+            }
         }
+
+        if (m_Sampler)   { vkDestroySampler(m_Device, m_Sampler, nullptr); }
+        if (m_ImageView) { vkDestroyImageView(m_Device, m_ImageView, nullptr); }
+        if (m_Image)     { vmaDestroyImage(m_Allocator, m_Image, m_Alloc); }
+        if (m_GpuBytes)  { GpuMemoryTracker::Free(EGpuMemoryCategory::Texture, m_GpuBytes); }
     }
 
     void VulkanTexture2D::Upload(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels)
     {
-        m_Width  = InWidth;
-        m_Height = InHeight;
+        m_Width    = InWidth;
+        m_Height   = InHeight;
+        m_UniqueID = s_NextUniqueID.fetch_add(1, std::memory_order_relaxed);
 
         VulkanDevice* lDevice = VulkanFrameContext::Device();
         OPAAX_CORE_ASSERT(lDevice)
@@ -114,28 +125,6 @@ namespace Opaax
             lSrc = lExpanded.data();
         }
 
-        // ---- Staging buffer (host-visible) ----
-        VkBuffer      lStaging      = VK_NULL_HANDLE;
-        VmaAllocation lStagingAlloc = nullptr;
-        {
-            VkBufferCreateInfo lBufInfo{ VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
-            lBufInfo.size  = lImageSize;
-            lBufInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-
-            VmaAllocationCreateInfo lAllocCI{};
-            lAllocCI.usage = VMA_MEMORY_USAGE_AUTO;
-            lAllocCI.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT
-                           | VMA_ALLOCATION_CREATE_MAPPED_BIT;
-
-            VmaAllocationInfo lOut{};
-            if (vmaCreateBuffer(m_Allocator, &lBufInfo, &lAllocCI, &lStaging, &lStagingAlloc, &lOut) != VK_SUCCESS)
-            {
-                OPAAX_CORE_ERROR("VulkanTexture2D: staging buffer creation failed.");
-                return;
-            }
-            std::memcpy(lOut.pMappedData, lSrc, lImageSize);
-        }
-
         // ---- Device-local image ----
         {
             VkImageCreateInfo lImgInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
@@ -155,32 +144,21 @@ namespace Opaax
             if (vmaCreateImage(m_Allocator, &lImgInfo, &lAllocCI, &m_Image, &m_Alloc, nullptr) != VK_SUCCESS)
             {
                 OPAAX_CORE_ERROR("VulkanTexture2D: vmaCreateImage failed.");
-                vmaDestroyBuffer(m_Allocator, lStaging, lStagingAlloc);
                 return;
             }
         }
 
-        // ---- Copy staging -> image (synchronous, outside the frame loop) ----
-        lDevice->ImmediateSubmit([&](VkCommandBuffer InCmd)
+        // ---- Queue the copy (batched; submitted ahead of the next frame, no stall) ----
+        VulkanUploadManager* lUploads = lDevice->GetUploads();
+        m_UploadSerial = lUploads ? lUploads->UploadImage(m_Image, lSrc, lImageSize, InWidth, InHeight) : 0;
+        if (m_UploadSerial == 0)
         {
-            TransitionForCopy(InCmd, m_Image,
-                              VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                              VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
-                              0, VK_ACCESS_TRANSFER_WRITE_BIT);
-
-            VkBufferImageCopy lCopy{};
-            lCopy.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
-            lCopy.imageExtent      = { InWidth, InHeight, 1 };
-            vkCmdCopyBufferToImage(InCmd, lStaging, m_Image,
-                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &lCopy);
-
-            TransitionForCopy(InCmd, m_Image,
-                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-                              VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                              VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT);
-        });
-
-        vmaDestroyBuffer(m_Allocator, lStaging, lStagingAlloc);
+            OPAAX_CORE_ERROR("VulkanTexture2D: failed to queue the {}x{} upload.", InWidth, InHeight);
+            vmaDestroyImage(m_Allocator, m_Image, m_Alloc);
+            m_Image = VK_NULL_HANDLE;
+            m_Alloc = nullptr;
+            return;
+        }
 
         // ---- View (R8 coverage swizzled into alpha; RGBA identity) ----
         {
@@ -213,6 +191,121 @@ namespace Opaax
         }
 
         m_Loaded = (m_ImageView != VK_NULL_HANDLE) && (m_Sampler != VK_NULL_HANDLE);
+
+        VmaAllocationInfo lAllocInfo{};
+        vmaGetAllocationInfo(m_Allocator, m_Alloc, &lAllocInfo);
+        m_GpuBytes = lAllocInfo.size;
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, m_GpuBytes);
+    }
+
+    void VulkanTexture2D::UploadCooked(const TextureDesc& InDesc)
+    {
+        m_Width    = InDesc.Width;
+        m_Height   = InDesc.Height;
+        m_UniqueID = s_NextUniqueID.fetch_add(1, std::memory_order_relaxed);
+
+        VulkanDevice* lDevice = VulkanFrameContext::Device();
+        OPAAX_CORE_ASSERT(lDevice)
+        m_Device = lDevice->GetDevice();
+
+        VkFormat lFormat = VK_FORMAT_R8G8B8A8_UNORM;
+        switch (InDesc.Format)
+        {
+            case ETextureFormat::BC1:   lFormat = VK_FORMAT_BC1_RGB_UNORM_BLOCK; break;
+            case ETextureFormat::BC3:   lFormat = VK_FORMAT_BC3_UNORM_BLOCK;     break;
+            case ETextureFormat::RGBA8: break;
+        }
+
+        // Level offsets in one staging block. A cooked pack already stores the chain back to back
+        // (each level a multiple of 4 bytes / one block), so stage it straight from the mapping;
+        // only a scattered chain is gathered first.
+        VkDeviceSize lOffsets[MaxTextureMips]{};
+        VkDeviceSize lTotal      = 0;
+        bool         lContiguous = true;
+        for (Uint32 lMip = 0; lMip < InDesc.MipCount; ++lMip)
+        {
+            lOffsets[lMip] = lTotal;
+            lContiguous    = lContiguous && InDesc.Mips[lMip] == InDesc.Mips[0] + lTotal;
+            lTotal        += GetTextureLevelSize(InDesc.Format, GetTextureMipExtent(InDesc.Width, lMip),
+                                                 GetTextureMipExtent(InDesc.Height, lMip));
+        }
+
+        TDynArray<Uint8> lGathered;
+        const unsigned char* lSrc = InDesc.Mips[0];
+        if (!lContiguous)
+        {
+            lGathered.resize(static_cast<size_t>(lTotal));
+            for (Uint32 lMip = 0; lMip < InDesc.MipCount; ++lMip)
+            {
+                const VkDeviceSize lEnd = (lMip + 1 < InDesc.MipCount) ? lOffsets[lMip + 1] : lTotal;
+                std::memcpy(lGathered.data() + lOffsets[lMip], InDesc.Mips[lMip], static_cast<size_t>(lEnd - lOffsets[lMip]));
+            }
+            lSrc = lGathered.data();
+        }
+
+        // ---- Device-local image, full chain ----
+        {
+            VkImageCreateInfo lImgInfo{ VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+            lImgInfo.imageType     = VK_IMAGE_TYPE_2D;
+            lImgInfo.format        = lFormat;
+            lImgInfo.extent        = { InDesc.Width, InDesc.Height, 1 };
+            lImgInfo.mipLevels     = InDesc.MipCount;
+            lImgInfo.arrayLayers   = 1;
+            lImgInfo.samples       = VK_SAMPLE_COUNT_1_BIT;
+            lImgInfo.tiling        = VK_IMAGE_TILING_OPTIMAL;
+            lImgInfo.usage         = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+            lImgInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+            VmaAllocationCreateInfo lAllocCI{};
+            lAllocCI.usage = VMA_MEMORY_USAGE_AUTO;
+
+            if (vmaCreateImage(m_Allocator, &lImgInfo, &lAllocCI, &m_Image, &m_Alloc, nullptr) != VK_SUCCESS)
+            {
+                OPAAX_CORE_ERROR("VulkanTexture2D: vmaCreateImage failed (cooked, {} mips).", InDesc.MipCount);
+                return;
+            }
+        }
+
+        VulkanUploadManager* lUploads = lDevice->GetUploads();
+        m_UploadSerial = lUploads ? lUploads->UploadImageMips(m_Image, lSrc, lTotal, InDesc.Width, InDesc.Height,
+                                                              InDesc.MipCount, lOffsets) : 0;
+        if (m_UploadSerial == 0)
+        {
+            OPAAX_CORE_ERROR("VulkanTexture2D: failed to queue the cooked {}x{} upload.", InDesc.Width, InDesc.Height);
+            vmaDestroyImage(m_Allocator, m_Image, m_Alloc);
+            m_Image = VK_NULL_HANDLE;
+            m_Alloc = nullptr;
+            return;
+        }
+
+        {
+            VkImageViewCreateInfo lViewInfo{ VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO };
+            lViewInfo.image            = m_Image;
+            lViewInfo.viewType         = VK_IMAGE_VIEW_TYPE_2D;
+            lViewInfo.format           = lFormat;
+            lViewInfo.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, InDesc.MipCount, 0, 1 };
+            vkCreateImageView(m_Device, &lViewInfo, nullptr, &m_ImageView);
+        }
+
+        // Same filtering as the sprite path, trilinear across the cooked chain.
+        {
+            VkSamplerCreateInfo lSamplerInfo{ VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO };
+            lSamplerInfo.minFilter    = VK_FILTER_LINEAR;
+            lSamplerInfo.magFilter    = VK_FILTER_NEAREST;
+            lSamplerInfo.mipmapMode   = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+            lSamplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+            lSamplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+            lSamplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+            lSamplerInfo.maxLod       = static_cast<float>(InDesc.MipCount);
+            vkCreateSampler(m_Device, &lSamplerInfo, nullptr, &m_Sampler);
+        }
+
+        m_Loaded = (m_ImageView != VK_NULL_HANDLE) && (m_Sampler != VK_NULL_HANDLE);
+
+        VmaAllocationInfo lAllocInfo{};
+        vmaGetAllocationInfo(m_Allocator, m_Alloc, &lAllocInfo);
+        m_GpuBytes = lAllocInfo.size;
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, m_GpuBytes);
     }
 
 } // namespace Opaax
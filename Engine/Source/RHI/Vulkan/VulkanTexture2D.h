@@ -15,13 +15,15 @@ namespace Opaax
     /**
      * @class VulkanTexture2D
      *
-     * ITexture2D for Vulkan: a sampled VkImage (VMA-backed) + view + sampler. Uploaded once via a
-     * staging buffer + a synchronous one-shot copy (textures load outside the frame loop). Channel
-     * handling mirrors OpenGLTexture2D::Upload so sprites AND text render identically:
+     * ITexture2D for Vulkan: a sampled VkImage (VMA-backed) + view + sampler. Pixels go through
+     * VulkanUploadManager — staged into the persistent ring and copied in the next batched submit,
+     * so a texture can be created at any time (mid-frame included) without stalling the queue.
+     * Channel handling mirrors OpenGLTexture2D::Upload so sprites AND text render identically:
      *   - 4ch -> R8G8B8A8_UNORM, identity swizzle
      *   - 1ch (font atlas R8) -> R8_UNORM with a view swizzle {ONE,ONE,ONE,R}, so coverage reads as
      *     (1,1,1,a) — the Vulkan equivalent of GL's GL_TEXTURE_SWIZZLE_RGBA path. LINEAR + CLAMP.
      *   - 3ch -> expanded to RGBA on the CPU (Vulkan rarely supports sampled RGB8)
+     * A cooked TextureDesc (RGBA8 / BC1 / BC3 + mip chain) is staged as-is, all levels in one copy.
      */
     class VulkanTexture2D final : public ITexture2D
     {
@@ -32,6 +34,7 @@ namespace Opaax
         explicit VulkanTexture2D(const char* InPath);
         VulkanTexture2D(Uint32 InWidth, Uint32 InHeight);                                   // 1x1 white
         VulkanTexture2D(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
+        explicit VulkanTexture2D(const TextureDesc& InDesc);                               // cooked, no conversion
         ~VulkanTexture2D() override;
 
         // =============================================================================
@@ -47,6 +50,7 @@ namespace Opaax
         Uint32 GetHeight()     const noexcept override { return m_Height; }
         Uint32 GetRendererID() const noexcept override { return 0; }   // editor uses GetTextureID seam (image view + sampler)
         bool   IsLoaded()      const noexcept override { return m_Loaded; }
+        Uint64 GetGpuMemorySize() const noexcept override { return m_GpuBytes; }
         //~End ITexture2D interface
 
         // =============================================================================
@@ -56,12 +60,17 @@ namespace Opaax
         VkImageView GetImageView() const noexcept { return m_ImageView; }
         VkSampler   GetSampler()   const noexcept { return m_Sampler; }
 
+        // Process-unique, never reused (unlike handle values) — lets VulkanBindGroup tell a new
+        // texture from a destroyed one whose view handle the driver recycled.
+        Uint64      GetUniqueID()  const noexcept { return m_UniqueID; }
+
         // =============================================================================
         // Functions
         // =============================================================================
     private:
         // InChannels: 4 = RGBA8, 3 = RGB8 (expanded), 1 = R8 coverage (alpha-swizzled).
         void Upload(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
+        void UploadCooked(const TextureDesc& InDesc);
 
         // =============================================================================
         // Members
@@ -75,6 +84,10 @@ namespace Opaax
         VkImageView   m_ImageView = VK_NULL_HANDLE;
         VkSampler     m_Sampler   = VK_NULL_HANDLE;
 
+        Uint64 m_UploadSerial = 0;   // VulkanUploadManager batch carrying the pixel copy
+        Uint64 m_UniqueID     = 0;
+        Uint64 m_GpuBytes     = 0;   // VMA allocation size, reported to GpuMemoryTracker
+
         Uint32 m_Width  = 1;
         Uint32 m_Height = 1;
         bool   m_Loaded = false;
@@ -4,10 +4,7 @@
 
 #if OPAAX_HAS_VULKAN
 
-#include "RHI/Vulkan/VulkanSwapchain.h"   // OPAAX_FRAMES_IN_FLIGHT
-
 #include <vulkan/vulkan.h>
-#include <vma/vk_mem_alloc.h>
 
 namespace Opaax
 {
@@ -17,12 +14,12 @@ namespace Opaax
     /**
      * @class VulkanUniformBuffer
      *
-     * Uniform buffer backed by one host-visible+mapped VMA allocation PER frame-in-flight, each
-     * holding a RING of aligned blocks. The camera UBO is rewritten on every Renderer2D::Begin
-     * (world camera, then overlay screen-space camera) — two writes per frame minimum — so each
-     * write lands in the NEXT ring slot. The bind group reads GetBuffer(frameSlot) +
-     * GetCurrentByteOffset() to point that pass's descriptor at the matching block. The ring
-     * cursor resets when the frame generation changes.
+     * Uniform buffer with no storage of its own: every SetData sub-allocates one block (aligned to
+     * minUniformBufferOffsetAlignment) from the device's VulkanFrameAllocator. The camera UBO is
+     * rewritten on every Renderer2D::Begin (world camera, then overlay screen-space camera), so each
+     * write lands in a fresh block and there is no per-buffer write cap. The bind group's binding is
+     * UNIFORM_BUFFER_DYNAMIC: its descriptor names GetBindBuffer() and the draw passes
+     * GetCurrentByteOffset() as the dynamic offset, so moving to the next block rewrites nothing.
      */
     class VulkanUniformBuffer final : public IUniformBuffer
     {
@@ -46,26 +43,18 @@ namespace Opaax
         // Get — consumed by VulkanBindGroup
         // =============================================================================
     public:
-        VkBuffer     GetBuffer(Uint32 InFrameSlot) const noexcept { return m_Buffers[InFrameSlot]; }
-        VkDeviceSize GetCurrentByteOffset()        const noexcept { return m_CurrentByteOffset; }
-        VkDeviceSize GetBlockSize()                const noexcept { return m_BlockSize; }
+        VkBuffer     GetBindBuffer()        const noexcept { return m_BindBuffer; }
+        VkDeviceSize GetCurrentByteOffset() const noexcept { return m_CurrentByteOffset; }
+        VkDeviceSize GetBlockSize()         const noexcept { return m_BlockSize; }
 
         // =============================================================================
         // Members
         // =============================================================================
     private:
-        VmaAllocator m_Allocator = nullptr;
         VkDeviceSize m_BlockSize = 0;   // logical block size (sizeof the std140 struct)
-        VkDeviceSize m_Aligned   = 0;   // block size rounded up to minUniformBufferOffsetAlignment
-
-        VkBuffer      m_Buffers[OPAAX_FRAMES_IN_FLIGHT] = {};
-        VmaAllocation m_Allocs [OPAAX_FRAMES_IN_FLIGHT] = {};
-        void*         m_Mapped [OPAAX_FRAMES_IN_FLIGHT] = {};
 
-        Uint64       m_FrameGen          = ~0ull;
-        Uint32       m_RingCursor        = 0;
-        Uint32       m_RingDepth         = 0;   // EngineConfig::VulkanFrameRing() — sizes + bounds the ring
-        VkDeviceSize m_CurrentByteOffset = 0;   // byte offset of the slot the last SetData wrote
+        VkBuffer     m_BindBuffer        = VK_NULL_HANDLE;   // frame-allocator page of the last write
+        VkDeviceSize m_CurrentByteOffset = 0;                // its offset — the dynamic offset at bind
     };
 
 } // namespace Opaax
@@ -0,0 +1,369 @@
+#include "VulkanUploadManager.h"
+
+#if OPAAX_HAS_VULKAN
+
+#include "VulkanDevice.h"
+#include "Core/Log/OpaaxLog.h"
+#include "RHI/GpuMemoryTracker.h"
+#include "RHI/Texture.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace Opaax
+{
+    namespace
+    {
+        // Persistent staging ring. Sized for a typical level's worth of sprite atlases in one batch;
+        // anything larger takes the dedicated-buffer path instead of stalling.
+        constexpr VkDeviceSize StagingRingSize = 16ull * 1024ull * 1024ull;
+
+        // vkCmdCopyBufferToImage wants bufferOffset % 4 == 0 (and % texel size); 16 covers every
+        // format we upload plus optimalBufferCopyOffsetAlignment on common hardware.
+        constexpr VkDeviceSize StagingAlignment = 16;
+
+        void ImageBarrier(VkCommandBuffer InCmd, VkImage InImage,
+                          VkImageLayout InOld, VkImageLayout InNew,
+                          VkPipelineStageFlags InSrc, VkPipelineStageFlags InDst,
+                          VkAccessFlags InSrcAccess, VkAccessFlags InDstAccess, Uint32 InMipCount = 1)
+        {
+            VkImageMemoryBarrier lBarrier{ VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            lBarrier.oldLayout           = InOld;
+            lBarrier.newLayout           = InNew;
+            lBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            lBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            lBarrier.image               = InImage;
+            lBarrier.subresourceRange    = { VK_IMAGE_ASPECT_COLOR_BIT, 0, InMipCount, 0, 1 };
+            lBarrier.srcAccessMask       = InSrcAccess;
+            lBarrier.dstAccessMask       = InDstAccess;
+            vkCmdPipelineBarrier(InCmd, InSrc, InDst, 0, 0, nullptr, 0, nullptr, 1, &lBarrier);
+        }
+
+        bool CreateStagingBuffer(VmaAllocator InAllocator, VkDeviceSize InSize,
+                                 VkBuffer& OutBuffer, VmaAllocation& OutAlloc, void*& OutMapped)
+        {
+            VkBufferCreateInfo lBufInfo{ VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+            lBufInfo.size  = InSize;
+            lBufInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+            VmaAllocationCreateInfo lAllocCI{};
+            lAllocCI.usage = VMA_MEMORY_USAGE_AUTO;
+            lAllocCI.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT
+                           | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+            VmaAllocationInfo lOut{};
+            if (vmaCreateBuffer(InAllocator, &lBufInfo, &lAllocCI, &OutBuffer, &OutAlloc, &lOut) != VK_SUCCESS)
+            {
+                return false;
+            }
+            OutMapped = lOut.pMappedData;
+            return true;
+        }
+    }
+
+    // =============================================================================
+    // CTOR - DTOR
+    // =============================================================================
+    VulkanUploadManager::VulkanUploadManager(VulkanDevice& InDevice)
+        : m_Device(InDevice)
+    {
+        VkCommandPoolCreateInfo lPoolInfo{ VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+        lPoolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT
+                                   | VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+        lPoolInfo.queueFamilyIndex = m_Device.GetGraphicsQueueFamily();
+        if (vkCreateCommandPool(m_Device.GetDevice(), &lPoolInfo, nullptr, &m_Pool) != VK_SUCCESS)
+        {
+            OPAAX_CORE_ERROR("VulkanUploadManager: command pool creation failed.");
+            return;
+        }
+
+        void* lMapped = nullptr;
+        if (!CreateStagingBuffer(m_Device.GetAllocator(), StagingRingSize, m_Ring, m_RingAlloc, lMapped))
+        {
+            // Not fatal — every upload then takes the dedicated-buffer path.
+            OPAAX_CORE_ERROR("VulkanUploadManager: staging ring creation failed ({} MiB).", StagingRingSize >> 20);
+            return;
+        }
+        GpuMemoryTracker::Allocate(EGpuMemoryCategory::Staging, StagingRingSize);
+        m_RingMapped  = static_cast<Uint8*>(lMapped);
+        m_RingOffsets = VulkanStagingRing(StagingRingSize);
+    }
+
+    VulkanUploadManager::~VulkanUploadManager()
+    {
+        const VkDevice lDevice = m_Device.GetDevice();
+
+        // A batch still open at teardown is discarded, not submitted — textures that recorded into
+        // it may already be destroyed, and nothing will ever sample them now.
+        if (m_Open.Cmd)
+        {
+            vkEndCommandBuffer(m_Open.Cmd);
+            Release(m_Open);
+            m_Free.push_back(Move(m_Open));
+        }
+
+        for (Batch& lBatch : m_InFlight)
+        {
+            vkWaitForFences(lDevice, 1, &lBatch.Fence, VK_TRUE, UINT64_MAX);
+            Release(lBatch);
+            m_Free.push_back(Move(lBatch));
+        }
+        m_InFlight.clear();
+
+        for (Batch& lBatch : m_Free)
+        {
+            if (lBatch.Fence) { vkDestroyFence(lDevice, lBatch.Fence, nullptr); }
+        }
+        if (m_Pool) { vkDestroyCommandPool(lDevice, m_Pool, nullptr); }   // frees the command buffers
+        if (m_Ring)
+        {
+            vmaDestroyBuffer(m_Device.GetAllocator(), m_Ring, m_RingAlloc);
+            GpuMemoryTracker::Free(EGpuMemoryCategory::Staging, StagingRingSize);
+        }
+
+        if (m_UploadCount > 0)
+        {
+            OPAAX_CORE_INFO("VulkanUploadManager: {} upload(s), {:.2f} MiB in {} submit(s), {} ring stall(s).",
+                            m_UploadCount, static_cast<double>(m_UploadBytes) / (1024.0 * 1024.0),
+                            m_SubmitCount, m_StallCount);
+        }
+    }
+
+    // =============================================================================
+    // Functions
+    // =============================================================================
+    Uint64 VulkanUploadManager::UploadImage(VkImage InImage, const void* InData, VkDeviceSize InSize,
+                                            Uint32 InWidth, Uint32 InHeight)
+    {
+        const VkDeviceSize lBaseOffset = 0;
+        return UploadImageMips(InImage, InData, InSize, InWidth, InHeight, 1, &lBaseOffset);
+    }
+
+    Uint64 VulkanUploadManager::UploadImageMips(VkImage InImage, const void* InData, VkDeviceSize InSize,
+                                                Uint32 InWidth, Uint32 InHeight,
+                                                Uint32 InMipCount, const VkDeviceSize* InLevelOffsets)
+    {
+        if (!m_Pool || !InImage || !InData || InSize == 0 || InMipCount == 0)
+        {
+            return 0;
+        }
+
+        // Stage first: a full ring may flush the open batch, so only open ours afterwards.
+        VkBuffer     lSrc    = VK_NULL_HANDLE;
+        VkDeviceSize lOffset = 0;
+        if (!Stage(InData, InSize, lSrc, lOffset))
+        {
+            return 0;
+        }
+
+        VkCommandBuffer lCmd = OpenBatch();
+        if (!lCmd)
+        {
+            return 0;
+        }
+
+        ImageBarrier(lCmd, InImage,
+                     VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                     0, VK_ACCESS_TRANSFER_WRITE_BIT, InMipCount);
+
+        VkBufferImageCopy lCopies[MaxTextureMips]{};
+        for (Uint32 lMip = 0; lMip < InMipCount; ++lMip)
+        {
+            lCopies[lMip].bufferOffset     = lOffset + InLevelOffsets[lMip];
+            lCopies[lMip].imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, lMip, 0, 1 };
+            lCopies[lMip].imageExtent      = { GetTextureMipExtent(InWidth, lMip), GetTextureMipExtent(InHeight, lMip), 1 };
+        }
+        vkCmdCopyBufferToImage(lCmd, lSrc, InImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, InMipCount, lCopies);
+
+        // Later submissions on this queue (the frame that draws with it) wait on this transition.
+        ImageBarrier(lCmd, InImage,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                     VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                     VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT, InMipCount);
+
+        ++m_UploadCount;
+        m_UploadBytes += InSize;
+        return m_Open.Serial;
+    }
+
+    bool VulkanUploadManager::Stage(const void* InData, VkDeviceSize InSize, VkBuffer& OutBuffer, VkDeviceSize& OutOffset)
+    {
+        const VmaAllocator lAllocator = m_Device.GetAllocator();
+
+        if (!m_Ring || InSize > m_RingOffsets.GetCapacity())
+        {
+            VkBuffer      lBuffer = VK_NULL_HANDLE;
+            VmaAllocation lAlloc  = nullptr;
+            void*         lMapped = nullptr;
+            if (!CreateStagingBuffer(lAllocator, InSize, lBuffer, lAlloc, lMapped))
+            {
+                OPAAX_CORE_ERROR("VulkanUploadManager: dedicated staging buffer ({} bytes) creation failed.", InSize);
+                return false;
+            }
+            std::memcpy(lMapped, InData, InSize);
+            vmaFlushAllocation(lAllocator, lAlloc, 0, VK_WHOLE_SIZE);
+
+            if (!OpenBatch())
+            {
+                vmaDestroyBuffer(lAllocator, lBuffer, lAlloc);
+                return false;
+            }
+            m_Open.Dedicated.emplace_back(lBuffer, lAlloc);
+            OutBuffer = lBuffer;
+            OutOffset = 0;
+            return true;
+        }
+
+        Uint64 lOffset = 0;
+        while (!m_RingOffsets.Allocate(InSize, StagingAlignment, lOffset))
+        {
+            // Ring full of not-yet-executed uploads: submit what is pending, then wait for the
+            // oldest batch only — the rest keep running.
+            Flush();
+            if (m_InFlight.empty())
+            {
+                OPAAX_CORE_ERROR("VulkanUploadManager: staging ring cannot fit {} bytes.", InSize);
+                return false;
+            }
+            WaitOldest();
+            ++m_StallCount;
+        }
+
+        std::memcpy(m_RingMapped + lOffset, InData, InSize);
+        vmaFlushAllocation(lAllocator, m_RingAlloc, lOffset, InSize);
+        OutBuffer = m_Ring;
+        OutOffset = lOffset;
+        return true;
+    }
+
+    VkCommandBuffer VulkanUploadManager::OpenBatch()
+    {
+        if (m_Open.Cmd)
+        {
+            return m_Open.Cmd;
+        }
+
+        const VkDevice lDevice = m_Device.GetDevice();
+        if (!m_Free.empty())
+        {
+            m_Open = Move(m_Free.back());
+            m_Free.pop_back();
+            vkResetFences(lDevice, 1, &m_Open.Fence);
+            vkResetCommandBuffer(m_Open.Cmd, 0);
+        }
+        else
+        {
+            VkCommandBufferAllocateInfo lAllocInfo{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            lAllocInfo.commandPool        = m_Pool;
+            lAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            lAllocInfo.commandBufferCount = 1;
+
+            VkFenceCreateInfo lFenceInfo{ VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            if (vkAllocateCommandBuffers(lDevice, &lAllocInfo, &m_Open.Cmd) != VK_SUCCESS
+                || vkCreateFence(lDevice, &lFenceInfo, nullptr, &m_Open.Fence) != VK_SUCCESS)
+            {
+                OPAAX_CORE_ERROR("VulkanUploadManager: failed to allocate an upload batch.");
+                if (m_Open.Cmd) { vkFreeCommandBuffers(lDevice, m_Pool, 1, &m_Open.Cmd); }
+                m_Open = {};
+                return VK_NULL_HANDLE;
+            }
+        }
+
+        VkCommandBufferBeginInfo lBegin{ VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        lBegin.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        vkBeginCommandBuffer(m_Open.Cmd, &lBegin);
+
+        m_Open.Serial = m_NextSerial++;
+        return m_Open.Cmd;
+    }
+
+    void VulkanUploadManager::Flush()
+    {
+        if (m_Open.Cmd)
+        {
+            vkEndCommandBuffer(m_Open.Cmd);
+            m_RingOffsets.Close(m_Open.Serial);
+
+            VkSubmitInfo lSubmit{ VK_STRUCTURE_TYPE_SUBMIT_INFO };
+            lSubmit.commandBufferCount = 1;
+            lSubmit.pCommandBuffers    = &m_Open.Cmd;
+            if (vkQueueSubmit(m_Device.GetGraphicsQueue(), 1, &lSubmit, m_Open.Fence) != VK_SUCCESS)
+            {
+                // Nothing will signal the fence; treat as executed so waiters and the ring move on.
+                OPAAX_CORE_ERROR("VulkanUploadManager: upload batch {} submit failed.", m_Open.Serial);
+                m_CompletedSerial = m_Open.Serial;
+                m_RingOffsets.Retire(m_Open.Serial);
+                Release(m_Open);
+                m_Free.push_back(Move(m_Open));
+            }
+            else
+            {
+                m_InFlight.push_back(Move(m_Open));
+                ++m_SubmitCount;
+            }
+            m_Open = {};
+        }
+
+        RetireCompleted();
+    }
+
+    void VulkanUploadManager::Wait(Uint64 InSerial)
+    {
+        if (InSerial == 0 || IsComplete(InSerial))
+        {
+            return;
+        }
+        if (m_Open.Cmd && m_Open.Serial <= InSerial)
+        {
+            Flush();
+        }
+        while (!IsComplete(InSerial) && !m_InFlight.empty())
+        {
+            WaitOldest();
+        }
+    }
+
+    void VulkanUploadManager::RetireCompleted()
+    {
+        const VkDevice lDevice = m_Device.GetDevice();
+
+        // Same queue, so batches finish in submission order: stop at the first unsignalled fence.
+        size_t lRetired = 0;
+        for (; lRetired < m_InFlight.size(); ++lRetired)
+        {
+            Batch& lBatch = m_InFlight[lRetired];
+            if (vkGetFenceStatus(lDevice, lBatch.Fence) != VK_SUCCESS)
+            {
+                break;
+            }
+            m_CompletedSerial = lBatch.Serial;
+            m_RingOffsets.Retire(lBatch.Serial);
+            Release(lBatch);
+            m_Free.push_back(Move(lBatch));
+        }
+        m_InFlight.erase(m_InFlight.begin(), m_InFlight.begin() + static_cast<std::ptrdiff_t>(lRetired));
+    }
+
+    void VulkanUploadManager::WaitOldest()
+    {
+        if (m_InFlight.empty())
+        {
+            return;
+        }
+        vkWaitForFences(m_Device.GetDevice(), 1, &m_InFlight.front().Fence, VK_TRUE, UINT64_MAX);
+        RetireCompleted();
+    }
+
+    void VulkanUploadManager::Release(Batch& InBatch)
+    {
+        for (const auto& [lBuffer, lAlloc] : InBatch.Dedicated)
+        {
+            vmaDestroyBuffer(m_Device.GetAllocator(), lBuffer, lAlloc);
+        }
+        InBatch.Dedicated.clear();
+    }
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_VULKAN
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Core/OpaaxTypes.h"
+
+#if OPAAX_HAS_VULKAN
+
+#include "VulkanStagingRing.h"
+
+#include <vulkan/vulkan.h>
+#include <vma/vk_mem_alloc.h>
+
+#include <utility>
+
+namespace Opaax
+{
+    class VulkanDevice;
+
+    // =============================================================================
+    // VulkanUploadManager
+    // =============================================================================
+    /**
+     * @class VulkanUploadManager
+     *
+     * Asynchronous host -> device image uploads. Pixels are copied into a persistent, mapped
+     * staging ring and the copy + layout transitions are recorded into the OPEN upload batch — no
+     * submit, no wait. Flush() submits the batch on the graphics queue with its own fence;
+     * VulkanRenderAPI calls it right before each frame submit, so everything created since the last
+     * frame (a whole level's textures) goes out in one vkQueueSubmit, ahead of the draws that
+     * sample it. Queue submission order + the TRANSFER -> FRAGMENT_SHADER barrier in the batch is
+     * the GPU-side dependency; the fence only drives CPU-side retirement of ring space.
+     *
+     * Uploads larger than the ring get a dedicated staging buffer, freed with their batch. When the
+     * ring is full the manager flushes and waits on the OLDEST in-flight batch only.
+     *
+     * Main thread only (the same thread that creates textures and runs the frame loop). The one
+     * exception is Texture2D's re-upload of an evicted texture, which may run on a parallel pass
+     * recorder; it is serialized by Texture2D's lock while the main thread waits on the recording.
+     * Owned by VulkanDevice.
+     */
+    class VulkanUploadManager
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        explicit VulkanUploadManager(VulkanDevice& InDevice);
+        ~VulkanUploadManager();
+
+        VulkanUploadManager(const VulkanUploadManager&)            = delete;
+        VulkanUploadManager& operator=(const VulkanUploadManager&) = delete;
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /**
+         * Stage InData (tightly packed, InSize bytes) and record its copy into InImage (mip 0, layer 0,
+         * currently UNDEFINED), leaving it SHADER_READ_ONLY_OPTIMAL.
+         * @return the batch serial the upload completes with (for Wait / IsComplete), 0 on failure.
+         */
+        Uint64 UploadImage(VkImage InImage, const void* InData, VkDeviceSize InSize, Uint32 InWidth, Uint32 InHeight);
+
+        /**
+         * UploadImage for a whole mip chain staged in one go: level i starts at InLevelOffsets[i]
+         * in InData (largest first, block-aligned) and is InWidth/InHeight >> i. Every level ends
+         * SHADER_READ_ONLY_OPTIMAL. @return the batch serial, 0 on failure.
+         */
+        Uint64 UploadImageMips(VkImage InImage, const void* InData, VkDeviceSize InSize, Uint32 InWidth, Uint32 InHeight,
+                               Uint32 InMipCount, const VkDeviceSize* InLevelOffsets);
+
+        // Submit the open batch (if it recorded anything) and retire batches whose fence signalled.
+        void Flush();
+
+        // Block until InSerial's batch has executed — flushes it first if still open. For resource
+        // teardown (an image must not be destroyed under a pending copy).
+        void Wait(Uint64 InSerial);
+
+        bool IsComplete(Uint64 InSerial) const noexcept { return InSerial <= m_CompletedSerial; }
+
+    private:
+        struct Batch
+        {
+            VkCommandBuffer Cmd    = VK_NULL_HANDLE;
+            VkFence         Fence  = VK_NULL_HANDLE;
+            Uint64          Serial = 0;
+            TDynArray<std::pair<VkBuffer, VmaAllocation>> Dedicated;   // oversized staging, freed on retire
+        };
+
+        // Lazily open a batch (recycling a retired one) and return its command buffer.
+        VkCommandBuffer OpenBatch();
+        void            RetireCompleted();
+        void            WaitOldest();
+        void            Release(Batch& InBatch);
+
+        // Stage InSize bytes; OutBuffer/OutOffset say where the copy reads from.
+        bool Stage(const void* InData, VkDeviceSize InSize, VkBuffer& OutBuffer, VkDeviceSize& OutOffset);
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        VulkanDevice&     m_Device;
+        VkCommandPool     m_Pool         = VK_NULL_HANDLE;
+
+        VkBuffer          m_Ring         = VK_NULL_HANDLE;
+        VmaAllocation     m_RingAlloc    = nullptr;
+        Uint8*            m_RingMapped   = nullptr;
+        VulkanStagingRing m_RingOffsets;
+
+        Batch             m_Open;                      // Cmd == null -> no batch open
+        TDynArray<Batch>  m_InFlight;                  // submission order
+        TDynArray<Batch>  m_Free;                      // retired, cmd/fence reusable
+
+        Uint64            m_NextSerial      = 1;
+        Uint64            m_CompletedSerial = 0;
+
+        Uint64            m_UploadCount  = 0;
+        Uint64            m_UploadBytes  = 0;
+        Uint64            m_SubmitCount  = 0;
+        Uint64            m_StallCount   = 0;          // ring-full waits
+    };
+
+} // namespace Opaax
+
+#endif // OPAAX_HAS_VULKAN
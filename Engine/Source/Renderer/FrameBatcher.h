@@ -122,4 +122,39 @@ namespace Opaax
 
         return lBatch + 1;
     }
+
+    /**
+     * Split one batch of InQuadCount consecutive quads into indexed draws of at most
+     * InMaxQuadsPerDraw quads each — the shape of an indirect draw buffer when the batch outgrows
+     * the shared quad index buffer. Every draw reuses the same index range (FirstIndex 0) and is
+     * rebased onto its quads through VertexOffset (= first quad * 4).
+     *
+     * TDrawCommand is any struct with IndexCount / InstanceCount / FirstIndex / VertexOffset /
+     * FirstInstance (DrawIndexedIndirectCommand in the renderer) — templated so this stays RHI-free.
+     *
+     * @param InQuadCount       quads in the batch
+     * @param InMaxQuadsPerDraw quads the index buffer covers (MAX_QUADS); clamped to >= 1
+     * @param OutDraws          [out] ceil(InQuadCount / InMaxQuadsPerDraw) entries
+     * @return number of draws written (0 when InQuadCount == 0)
+     */
+    //------------------------------------------------------------------------------
+    template<typename TDrawCommand>
+    Uint32 BuildQuadDraws(Uint32 InQuadCount, Uint32 InMaxQuadsPerDraw, TDrawCommand* OutDraws)
+    {
+        if (InMaxQuadsPerDraw < 1) { InMaxQuadsPerDraw = 1; }
+
+        Uint32 lDraws = 0;
+        for (Uint32 lFirstQuad = 0; lFirstQuad < InQuadCount; lFirstQuad += InMaxQuadsPerDraw)
+        {
+            const Uint32 lQuads = (InQuadCount - lFirstQuad < InMaxQuadsPerDraw) ? InQuadCount - lFirstQuad
+                                                                                 : InMaxQuadsPerDraw;
+            TDrawCommand& lDraw = OutDraws[lDraws++];
+            lDraw.IndexCount    = lQuads * 6;
+            lDraw.InstanceCount = 1;
+            lDraw.FirstIndex    = 0;
+            lDraw.VertexOffset  = static_cast<decltype(lDraw.VertexOffset)>(lFirstQuad * 4);
+            lDraw.FirstInstance = 0;
+        }
+        return lDraws;
+    }
 }
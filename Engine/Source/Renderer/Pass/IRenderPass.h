@@ -17,8 +17,10 @@ namespace Opaax
      * Adding a render feature = writing a pass class + registering it on the pipeline.
      * Built-ins: WorldRenderPass (world camera), OverlayRenderPass (screen space).
      *
-     * Submission stays on the GL thread; a pass may use the Job system for off-thread
-     * prep but must issue draw calls from Execute.
+     * Submission stays on the render thread: a pass may use the Job system for off-thread
+     * prep but must issue draw calls from Execute. A pass that opts into CanRecordInParallel may
+     * have that Execute itself run on a job worker, recording into a secondary command buffer the
+     * pipeline then executes in order from the primary.
      */
     class OPAAX_API IRenderPass
     {
@@ -34,5 +36,11 @@ namespace Opaax
     public:
         virtual void        Execute(const RenderContext& InContext) = 0;
         virtual const char* GetName() const                         = 0;
+
+        // True if Execute may run on a job worker, recording into InContext.Cmd (a secondary)
+        // concurrently with the other passes. Such a pass opens exactly one render pass, and only
+        // touches concurrency-safe state — Renderer2D, Text2D and the RHI are; mutating the World
+        // or the asset registry is not. Ignored (serial) on backends without secondaries.
+        virtual bool CanRecordInParallel() const { return false; }
     };
 }
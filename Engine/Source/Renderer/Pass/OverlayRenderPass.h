@@ -31,7 +31,8 @@ namespace Opaax
         //~Begin IRenderPass interface
     public:
         void        Execute(const RenderContext& InContext) override;
-        const char* GetName() const override { return "OverlayRenderPass"; }
+        const char* GetName() const             override { return "OverlayRenderPass"; }
+        bool        CanRecordInParallel() const override { return true; }
         //~End IRenderPass interface
 
         // =============================================================================
@@ -2,7 +2,15 @@
 
 #include "World/RenderContext.h"
 #include "RHI/RenderCommand.h"
+#include "RHI/ICommandBuffer.h"
+#include "Renderer/Renderer2D.h"
+#include "Renderer/RenderStats.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/Jobs/JobSubsystem.h"
+#include "Core/Log/OpaaxLog.h"
 
+#include <algorithm>
+#include <chrono>
 #include <utility>
 
 namespace Opaax
@@ -11,23 +19,188 @@ namespace Opaax
     {
         if (InPass)
         {
+            if (!m_GpuTimer)
+            {
+                m_GpuTimer = ITimestampQueryPool::Create(RenderStats::MaxPasses * 2u);
+            }
             m_Passes.push_back(std::move(InPass));
         }
     }
 
     void RenderPipeline::Execute(IRenderTarget& InTarget, double InAlpha)
+    {
+        if (CanExecuteInParallel()) { ExecuteParallel(InTarget, InAlpha); }
+        else                        { ExecuteSerial(InTarget, InAlpha); }
+    }
+
+    bool RenderPipeline::CanExecuteInParallel()
+    {
+        if (!m_Jobs || m_Jobs->GetWorkerCount() == 0 || !EngineConfig::ParallelPassRecording()) { return false; }
+
+        bool lAnyParallel = false;
+        for (const auto& lPass : m_Passes) { lAnyParallel |= lPass->CanRecordInParallel(); }
+        if (!lAnyParallel) { return false; }
+
+        // One secondary + one Renderer2D recording context per pass, or the whole frame stays serial.
+        const Uint64 lPassCount = m_Passes.size();
+        if (RenderCommand::GetSecondaryCommandBufferCount() < lPassCount
+            || Renderer2D::GetMaxConcurrentRecordings() < lPassCount)
+        {
+            if (!m_bWarnedFallback && RenderCommand::GetSecondaryCommandBufferCount() > 0)
+            {
+                OPAAX_CORE_WARN("RenderPipeline: {} passes exceed the backend's {} secondary recorders "
+                                "({} Renderer2D contexts) — recording serially.",
+                                lPassCount, RenderCommand::GetSecondaryCommandBufferCount(),
+                                Renderer2D::GetMaxConcurrentRecordings());
+                m_bWarnedFallback = true;
+            }
+            return false;
+        }
+        return true;
+    }
+
+    void RenderPipeline::ExecuteSerial(IRenderTarget& InTarget, double InAlpha)
     {
         // The frame's command buffer (opened by RenderCommand::BeginFrame in the run loop)
         // is threaded to every pass through the context.
-        const RenderContext lContext{ InTarget, RenderCommand::GetCommandBuffer(), InAlpha };
+        ICommandBuffer&     lCmd = RenderCommand::GetCommandBuffer();
+        const RenderContext lContext{ InTarget, lCmd, InAlpha };
+
+        // Collect the timestamp slot's old results + reset it — outside any render pass.
+        if (m_GpuTimer) { m_GpuTimer->BeginFrame(lCmd); }
+
         for (const auto& lPass : m_Passes)
         {
+            const Uint32 lGpuBegin = m_GpuTimer ? m_GpuTimer->WriteTimestamp(lCmd) : ITimestampQueryPool::InvalidQuery;
+            const auto   lCpuStart = std::chrono::steady_clock::now();
+
             lPass->Execute(lContext);
+
+            RenderPassTiming lTiming;
+            lTiming.Name      = lPass->GetName();
+            lTiming.CpuMicros = std::chrono::duration<double, std::micro>(
+                                    std::chrono::steady_clock::now() - lCpuStart).count();
+
+            // Passes run in a fixed order, so this frame's indices name the same pass in the
+            // resolved (older) frame the pool reads from.
+            const Uint32 lGpuEnd = m_GpuTimer ? m_GpuTimer->WriteTimestamp(lCmd) : ITimestampQueryPool::InvalidQuery;
+            lTiming.GpuMicros    = m_GpuTimer ? m_GpuTimer->GetElapsedMicros(lGpuBegin, lGpuEnd) : 0.0;
+
+            Renderer2D::RecordPassTiming(lTiming);
+        }
+    }
+
+    // One frame's parallel recording. Passes are claimed through Next by whichever thread gets
+    // there first, the calling thread included; a helper job that only runs once every pass is
+    // claimed returns at once. Jobs hold the state by SharedPtr so such a late job stays safe, and
+    // the pipeline reuses it once no job refers to it any more.
+    struct RenderPipeline::ParallelRecord
+    {
+        TDynArray<Uint32>       Passes;     // indices of the CanRecordInParallel passes
+        TFunction<void(Uint32)> Record;     // records pass i into secondary i
+        Atomic<Uint32>          Next{ 0 };  // next Passes slot to claim
+        Atomic<Uint32>          Done{ 0 };  // passes recorded
+        Mutex                   DoneMutex;
+        ConditionVariable       DoneCV;     // notified when Done reaches Passes.size()
+
+        // Claim and record passes until none are left.
+        void Help()
+        {
+            const Uint32 lCount = static_cast<Uint32>(Passes.size());
+            for (Uint32 lSlot = Next.fetch_add(1, std::memory_order_relaxed); lSlot < lCount;
+                 lSlot = Next.fetch_add(1, std::memory_order_relaxed))
+            {
+                Record(Passes[lSlot]);
+
+                // Notify under the lock so the waiter cannot check Done and sleep in between.
+                if (Done.fetch_add(1, std::memory_order_acq_rel) + 1 == lCount)
+                {
+                    LockGuard<Mutex> lLock(DoneMutex);
+                    DoneCV.notify_all();
+                }
+            }
+        }
+    };
+
+    void RenderPipeline::ExecuteParallel(IRenderTarget& InTarget, double InAlpha)
+    {
+        ICommandBuffer& lCmd = RenderCommand::GetCommandBuffer();
+        if (m_GpuTimer) { m_GpuTimer->BeginFrame(lCmd); }
+
+        const Uint32 lPassCount = static_cast<Uint32>(m_Passes.size());
+        m_RecordMicros.assign(lPassCount, 0.0);
+
+        // Pass i always records into secondary i. Each recording writes only its own m_RecordMicros slot.
+        auto lRecord = [this, &InTarget, InAlpha](Uint32 InIndex)
+        {
+            const RenderContext lContext{ InTarget, *RenderCommand::GetSecondaryCommandBuffer(InIndex), InAlpha };
+            const auto          lCpuStart = std::chrono::steady_clock::now();
+
+            m_Passes[InIndex]->Execute(lContext);
+
+            m_RecordMicros[InIndex] = std::chrono::duration<double, std::micro>(
+                                          std::chrono::steady_clock::now() - lCpuStart).count();
+        };
+
+        // A stale job from an earlier frame may still hold the last state — start a fresh one then.
+        if (!m_Record || m_Record.use_count() > 1) { m_Record = MakeShared<ParallelRecord>(); }
+        ParallelRecord& lShared = *m_Record;
+        lShared.Passes.clear();
+        lShared.Next.store(0, std::memory_order_relaxed);
+        lShared.Done.store(0, std::memory_order_relaxed);
+        lShared.Record = lRecord;
+        for (Uint32 i = 0; i < lPassCount; ++i)
+        {
+            if (m_Passes[i]->CanRecordInParallel()) { lShared.Passes.push_back(i); }
+        }
+
+        // One helper per worker at most; each records passes until none are left to claim.
+        const Uint32 lParallel = static_cast<Uint32>(lShared.Passes.size());
+        const Uint32 lHelpers  = std::min(lParallel, m_Jobs->GetWorkerCount());
+        for (Uint32 i = 0; i < lHelpers; ++i)
+        {
+            m_Jobs->Submit([lState = m_Record] { lState->Help(); });
+        }
+
+        // Passes that must stay on this thread record meanwhile, still into their own secondary.
+        for (Uint32 i = 0; i < lPassCount; ++i)
+        {
+            if (!m_Passes[i]->CanRecordInParallel()) { lRecord(i); }
+        }
+
+        // Then this thread records whatever no worker has picked up, and waits only for the
+        // passes a worker is recording right now.
+        lShared.Help();
+        {
+            UniqueLock<Mutex> lLock(lShared.DoneMutex);
+            lShared.DoneCV.wait(lLock, [&lShared, lParallel]
+            {
+                return lShared.Done.load(std::memory_order_acquire) == lParallel;
+            });
+        }
+        lShared.Record = nullptr;   // drops the frame-local captures before a stale job could see them
+
+        // Replay in registration order — the GPU sees exactly the serial pass order.
+        for (Uint32 i = 0; i < lPassCount; ++i)
+        {
+            const Uint32 lGpuBegin = m_GpuTimer ? m_GpuTimer->WriteTimestamp(lCmd) : ITimestampQueryPool::InvalidQuery;
+
+            lCmd.ExecuteSecondary(*RenderCommand::GetSecondaryCommandBuffer(i));
+
+            const Uint32 lGpuEnd = m_GpuTimer ? m_GpuTimer->WriteTimestamp(lCmd) : ITimestampQueryPool::InvalidQuery;
+
+            RenderPassTiming lTiming;
+            lTiming.Name      = m_Passes[i]->GetName();
+            lTiming.CpuMicros = m_RecordMicros[i];
+            lTiming.GpuMicros = m_GpuTimer ? m_GpuTimer->GetElapsedMicros(lGpuBegin, lGpuEnd) : 0.0;
+
+            Renderer2D::RecordPassTiming(lTiming);
         }
     }
 
     void RenderPipeline::Clear()
     {
         m_Passes.clear();
+        m_GpuTimer.reset();
     }
 }
@@ -3,10 +3,12 @@
 #include "Core/EngineAPI.h"
 #include "Core/OpaaxTypes.h"
 #include "Renderer/Pass/IRenderPass.h"
+#include "RHI/QueryPool.h"
 
 namespace Opaax
 {
     class IRenderTarget;
+    class JobSubsystem;
 
     /**
      * @class RenderPipeline
@@ -18,6 +20,21 @@ namespace Opaax
      *
      * IRenderPass is included (not forward-declared) so the UniquePtr element type is complete:
      * keeps dtor/move implicit and the member self-contained.
+     *
+     * Each pass is bracketed by a CPU wall-clock timer and a pair of GPU timestamps (owned
+     * ITimestampQueryPool); the per-pass result goes to Renderer2D::RecordPassTiming and shows up
+     * in RenderStats one frame late (GPU: a few frames late, once the queries resolve).
+     *
+     * Parallel recording (render.parallelPassRecording, a job system set, and a backend with one
+     * secondary command buffer + one Renderer2D context per pass): each pass records into its own
+     * secondary — CanRecordInParallel passes on job workers, the rest on the calling thread — then
+     * the secondaries are executed into the primary in registration order, so the GPU sees the
+     * same pass order as the serial path. GPU timestamps bracket each ExecuteSecondary.
+     *
+     * The job queue is shared with asset decodes, font bakes and scans, so a recording job may sit
+     * behind long work. The calling thread therefore never just waits: after its own passes it
+     * records every parallel pass no worker has started yet, and waits only for those in progress.
+     * Worst case, the frame records serially on the calling thread.
      */
     class OPAAX_API RenderPipeline
     {
@@ -40,19 +57,39 @@ namespace Opaax
         // Function
         // =============================================================================
     public:
-        // Append a pass to the end of the execution order.
+        // Append a pass to the end of the execution order. The first pass also creates the GPU
+        // timestamp pool (the render API — and so the backend — exists by then).
         void AddPass(UniquePtr<IRenderPass> InPass);
 
         // Run every pass in order. InTarget is the frame's final render target.
         void Execute(IRenderTarget& InTarget, double InAlpha);
 
-        // Drop all passes (subsystem shutdown).
+        // Drop all passes + the timestamp pool (subsystem shutdown, before the render API).
         void Clear();
 
+        // Job system used for parallel pass recording. Null = always serial.
+        void SetJobSystem(JobSubsystem* InJobs) noexcept { m_Jobs = InJobs; }
+
+    private:
+        // True if this frame can take the parallel path (see class doc).
+        bool CanExecuteInParallel();
+
+        void ExecuteSerial  (IRenderTarget& InTarget, double InAlpha);
+        void ExecuteParallel(IRenderTarget& InTarget, double InAlpha);
+
+        // Pass claiming shared by the calling thread and the frame's helper jobs (see the .cpp).
+        struct ParallelRecord;
+
         // =============================================================================
         // Members
         // =============================================================================
     private:
         TDynArray<UniquePtr<IRenderPass>> m_Passes;
+        UniquePtr<ITimestampQueryPool>    m_GpuTimer;   // 2 timestamps per pass (begin/end)
+
+        JobSubsystem*             m_Jobs = nullptr;          // borrowed (engine-owned subsystem)
+        SharedPtr<ParallelRecord> m_Record;                  // per-frame state, parallel path
+        TDynArray<double>         m_RecordMicros;            // CPU record time per pass, parallel path
+        bool                      m_bWarnedFallback = false; // more passes than secondaries, logged once
     };
 }
@@ -32,7 +32,8 @@ namespace Opaax
         //~Begin IRenderPass interface
     public:
         void        Execute(const RenderContext& InContext) override;
-        const char* GetName() const override { return "WorldRenderPass"; }
+        const char* GetName() const             override { return "WorldRenderPass"; }
+        bool        CanRecordInParallel() const override { return true; }
         //~End IRenderPass interface
 
         // =============================================================================
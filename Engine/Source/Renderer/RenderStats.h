@@ -8,6 +8,18 @@ namespace Opaax
     // Render stats
     // =============================================================================
 
+    /**
+     * One IRenderPass's timings. CpuMicros is the wall time of the pass's Execute on the render
+     * thread; GpuMicros is the timestamp-query delta around it, resolved a few frames late (0 when
+     * the backend has no timestamp support or the result is not back yet).
+     */
+    struct RenderPassTiming
+    {
+        const char* Name      = nullptr;   // IRenderPass::GetName() — static string
+        double      CpuMicros = 0.0;
+        double      GpuMicros = 0.0;
+    };
+
     /**
      * Per-frame renderer counters, accumulated across every Renderer2D Begin/End pass in a frame and
      * surfaced one frame late (so the stats overlay's own draws never perturb the numbers it shows).
@@ -15,12 +27,29 @@ namespace Opaax
      */
     struct RenderStats
     {
+        static constexpr Uint32 MaxPasses = 8;   // pass timings past this are dropped
+
         Uint32 Quads            = 0;   // quads submitted this frame
-        Uint32 DrawCalls        = 0;   // == Batches (one indexed draw per batch)
+        Uint32 DrawCalls        = 0;   // == Batches (one DrawIndexed or DrawIndexedIndirect per batch)
         Uint32 Batches          = 0;   // batches emitted (split on quad/slot pressure)
+        Uint32 IndirectDraws    = 0;   // draws packed into DrawIndexedIndirect submissions
         Uint32 PeakTextureSlots = 0;   // most distinct slots (incl. white) used by a single batch
         Uint32 RingHighWater    = 0;   // peak Vulkan descriptor-ring cursor this frame (0 on OpenGL)
         Uint32 CommandCapacity  = 0;   // persistent command-list capacity (realloc watch)
-        double SortMicros       = 0.0; // total time spent in the frame-global sort, microseconds
+        Uint64 FrameMemHighWater = 0;  // peak transient GPU bytes (vertex + UBO) this frame (0 on OpenGL)
+        Uint64 FrameMemCapacity  = 0;  // transient GPU bytes reserved for the frame slot (page growth watch)
+        Uint32 StateIssued      = 0;   // binds / texture units / descriptor writes that reached the API
+        Uint32 StateSkipped     = 0;   // ... filtered out as redundant by the command buffer
+
+        // CPU phase breakdown, microseconds, summed over every Begin/End in the frame.
+        double RecordMicros     = 0.0; // Begin -> End: DrawQuad/DrawSprite recording (incl. caller work)
+        double SortMicros       = 0.0; // frame-global stable sort
+        double AssignMicros     = 0.0; // AssignBatches (pure slot/batch assignment)
+        double GatherMicros     = 0.0; // copying sorted vertices into the staging buffer
+        double UploadMicros     = 0.0; // vertex SetData + bind-group texture writes + draw submit
+
+        // Per-pass timings, in RenderPipeline registration order.
+        RenderPassTiming Passes[MaxPasses] = {};
+        Uint32           PassCount         = 0;
     };
 }
@@ -11,6 +11,7 @@
 #include "World/IOverlayRenderSystem.h"
 #include "Core/Config/EngineConfig.h"
 #include "Core/Log/OpaaxLog.h"
+#include "Core/Jobs/JobSubsystem.h"
 
 #include "Core/CoreEngineApp.h"
 #include "Core/Window.h"
@@ -58,6 +59,10 @@ namespace Opaax
         m_Pipeline.AddPass(MakeUnique<WorldRenderPass>(GetEngineApp()));
         m_Pipeline.AddPass(MakeUnique<OverlayRenderPass>(GetEngineApp()));
 
+        // Workers for parallel pass recording (render.parallelPassRecording). The job subsystem is
+        // registered first, so it is already up.
+        m_Pipeline.SetJobSystem(GetEngineApp() ? GetEngineApp()->GetSubsystem<JobSubsystem>() : nullptr);
+
         // Engine-owned render-stats overlay — registered only when enabled in config (no runtime key
         // yet; a live toggle is a future CVar/console milestone). Reports engine state, so the engine
         // registers it, not game code.
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <mutex>
 
 namespace Opaax
 {
@@ -26,9 +27,16 @@ namespace Opaax
     // Batch constants
     // =============================================================================
     static constexpr Uint32 MAX_QUADS         = 1000; // per-BATCH emission cap (not a frame cap)
-    static constexpr Uint32 MAX_VERTICES      = MAX_QUADS * 4;
     static constexpr Uint32 MAX_INDICES       = MAX_QUADS * 6;
+    // Quad cap of one texture group when the backend takes indirect draws: the group shares one slot
+    // table and is submitted as ceil(quads / MAX_QUADS) draws in a single DrawIndexedIndirect.
+    static constexpr Uint32 MAX_GROUP_QUADS    = MAX_QUADS * 16;
+    static constexpr Uint32 MAX_GROUP_VERTICES = MAX_GROUP_QUADS * 4;
     static constexpr Uint32 MAX_TEXTURE_SLOTS = 16;   // minimum guaranteed by OpenGL 3.3
+
+    // Added to a vertex's TexIndex to select the distance-field path in Sprite.glsl. Keeping the
+    // mode in the vertex (not a second pipeline) lets SDF text batch with sprites in one draw.
+    static constexpr float  DISTANCE_FIELD_TEX_INDEX_BIAS = static_cast<float>(MAX_TEXTURE_SLOTS);
     
     // =============================================================================
     // Vertex layout
@@ -38,14 +46,15 @@ namespace Opaax
         Vector3F Position;     // world space XYZ (Z = 0 for 2D)
         Vector4F Color;        // RGBA tint
         Vector2F TexCoord;     // UV
-        float    TexIndex;     // texture slot index (float for shader compatibility)
+        float    TexIndex;     // texture slot index, + DISTANCE_FIELD_TEX_INDEX_BIAS for SDF (float for shader compatibility)
     };
     
     // =============================================================================
     // Recorded draw command
     //
     // One per DrawQuad/DrawSprite. Corners/UV/color are computed at record time; the texture SLOT is
-    // resolved later, at emit, so the recorded TexIndex is a placeholder overwritten in EmitFrame.
+    // resolved later, at emit, so the recorded TexIndex only carries the shading-mode bias (0 or
+    // DISTANCE_FIELD_TEX_INDEX_BIAS) and EmitFrame adds the slot to it.
     // =============================================================================
     struct QuadCommand
     {
@@ -55,16 +64,18 @@ namespace Opaax
     };
  
     // =============================================================================
-    // Renderer2D internal state
+    // Recording context
+    //
+    // Everything one Begin/End recording writes. Begin binds a free context to the calling thread
+    // and End hands it back, so passes recorded in parallel (RenderPipeline, on job workers) each
+    // batch into their own VBO / camera UBO / bind group / command list and DrawQuad/DrawSprite
+    // take no lock. Serial recording reuses the first context pass after pass.
     // =============================================================================
-    struct Renderer2DData
+    struct Renderer2DContext
     {
         UniquePtr<IVertexArray>   QuadVAO;
         IVertexBuffer*            QuadVBO      = nullptr;  // non-owning, owned by VAO
-        UniquePtr<ShaderAsset>    QuadShader;
-        UniquePtr<Texture2D>      WhiteTexture;
-        UniquePtr<IUniformBuffer> CameraUBO;  // binding 1: u_ViewProjection (std140)
-        UniquePtr<IPipeline>      QuadPipeline;     // sprite pipeline (shader + layout + alpha blend)
+        UniquePtr<IUniformBuffer> CameraUBO;        // binding 1: u_ViewProjection (std140)
         UniquePtr<IBindGroup>     QuadBindGroup;    // camera UBO + 16-sampler array
         ICommandBuffer*           Cmd          = nullptr;  // active recorder, set in Begin (non-owning)
 
@@ -77,19 +88,157 @@ namespace Opaax
         TDynArray<BatchAssignment> Assign;
 
         // One batch's worth of upload-ready vertices, gathered in sorted order before each draw.
-        TFixedArray<QuadVertex, MAX_VERTICES>      SortedBuffer;
+        // Sized to MAX_GROUP_VERTICES in Init (a grouped batch can hold up to MAX_GROUP_QUADS).
+        TDynArray<QuadVertex>                      SortedBuffer;
+        // Indirect draw scratch for a grouped batch (BuildQuadDraws output).
+        TDynArray<DrawIndexedIndirectCommand>      IndirectDraws;
         // Current batch's slot -> texture map (slot 0 = white).
         TFixedArray<Texture2D*, MAX_TEXTURE_SLOTS> BatchTextures;
 
         glm::mat4 ViewProjection = glm::mat4(1.f);
+
+        // Start of the current Begin/End recording window (RecordMicros).
+        std::chrono::steady_clock::time_point RecordStart;
+
+        // This recording's counters, folded into the frame's stats at End.
+        RenderStats       Stats;
+        CommandStateStats StateAtBegin;   // Cmd's filter counters at Begin (a serial Cmd spans passes)
+
+        bool bInUse = false;
+    };
+
+    // Concurrent Begin/End recordings — matches the backends' secondary recorder count.
+    static constexpr Uint32 MAX_RECORD_CONTEXTS = 4;
+
+    // =============================================================================
+    // Renderer2D internal state
+    // =============================================================================
+    struct Renderer2DData
+    {
+        UniquePtr<ShaderAsset>    QuadShader;
+        UniquePtr<Texture2D>      WhiteTexture;
+        UniquePtr<IPipeline>      QuadPipeline;     // sprite pipeline (shader + layout + alpha blend)
+
+        // Contexts[0..ContextCount) are live; more than one only with parallel pass recording.
+        TFixedArray<Renderer2DContext, MAX_RECORD_CONTEXTS> Contexts;
+        Uint32                                              ContextCount = 0;
+        std::mutex                                          ContextMutex;   // acquire/release + stats merge
     };
  
     static Renderer2DData s_Data;
+
+    // The context the calling thread is recording into (between Begin and End).
+    static thread_local Renderer2DContext* t_Context = nullptr;
     
     // Stats: accumulate the in-flight frame, publish it one frame late (so the overlay's own draws
     // never perturb the numbers it displays). NewFrame() rolls accum -> last.
     static RenderStats s_StatsAccum;
     static RenderStats s_StatsLast;
+
+    namespace
+    {
+        FORCEINLINE double MicrosSince(std::chrono::steady_clock::time_point InStart)
+        {
+            return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - InStart).count();
+        }
+
+        // One context's GPU-side batch state: VAO + dynamic VBO (sized to one grouped batch — the
+        // staging upload unit), the static quad index buffer, its camera UBO and bind group.
+        void InitContext(Renderer2DContext& OutContext)
+        {
+            OutContext.QuadVAO = IVertexArray::Create();
+
+            OutContext.SortedBuffer.resize(MAX_GROUP_VERTICES);
+            OutContext.IndirectDraws.resize((MAX_GROUP_QUADS + MAX_QUADS - 1) / MAX_QUADS);
+            auto lVBO = IVertexBuffer::Create(MAX_GROUP_VERTICES * sizeof(QuadVertex));
+            lVBO->SetLayout({
+                { EShaderDataType::Float3 },  // Position
+                { EShaderDataType::Float4 },  // Color
+                { EShaderDataType::Float2 },  // TexCoord
+                { EShaderDataType::Float  },  // TexIndex
+            });
+
+            // Store raw ptr before ownership transfer — needed for SetData on emit
+            OutContext.QuadVBO = lVBO.get();
+            OutContext.QuadVAO->AddVertexBuffer(Move(lVBO));
+
+            // --- Static index buffer — indices never change for quads ---
+            TFixedArray<Uint32, MAX_INDICES> lIndices;
+            Uint32 lOffset = 0;
+            for (Uint32 i = 0; i < MAX_INDICES; i += 6)
+            {
+                // Two triangles per quad: 0 1 2  2 3 0
+                lIndices[i + 0] = lOffset + 0;
+                lIndices[i + 1] = lOffset + 1;
+                lIndices[i + 2] = lOffset + 2;
+                lIndices[i + 3] = lOffset + 2;
+                lIndices[i + 4] = lOffset + 3;
+                lIndices[i + 5] = lOffset + 0;
+                lOffset += 4;
+            }
+            OutContext.QuadVAO->SetIndexBuffer(
+                IIndexBuffer::Create(lIndices.data(), MAX_INDICES));
+
+            OutContext.BatchTextures[0] = s_Data.WhiteTexture.get();
+
+            // Persistent record capacity — the frame list grows past MAX_QUADS now; reserve up front
+            // so a typical frame never reallocates (CommandCapacity in stats watches this).
+            OutContext.Commands.reserve(MAX_QUADS * 4);
+
+            // --- Camera UBO (binding 1) — sole source of u_ViewProjection, written each Begin.
+            //     Binding 1 (not 0) so it shares the Vulkan sprite descriptor set with the sampler
+            //     array at binding 0; GL is unaffected (separate UBO/texture namespaces).
+            OutContext.CameraUBO = IUniformBuffer::Create(static_cast<Uint32>(sizeof(glm::mat4)), 1);
+
+            // --- Bind group: camera UBO (binding 1) + the 16-sampler array. The UBO is set once;
+            //     textures are (re)set each emit.
+            OutContext.QuadBindGroup = IBindGroup::Create(BindGroupLayout{ 1u, MAX_TEXTURE_SLOTS });
+            OutContext.QuadBindGroup->SetUniformBuffer(*OutContext.CameraUBO);
+        }
+
+        Renderer2DContext* AcquireContext()
+        {
+            std::scoped_lock lLock(s_Data.ContextMutex);
+            for (Uint32 i = 0; i < s_Data.ContextCount; ++i)
+            {
+                if (!s_Data.Contexts[i].bInUse)
+                {
+                    s_Data.Contexts[i].bInUse = true;
+                    return &s_Data.Contexts[i];
+                }
+            }
+            return nullptr;
+        }
+
+        // Fold one recording into the frame: counts add up; peaks and capacities take the max.
+        void MergeStats(RenderStats& InOutFrame, const RenderStats& InRecording)
+        {
+            InOutFrame.Quads             += InRecording.Quads;
+            InOutFrame.DrawCalls         += InRecording.DrawCalls;
+            InOutFrame.Batches           += InRecording.Batches;
+            InOutFrame.IndirectDraws     += InRecording.IndirectDraws;
+            InOutFrame.PeakTextureSlots   = std::max(InOutFrame.PeakTextureSlots,  InRecording.PeakTextureSlots);
+            InOutFrame.RingHighWater      = std::max(InOutFrame.RingHighWater,     InRecording.RingHighWater);
+            InOutFrame.CommandCapacity    = std::max(InOutFrame.CommandCapacity,   InRecording.CommandCapacity);
+            InOutFrame.FrameMemHighWater  = std::max(InOutFrame.FrameMemHighWater, InRecording.FrameMemHighWater);
+            InOutFrame.FrameMemCapacity   = std::max(InOutFrame.FrameMemCapacity,  InRecording.FrameMemCapacity);
+            InOutFrame.StateIssued       += InRecording.StateIssued;
+            InOutFrame.StateSkipped      += InRecording.StateSkipped;
+            InOutFrame.RecordMicros      += InRecording.RecordMicros;
+            InOutFrame.SortMicros        += InRecording.SortMicros;
+            InOutFrame.AssignMicros      += InRecording.AssignMicros;
+            InOutFrame.GatherMicros      += InRecording.GatherMicros;
+            InOutFrame.UploadMicros      += InRecording.UploadMicros;
+        }
+
+        void ReleaseContext(Renderer2DContext& InContext)
+        {
+            std::scoped_lock lLock(s_Data.ContextMutex);
+            MergeStats(s_StatsAccum, InContext.Stats);
+            InContext.Stats  = RenderStats{};
+            InContext.bInUse = false;
+        }
+    }
  
     // =============================================================================
     // Init / Shutdown
@@ -99,57 +248,15 @@ namespace Opaax
     {
         OPAAX_CORE_INFO("Renderer2D::Init()");
  
-        // --- VAO + dynamic VBO (sized to one batch — the staging upload unit) ---
-        s_Data.QuadVAO = IVertexArray::Create();
- 
-        auto lVBO = IVertexBuffer::Create(MAX_VERTICES * sizeof(QuadVertex));
-        lVBO->SetLayout({
-            { EShaderDataType::Float3 },  // Position
-            { EShaderDataType::Float4 },  // Color
-            { EShaderDataType::Float2 },  // TexCoord
-            { EShaderDataType::Float  },  // TexIndex
-        });
- 
-        // Store raw ptr before ownership transfer — needed for SetData on emit
-        s_Data.QuadVBO = lVBO.get();
-        s_Data.QuadVAO->AddVertexBuffer(Move(lVBO));
-
-        // --- Static index buffer — indices never change for quads ---
-        TFixedArray<Uint32, MAX_INDICES> lIndices;
-        Uint32 lOffset = 0;
-        for (Uint32 i = 0; i < MAX_INDICES; i += 6)
-        {
-            // Two triangles per quad: 0 1 2  2 3 0
-            lIndices[i + 0] = lOffset + 0;
-            lIndices[i + 1] = lOffset + 1;
-            lIndices[i + 2] = lOffset + 2;
-            lIndices[i + 3] = lOffset + 2;
-            lIndices[i + 4] = lOffset + 3;
-            lIndices[i + 5] = lOffset + 0;
-            lOffset += 4;
-        }
-        s_Data.QuadVAO->SetIndexBuffer(
-            IIndexBuffer::Create(lIndices.data(), MAX_INDICES));
- 
         // --- White 1x1 texture for solid colour quads (always slot 0) ---
-        s_Data.WhiteTexture     = MakeUnique<Texture2D>(1u, 1u);
-        s_Data.BatchTextures[0] = s_Data.WhiteTexture.get();
-        
-        // Persistent record capacity — the frame list grows past MAX_QUADS now; reserve up front so
-        // a typical frame never reallocates (CommandCapacity in stats watches this).
-        s_Data.Commands.reserve(MAX_QUADS * 4);
- 
+        s_Data.WhiteTexture = MakeUnique<Texture2D>(1u, 1u);
+
         // --- Shader ---
         // Batch shader loads from disk (asset pipeline) — direct path ctor, not AssetRegistry:
         // Init runs at RenderSubsystem::Startup, before the loader/manifest are guaranteed ready.
         const OpaaxString lShaderPath = EngineConfig::EngineAssetsRoot() + "/Shaders/Sprite.glsl";
         s_Data.QuadShader = MakeUnique<ShaderAsset>(lShaderPath, OPAAX_ID("Shaders/Sprite"));
 
-        // --- Camera UBO (binding 1) — sole source of u_ViewProjection, written each Begin.
-        //     Binding 1 (not 0) so it shares the Vulkan sprite descriptor set with the sampler
-        //     array at binding 0; GL is unaffected (separate UBO/texture namespaces).
-        s_Data.CameraUBO = IUniformBuffer::Create(static_cast<Uint32>(sizeof(glm::mat4)), 1);
-
         // --- Sprite pipeline: shader + vertex layout + alpha blend. VertexLayout is consumed by
         //     command-buffer backends (Vulkan); the GL VAO already encodes the layout.
         PipelineDesc lPipelineDesc;
@@ -165,21 +272,32 @@ namespace Opaax
         lPipelineDesc.DebugName = "Renderer2D::Sprite";
         s_Data.QuadPipeline = IPipeline::Create(lPipelineDesc);
 
-        // --- Bind group: camera UBO (binding 1) + the 16-sampler array. The UBO is set once;
-        //     textures are (re)set each emit.
-        s_Data.QuadBindGroup = IBindGroup::Create(BindGroupLayout{ 1u, MAX_TEXTURE_SLOTS });
-        s_Data.QuadBindGroup->SetUniformBuffer(*s_Data.CameraUBO);
+        // --- Recording contexts: one, or one per secondary recorder when passes may record in
+        //     parallel (each costs a grouped-batch VBO + staging buffer, so only then).
+        const Uint32 lSecondaries = RenderCommand::GetSecondaryCommandBufferCount();
+        s_Data.ContextCount = (EngineConfig::ParallelPassRecording() && lSecondaries > 0)
+                            ? std::min(lSecondaries, MAX_RECORD_CONTEXTS) : 1u;
+        for (Uint32 i = 0; i < s_Data.ContextCount; ++i)
+        {
+            InitContext(s_Data.Contexts[i]);
+        }
     }
  
     void Renderer2D::Shutdown()
     {
         OPAAX_CORE_INFO("Renderer2D::Shutdown()");
-        s_Data.QuadBindGroup.reset();
+        for (Uint32 i = 0; i < s_Data.ContextCount; ++i)
+        {
+            Renderer2DContext& lContext = s_Data.Contexts[i];
+            lContext.QuadBindGroup.reset();
+            lContext.QuadVAO.reset();
+            lContext.QuadVBO = nullptr;
+            lContext.CameraUBO.reset();
+        }
+        s_Data.ContextCount = 0;
         s_Data.QuadPipeline.reset();   // before the shader it references
-        s_Data.QuadVAO.reset();
         s_Data.QuadShader.reset();
         s_Data.WhiteTexture.reset();
-        s_Data.CameraUBO.reset();
     }
     
     // =============================================================================
@@ -193,6 +311,18 @@ namespace Opaax
     }
 
     const RenderStats& Renderer2D::GetStats() { return s_StatsLast; }
+
+    void Renderer2D::RecordPassTiming(const RenderPassTiming& InTiming)
+    {
+        std::scoped_lock lLock(s_Data.ContextMutex);
+        if (s_StatsAccum.PassCount >= RenderStats::MaxPasses) { return; }
+        s_StatsAccum.Passes[s_StatsAccum.PassCount++] = InTiming;
+    }
+
+    Uint32 Renderer2D::GetMaxConcurrentRecordings()
+    {
+        return s_Data.ContextCount;
+    }
  
     // =============================================================================
     // Begin / End
@@ -200,28 +330,52 @@ namespace Opaax
  
     void Renderer2D::Begin(ICamera& InCamera, ICommandBuffer& InCmd)
     {
-        s_Data.Cmd            = &InCmd;
-        s_Data.ViewProjection = InCamera.GetViewProjection();
+        OPAAX_CORE_ASSERT(t_Context == nullptr)   // Begin/End do not nest on one thread
+
+        t_Context = AcquireContext();
+        if (!t_Context)
+        {
+            OPAAX_CORE_ERROR("Renderer2D::Begin: all {} recording contexts are busy — this pass draws nothing.",
+                             s_Data.ContextCount);
+            return;
+        }
+        Renderer2DContext& lCtx = *t_Context;
+
+        lCtx.Cmd            = &InCmd;
+        lCtx.ViewProjection = InCamera.GetViewProjection();
+        lCtx.StateAtBegin   = InCmd.GetStateStats();
 
         // Bind the sprite pipeline (shader + blend) on the command buffer.
-        s_Data.Cmd->BindPipeline(*s_Data.QuadPipeline);
+        lCtx.Cmd->BindPipeline(*s_Data.QuadPipeline);
 
         // u_ViewProjection rides the camera UBO (binding 1) — SPIR-V has no default-block path.
-        s_Data.CameraUBO->SetData(glm::value_ptr(s_Data.ViewProjection),
-                                  static_cast<Uint32>(sizeof(glm::mat4)));
+        lCtx.CameraUBO->SetData(glm::value_ptr(lCtx.ViewProjection),
+                                static_cast<Uint32>(sizeof(glm::mat4)));
 
         StartBatch();
+        lCtx.RecordStart = std::chrono::steady_clock::now();
     }
 
     void Renderer2D::End()
     {
+        if (!t_Context) { return; }   // Begin found no free context
+        Renderer2DContext& lCtx = *t_Context;
+
         EmitFrame();
-        s_Data.Cmd = nullptr;
+
+        // The command buffer's filter counters are frame-cumulative — keep this recording's share.
+        const CommandStateStats lState = lCtx.Cmd->GetStateStats();
+        lCtx.Stats.StateIssued  = lState.Issued  - lCtx.StateAtBegin.Issued;
+        lCtx.Stats.StateSkipped = lState.Skipped - lCtx.StateAtBegin.Skipped;
+
+        lCtx.Cmd  = nullptr;
+        t_Context = nullptr;
+        ReleaseContext(lCtx);
     }
  
     void Renderer2D::StartBatch()
     {
-        s_Data.Commands.clear();   // keeps capacity — the record is reused frame to frame
+        t_Context->Commands.clear();   // keeps capacity — the record is reused frame to frame
     }
     
     // =============================================================================
@@ -230,45 +384,56 @@ namespace Opaax
  
     void Renderer2D::EmitFrame()
     {
-        const Uint32 lCount = static_cast<Uint32>(s_Data.Commands.size());
+        Renderer2DContext& lCtx   = *t_Context;
+        RenderStats&       lStats = lCtx.Stats;
+        lStats.RecordMicros += MicrosSince(lCtx.RecordStart);
+
+        const Uint32 lCount = static_cast<Uint32>(lCtx.Commands.size());
         if (lCount == 0) { return; }
 
         // --- Frame-global stable sort by draw key. Stable => equal keys keep submission order.
         //     Painter's algorithm: ascending key draws back-to-front; depth test stays OFF (correct
         //     for alpha-blended 2D). The key is (Layer, OrderInLayer) only — texture grouping is the
         //     per-batch slot window's job, so same-band overlapping sprites keep submission order. ---
-        s_Data.SortIndices.resize(lCount);
-        for (Uint32 i = 0; i < lCount; ++i) { s_Data.SortIndices[i] = i; }
+        lCtx.SortIndices.resize(lCount);
+        for (Uint32 i = 0; i < lCount; ++i) { lCtx.SortIndices[i] = i; }
 
         const auto lSortStart = std::chrono::steady_clock::now();
-        std::stable_sort(s_Data.SortIndices.begin(), s_Data.SortIndices.end(),
-            [](Uint32 InA, Uint32 InB)
-            { return s_Data.Commands[InA].SortKey < s_Data.Commands[InB].SortKey; });
-        const auto lSortEnd = std::chrono::steady_clock::now();
-        s_StatsAccum.SortMicros +=
-            std::chrono::duration<double, std::micro>(lSortEnd - lSortStart).count();
+        std::stable_sort(lCtx.SortIndices.begin(), lCtx.SortIndices.end(),
+            [&lCtx](Uint32 InA, Uint32 InB)
+            { return lCtx.Commands[InA].SortKey < lCtx.Commands[InB].SortKey; });
+        lStats.SortMicros += MicrosSince(lSortStart);
 
         // --- Texture identities in sorted order -> pure batch/slot assignment ---
-        s_Data.SortTexKeys.resize(lCount);
-        s_Data.Assign.resize(lCount);
+        const auto lAssignStart = std::chrono::steady_clock::now();
+        lCtx.SortTexKeys.resize(lCount);
+        lCtx.Assign.resize(lCount);
         for (Uint32 k = 0; k < lCount; ++k)
         {
-            s_Data.SortTexKeys[k] =
-                 reinterpret_cast<Uint64>(s_Data.Commands[s_Data.SortIndices[k]].Texture);
+            lCtx.SortTexKeys[k] =
+                 reinterpret_cast<Uint64>(lCtx.Commands[lCtx.SortIndices[k]].Texture);
         }
-        AssignBatches(s_Data.SortTexKeys.data(), lCount, MAX_QUADS, MAX_TEXTURE_SLOTS,
-                      s_Data.Assign.data());
-        
-        // --- Walk sorted commands; gather each batch into the staging buffer; emit on boundaries ---
+        // With indirect draws a batch is a texture group: it only closes on slot pressure (or the
+        // group cap), and EmitBatch splits it into index-buffer-sized draws in one submission.
+        // Without, the per-batch DrawIndexed loop caps each batch at MAX_QUADS.
+        const Uint32 lQuadCap = lCtx.Cmd->SupportsDrawIndirect() ? MAX_GROUP_QUADS : MAX_QUADS;
+        AssignBatches(lCtx.SortTexKeys.data(), lCount, lQuadCap, MAX_TEXTURE_SLOTS,
+                      lCtx.Assign.data());
+        lStats.AssignMicros += MicrosSince(lAssignStart);
+
+        // --- Walk sorted commands; gather each batch into the staging buffer; emit on boundaries.
+        //     EmitBatch books its own time as upload — subtract it so Gather is the copy alone. ---
+        const double lUploadBefore = lStats.UploadMicros;
+        const auto   lGatherStart  = std::chrono::steady_clock::now();
         Uint32 lCurrentBatch = 0;
         Uint32 lQuadInBatch  = 0;
         Uint32 lSlotCount    = 1;                          // slot 0 = white
-        s_Data.BatchTextures[0] = s_Data.WhiteTexture.get();
+        lCtx.BatchTextures[0] = s_Data.WhiteTexture.get();
 
         for (Uint32 k = 0; k < lCount; ++k)
         {
-            const BatchAssignment& lBA  = s_Data.Assign[k];
-            const QuadCommand&     lCmd = s_Data.Commands[s_Data.SortIndices[k]];
+            const BatchAssignment& lBA  = lCtx.Assign[k];
+            const QuadCommand&     lCmd = lCtx.Commands[lCtx.SortIndices[k]];
 
             if (lBA.BatchIndex != lCurrentBatch)
             {
@@ -276,54 +441,79 @@ namespace Opaax
                 lCurrentBatch = lBA.BatchIndex;
                 lQuadInBatch  = 0;
                 lSlotCount    = 1;
-                s_Data.BatchTextures[0] = s_Data.WhiteTexture.get();
+                lCtx.BatchTextures[0] = s_Data.WhiteTexture.get();
             }
 
             if (lBA.Slot != 0)
             {
-                s_Data.BatchTextures[lBA.Slot] = lCmd.Texture;
+                lCtx.BatchTextures[lBA.Slot] = lCmd.Texture;
                 if (lBA.Slot + 1 > lSlotCount) { lSlotCount = lBA.Slot + 1; }
         }
 
-            // Copy the 4 vertices into the staging buffer, stamping the resolved slot as TexIndex.
+            // Copy the 4 vertices into the staging buffer, adding the resolved slot to the recorded bias.
             const Uint32 lDst = lQuadInBatch * 4;
             for (Uint32 v = 0; v < 4; ++v)
             {
                 QuadVertex lVert = lCmd.Vertices[v];
-                lVert.TexIndex   = static_cast<float>(lBA.Slot);
-                s_Data.SortedBuffer[lDst + v] = lVert;
+                lVert.TexIndex  += static_cast<float>(lBA.Slot);
+                lCtx.SortedBuffer[lDst + v] = lVert;
             }
             ++lQuadInBatch;
         }
         EmitBatch(lQuadInBatch, lSlotCount);               // final partial batch
+        lStats.GatherMicros += MicrosSince(lGatherStart) - (lStats.UploadMicros - lUploadBefore);
 
-        s_StatsAccum.CommandCapacity = static_cast<Uint32>(s_Data.Commands.capacity());
+        lStats.CommandCapacity = static_cast<Uint32>(lCtx.Commands.capacity());
     }
 
     void Renderer2D::EmitBatch(Uint32 InQuadCount, Uint32 InSlotCount)
     {
         if (InQuadCount == 0) { return; }
 
+        Renderer2DContext& lCtx   = *t_Context;
+        RenderStats&       lStats = lCtx.Stats;
+
+        const auto lUploadStart = std::chrono::steady_clock::now();
+
         const Uint32 lDataSize = InQuadCount * 4u * static_cast<Uint32>(sizeof(QuadVertex));
-        s_Data.QuadVBO->SetData(s_Data.SortedBuffer.data(), lDataSize);
+        lCtx.QuadVBO->SetData(lCtx.SortedBuffer.data(), lDataSize);
 
         // Every sampler unit must reference a live texture (no dangling descriptor across draws):
-        // active slots get their texture, the rest get white.
+        // active slots get their texture, the rest get white. Acquire marks the texture drawn for
+        // TextureResidency and re-uploads it if it was evicted; a failed re-upload draws white.
+        ITexture2D* lWhite = s_Data.WhiteTexture->GetRHITexture();
         for (Uint32 i = 0; i < MAX_TEXTURE_SLOTS; ++i)
         {
-            Texture2D* lTex = (i < InSlotCount) ? s_Data.BatchTextures[i] : s_Data.WhiteTexture.get();
-            if (!lTex) { lTex = s_Data.WhiteTexture.get(); }
-            s_Data.QuadBindGroup->SetTexture(i, *lTex->GetRHITexture());
+            Texture2D*  lTex = (i < InSlotCount) ? lCtx.BatchTextures[i] : nullptr;
+            ITexture2D* lRHI = lTex ? lTex->AcquireRHITexture() : nullptr;
+            lCtx.QuadBindGroup->SetTexture(i, lRHI ? *lRHI : *lWhite);
         }
 
-        s_Data.Cmd->BindBindGroup(*s_Data.QuadBindGroup);
-        s_Data.Cmd->BindVertexArray(*s_Data.QuadVAO);
-        s_Data.Cmd->DrawIndexed(InQuadCount * 6);
-
-        ++s_StatsAccum.Batches;
-        ++s_StatsAccum.DrawCalls;
-        s_StatsAccum.Quads += InQuadCount;
-        if (InSlotCount > s_StatsAccum.PeakTextureSlots) { s_StatsAccum.PeakTextureSlots = InSlotCount; }
+        lCtx.Cmd->BindBindGroup(*lCtx.QuadBindGroup);
+        lCtx.Cmd->BindVertexArray(*lCtx.QuadVAO);
+        if (InQuadCount > MAX_QUADS)
+        {
+            // Past the shared index buffer: one indirect submission of rebased MAX_QUADS draws.
+            const Uint32 lDraws = BuildQuadDraws(InQuadCount, MAX_QUADS, lCtx.IndirectDraws.data());
+            lCtx.Cmd->DrawIndexedIndirect(lCtx.IndirectDraws.data(), lDraws);
+            lStats.IndirectDraws += lDraws;
+        }
+        else
+        {
+            lCtx.Cmd->DrawIndexed(InQuadCount * 6);
+        }
+        lStats.UploadMicros += MicrosSince(lUploadStart);
+
+        ++lStats.Batches;
+        ++lStats.DrawCalls;
+        lStats.Quads += InQuadCount;
+        if (InSlotCount > lStats.PeakTextureSlots) { lStats.PeakTextureSlots = InSlotCount; }
+
+        // Backend ring / transient-memory cursors only grow within a frame, so the latest read is
+        // the frame's high-water so far.
+        lStats.RingHighWater     = std::max(lStats.RingHighWater, lCtx.QuadBindGroup->GetRingHighWater());
+        lStats.FrameMemHighWater = std::max(lStats.FrameMemHighWater, RenderCommand::GetFrameMemoryUsed());
+        lStats.FrameMemCapacity  = RenderCommand::GetFrameMemoryCapacity();
     }
  
     // =============================================================================
@@ -372,19 +562,21 @@ namespace Opaax
                                 ERenderLayer    InLayer,
                                 Int16           InOrderInLayer)
     {
+        if (!t_Context) { return; }   // outside Begin/End — nothing records
+
         Vector2F lBL, lBR, lTR, lTL;
         ComputeCorners(InPosition, InSize.x * 0.5f, InSize.y * 0.5f, InRotationRad, lBL, lBR, lTR, lTL);
         QuadCommand lCmd;
         lCmd.SortKey = MakeSortKey(InLayer, InOrderInLayer, 0u);
         lCmd.Texture = nullptr;                       // white (slot 0), resolved at emit
 
-        constexpr float lTexIndex = 0.f;              // placeholder — EmitFrame stamps the real slot
+        constexpr float lTexIndex = 0.f;              // color path — EmitFrame adds the real slot
         lCmd.Vertices[0] = { { lBL.x, lBL.y, 0.f }, InColor, { 0.f, 0.f }, lTexIndex };
         lCmd.Vertices[1] = { { lBR.x, lBR.y, 0.f }, InColor, { 1.f, 0.f }, lTexIndex };
         lCmd.Vertices[2] = { { lTR.x, lTR.y, 0.f }, InColor, { 1.f, 1.f }, lTexIndex };
         lCmd.Vertices[3] = { { lTL.x, lTL.y, 0.f }, InColor, { 0.f, 1.f }, lTexIndex };
 
-        s_Data.Commands.push_back(lCmd);
+        t_Context->Commands.push_back(lCmd);
     }
 
     void Renderer2D::DrawSprite(const Vector2F& InPosition, const Vector2F& InSize, const TextureHandle& InTexture,
@@ -424,6 +616,8 @@ namespace Opaax
                                 ERenderLayer    InLayer,
                                 Int16           InOrderInLayer)
     {
+        if (!t_Context) { return; }
+
         Vector2F lBL, lBR, lTR, lTL;
         ComputeCorners(InPosition, InSize.x * 0.5f, InSize.y * 0.5f, InRotationRad, lBL, lBR, lTR, lTL);
 
@@ -431,13 +625,45 @@ namespace Opaax
         lCmd.SortKey = MakeSortKey(InLayer, InOrderInLayer, 0u);  // slot resolved per-batch at emit
         lCmd.Texture = &InTexture;
 
-        constexpr float lTexIndex = 0.f;                         // placeholder — EmitFrame stamps the slot
+        constexpr float lTexIndex = 0.f;                         // color path — EmitFrame adds the slot
         lCmd.Vertices[0] = { { lBL.x, lBL.y, 0.f }, InColor, { InUVMin.x, InUVMin.y }, lTexIndex };
         lCmd.Vertices[1] = { { lBR.x, lBR.y, 0.f }, InColor, { InUVMax.x, InUVMin.y }, lTexIndex };
         lCmd.Vertices[2] = { { lTR.x, lTR.y, 0.f }, InColor, { InUVMax.x, InUVMax.y }, lTexIndex };
         lCmd.Vertices[3] = { { lTL.x, lTL.y, 0.f }, InColor, { InUVMin.x, InUVMax.y }, lTexIndex };
 
-        s_Data.Commands.push_back(lCmd);
+        t_Context->Commands.push_back(lCmd);
+    }
+
+    void Renderer2D::DrawSpriteRun(const Vector2F&      InOrigin,
+                                   Texture2D&           InTexture,
+                                   const SpriteRunQuad* InQuads,
+                                   Uint32               InCount,
+                                   const Vector4F&      InColor,
+                                   ERenderLayer         InLayer,
+                                   Int16                InOrderInLayer,
+                                   bool                 InDistanceField)
+    {
+        if (InCount == 0 || !t_Context) { return; }
+
+        TDynArray<QuadCommand>& lCommands = t_Context->Commands;
+        const Uint64 lKey = MakeSortKey(InLayer, InOrderInLayer, 0u);
+        lCommands.reserve(lCommands.size() + InCount);
+
+        const float lTexIndex = InDistanceField ? DISTANCE_FIELD_TEX_INDEX_BIAS : 0.f;   // EmitFrame adds the slot
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            const SpriteRunQuad& lQ = InQuads[i];
+            const float lX0 = InOrigin.x + lQ.Min.x, lY0 = InOrigin.y + lQ.Min.y;
+            const float lX1 = InOrigin.x + lQ.Max.x, lY1 = InOrigin.y + lQ.Max.y;
+
+            QuadCommand& lCmd = lCommands.emplace_back();
+            lCmd.SortKey     = lKey;
+            lCmd.Texture     = &InTexture;
+            lCmd.Vertices[0] = { { lX0, lY0, 0.f }, InColor, { lQ.UVMin.x, lQ.UVMin.y }, lTexIndex };
+            lCmd.Vertices[1] = { { lX1, lY0, 0.f }, InColor, { lQ.UVMax.x, lQ.UVMin.y }, lTexIndex };
+            lCmd.Vertices[2] = { { lX1, lY1, 0.f }, InColor, { lQ.UVMax.x, lQ.UVMax.y }, lTexIndex };
+            lCmd.Vertices[3] = { { lX0, lY1, 0.f }, InColor, { lQ.UVMin.x, lQ.UVMax.y }, lTexIndex };
+        }
     }
 
 } // namespace Opaax
\ No newline at end of file
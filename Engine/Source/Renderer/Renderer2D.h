@@ -16,6 +16,19 @@ namespace Opaax
     class ICamera;
     class ICommandBuffer;
 
+    /**
+     * @struct SpriteRunQuad
+     * One pre-built axis-aligned quad of a sprite run (see Renderer2D::DrawSpriteRun).
+     * Min/Max are the bottom-left/top-right corners relative to the run's origin.
+     */
+    struct SpriteRunQuad
+    {
+        Vector2F Min   = { 0.f, 0.f };
+        Vector2F Max   = { 0.f, 0.f };
+        Vector2F UVMin = { 0.f, 0.f };
+        Vector2F UVMax = { 1.f, 1.f };
+    };
+
     /**
      * @class Renderer2D
      *
@@ -32,6 +45,11 @@ namespace Opaax
      *          Renderer2D::End();
      *
      * Init() and Shutdown() are called by the RenderSubsystem — not by game code.
+     *
+     * Each Begin/End records into a context bound to the calling thread. With parallel pass
+     * recording (render.parallelPassRecording) Init builds GetMaxConcurrentRecordings() of them,
+     * so passes on different job workers can Begin/draw/End at the same time; otherwise there is
+     * one and Begin/End must stay on one thread at a time. Begin/End never nest on a thread.
      */
     class OPAAX_API Renderer2D
     {
@@ -57,12 +75,22 @@ namespace Opaax
 
         /** Renderer counters for the previously completed frame (one frame late — see RenderStats). */
         static const RenderStats& GetStats();
+
+        /**
+         * Append one render pass's CPU/GPU timing to the in-flight frame's stats. Called by
+         * RenderPipeline after each pass; entries past RenderStats::MaxPasses are dropped.
+         */
+        static void RecordPassTiming(const RenderPassTiming& InTiming);
+
+        /** How many Begin/End recordings may be open at once, on different threads (>= 1 after Init). */
+        static Uint32 GetMaxConcurrentRecordings();
      
         /**
          * Call once per frame (per pass) before any draw calls. Records into InCmd — binds the
          * sprite pipeline and writes the camera UBO; draws issued until End() record into InCmd too.
          * @param InCamera camera supplying the view-projection
-         * @param InCmd    the frame's command buffer (from RenderContext)
+         * @param InCmd    the pass's command buffer (from RenderContext — the frame's, or a secondary
+         *                 recorder when the pass records in parallel)
          */
         static void Begin(ICamera& InCamera, ICommandBuffer& InCmd);
 
@@ -136,6 +164,23 @@ namespace Opaax
                                float           InRotationRad  = 0.f,
                                ERenderLayer    InLayer        = ERenderLayer::Default,
                                Int16           InOrderInLayer = 0);
+
+        /**
+         * Draw a span of pre-laid-out, un-rotated quads sharing one texture, translated by InOrigin.
+         * Same result as one DrawSprite per quad, without the per-call corner math — the replay path
+         * for cached glyph runs (Text2D).
+         *
+         * InDistanceField: InTexture is a signed-distance-field atlas (FontAsset DistanceField mode);
+         * the sprite shader reconstructs a crisp edge from it at any scale instead of sampling color.
+         */
+        static void DrawSpriteRun(const Vector2F&      InOrigin,
+                                  Texture2D&           InTexture,
+                                  const SpriteRunQuad* InQuads,
+                                  Uint32               InCount,
+                                  const Vector4F&      InColor        = Vector4F(1.f),
+                                  ERenderLayer         InLayer        = ERenderLayer::Default,
+                                  Int16                InOrderInLayer = 0,
+                                  bool                 InDistanceField = false);
     };
  
 } // namespace Opaax
\ No newline at end of file
@@ -49,6 +49,29 @@ namespace Opaax
             lDesc.FragmentSrc = OpaaxString(lFrag.c_str());
             return lDesc;
         }
+
+        // Read InPath and split it into OutDesc. Logs and returns false when the file is missing
+        // or either stage section is empty.
+        bool ReadShaderStages(const OpaaxString& InPath, const OpaaxString& InDebugName, ShaderDesc& OutDesc)
+        {
+            std::ifstream lFile(InPath.CStr(), std::ios::binary);
+            if (!lFile.is_open())
+            {
+                OPAAX_CORE_ERROR("ShaderAsset: cannot open shader file '{}'", InPath);
+                return false;
+            }
+
+            std::stringstream lRaw;
+            lRaw << lFile.rdbuf();
+            OutDesc = ParseShaderStages(OpaaxString(lRaw.str().c_str()), InDebugName);
+
+            if (OutDesc.VertexSrc.IsEmpty() || OutDesc.FragmentSrc.IsEmpty())
+            {
+                OPAAX_CORE_ERROR("ShaderAsset: '{}' missing a vertex or fragment '#type' section.", InPath);
+                return false;
+            }
+            return true;
+        }
     }
 
     // =============================================================================
@@ -60,30 +83,17 @@ namespace Opaax
         , m_State(EAssetState::Loading)
     {
         const OpaaxString lPath = InSourcePath;
-        std::ifstream lFile(lPath.CStr(), std::ios::binary);
-        if (!lFile.is_open())
-        {
-            OPAAX_CORE_ERROR("ShaderAsset: cannot open shader file '{}'", lPath);
-            m_State = EAssetState::Failed;
-            return;
-        }
-
-        std::stringstream lRaw;
-        lRaw << lFile.rdbuf();
-        const OpaaxString lSource(lRaw.str().c_str());
-
         const OpaaxString lName = InAssetID.ToString();
-        ShaderDesc        lDesc = ParseShaderStages(lSource, lName);
-
-        if (lDesc.VertexSrc.IsEmpty() || lDesc.FragmentSrc.IsEmpty())
+        ShaderDesc        lDesc;
+        if (!ReadShaderStages(lPath, lName, lDesc))
         {
-            OPAAX_CORE_ERROR("ShaderAsset: '{}' missing a vertex or fragment '#type' section.", lPath);
             m_State = EAssetState::Failed;
             return;
         }
 
         // Compile both stages to SPIR-V when glslang is available — the portable IR backends
-        // consume (GL via GL_ARB_gl_spirv, Vulkan natively). When glslang is absent (no Vulkan
+        // consume (GL via GL_ARB_gl_spirv, Vulkan natively); a warm SpirvCache skips glslang
+        // entirely. When glslang is absent (no Vulkan
         // SDK at build time) the blobs stay empty and the OpenGL backend falls back to the GLSL
         // source path — the engine still runs on OpenGL, only the Vulkan backend is unavailable.
         lDesc.VertexSpirv   = ShaderCompiler::CompileGLSLToSPIRV(EShaderStage::Vertex,   lDesc.VertexSrc,   lName);
@@ -99,6 +109,20 @@ namespace Opaax
 
     ShaderAsset::~ShaderAsset() = default;
 
+    bool ShaderAsset::Cook(const OpaaxString& InSourcePath, const OpaaxString& InDebugName)
+    {
+        ShaderDesc lDesc;
+        if (!ReadShaderStages(InSourcePath, InDebugName, lDesc))
+        {
+            return false;
+        }
+
+        // Same inputs as the ctor, so the entries written here are exactly the ones it looks up.
+        const bool lVert = !ShaderCompiler::CompileGLSLToSPIRV(EShaderStage::Vertex,   lDesc.VertexSrc,   InDebugName).empty();
+        const bool lFrag = !ShaderCompiler::CompileGLSLToSPIRV(EShaderStage::Fragment, lDesc.FragmentSrc, InDebugName).empty();
+        return lVert && lFrag;
+    }
+
     // =============================================================================
     // Functions
     // =============================================================================
@@ -73,6 +73,14 @@ namespace Opaax
     public:
         bool IsLoaded() const noexcept { return m_State == EAssetState::Loaded; }
 
+        /**
+         * Offline cook: read + split InSourcePath and compile both stages to SPIR-V, which lands
+         * in the SpirvCache so a later ShaderAsset load of the same source skips glslang. No GPU
+         * work — safe without an RHI. False if the file is unreadable, a stage is missing or
+         * compilation fails (always false when glslang is absent).
+         */
+        static bool Cook(const OpaaxString& InSourcePath, const OpaaxString& InDebugName);
+
         // The composed backend shader — for pipeline creation (PipelineDesc::Shader). Not owned by the caller.
         IShader* GetRHIShader() const noexcept { return m_Gpu.get(); }
 
@@ -5,6 +5,8 @@
 #include "Renderer/Text/Text2D.h"
 #include "Renderer/Text/FontAsset.h"
 #include "Renderer/RenderTarget.hpp"
+#include "Renderer/TextureResidency.h"
+#include "RHI/GpuMemoryTracker.h"
 #include "World/RenderContext.h"
 #include "Assets/AssetHandle.hpp"
 #include "Assets/AssetRegistry.h"
@@ -15,14 +17,19 @@
 
 namespace Opaax
 {
+    namespace
+    {
+        FORCEINLINE double ToMiB(Uint64 InBytes) { return static_cast<double>(InBytes) / (1024.0 * 1024.0); }
+    }
+
     void RenderStatsOverlaySystem::OnRenderOverlay(World& /*InWorld*/, const RenderContext& InContext)
     {
         if (m_Disabled) { return; }
 
-        // Frame-scoped cache-hit load (first frame bakes; the registry keeps its own ref so the font
-        // stays cached). The handle releases at function scope — never outlives AssetRegistry::Shutdown.
+        // Frame-scoped cache-hit load (first frame queues the bake — text appears once the JobSubsystem
+        // completion uploads the atlas; the registry keeps its own ref so the font stays cached). The handle releases at function scope — never outlives AssetRegistry::Shutdown.
         TAssetHandle<FontAsset> lFont = AssetRegistry::Load<FontAsset>(OPAAX_ID("Fonts/Roboto-Regular"));
-        if (!lFont.IsValid())
+        if (!lFont.IsValid() || lFont->GetState() == EAssetState::Failed)
         {
             OPAAX_CORE_WARN("RenderStatsOverlaySystem: engine font 'Fonts/Roboto-Regular' unavailable — overlay disabled.");
             m_Disabled = true;
@@ -30,12 +37,36 @@ namespace Opaax
         }
 
         const RenderStats& lStats = Renderer2D::GetStats();
+        const GpuMemoryStats lGpu = GpuMemoryTracker::GetStats();
+        const AssetCacheStats& lCache = AssetRegistry::GetCacheStats();
 
-        char lBuf[256];
-        std::snprintf(lBuf, sizeof(lBuf),
-            "Draw calls: %u\nBatches: %u\nQuads: %u\nPeak slots: %u\nSort: %.1f us\nRing HW: %u\nCmd cap: %u",
-            lStats.DrawCalls, lStats.Batches, lStats.Quads, lStats.PeakTextureSlots,
-            lStats.SortMicros, lStats.RingHighWater, lStats.CommandCapacity);
+        char lBuf[1536];
+        int  lLen = std::snprintf(lBuf, sizeof(lBuf),
+            "Draw calls: %u (%u indirect)\nBatches: %u\nQuads: %u\nPeak slots: %u\nRing HW: %u\nCmd cap: %u\n"
+            "Frame mem: %.1f / %.1f KiB\nState: %u issued / %u skipped\n"
+            "GPU mem: %.1f MiB (tex %.1f, rt %.1f)\nDevice: %.1f / %.1f MiB\nTex evictions: %u\n"
+            "Assets: %u, %.1f / %.1f MiB\nAsset evictions: %u (%u re-loaded)\n"
+            "Record: %.1f us\nSort: %.1f us\nAssign: %.1f us\nGather: %.1f us\nUpload: %.1f us",
+            lStats.DrawCalls, lStats.IndirectDraws, lStats.Batches, lStats.Quads, lStats.PeakTextureSlots,
+            lStats.RingHighWater, lStats.CommandCapacity,
+            static_cast<double>(lStats.FrameMemHighWater) / 1024.0, static_cast<double>(lStats.FrameMemCapacity) / 1024.0,
+            lStats.StateIssued, lStats.StateSkipped,
+            ToMiB(lGpu.GetTotalBytes()), ToMiB(lGpu.GetBytes(EGpuMemoryCategory::Texture)),
+            ToMiB(lGpu.GetBytes(EGpuMemoryCategory::RenderTarget)),
+            ToMiB(lGpu.DeviceUsage), ToMiB(lGpu.DeviceBudget), TextureResidency::GetEvictionCount(),
+            lCache.ResidentCount, ToMiB(lCache.ResidentBytes), ToMiB(lCache.BudgetBytes),
+            lCache.Evictions, lCache.Reloads,
+            lStats.RecordMicros, lStats.SortMicros, lStats.AssignMicros, lStats.GatherMicros,
+            lStats.UploadMicros);
+
+        // Per-pass CPU / GPU (GPU reads 0 until the backend's timestamp queries resolve).
+        for (Uint32 i = 0; i < lStats.PassCount && lLen > 0 && lLen < static_cast<int>(sizeof(lBuf)); ++i)
+        {
+            const RenderPassTiming& lPass = lStats.Passes[i];
+            lLen += std::snprintf(lBuf + lLen, sizeof(lBuf) - static_cast<size_t>(lLen),
+                "\n%s: cpu %.2f ms / gpu %.2f ms",
+                lPass.Name ? lPass.Name : "?", lPass.CpuMicros / 1000.0, lPass.GpuMicros / 1000.0);
+        }
 
         // Screen-space: the OverlayRenderPass binds a ScreenSpaceCamera (bottom-left origin, Y-up,
         // pixel units). Text2D anchors at the top-left of the first glyph and advances downward, so
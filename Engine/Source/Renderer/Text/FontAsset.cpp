@@ -1,11 +1,17 @@
 #include "FontAsset.h"
 
+#include "Core/Jobs/JobSubsystem.h"
 #include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxHash.h"
 #include "Renderer/Texture2D.h"
+#include "Renderer/Text/FontBakeCache.h"
 #include "Renderer/Text/FontKerning.h"
+#include "Renderer/Text/Text2D.h"
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <vector>
 
 // stb_truetype — implementation defined once here. The two stb implementations
@@ -50,175 +56,416 @@ namespace Opaax
             }
             return lBytes;
         }
-    }
 
-    // =============================================================================
-    // CTORS - DTOR
-    // =============================================================================
-    FontAsset::FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID)
-        : m_AssetID(InAssetID)
-        , m_SourcePath(InSourcePath)
-        , m_State(EAssetState::Loading)
-    {
-        const TDynArray<unsigned char> lFontBytes = ReadFileBytes(m_SourcePath);
-        if (lFontBytes.empty())
+        // Per-glyph SDFs (stbtt_GetCodepointSDF) shelf-packed into one square R8 atlas,
+        // grow-by-double like the bitmap path. Glyph rectangles are placed left to right
+        // in rows as tall as the tallest glyph so far, with 1 px between neighbours — 95
+        // near-uniform glyphs pack tightly enough that a skyline packer buys nothing.
+        // Writes OutGlyphs in PixelHeight units (UV V-swapped, as in the bitmap path).
+        bool BakeDistanceFieldAtlas(const stbtt_fontinfo&      InFontInfo,
+                                    float                      InPixelScale,
+                                    FontAsset::GlyphMetrics*   OutGlyphs,
+                                    std::vector<unsigned char>& OutAtlas,
+                                    Uint32&                    OutSize)
         {
-            OPAAX_CORE_ERROR("FontAsset: failed to read TTF bytes from '{}'", m_SourcePath.CStr());
-            m_State = EAssetState::Failed;
-            return;
+            struct SdfGlyph
+            {
+                unsigned char* Pixels = nullptr;
+                int W = 0, H = 0, XOff = 0, YOff = 0;
+                Uint32 X = 0, Y = 0;
+            };
+            SdfGlyph lGlyphs[FontAsset::CodepointCount] = {};
+
+            const float lSdfScale  = stbtt_ScaleForPixelHeight(&InFontInfo, FontAsset::SdfPixelHeight);
+            const float lDistScale = static_cast<float>(FontAsset::SdfOnEdge) / static_cast<float>(FontAsset::SdfPadding);
+            for (Uint32 i = 0; i < FontAsset::CodepointCount; ++i)
+            {
+                SdfGlyph& lG = lGlyphs[i];
+                lG.Pixels = stbtt_GetCodepointSDF(&InFontInfo, lSdfScale,
+                                                  static_cast<int>(FontAsset::FirstCodepoint + i),
+                                                  FontAsset::SdfPadding, FontAsset::SdfOnEdge, lDistScale,
+                                                  &lG.W, &lG.H, &lG.XOff, &lG.YOff);
+            }
+
+            bool lPacked = false;
+            for (Uint32 lSize = FontAsset::InitialAtlas; lSize <= FontAsset::MaxAtlas && !lPacked; lSize *= 2u)
+            {
+                Uint32 lX = 1, lY = 1, lRowH = 0;
+                lPacked = true;
+                for (SdfGlyph& lG : lGlyphs)
+                {
+                    if (!lG.Pixels) { continue; }
+                    const Uint32 lW = static_cast<Uint32>(lG.W), lH = static_cast<Uint32>(lG.H);
+                    if (lX + lW + 1 > lSize) { lX = 1; lY += lRowH + 1; lRowH = 0; }
+                    if (lY + lH + 1 > lSize) { lPacked = false; break; }
+                    lG.X = lX;
+                    lG.Y = lY;
+                    lX += lW + 1;
+                    lRowH = std::max(lRowH, lH);
+                }
+                if (lPacked) { OutSize = lSize; }
+            }
+
+            if (lPacked)
+            {
+                OutAtlas.assign(static_cast<size_t>(OutSize) * OutSize, 0);
+                const float lInvSize = 1.f / static_cast<float>(OutSize);
+                const float lToPixel = FontAsset::PixelHeight / FontAsset::SdfPixelHeight;
+
+                for (Uint32 i = 0; i < FontAsset::CodepointCount; ++i)
+                {
+                    const SdfGlyph&          lG   = lGlyphs[i];
+                    FontAsset::GlyphMetrics& lOut = OutGlyphs[i];
+
+                    int lAdvance = 0, lBearing = 0;
+                    stbtt_GetCodepointHMetrics(&InFontInfo, static_cast<int>(FontAsset::FirstCodepoint + i),
+                                               &lAdvance, &lBearing);
+                    lOut.XAdvance = static_cast<float>(lAdvance) * InPixelScale;
+
+                    if (!lG.Pixels) { continue; }   // blank glyph (space): advance only
+
+                    for (int lRow = 0; lRow < lG.H; ++lRow)
+                    {
+                        std::memcpy(&OutAtlas[(static_cast<size_t>(lG.Y) + lRow) * OutSize + lG.X],
+                                    lG.Pixels + static_cast<size_t>(lRow) * lG.W, static_cast<size_t>(lG.W));
+                    }
+
+                    const float lX0 = static_cast<float>(lG.X),        lY0 = static_cast<float>(lG.Y);
+                    const float lX1 = static_cast<float>(lG.X + lG.W), lY1 = static_cast<float>(lG.Y + lG.H);
+                    lOut.UVMin      = Vector2F(lX0 * lInvSize, lY1 * lInvSize);
+                    lOut.UVMax      = Vector2F(lX1 * lInvSize, lY0 * lInvSize);
+                    lOut.QuadOffset = Vector2F(static_cast<float>(lG.XOff) * lToPixel, static_cast<float>(lG.YOff) * lToPixel);
+                    lOut.QuadSize   = Vector2F(static_cast<float>(lG.W) * lToPixel,    static_cast<float>(lG.H) * lToPixel);
+                }
+            }
+
+            for (SdfGlyph& lG : lGlyphs)
+            {
+                if (lG.Pixels) { stbtt_FreeSDF(lG.Pixels, nullptr); }
+            }
+            return lPacked;
         }
 
-        // The TTF byte
-        // buffer must remain alive across stbtt_PackFontRange + future kern queries;
-        // lFontBytes is a local std::vector so it dies at ctor end.
-        stbtt_fontinfo lFontInfo = {};
-        if (!stbtt_InitFont(&lFontInfo, lFontBytes.data(), 0))
+        // stbtt_PackFontRange at PixelHeight, (sOversampleH, sOversampleV). Grow-by-double up to
+        // MaxAtlas: PackFontRange returns 0 on out-of-room failure (the only path that should retry);
+        // other failures are unrecoverable and fall through to the post-loop error.
+        bool BakeBitmapAtlas(const TDynArray<unsigned char>& InFontBytes,
+                             const OpaaxString&              InSourcePath,
+                             FontAsset::GlyphMetrics*        OutGlyphs,
+                             std::vector<unsigned char>&     OutAtlas,
+                             Uint32&                         OutSize)
         {
-            OPAAX_CORE_ERROR("FontAsset: stbtt_InitFont rejected '{}'", m_SourcePath.CStr());
-            m_State = EAssetState::Failed;
-            return;
+            stbtt_packedchar lPacked[FontAsset::CodepointCount] = {};
+            bool   lPackOk = false;
+            Uint32 lSize   = FontAsset::InitialAtlas;
+
+            while (lSize <= FontAsset::MaxAtlas)
+            {
+                OutAtlas.assign(static_cast<size_t>(lSize) * lSize, 0);
+
+                stbtt_pack_context lPack = {};
+                if (!stbtt_PackBegin(&lPack, OutAtlas.data(),
+                                     static_cast<int>(lSize), static_cast<int>(lSize),
+                                     0 /*stride = width*/, 1 /*padding*/, nullptr))
+                {
+                    OPAAX_CORE_ERROR("FontAsset: stbtt_PackBegin failed at size {}x{} for '{}'",
+                                     lSize, lSize, InSourcePath.CStr());
+                    return false;
+                }
+
+                stbtt_PackSetOversampling(&lPack, sOversampleH, sOversampleV);
+
+                const int lResult = stbtt_PackFontRange(&lPack, InFontBytes.data(), 0,
+                                                        FontAsset::PixelHeight,
+                                                        static_cast<int>(FontAsset::FirstCodepoint),
+                                                        static_cast<int>(FontAsset::CodepointCount),
+                                                        lPacked);
+                stbtt_PackEnd(&lPack);
+
+                if (lResult)
+                {
+                    lPackOk = true;
+                    break;
+                }
+
+                const Uint32 lNext = lSize * 2u;
+                OPAAX_CORE_WARN("FontAsset: atlas {}x{} too small for '{}' — retrying at {}x{}",
+                                lSize, lSize, InSourcePath.CStr(), lNext, lNext);
+                lSize = lNext;
+            }
+
+            if (!lPackOk)
+            {
+                OPAAX_CORE_ERROR("FontAsset: atlas exceeded MaxAtlas {}x{} for '{}' — fail-loud per D-h",
+                                 FontAsset::MaxAtlas, FontAsset::MaxAtlas, InSourcePath.CStr());
+                return false;
+            }
+
+            OutSize = lSize;
+
+            // stbtt_packedchar -> POD GlyphMetrics. UVs normalized to [0,1].
+            // V is swapped here (UVMin.y = y1/H, UVMax.y = y0/H) because stb_truetype
+            // writes the atlas top-down (row 0 = top of original), while Renderer2D's
+            // vertex layout — matching stb_image's globally-set vertical-flip-on-load
+            // — assumes bottom-up data (UV.y=0 at world bottom = original bottom).
+            // Inverting V at bake-time keeps Step 4's layout walker math straight.
+            const float lInvSize = 1.f / static_cast<float>(lSize);
+            for (Uint32 i = 0; i < FontAsset::CodepointCount; ++i)
+            {
+                const stbtt_packedchar&  lP   = lPacked[i];
+                FontAsset::GlyphMetrics& lOut = OutGlyphs[i];
+
+                lOut.UVMin      = Vector2F(static_cast<float>(lP.x0) * lInvSize, static_cast<float>(lP.y1) * lInvSize);
+                lOut.UVMax      = Vector2F(static_cast<float>(lP.x1) * lInvSize, static_cast<float>(lP.y0) * lInvSize);
+                lOut.QuadOffset = Vector2F(lP.xoff,  lP.yoff);
+                lOut.QuadSize   = Vector2F(lP.xoff2 - lP.xoff, lP.yoff2 - lP.yoff);
+                lOut.XAdvance   = lP.xadvance;
+            }
+            return true;
         }
 
-        // Scale font-VMetrics to the bake pixel height. Layout consumers use these
-        // for baseline offset (Ascent) and \n line advance.
-        const float lScale = stbtt_ScaleForPixelHeight(&lFontInfo, PixelHeight);
-        Int32 lUnscaledAscent = 0, lUnscaledDescent = 0, lUnscaledLineGap = 0;
-        stbtt_GetFontVMetrics(&lFontInfo, &lUnscaledAscent, &lUnscaledDescent, &lUnscaledLineGap);
-
-        m_VMetrics.Ascent      = static_cast<float>(lUnscaledAscent)  * lScale;
-        m_VMetrics.Descent     = static_cast<float>(lUnscaledDescent) * lScale;
-        m_VMetrics.LineGap     = static_cast<float>(lUnscaledLineGap) * lScale;
-        m_VMetrics.LineAdvance = m_VMetrics.Ascent - m_VMetrics.Descent + m_VMetrics.LineGap;
-
-        // Atlas bake — grow-by-double up to MaxAtlas. PackFontRange returns 0 on
-        // out-of-room failure (the only path that should retry); other failures
-        // are unrecoverable and fall through to the post-loop error.
-        Uint32 lSize = InitialAtlas;
-        std::vector<unsigned char> lAtlasBytes;
-        stbtt_packedchar lPacked[CodepointCount] = {};
-        bool lPackOk = false;
-
-        while (lSize <= MaxAtlas)
+        // Kerning LUT — 95×95 codepoint matrix via stbtt_GetCodepointKernAdvance.
+        // Returned values are unscaled font-units; multiply by InScale to match the
+        // per-glyph metrics' pixel space. Zero-advance pairs are dropped (a missing
+        // key in GetKerning implies 0). Sorted by packed (First<<8)|Second key so
+        // std::lower_bound walks it in O(log N) at draw time.
+        void BakeKerning(const stbtt_fontinfo& InFontInfo, float InScale, TDynArray<FontAsset::KerningPair>& OutKerning)
         {
-            lAtlasBytes.assign(static_cast<size_t>(lSize) * lSize, 0);
+            OutKerning.clear();
+            OutKerning.reserve(FontAsset::CodepointCount); // conservative; ~1 entry per first-glyph on average for Roboto-class fonts
+            for (Uint32 lA = FontAsset::FirstCodepoint; lA <= FontAsset::LastCodepoint; ++lA)
+            {
+                for (Uint32 lB = FontAsset::FirstCodepoint; lB <= FontAsset::LastCodepoint; ++lB)
+                {
+                    const int lRaw = stbtt_GetCodepointKernAdvance(&InFontInfo,
+                                                                   static_cast<int>(lA),
+                                                                   static_cast<int>(lB));
+                    if (lRaw == 0)
+                    {
+                        continue;
+                    }
+                    OutKerning.push_back({
+                        static_cast<Uint8>(lA),
+                        static_cast<Uint8>(lB),
+                        static_cast<float>(lRaw) * InScale
+                    });
+                }
+            }
+            std::sort(OutKerning.begin(), OutKerning.end(),
+                      [](const FontAsset::KerningPair& InA, const FontAsset::KerningPair& InB) noexcept
+                      {
+                          return PackKerningKey(InA.First, InA.Second)
+                               < PackKerningKey(InB.First, InB.Second);
+                      });
+            OutKerning.shrink_to_fit();
+        }
+
+        // Everything CPU-side: TTF read, baked-cache lookup, atlas + metrics + kerning bake, cache
+        // store. Touches no engine state beyond logging, so it runs on any thread. InCacheDir empty
+        // = no cache.
+        bool BakeFont(const OpaaxString& InSourcePath, EFontBakeMode InMode, const OpaaxString& InCacheDir,
+                      FontBakeData& OutData)
+        {
+            const TDynArray<unsigned char> lFontBytes = ReadFileBytes(InSourcePath);
+            if (lFontBytes.empty())
+            {
+                OPAAX_CORE_ERROR("FontAsset: failed to read TTF bytes from '{}'", InSourcePath.CStr());
+                return false;
+            }
 
-            stbtt_pack_context lPack = {};
-            if (!stbtt_PackBegin(&lPack, lAtlasBytes.data(),
-                                 static_cast<int>(lSize), static_cast<int>(lSize),
-                                 0 /*stride = width*/, 1 /*padding*/, nullptr))
+            const bool  lSdf = (InMode == EFontBakeMode::DistanceField);
+            FontBakeKey lKey;
+            lKey.FileHash    = OpaaxHash::HashBytes(lFontBytes.data(), lFontBytes.size());
+            lKey.FileSize    = static_cast<Uint32>(lFontBytes.size());
+            lKey.PixelHeight = lSdf ? FontAsset::SdfPixelHeight : FontAsset::PixelHeight;
+            lKey.OversampleH = lSdf ? 1u : sOversampleH;
+            lKey.OversampleV = lSdf ? 1u : sOversampleV;
+            lKey.Mode        = InMode;
+
+            if (FontBakeCache::Read(InCacheDir, lKey, OutData))
+            {
+                OPAAX_CORE_TRACE("FontAsset: baked-cache hit for '{}'", InSourcePath.CStr());
+                return true;
+            }
+
+            // The TTF byte
+            // buffer must remain alive across stbtt_PackFontRange + future kern queries;
+            // lFontBytes is a local std::vector so it dies at function end.
+            stbtt_fontinfo lFontInfo = {};
+            if (!stbtt_InitFont(&lFontInfo, lFontBytes.data(), 0))
             {
-                OPAAX_CORE_ERROR("FontAsset: stbtt_PackBegin failed at size {}x{} for '{}'",
-                                 lSize, lSize, m_SourcePath.CStr());
-                m_State = EAssetState::Failed;
-                return;
+                OPAAX_CORE_ERROR("FontAsset: stbtt_InitFont rejected '{}'", InSourcePath.CStr());
+                return false;
             }
 
-            stbtt_PackSetOversampling(&lPack, sOversampleH, sOversampleV);
+            // Scale font-VMetrics to the bake pixel height. Layout consumers use these
+            // for baseline offset (Ascent) and \n line advance.
+            const float lScale = stbtt_ScaleForPixelHeight(&lFontInfo, FontAsset::PixelHeight);
+            Int32 lUnscaledAscent = 0, lUnscaledDescent = 0, lUnscaledLineGap = 0;
+            stbtt_GetFontVMetrics(&lFontInfo, &lUnscaledAscent, &lUnscaledDescent, &lUnscaledLineGap);
 
-            const int lResult = stbtt_PackFontRange(&lPack, lFontBytes.data(), 0,
-                                                    PixelHeight,
-                                                    static_cast<int>(FirstCodepoint),
-                                                    static_cast<int>(CodepointCount),
-                                                    lPacked);
-            stbtt_PackEnd(&lPack);
+            FontAsset::FontVMetrics& lV = OutData.VMetrics;
+            lV.Ascent      = static_cast<float>(lUnscaledAscent)  * lScale;
+            lV.Descent     = static_cast<float>(lUnscaledDescent) * lScale;
+            lV.LineGap     = static_cast<float>(lUnscaledLineGap) * lScale;
+            lV.LineAdvance = lV.Ascent - lV.Descent + lV.LineGap;
 
-            if (lResult)
+            if (lSdf)
+            {
+                if (!BakeDistanceFieldAtlas(lFontInfo, lScale, OutData.Glyphs, OutData.Atlas, OutData.AtlasSize))
+                {
+                    OPAAX_CORE_ERROR("FontAsset: SDF atlas exceeded MaxAtlas {}x{} for '{}'",
+                                     FontAsset::MaxAtlas, FontAsset::MaxAtlas, InSourcePath.CStr());
+                    return false;
+                }
+            }
+            else if (!BakeBitmapAtlas(lFontBytes, InSourcePath, OutData.Glyphs, OutData.Atlas, OutData.AtlasSize))
             {
-                lPackOk = true;
-                break;
+                return false;
             }
 
-            const Uint32 lNext = lSize * 2u;
-            OPAAX_CORE_WARN("FontAsset: atlas {}x{} too small for '{}' — retrying at {}x{}",
-                            lSize, lSize, m_SourcePath.CStr(), lNext, lNext);
-            lSize = lNext;
+            BakeKerning(lFontInfo, lScale, OutData.Kerning);
+
+            // A failed store only costs the next launch a re-bake.
+            FontBakeCache::Write(InCacheDir, lKey, OutData);
+            return true;
         }
+    }
+
+    // =============================================================================
+    // Async bake hand-off
+    // =============================================================================
+
+    // Owner is only read/cleared on the main thread (the job's OnComplete and ~FontAsset), so
+    // no atomics; the worker only writes Data/bBaked, published to the main thread by the
+    // JobSubsystem completion queue.
+    struct FontAsset::PendingBake
+    {
+        FontAsset*   Owner  = nullptr;
+        FontBakeData Data;
+        bool         bBaked = false;
+    };
 
-        if (!lPackOk)
+    // =============================================================================
+    // CTORS - DTOR
+    // =============================================================================
+    FontAsset::FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID, EFontBakeMode InBakeMode)
+        : m_AssetID(InAssetID)
+        , m_SourcePath(InSourcePath)
+        , m_State(EAssetState::Loading)
+        , m_BakeMode(InBakeMode)
+    {
+        FontBakeData lData;
+        if (!BakeFont(m_SourcePath, m_BakeMode, FontBakeCache::ResolveDirectory(), lData))
         {
-            OPAAX_CORE_ERROR("FontAsset: atlas exceeded MaxAtlas {}x{} for '{}' — fail-loud per D-h",
-                             MaxAtlas, MaxAtlas, m_SourcePath.CStr());
             m_State = EAssetState::Failed;
             return;
         }
+        Finalize(lData);
+    }
+
+    FontAsset::FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID, EFontBakeMode InBakeMode,
+                         JobSubsystem& InJobs)
+        : m_AssetID(InAssetID)
+        , m_SourcePath(InSourcePath)
+        , m_State(EAssetState::Loading)
+        , m_BakeMode(InBakeMode)
+        , m_PendingBake(MakeShared<PendingBake>())
+    {
+        m_PendingBake->Owner = this;
 
-        m_AtlasSize = lSize;
+        // Worker captures copies only — never `this`, which may be gone by the time it runs.
+        InJobs.Submit(
+            [lPending = m_PendingBake, lPath = m_SourcePath, lMode = m_BakeMode,
+             lCacheDir = FontBakeCache::ResolveDirectory()]
+            {
+                lPending->bBaked = BakeFont(lPath, lMode, lCacheDir, lPending->Data);
+            },
+            [lPending = m_PendingBake]
+            {
+                FontAsset* lOwner = lPending->Owner;
+                if (!lOwner)
+                {
+                    return;   // unloaded while baking — drop the result
+                }
+                lOwner->m_PendingBake.reset();
 
-        // stbtt_packedchar -> POD GlyphMetrics. UVs normalized to [0,1].
-        // V is swapped here (UVMin.y = y1/H, UVMax.y = y0/H) because stb_truetype
-        // writes the atlas top-down (row 0 = top of original), while Renderer2D's
-        // vertex layout — matching stb_image's globally-set vertical-flip-on-load
-        // — assumes bottom-up data (UV.y=0 at world bottom = original bottom).
-        // Inverting V at bake-time keeps Step 4's layout walker math straight.
-        const float lInvSize = 1.f / static_cast<float>(lSize);
-        for (Uint32 i = 0; i < CodepointCount; ++i)
+                if (!lPending->bBaked)
+                {
+                    lOwner->m_State = EAssetState::Failed;
+                    return;
+                }
+                lOwner->Finalize(lPending->Data);
+            });
+    }
+
+    FontAsset::FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID, EFontBakeMode InBakeMode,
+                         FontBakeData& InBaked)
+        : m_AssetID(InAssetID)
+        , m_SourcePath(InSourcePath)
+        , m_State(EAssetState::Loading)
+        , m_BakeMode(InBakeMode)
+    {
+        Finalize(InBaked);
+    }
+
+    // Defined here so UniquePtr<Texture2D>'s deleter sees the complete type.
+    FontAsset::~FontAsset()
+    {
+        if (m_PendingBake)
         {
-            const stbtt_packedchar& lP = lPacked[i];
-            GlyphMetrics&           lOut = m_Glyphs[i];
-
-            lOut.UVMin      = Vector2F(static_cast<float>(lP.x0) * lInvSize, static_cast<float>(lP.y1) * lInvSize);
-            lOut.UVMax      = Vector2F(static_cast<float>(lP.x1) * lInvSize, static_cast<float>(lP.y0) * lInvSize);
-            lOut.QuadOffset = Vector2F(lP.xoff,  lP.yoff);
-            lOut.QuadSize   = Vector2F(lP.xoff2 - lP.xoff, lP.yoff2 - lP.yoff);
-            lOut.XAdvance   = lP.xadvance;
+            m_PendingBake->Owner = nullptr;
         }
 
+        // Cached glyph runs key on this font's address and reference its atlas.
+        Text2D::EvictGlyphRuns(*this);
+    }
+
+    // =============================================================================
+    // Internal
+    // =============================================================================
+    void FontAsset::Finalize(FontBakeData& InData)
+    {
         // GPU upload via Step 1 R8 path (Texture2D composes OpenGLTexture2D with
-        // GL_R8 + GL_RED + swizzle). lAtlasBytes owns the buffer until the ctor
-        // returns; safe per the raw-bytes ctor contract.
-        m_Atlas = MakeUnique<Texture2D>(lAtlasBytes.data(), lSize, lSize, 1);
+        // GL_R8 + GL_RED + swizzle). InData.Atlas owns the buffer until we return;
+        // safe per the raw-bytes ctor contract.
+        m_Atlas = MakeUnique<Texture2D>(InData.Atlas.data(), InData.AtlasSize, InData.AtlasSize, 1);
         if (!m_Atlas || !m_Atlas->IsLoaded())
         {
             OPAAX_CORE_ERROR("FontAsset: GPU upload failed for '{}'", m_SourcePath.CStr());
+            m_Atlas.reset();
             m_State = EAssetState::Failed;
             return;
         }
 
-        // Kerning LUT — 95×95 codepoint matrix via stbtt_GetCodepointKernAdvance
-        // against the ctor-scoped lFontInfo. Returned values are unscaled font-units;
-        // multiply by lScale to match the per-glyph metrics' pixel space. Zero-advance
-        // pairs are dropped (a missing key in GetKerning implies 0). Sorted by packed
-        // (First<<8)|Second key so std::lower_bound walks it in O(log N) at draw time.
-        m_Kerning.reserve(CodepointCount); // conservative; ~1 entry per first-glyph on average for Roboto-class fonts
-        for (Uint32 lA = FirstCodepoint; lA <= LastCodepoint; ++lA)
-        {
-            for (Uint32 lB = FirstCodepoint; lB <= LastCodepoint; ++lB)
-            {
-                const int lRaw = stbtt_GetCodepointKernAdvance(&lFontInfo,
-                                                               static_cast<int>(lA),
-                                                               static_cast<int>(lB));
-                if (lRaw == 0)
-                {
-                    continue;
-                }
-                m_Kerning.push_back({
-                    static_cast<Uint8>(lA),
-                    static_cast<Uint8>(lB),
-                    static_cast<float>(lRaw) * lScale
-                });
-            }
-        }
-        std::sort(m_Kerning.begin(), m_Kerning.end(),
-                  [](const KerningPair& InA, const KerningPair& InB) noexcept
-                  {
-                      return PackKerningKey(InA.First, InA.Second)
-                           < PackKerningKey(InB.First, InB.Second);
-                  });
-        m_Kerning.shrink_to_fit();
+        m_AtlasSize = InData.AtlasSize;
+        m_VMetrics  = InData.VMetrics;
+        m_Kerning   = Move(InData.Kerning);
+        std::copy(std::begin(InData.Glyphs), std::end(InData.Glyphs), std::begin(m_Glyphs));
 
         m_State = EAssetState::Loaded;
-        OPAAX_CORE_INFO("FontAsset loaded '{}' ({} glyphs, atlas {}x{}, kern pairs {}, ascent {:.1f} / descent {:.1f} / lineGap {:.1f})",
+        OPAAX_CORE_INFO("FontAsset loaded '{}' ({} glyphs, {} atlas {}x{}, kern pairs {}, ascent {:.1f} / descent {:.1f} / lineGap {:.1f})",
                         m_SourcePath.CStr(),
-                        CodepointCount, m_AtlasSize, m_AtlasSize, m_Kerning.size(),
+                        CodepointCount, IsDistanceField() ? "SDF" : "bitmap",
+                        m_AtlasSize, m_AtlasSize, m_Kerning.size(),
                         m_VMetrics.Ascent, m_VMetrics.Descent, m_VMetrics.LineGap);
     }
 
-    // Defined here so UniquePtr<Texture2D>'s deleter sees the complete type.
-    FontAsset::~FontAsset() = default;
-
     // =============================================================================
     // Public API
     // =============================================================================
+    bool FontAsset::Bake(const OpaaxString& InSourcePath, EFontBakeMode InBakeMode, const OpaaxString& InCacheDir,
+                         FontBakeData& OutData)
+    {
+        return BakeFont(InSourcePath, InBakeMode, InCacheDir, OutData);
+    }
+
+    Uint64 FontAsset::GetMemorySize() const
+    {
+        const Uint64 lAtlas = m_Atlas ? sizeof(Texture2D) + m_Atlas->GetGpuMemorySize() : 0u;
+        return lAtlas + m_Kerning.capacity() * sizeof(KerningPair);
+    }
+
     bool FontAsset::GetGlyphMetrics(char InCodepoint, GlyphMetrics& OutMetrics) const noexcept
     {
         const Uint32 lCp = static_cast<Uint32>(static_cast<unsigned char>(InCodepoint));
@@ -12,6 +12,22 @@
 namespace Opaax
 {
     class Texture2D;
+    class JobSubsystem;
+    struct FontBakeData;
+
+    /**
+     * @enum EFontBakeMode
+     * How FontAsset rasterises its atlas.
+     *  - Bitmap:        stbtt_PackFontRange coverage at PixelHeight, 2x2 oversampled. Crisp at
+     *                   Scale 1, blurry/blocky when scaled up.
+     *  - DistanceField: single-channel SDF (stbtt_GetCodepointSDF) baked at SdfPixelHeight; the
+     *                   sprite shader thresholds it, so one atlas stays sharp at every Scale.
+     */
+    enum class EFontBakeMode : Uint8
+    {
+        Bitmap,
+        DistanceField
+    };
 
     // =============================================================================
     // FontAsset
@@ -25,8 +41,14 @@ namespace Opaax
     // Bake pixel height: 32 px.
     // Atlas: starts 512x512 R8, grows by doubling up to 2048x2048; fails loudly
     // past the cap. Oversample default (2,2) for sharper anti-alias.
+    // DistanceField mode: per-glyph SDFs at SdfPixelHeight, shelf-packed into the
+    // same R8 atlas (no oversampling — the field interpolates cleanly).
     //
     // Kerning is NOT in this step — Step 3 of M5 adds the kerning LUT.
+    //
+    // Bake output (atlas + metrics + kerning) is persisted by FontBakeCache; a
+    // cache hit skips stb_truetype entirely. The async ctor runs read + bake on
+    // a JobSubsystem worker and only the atlas upload on the main thread.
     // =============================================================================
     /**
      * @class FontAsset
@@ -48,6 +70,13 @@ namespace Opaax
         static constexpr Uint32 InitialAtlas   = 512u;
         static constexpr Uint32 MaxAtlas       = 2048u;
 
+        // DistanceField bake: glyphs rasterised at SdfPixelHeight with SdfPadding px of field
+        // around each; the edge sits at SdfOnEdge (of 255). Metrics are rescaled to PixelHeight
+        // so DrawParams::Scale means the same thing in both modes.
+        static constexpr float  SdfPixelHeight = 48.f;
+        static constexpr Int32  SdfPadding     = 5;
+        static constexpr Uint8  SdfOnEdge      = 128;
+
         // =============================================================================
         // POD types
         // =============================================================================
@@ -101,8 +130,26 @@ namespace Opaax
          * @param InSourcePath Path the engine resolves at runtime (cwd-relative or
          *                     project-relative — matches Texture2D resolution).
          * @param InAssetID    Registry-stable logical ID.
+         * @param InBakeMode   Bitmap coverage (default) or signed distance field.
          */
-        FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID);
+        FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                  EFontBakeMode InBakeMode = EFontBakeMode::Bitmap);
+
+        /**
+         * Async load. File read + bake (or baked-cache hit) run on an InJobs worker; the atlas
+         * upload runs in the job's main-thread completion. State is Loading until then, Loaded
+         * or Failed after — Text2D already skips fonts that are not IsLoaded().
+         * Destroying the asset before completion is safe: the result is dropped.
+         */
+        FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                  EFontBakeMode InBakeMode, JobSubsystem& InJobs);
+
+        /**
+         * Pre-baked load: adopt InBaked (from Bake, typically run on a worker by
+         * AssetRegistry::LoadAsync) and upload the atlas. Main thread. Loaded or Failed on return.
+         */
+        FontAsset(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                  EFontBakeMode InBakeMode, FontBakeData& InBaked);
 
         ~FontAsset() override;
 
@@ -127,6 +174,7 @@ namespace Opaax
         AssetType          GetType()       const override { return AssetType::Font;  }
         EAssetState        GetState()      const override { return m_State;         }
         const OpaaxString& GetSourcePath() const override { return m_SourcePath;    }
+        Uint64             GetMemorySize() const override;   // atlas texture + kerning table
         //~ End IAsset interface
 
         // =============================================================================
@@ -137,6 +185,8 @@ namespace Opaax
         FORCEINLINE Uint32              GetAtlasSize()    const noexcept { return m_AtlasSize;    }
         FORCEINLINE const Texture2D*    GetAtlasTexture() const noexcept { return m_Atlas.get();  }
         FORCEINLINE const FontVMetrics& GetFontVMetrics() const noexcept { return m_VMetrics;     }
+        FORCEINLINE EFontBakeMode       GetBakeMode()     const noexcept { return m_BakeMode;     }
+        FORCEINLINE bool                IsDistanceField() const noexcept { return m_BakeMode == EFontBakeMode::DistanceField; }
 
         /**
          * Per-glyph metrics for a codepoint in [0x20..0x7E]. Returns false for
@@ -157,6 +207,24 @@ namespace Opaax
             return static_cast<Uint32>(m_Kerning.size());
         }
 
+        /**
+         * CPU half of a load — TTF read + bake, or a baked-cache hit. Touches no engine state
+         * beyond logging, so it is safe on any thread: InCacheDir comes from
+         * FontBakeCache::ResolveDirectory on the main thread (empty = no cache). False on failure (logged).
+         */
+        static bool Bake(const OpaaxString& InSourcePath, EFontBakeMode InBakeMode, const OpaaxString& InCacheDir,
+                         FontBakeData& OutData);
+
+        // =============================================================================
+        // Internal
+        // =============================================================================
+    private:
+        // Shared between the asset and its in-flight bake job (defined in FontAsset.cpp).
+        struct PendingBake;
+
+        // Main thread: GPU atlas upload + adopt the CPU-side bake. Sets Loaded or Failed.
+        void Finalize(FontBakeData& InData);
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -164,11 +232,13 @@ namespace Opaax
         OpaaxStringID            m_AssetID    = {};
         OpaaxString              m_SourcePath;
         EAssetState              m_State      = EAssetState::Unloaded;
+        EFontBakeMode            m_BakeMode   = EFontBakeMode::Bitmap;
         UniquePtr<Texture2D>     m_Atlas;
         Uint32                   m_AtlasSize  = 0u;
         GlyphMetrics             m_Glyphs[CodepointCount] = {};
         FontVMetrics             m_VMetrics   = {};
         TDynArray<KerningPair> m_Kerning;
+        SharedPtr<PendingBake>   m_PendingBake;   // non-null while an async bake is in flight
     };
 
 } // namespace Opaax
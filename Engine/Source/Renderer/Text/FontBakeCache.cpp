@@ -0,0 +1,66 @@
+#include "FontBakeCache.h"
+
+#include "Core/Config/EngineConfig.h"
+#include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxFile.h"
+
+#include <cstdio>
+
+namespace Opaax
+{
+    namespace
+    {
+        // <FileHash>_<FileSize>_<PixelHeight>_<OversampleH>x<OversampleV>_<Mode>.fontbake — the header
+        // re-checks every field, the name only has to keep distinct keys in distinct files.
+        OpaaxString EntryPath(const OpaaxString& InDirectory, const FontBakeKey& InKey)
+        {
+            char lName[96];
+            std::snprintf(lName, sizeof(lName), "/%08x_%u_%g_%ux%u_%u.fontbake",
+                          InKey.FileHash, InKey.FileSize, static_cast<double>(InKey.PixelHeight),
+                          InKey.OversampleH, InKey.OversampleV, static_cast<Uint32>(InKey.Mode));
+            OpaaxString lPath = InDirectory;
+            lPath += lName;
+            return lPath;
+        }
+    }
+
+    OpaaxString FontBakeCache::ResolveDirectory()
+    {
+        return EngineConfig::CacheDirectory("Fonts");
+    }
+
+    bool FontBakeCache::Read(const OpaaxString& InDirectory, const FontBakeKey& InKey, FontBakeData& OutData)
+    {
+        if (InDirectory.IsEmpty())
+        {
+            return false;
+        }
+
+        const OpaaxString lPath = EntryPath(InDirectory, InKey);
+        TDynArray<Uint8>  lBytes;
+        if (!OpaaxFile::ReadBinary(lPath.CStr(), lBytes))
+        {
+            return false;
+        }
+
+        if (!Deserialize(lBytes.data(), lBytes.size(), InKey, OutData))
+        {
+            OPAAX_CORE_WARN("FontBakeCache: discarding stale or corrupt entry '{}'", lPath.CStr());
+            return false;
+        }
+        return true;
+    }
+
+    bool FontBakeCache::Write(const OpaaxString& InDirectory, const FontBakeKey& InKey, const FontBakeData& InData)
+    {
+        if (InDirectory.IsEmpty())
+        {
+            return false;
+        }
+
+        TDynArray<Uint8> lBytes;
+        Serialize(InKey, InData, lBytes);
+        return OpaaxFile::WriteBinaryAtomic(EntryPath(InDirectory, InKey).CStr(), lBytes.data(), lBytes.size());
+    }
+
+} // namespace Opaax
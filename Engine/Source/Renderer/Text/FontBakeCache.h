@@ -0,0 +1,228 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxHash.h"
+#include "Core/OpaaxString.hpp"
+#include "Core/OpaaxTypes.h"
+#include "Renderer/Text/FontAsset.h"
+
+#include <cstring>
+#include <vector>
+
+namespace Opaax
+{
+    // =============================================================================
+    // Baked-font cache
+    //
+    // Everything FontAsset derives from a TTF — the R8 atlas, per-glyph metrics,
+    // vertical metrics and the kerning table — persisted as one versioned binary
+    // blob so later launches skip stbtt_PackFontRange / the 95x95 kern matrix and
+    // go straight to the GPU upload.
+    //
+    // Keyed by (font file content hash + size, raster pixel height, oversampling,
+    // bake mode). The key is stored in the header and checked on read, so a
+    // stale or colliding file is a miss, never wrong glyphs. A trailing FNV-1a
+    // checksum rejects torn/corrupt writes. Host byte order — the cache is
+    // machine-local derived data, not a shipped format.
+    //
+    // Serialize/Deserialize are header-inline and RHI-free (unit-testable); the
+    // disk half lives in FontBakeCache.cpp.
+    // =============================================================================
+
+    /**
+     * @struct FontBakeData
+     * CPU-side bake output. Produced on a worker (or the loading thread), consumed by
+     * FontAsset on the main thread for the atlas upload.
+     */
+    struct FontBakeData
+    {
+        Uint32                            AtlasSize = 0u;
+        std::vector<unsigned char>        Atlas;                             // AtlasSize^2 R8 texels
+        FontAsset::GlyphMetrics           Glyphs[FontAsset::CodepointCount] = {};
+        FontAsset::FontVMetrics           VMetrics  = {};
+        TDynArray<FontAsset::KerningPair> Kerning;                           // sorted, as FontAsset expects
+    };
+
+    /**
+     * @struct FontBakeKey
+     * Inputs that determine a bake's output. PixelHeight/Oversample are the raster settings
+     * actually used (SdfPixelHeight and 1x1 for DistanceField).
+     */
+    struct FontBakeKey
+    {
+        Uint32        FileHash    = 0u;   // OpaaxHash::HashBytes over the TTF bytes
+        Uint32        FileSize    = 0u;
+        float         PixelHeight = 0.f;
+        Uint32        OversampleH = 1u;
+        Uint32        OversampleV = 1u;
+        EFontBakeMode Mode        = EFontBakeMode::Bitmap;
+
+        bool operator==(const FontBakeKey& InOther) const noexcept
+        {
+            return FileHash == InOther.FileHash && FileSize == InOther.FileSize
+                && PixelHeight == InOther.PixelHeight && OversampleH == InOther.OversampleH
+                && OversampleV == InOther.OversampleV && Mode == InOther.Mode;
+        }
+    };
+
+    namespace FontBakeCache
+    {
+        static constexpr Uint32 Magic   = 0x4342464Fu;   // "OFBC"
+        static constexpr Uint32 Version = 1u;            // bump on any layout / bake-algorithm change
+
+        namespace Detail
+        {
+            template<typename T>
+            FORCEINLINE void Put(TDynArray<Uint8>& OutBytes, const T& InValue)
+            {
+                const size_t lAt = OutBytes.size();
+                OutBytes.resize(lAt + sizeof(T));
+                std::memcpy(OutBytes.data() + lAt, &InValue, sizeof(T));
+            }
+
+            struct Reader
+            {
+                const Uint8* Data;
+                size_t       Size;
+                size_t       Pos = 0;
+
+                template<typename T>
+                bool Get(T& OutValue) noexcept
+                {
+                    if (Size - Pos < sizeof(T)) { return false; }
+                    std::memcpy(&OutValue, Data + Pos, sizeof(T));
+                    Pos += sizeof(T);
+                    return true;
+                }
+            };
+
+            inline void PutGlyph(TDynArray<Uint8>& OutBytes, const FontAsset::GlyphMetrics& InG)
+            {
+                const float lFields[9] = { InG.UVMin.x, InG.UVMin.y, InG.UVMax.x, InG.UVMax.y,
+                                           InG.QuadOffset.x, InG.QuadOffset.y,
+                                           InG.QuadSize.x, InG.QuadSize.y, InG.XAdvance };
+                Put(OutBytes, lFields);
+            }
+
+            inline bool GetGlyph(Reader& InReader, FontAsset::GlyphMetrics& OutG) noexcept
+            {
+                float lFields[9] = {};
+                if (!InReader.Get(lFields)) { return false; }
+                OutG.UVMin      = Vector2F(lFields[0], lFields[1]);
+                OutG.UVMax      = Vector2F(lFields[2], lFields[3]);
+                OutG.QuadOffset = Vector2F(lFields[4], lFields[5]);
+                OutG.QuadSize   = Vector2F(lFields[6], lFields[7]);
+                OutG.XAdvance   = lFields[8];
+                return true;
+            }
+        }
+
+        /** Encode InData under InKey. Fields are written one by one — no struct padding on disk. */
+        inline void Serialize(const FontBakeKey& InKey, const FontBakeData& InData, TDynArray<Uint8>& OutBytes)
+        {
+            using namespace Detail;
+            OutBytes.clear();
+            OutBytes.reserve(128 + sizeof(float) * 9 * FontAsset::CodepointCount
+                             + InData.Kerning.size() * 6 + InData.Atlas.size());
+
+            Put(OutBytes, Magic);
+            Put(OutBytes, Version);
+            Put(OutBytes, InKey.FileHash);
+            Put(OutBytes, InKey.FileSize);
+            Put(OutBytes, InKey.PixelHeight);
+            Put(OutBytes, InKey.OversampleH);
+            Put(OutBytes, InKey.OversampleV);
+            Put(OutBytes, static_cast<Uint32>(InKey.Mode));
+            Put(OutBytes, FontAsset::FirstCodepoint);
+            Put(OutBytes, FontAsset::CodepointCount);
+
+            Put(OutBytes, InData.VMetrics.Ascent);
+            Put(OutBytes, InData.VMetrics.Descent);
+            Put(OutBytes, InData.VMetrics.LineGap);
+            Put(OutBytes, InData.VMetrics.LineAdvance);
+            for (const FontAsset::GlyphMetrics& lG : InData.Glyphs) { PutGlyph(OutBytes, lG); }
+
+            Put(OutBytes, static_cast<Uint32>(InData.Kerning.size()));
+            for (const FontAsset::KerningPair& lK : InData.Kerning)
+            {
+                Put(OutBytes, lK.First);
+                Put(OutBytes, lK.Second);
+                Put(OutBytes, lK.Advance);
+            }
+
+            Put(OutBytes, InData.AtlasSize);
+            OutBytes.insert(OutBytes.end(), InData.Atlas.begin(), InData.Atlas.end());
+
+            Put(OutBytes, OpaaxHash::HashBytes(OutBytes.data(), OutBytes.size()));
+        }
+
+        /**
+         * Decode a blob written by Serialize. False (OutData unspecified) on a wrong magic/version,
+         * a key or codepoint-range mismatch, truncation or a checksum failure.
+         */
+        inline bool Deserialize(const Uint8* InBytes, size_t InSize, const FontBakeKey& InKey, FontBakeData& OutData)
+        {
+            using namespace Detail;
+            if (!InBytes || InSize < sizeof(Uint32)) { return false; }
+
+            const size_t lBody = InSize - sizeof(Uint32);
+            Uint32 lStoredSum = 0;
+            std::memcpy(&lStoredSum, InBytes + lBody, sizeof(Uint32));
+            if (lStoredSum != OpaaxHash::HashBytes(InBytes, lBody)) { return false; }
+
+            Reader      lIn{ InBytes, lBody };
+            Uint32      lMagic = 0, lVersion = 0, lMode = 0, lFirst = 0, lCount = 0;
+            FontBakeKey lKey;
+            if (!lIn.Get(lMagic) || lMagic != Magic || !lIn.Get(lVersion) || lVersion != Version) { return false; }
+            if (!lIn.Get(lKey.FileHash) || !lIn.Get(lKey.FileSize) || !lIn.Get(lKey.PixelHeight)
+                || !lIn.Get(lKey.OversampleH) || !lIn.Get(lKey.OversampleV) || !lIn.Get(lMode))
+            {
+                return false;
+            }
+            lKey.Mode = static_cast<EFontBakeMode>(lMode);
+            if (!(lKey == InKey)) { return false; }
+            if (!lIn.Get(lFirst) || lFirst != FontAsset::FirstCodepoint
+                || !lIn.Get(lCount) || lCount != FontAsset::CodepointCount)
+            {
+                return false;
+            }
+
+            if (!lIn.Get(OutData.VMetrics.Ascent) || !lIn.Get(OutData.VMetrics.Descent)
+                || !lIn.Get(OutData.VMetrics.LineGap) || !lIn.Get(OutData.VMetrics.LineAdvance))
+            {
+                return false;
+            }
+            for (FontAsset::GlyphMetrics& lG : OutData.Glyphs)
+            {
+                if (!GetGlyph(lIn, lG)) { return false; }
+            }
+
+            Uint32 lKernCount = 0;
+            if (!lIn.Get(lKernCount) || lKernCount > FontAsset::CodepointCount * FontAsset::CodepointCount) { return false; }
+            OutData.Kerning.resize(lKernCount);
+            for (FontAsset::KerningPair& lK : OutData.Kerning)
+            {
+                if (!lIn.Get(lK.First) || !lIn.Get(lK.Second) || !lIn.Get(lK.Advance)) { return false; }
+            }
+
+            if (!lIn.Get(OutData.AtlasSize) || OutData.AtlasSize == 0 || OutData.AtlasSize > FontAsset::MaxAtlas) { return false; }
+            const size_t lTexels = static_cast<size_t>(OutData.AtlasSize) * OutData.AtlasSize;
+            if (lIn.Size - lIn.Pos != lTexels) { return false; }
+            OutData.Atlas.assign(InBytes + lIn.Pos, InBytes + lIn.Pos + lTexels);
+            return true;
+        }
+
+        /**
+         * Absolute directory baked fonts are cached in (<EngineConfig::CacheRelPath>/Fonts), or
+         * empty when caching is disabled. Resolve on the main thread and hand to the bake.
+         */
+        OPAAX_API OpaaxString ResolveDirectory();
+
+        /** Load the entry for InKey from InDirectory. False on miss or any validation failure. */
+        OPAAX_API bool Read(const OpaaxString& InDirectory, const FontBakeKey& InKey, FontBakeData& OutData);
+
+        /** Persist InData for InKey (temp file + rename, so a concurrent reader never sees half a file). */
+        OPAAX_API bool Write(const OpaaxString& InDirectory, const FontBakeKey& InKey, const FontBakeData& InData);
+    }
+
+} // namespace Opaax
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+#include "Core/OpaaxMathTypes.h"
+#include "Renderer/Renderer2D.h"   // SpriteRunQuad
+
+#include <cstring>
+#include <list>
+#include <string>
+
+namespace Opaax
+{
+    class FontAsset;
+}
+
+namespace Opaax::Text2D
+{
+    // =============================================================================
+    // Glyph-run cache (pure)
+    //
+    // Text2D lays a string out once into a GlyphRun — one quad per visible glyph,
+    // corners relative to the text's top-left origin — and replays it on later
+    // frames through Renderer2D::DrawSpriteRun. HUD/debug text is mostly identical
+    // frame to frame, so a hit skips the glyph lookups, kerning searches and
+    // per-glyph DrawSprite calls entirely.
+    //
+    // Keyed by (text hash, font, layout params). Color is NOT part of the key — it
+    // is applied at emit — so a tint animation still hits. The stored text is
+    // compared on lookup, so a hash collision can only cost a miss.
+    //
+    // Header-inline and RHI-free so the LRU/budget logic is unit-testable alone.
+    // =============================================================================
+
+    /**
+     * @struct GlyphRunKey
+     * Identity of a laid-out run. Only the DrawParams fields that change geometry.
+     */
+    struct GlyphRunKey
+    {
+        Uint32           TextHash        = 0;
+        const FontAsset* Font            = nullptr;
+        float            Scale           = 1.f;
+        float            LineHeightScale = 1.f;
+        bool             EnableKerning   = true;
+
+        bool operator==(const GlyphRunKey& InOther) const noexcept
+        {
+            return TextHash == InOther.TextHash && Font == InOther.Font && Scale == InOther.Scale
+                && LineHeightScale == InOther.LineHeightScale && EnableKerning == InOther.EnableKerning;
+        }
+    };
+
+    struct GlyphRunKeyHash
+    {
+        size_t operator()(const GlyphRunKey& InKey) const noexcept
+        {
+            Uint32 lScale = 0, lLine = 0;
+            std::memcpy(&lScale, &InKey.Scale, sizeof(float));
+            std::memcpy(&lLine,  &InKey.LineHeightScale, sizeof(float));
+
+            size_t lHash = InKey.TextHash;
+            lHash = lHash * 31u + reinterpret_cast<size_t>(InKey.Font);
+            lHash = lHash * 31u + lScale;
+            lHash = lHash * 31u + lLine;
+            return lHash * 2u + (InKey.EnableKerning ? 1u : 0u);
+        }
+    };
+
+    /**
+     * @struct GlyphRun
+     * A laid-out string: origin-relative quads plus the Measure() result.
+     */
+    struct GlyphRun
+    {
+        std::string              Text;    // collision guard
+        TDynArray<SpriteRunQuad> Quads;
+        Vector2F                 Size = { 0.f, 0.f };   // {max line width, total height}
+    };
+
+    /**
+     * @struct GlyphRunCacheStats
+     * Lifetime counters (Clear() resets them) + current occupancy.
+     */
+    struct GlyphRunCacheStats
+    {
+        Uint64 Hits      = 0;
+        Uint64 Misses    = 0;
+        Uint64 Evictions = 0;
+        Uint32 Entries   = 0;
+        Uint32 Quads     = 0;
+    };
+
+    /**
+     * @class GlyphRunCache
+     *
+     * LRU map GlyphRunKey -> GlyphRun under two budgets: entry count and total quads
+     * (the memory that actually grows with text length). A run larger than the whole
+     * quad budget is never admitted — callers draw it from their scratch layout.
+     */
+    class GlyphRunCache
+    {
+        // =============================================================================
+        // CTOR - DTOR
+        // =============================================================================
+    public:
+        static constexpr Uint32 DefaultMaxEntries = 256;
+        static constexpr Uint32 DefaultMaxQuads   = 16384;
+
+        explicit GlyphRunCache(Uint32 InMaxEntries = DefaultMaxEntries, Uint32 InMaxQuads = DefaultMaxQuads)
+            : m_MaxEntries(InMaxEntries), m_MaxQuads(InMaxQuads) {}
+
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        /** Cached run for (InKey, InText), promoted to most-recent; nullptr on miss. */
+        const GlyphRun* Find(const GlyphRunKey& InKey, const char* InText)
+        {
+            auto lIt = m_Index.find(InKey);
+            if (lIt == m_Index.end() || lIt->second->Run.Text != InText)
+            {
+                ++m_Stats.Misses;
+                return nullptr;
+            }
+            m_Lru.splice(m_Lru.begin(), m_Lru, lIt->second);
+            ++m_Stats.Hits;
+            return &lIt->second->Run;
+        }
+
+        /** True when a run of InQuadCount quads fits the budget at all. */
+        FORCEINLINE bool CanAdmit(Uint32 InQuadCount) const noexcept
+        {
+            return m_MaxEntries > 0 && InQuadCount <= m_MaxQuads;
+        }
+
+        /**
+         * Store InRun under InKey (replacing a colliding entry), evicting least-recently
+         * used runs until both budgets hold. Caller checks CanAdmit first.
+         */
+        const GlyphRun& Insert(const GlyphRunKey& InKey, GlyphRun&& InRun)
+        {
+            auto lExisting = m_Index.find(InKey);
+            if (lExisting != m_Index.end()) { Erase(lExisting->second); }
+
+            const Uint32 lQuads = static_cast<Uint32>(InRun.Quads.size());
+            while (!m_Lru.empty() && (m_Index.size() >= m_MaxEntries || m_Stats.Quads + lQuads > m_MaxQuads))
+            {
+                Erase(std::prev(m_Lru.end()));
+                ++m_Stats.Evictions;
+            }
+
+            m_Lru.push_front({ InKey, Move(InRun) });
+            m_Index[InKey] = m_Lru.begin();
+            m_Stats.Quads += lQuads;
+            m_Stats.Entries = static_cast<Uint32>(m_Index.size());
+            return m_Lru.front().Run;
+        }
+
+        /** Drop every run laid out with InFont (called when the font is destroyed). */
+        void EvictFont(const FontAsset* InFont)
+        {
+            for (auto lIt = m_Lru.begin(); lIt != m_Lru.end();)
+            {
+                auto lNext = std::next(lIt);
+                if (lIt->Key.Font == InFont) { Erase(lIt); }
+                lIt = lNext;
+            }
+        }
+
+        void Clear()
+        {
+            m_Lru.clear();
+            m_Index.clear();
+            m_Stats = {};
+        }
+
+        /** Shrinking evicts immediately (LRU first). */
+        void SetCapacity(Uint32 InMaxEntries, Uint32 InMaxQuads)
+        {
+            m_MaxEntries = InMaxEntries;
+            m_MaxQuads   = InMaxQuads;
+            while (!m_Lru.empty() && (m_Index.size() > m_MaxEntries || m_Stats.Quads > m_MaxQuads))
+            {
+                Erase(std::prev(m_Lru.end()));
+                ++m_Stats.Evictions;
+            }
+        }
+
+        FORCEINLINE const GlyphRunCacheStats& GetStats() const noexcept { return m_Stats; }
+
+    private:
+        struct Entry
+        {
+            GlyphRunKey Key;
+            GlyphRun    Run;
+        };
+        using EntryList = std::list<Entry>;
+
+        void Erase(EntryList::iterator InIt)
+        {
+            m_Stats.Quads -= static_cast<Uint32>(InIt->Run.Quads.size());
+            m_Index.erase(InIt->Key);
+            m_Lru.erase(InIt);
+            m_Stats.Entries = static_cast<Uint32>(m_Index.size());
+        }
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        EntryList                                                       m_Lru;      // front = most recent
+        UnorderedMap<GlyphRunKey, EntryList::iterator, GlyphRunKeyHash> m_Index;
+        Uint32                                                          m_MaxEntries;
+        Uint32                                                          m_MaxQuads;
+        GlyphRunCacheStats                                              m_Stats;
+    };
+
+} // namespace Opaax::Text2D
@@ -3,6 +3,9 @@
 #include "Renderer/Renderer2D.h"
 #include "Renderer/Text/FontAsset.h"
 #include "Renderer/Texture2D.h"
+#include "Core/OpaaxHash.h"
+
+#include <mutex>
 
 namespace Opaax::Text2D
 {
@@ -27,6 +30,135 @@ namespace Opaax::Text2D
             }
             return InFont.GetGlyphMetrics(sFallbackGlyph, OutG);
         }
+
+        GlyphRunCache s_RunCache;
+        GlyphRun      s_Scratch;    // layout target on a miss — moved into the cache when admitted
+
+        // Guards s_RunCache + s_Scratch: passes may record in parallel (render.parallelPassRecording),
+        // and a returned run is only valid while the lock is held.
+        std::mutex    s_RunMutex;
+
+        // Lay InText out into OutRun: one quad per visible glyph, corners relative to the
+        // text's top-left origin, plus the Measure() size. The single layout walker shared
+        // by DrawString and Measure (cached or not).
+        void LayoutRun(const char* InText, const FontAsset& InFont, const DrawParams& InParams, GlyphRun& OutRun)
+        {
+            OutRun.Text = InText;
+            OutRun.Quads.clear();
+
+            const FontAsset::FontVMetrics& lV = InFont.GetFontVMetrics();
+            const float lScale      = InParams.Scale;
+            const float lLineDownPx = lV.LineAdvance * InParams.LineHeightScale * lScale;
+
+            FontAsset::GlyphMetrics lSpace = {};
+            const bool              lSpaceOk = InFont.GetGlyphMetrics(' ', lSpace);
+
+            // Y-UP world: the origin is the text's top-left. Baseline sits BELOW the top
+            // by Ascent*Scale (stb's Ascent is the distance from baseline to the highest
+            // glyph extent; in y-up world that distance goes upward, so baseline =
+            // top - Ascent).
+            float  lCursorX   = 0.f;
+            float  lCursorY   = -lV.Ascent * lScale;
+            float  lMaxWidth  = 0.f;
+            Uint32 lLineCount = 1u;
+            char   lPrev      = 0;
+
+            for (const char* lP = InText; *lP; ++lP)
+            {
+                const char lC = *lP;
+
+                if (lC == '\n')
+                {
+                    if (lCursorX > lMaxWidth) { lMaxWidth = lCursorX; }
+                    lCursorX = 0.f;
+                    lCursorY -= lLineDownPx; // y-up: new line moves the baseline downward
+                    ++lLineCount;
+                    lPrev    = 0;
+                    continue;
+                }
+                if (lC == '\t')
+                {
+                    if (lSpaceOk)
+                    {
+                        lCursorX += static_cast<float>(sTabSpaceWidth) * lSpace.XAdvance * lScale;
+                    }
+                    lPrev = 0;
+                    continue;
+                }
+
+                FontAsset::GlyphMetrics lG = {};
+                if (!ResolveGlyph(InFont, lC, lG))
+                {
+                    lPrev = 0;
+                    continue;
+                }
+
+                // Apply kerning before fixing this glyph's draw position. GetKerning
+                // returns 0 for prev=0 (start of line / after tab) since 0 is outside
+                // the baked range — no special-case branch needed beyond the toggle.
+                if (InParams.EnableKerning && lPrev != 0)
+                {
+                    lCursorX += InFont.GetKerning(lPrev, lC) * lScale;
+                }
+
+                // Y-UP quad geometry. QuadOffset.y is stb's yoff (offset from pen to
+                // bbox top in stb's y-down — typically negative for ascending glyphs).
+                // top_y    = cursor_y - QuadOffset.y * Scale    (subtracting a negative goes up)
+                // bottom_y = top_y - QuadSize.y * Scale         (y-up: down = subtract)
+                //
+                // Equivalent (LearnOpenGL §60 reference-glyph trick) but cleaner —
+                // uses the documented font Ascent instead of a top-touching probe glyph.
+                // Zero-area glyphs (space) advance the pen but emit no quad.
+                const float lQuadW = lG.QuadSize.x * lScale;
+                const float lQuadH = lG.QuadSize.y * lScale;
+                if (lQuadW > 0.f && lQuadH > 0.f)
+                {
+                    const float lLeftX = lCursorX + lG.QuadOffset.x * lScale;
+                    const float lTopY  = lCursorY - lG.QuadOffset.y * lScale;
+
+                    // UVMin/UVMax are V-swapped at bake (Step 2) — they map cleanly to
+                    // Renderer2D's bottom-up vertex layout. No per-draw UV correction.
+                    SpriteRunQuad& lQuad = OutRun.Quads.emplace_back();
+                    lQuad.Min   = { lLeftX, lTopY - lQuadH };
+                    lQuad.Max   = { lLeftX + lQuadW, lTopY };
+                    lQuad.UVMin = lG.UVMin;
+                    lQuad.UVMax = lG.UVMax;
+                }
+
+                lCursorX += lG.XAdvance * lScale;
+                lPrev = lC;
+            }
+            if (lCursorX > lMaxWidth) { lMaxWidth = lCursorX; }
+
+            // Total height = N_lines * LineAdvance — over-estimates by ~LineGap on the
+            // last line but matches "where the next line would start if appended" which
+            // is what layout callers (future Draw Debug API) actually need.
+            OutRun.Size = { lMaxWidth, static_cast<float>(lLineCount) * lLineDownPx };
+        }
+
+        // Cached run for (InText, InFont, InParams), laid out + admitted on a miss. Runs too
+        // large for the cache budget are laid out into s_Scratch (valid until the next call).
+        const GlyphRun& AcquireRun(const char* InText, const FontAsset& InFont, const DrawParams& InParams)
+        {
+            GlyphRunKey lKey;
+            lKey.TextHash        = OpaaxHash::Hash(InText);
+            lKey.Font            = &InFont;
+            lKey.Scale           = InParams.Scale;
+            lKey.LineHeightScale = InParams.LineHeightScale;
+            lKey.EnableKerning   = InParams.EnableKerning;
+
+            if (const GlyphRun* lHit = s_RunCache.Find(lKey, InText))
+            {
+                return *lHit;
+            }
+
+            LayoutRun(InText, InFont, InParams, s_Scratch);
+            if (!s_RunCache.CanAdmit(static_cast<Uint32>(s_Scratch.Quads.size())))
+            {
+                return s_Scratch;
+            }
+            return s_RunCache.Insert(lKey, Move(s_Scratch));
+        }
     }
 
     // =============================================================================
@@ -46,85 +178,14 @@ namespace Opaax::Text2D
         {
             return;
         }
-        // Renderer2D::DrawSprite mutates only its own bind-slot state, not the texture.
+        // Renderer2D::DrawSpriteRun mutates only its own bind-slot state, not the texture.
         Texture2D& lAtlas = const_cast<Texture2D&>(*lAtlasPtr);
 
-        const FontAsset::FontVMetrics& lV = InFont.GetFontVMetrics();
-        const float lScale      = InParams.Scale;
-        const float lLineDownPx = lV.LineAdvance * InParams.LineHeightScale * lScale;
-
-        // Y-UP world: user passes the text's top-left. Baseline sits BELOW the top
-        // by Ascent*Scale (stb's Ascent is the distance from baseline to the highest
-        // glyph extent; in y-up world that distance goes upward, so baseline =
-        // top - Ascent).
-        const float lStartX     = InWorldPos.x;
-        const float lBaselineY0 = InWorldPos.y - lV.Ascent * lScale;
-
-        FontAsset::GlyphMetrics lSpace = {};
-        const bool              lSpaceOk = InFont.GetGlyphMetrics(' ', lSpace);
-
-        float lCursorX = lStartX;
-        float lCursorY = lBaselineY0;
-        char  lPrev    = 0;
-
-        for (const char* lP = InText; *lP; ++lP)
-        {
-            const char lC = *lP;
-
-            if (lC == '\n')
-            {
-                lCursorX = lStartX;
-                lCursorY -= lLineDownPx; // y-up: new line moves the baseline downward
-                lPrev    = 0;
-                continue;
-            }
-            if (lC == '\t')
-            {
-                if (lSpaceOk)
-                {
-                    lCursorX += static_cast<float>(sTabSpaceWidth) * lSpace.XAdvance * lScale;
-                }
-                lPrev = 0;
-                continue;
-            }
-
-            FontAsset::GlyphMetrics lG = {};
-            if (!ResolveGlyph(InFont, lC, lG))
-            {
-                lPrev = 0;
-                continue;
-            }
-
-            // Apply kerning before fixing this glyph's draw position. GetKerning
-            // returns 0 for prev=0 (start of line / after tab) since 0 is outside
-            // the baked range — no special-case branch needed beyond the toggle.
-            if (InParams.EnableKerning && lPrev != 0)
-            {
-                lCursorX += InFont.GetKerning(lPrev, lC) * lScale;
-            }
-
-            // Y-UP quad geometry. QuadOffset.y is stb's yoff (offset from pen to
-            // bbox top in stb's y-down — typically negative for ascending glyphs).
-            // top_y    = cursor_y - QuadOffset.y * Scale    (subtracting a negative goes up)
-            // bottom_y = top_y - QuadSize.y * Scale         (y-up: down = subtract)
-            // center_y = top_y - QuadSize.y * Scale * 0.5
-            //
-            // Equivalent (LearnOpenGL §60 reference-glyph trick) but cleaner —
-            // uses the documented font Ascent instead of a top-touching probe glyph.
-            const float lQuadW   = lG.QuadSize.x * lScale;
-            const float lQuadH   = lG.QuadSize.y * lScale;
-            const float lTopY    = lCursorY - lG.QuadOffset.y * lScale;
-            const float lCenterX = lCursorX + lG.QuadOffset.x * lScale + lQuadW * 0.5f;
-            const float lCenterY = lTopY - lQuadH * 0.5f;
-
-            // UVMin/UVMax are V-swapped at bake (Step 2) — they map cleanly to
-            // Renderer2D's bottom-up vertex layout. No per-draw UV correction.
-            Renderer2D::DrawSprite({ lCenterX, lCenterY }, { lQuadW, lQuadH }, lAtlas,
-                                   lG.UVMin, lG.UVMax, InParams.Color, 0.f);
-
-            lCursorX += lG.XAdvance * lScale;
-            lPrev = lC;
-        }
+        std::scoped_lock lLock(s_RunMutex);
+        const GlyphRun& lRun = AcquireRun(InText, InFont, InParams);
+        Renderer2D::DrawSpriteRun(InWorldPos, lAtlas, lRun.Quads.data(),
+                                  static_cast<Uint32>(lRun.Quads.size()), InParams.Color,
+                                  ERenderLayer::Default, 0, InFont.IsDistanceField());
     }
 
     // =============================================================================
@@ -138,62 +199,36 @@ namespace Opaax::Text2D
         {
             return { 0.f, 0.f };
         }
+        // Measure-then-draw (centering) is the common pattern: the layout done here is the
+        // one the following DrawString replays.
+        std::scoped_lock lLock(s_RunMutex);
+        return AcquireRun(InText, InFont, InParams).Size;
+    }
 
-        const FontAsset::FontVMetrics& lV = InFont.GetFontVMetrics();
-        const float lScale      = InParams.Scale;
-        const float lLineDownPx = lV.LineAdvance * InParams.LineHeightScale * lScale;
-
-        FontAsset::GlyphMetrics lSpace = {};
-        const bool              lSpaceOk = InFont.GetGlyphMetrics(' ', lSpace);
-
-        float  lLineWidth = 0.f;
-        float  lMaxWidth  = 0.f;
-        Uint32 lLineCount = 1u;
-        char   lPrev      = 0;
-
-        for (const char* lP = InText; *lP; ++lP)
-        {
-            const char lC = *lP;
-
-            if (lC == '\n')
-            {
-                if (lLineWidth > lMaxWidth) { lMaxWidth = lLineWidth; }
-                lLineWidth = 0.f;
-                ++lLineCount;
-                lPrev = 0;
-                continue;
-            }
-            if (lC == '\t')
-            {
-                if (lSpaceOk)
-                {
-                    lLineWidth += static_cast<float>(sTabSpaceWidth) * lSpace.XAdvance * lScale;
-                }
-                lPrev = 0;
-                continue;
-            }
+    // =============================================================================
+    // Glyph-run cache
+    // =============================================================================
+    void SetGlyphRunCacheCapacity(Uint32 InMaxEntries, Uint32 InMaxQuads)
+    {
+        std::scoped_lock lLock(s_RunMutex);
+        s_RunCache.SetCapacity(InMaxEntries, InMaxQuads);
+    }
 
-            FontAsset::GlyphMetrics lG = {};
-            if (!ResolveGlyph(InFont, lC, lG))
-            {
-                lPrev = 0;
-                continue;
-            }
+    void ClearGlyphRunCache()
+    {
+        std::scoped_lock lLock(s_RunMutex);
+        s_RunCache.Clear();
+    }
 
-            if (InParams.EnableKerning && lPrev != 0)
-            {
-                lLineWidth += InFont.GetKerning(lPrev, lC) * lScale;
-            }
-            lLineWidth += lG.XAdvance * lScale;
-            lPrev = lC;
-        }
-        if (lLineWidth > lMaxWidth) { lMaxWidth = lLineWidth; }
+    void EvictGlyphRuns(const FontAsset& InFont)
+    {
+        std::scoped_lock lLock(s_RunMutex);
+        s_RunCache.EvictFont(&InFont);
+    }
 
-        // Total height = N_lines * LineAdvance — over-estimates by ~LineGap on the
-        // last line but matches "where the next line would start if appended" which
-        // is what layout callers (future Draw Debug API) actually need.
-        const float lTotalHeight = static_cast<float>(lLineCount) * lLineDownPx;
-        return { lMaxWidth, lTotalHeight };
+    const GlyphRunCacheStats& GetGlyphRunCacheStats()
+    {
+        return s_RunCache.GetStats();
     }
 
 } // namespace Opaax::Text2D
@@ -3,6 +3,7 @@
 #include "Core/EngineAPI.h"
 #include "Core/OpaaxMathTypes.h"
 #include "Renderer/Text/DrawParams.h"
+#include "Renderer/Text/GlyphRunCache.h"
 
 namespace Opaax
 {
@@ -15,8 +16,9 @@ namespace Opaax::Text2D
     // Text2D
     //
     // Engine-level text rendering primitive. World-space, top-left-anchored.
-    // Issues one Renderer2D::DrawSprite call per visible glyph into the existing
-    // batched-quad path. Position is the top-left of the first glyph's bounding
+    // Lays the string out once into an origin-relative glyph run (cached, LRU —
+    // see GlyphRunCache.h) and replays it through Renderer2D::DrawSpriteRun into
+    // the existing batched-quad path. Position is the top-left of the first glyph's bounding
     // box; the layout walker advances right + downward (Y-up world: downward =
     // smaller Y). Screen-space text is faked by callers updating worldPos per
     // frame against the camera (see future HUD milestone for ergonomic anchoring).
@@ -51,4 +53,19 @@ namespace Opaax::Text2D
                                const FontAsset&  InFont,
                                const DrawParams& InParams = {});
 
+    /**
+     * Glyph-run cache budget: at most InMaxEntries runs and InMaxQuads quads in
+     * total (defaults 256 / 16384). Shrinking evicts least-recently used runs.
+     * A 0 entry budget disables caching (every call lays out from scratch).
+     */
+    OPAAX_API void SetGlyphRunCacheCapacity(Uint32 InMaxEntries, Uint32 InMaxQuads);
+
+    /** Drop every cached run and reset the hit/miss counters. */
+    OPAAX_API void ClearGlyphRunCache();
+
+    /** Drop the runs laid out with InFont. Called by ~FontAsset — a run must never outlive its atlas. */
+    OPAAX_API void EvictGlyphRuns(const FontAsset& InFont);
+
+    OPAAX_API const GlyphRunCacheStats& GetGlyphRunCacheStats();
+
 } // namespace Opaax::Text2D
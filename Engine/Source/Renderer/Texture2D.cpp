@@ -1,9 +1,23 @@
 #include "Texture2D.h"
 
 #include "RHI/Texture.h"
+#include "RHI/GpuMemoryTracker.h"
+#include "Renderer/TextureResidency.h"
+#include "Assets/Pack/PackFileSystem.h"
+#include "Assets/Pack/TextureCook.h"
+#include "Core/Log/OpaaxLog.h"
+
+#include <mutex>
 
 namespace Opaax
 {
+    namespace
+    {
+        // Draw stamps + evicted re-uploads. Only residency-tracked textures take it: their GPU copy
+        // can be swapped back in mid-frame, by whichever recorder draws them first.
+        std::mutex s_AcquireMutex;
+    }
+
     // =============================================================================
     // CTORS - DTOR
     // =============================================================================
@@ -13,7 +27,28 @@ namespace Opaax
         , m_State(EAssetState::Loading)
         , m_Gpu(ITexture2D::Create(InSourcePath.CStr()))
     {
-        m_State = (m_Gpu && m_Gpu->IsLoaded()) ? EAssetState::Loaded : EAssetState::Failed;
+        FinishDiskLoad();
+    }
+
+    Texture2D::Texture2D(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                         const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels)
+        : m_AssetID(InAssetID)
+        , m_SourcePath(InSourcePath)
+        , m_State(EAssetState::Loading)
+        , m_Gpu(ITexture2D::Create(InData, InWidth, InHeight, InChannels))
+    {
+        FinishDiskLoad();
+    }
+
+    Texture2D::Texture2D(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                         const TextureDesc& InDesc, bool InPremultiplied)
+        : m_AssetID(InAssetID)
+        , m_SourcePath(InSourcePath)
+        , m_State(EAssetState::Loading)
+        , m_Gpu(ITexture2D::Create(InDesc))
+        , m_bPremultipliedAlpha(InPremultiplied)
+    {
+        FinishDiskLoad();
     }
 
     Texture2D::Texture2D(Uint32 InWidth, Uint32 InHeight)
@@ -21,6 +56,7 @@ namespace Opaax
         , m_Gpu(ITexture2D::Create(InWidth, InHeight))
     {
         m_State = (m_Gpu && m_Gpu->IsLoaded()) ? EAssetState::Loaded : EAssetState::Failed;
+        CacheGpuInfo();
     }
 
     Texture2D::Texture2D(const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels)
@@ -28,18 +64,92 @@ namespace Opaax
         , m_Gpu(ITexture2D::Create(InData, InWidth, InHeight, InChannels))
     {
         m_State = (m_Gpu && m_Gpu->IsLoaded()) ? EAssetState::Loaded : EAssetState::Failed;
+        CacheGpuInfo();
     }
 
-    Texture2D::~Texture2D() = default;
+    Texture2D::~Texture2D()
+    {
+        if (m_bResidencyTracked)
+        {
+            TextureResidency::Unregister(*this);
+            GpuMemoryTracker::SetAssetBytes(m_AssetID.GetId(), 0);
+        }
+    }
 
     // =============================================================================
     // Functions
     // =============================================================================
+    void Texture2D::CacheGpuInfo()
+    {
+        if (!m_Gpu || !m_Gpu->IsLoaded()) { return; }
+
+        m_Width    = m_Gpu->GetWidth();
+        m_Height   = m_Gpu->GetHeight();
+        m_GpuBytes = m_Gpu->GetGpuMemorySize();
+        if (m_AssetID.IsValid())
+        {
+            GpuMemoryTracker::SetAssetBytes(m_AssetID.GetId(), m_GpuBytes);
+        }
+    }
+
+    void Texture2D::FinishDiskLoad()
+    {
+        m_State = (m_Gpu && m_Gpu->IsLoaded()) ? EAssetState::Loaded : EAssetState::Failed;
+        CacheGpuInfo();
+
+        if (m_State == EAssetState::Loaded)
+        {
+            m_LastUsedFrame     = TextureResidency::GetFrame();
+            m_bResidencyTracked = true;
+            TextureResidency::Register(*this);
+        }
+    }
+
+    ITexture2D* Texture2D::AcquireRHITexture()
+    {
+        if (!m_bResidencyTracked) { return m_Gpu.get(); }   // runtime texture — never evicted
+
+        std::scoped_lock lLock(s_AcquireMutex);
+        m_LastUsedFrame = TextureResidency::GetFrame();
+        if (m_Gpu || m_State != EAssetState::Loaded) { return m_Gpu.get(); }
+
+        // Evicted — bring the GPU copy back from the cooked pack if mounted, else the source file.
+        TextureDesc lCooked;
+        bool        lPremultiplied = false;
+        if (TextureCook::Read(PackFileSystem::Find(m_AssetID), lCooked, lPremultiplied))
+        {
+            m_Gpu = ITexture2D::Create(lCooked);
+        }
+        else
+        {
+            m_Gpu = ITexture2D::Create(m_SourcePath.CStr());
+        }
+        if (!m_Gpu || !m_Gpu->IsLoaded())
+        {
+            OPAAX_CORE_ERROR("Texture2D: re-upload of evicted '{}' failed — texture marked Failed.", m_SourcePath.CStr());
+            m_Gpu.reset();
+            m_State = EAssetState::Failed;
+            return nullptr;
+        }
+
+        CacheGpuInfo();
+        OPAAX_CORE_TRACE("Texture2D: re-uploaded evicted '{}' ({} KiB).", m_SourcePath.CStr(), m_GpuBytes / 1024u);
+        return m_Gpu.get();
+    }
+
+    void Texture2D::EvictGpu()
+    {
+        if (!m_bResidencyTracked || !m_Gpu) { return; }
+
+        m_Gpu.reset();
+        GpuMemoryTracker::SetAssetBytes(m_AssetID.GetId(), 0);
+    }
+
     void Texture2D::Bind(Uint32 InSlot) const { if (m_Gpu) { m_Gpu->Bind(InSlot); } }
     void Texture2D::Unbind()            const { if (m_Gpu) { m_Gpu->Unbind();     } }
 
-    Uint32 Texture2D::GetWidth()      const noexcept { return m_Gpu ? m_Gpu->GetWidth()      : 0u; }
-    Uint32 Texture2D::GetHeight()     const noexcept { return m_Gpu ? m_Gpu->GetHeight()     : 0u; }
+    Uint32 Texture2D::GetWidth()      const noexcept { return m_Width;  }
+    Uint32 Texture2D::GetHeight()     const noexcept { return m_Height; }
     Uint32 Texture2D::GetRendererID() const noexcept { return m_Gpu ? m_Gpu->GetRendererID() : 0u; }
-    bool   Texture2D::IsLoaded()      const noexcept { return m_Gpu && m_Gpu->IsLoaded();          }
+    bool   Texture2D::IsLoaded()      const noexcept { return m_State == EAssetState::Loaded; }
 }
@@ -9,6 +9,7 @@
 namespace Opaax
 {
     class ITexture2D;
+    struct TextureDesc;
 
     // =============================================================================
     // Texture2D
@@ -24,6 +25,10 @@ namespace Opaax
      * Lifetime: heap-allocated by TextureLoader, owned by AssetRegistry's
      * type-erased entry. Never moved or copied — deleted special members
      * surface accidental misuse at compile time.
+     *
+     * Residency: a disk-loaded texture registers with TextureResidency, which may
+     * drop the GPU copy when over budget. The asset stays Loaded (size and path
+     * are cached here); AcquireRHITexture re-uploads it on the next draw.
      */
     class OPAAX_API Texture2D final : public IAsset
     {
@@ -40,6 +45,22 @@ namespace Opaax
          */
         Texture2D(const OpaaxString& InSourcePath, OpaaxStringID InAssetID);
 
+        /**
+         * Disk-loaded texture whose pixels were already decoded off-thread (TextureLoader::Decode,
+         * AssetRegistry::LoadAsync). Uploads InData; otherwise identical to the path ctor —
+         * residency-tracked, and an evicted copy re-uploads from the mounted pack or InSourcePath.
+         */
+        Texture2D(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                  const unsigned char* InData, Uint32 InWidth, Uint32 InHeight, Int32 InChannels);
+
+        /**
+         * Disk-loaded texture cooked into a mounted pack (TextureCook): InDesc points into the
+         * mapping and is uploaded in its stored format with its mip chain. InPremultiplied records
+         * how the colour was cooked, for whoever picks the blend mode.
+         */
+        Texture2D(const OpaaxString& InSourcePath, OpaaxStringID InAssetID,
+                  const TextureDesc& InDesc, bool InPremultiplied);
+
         /**
          * Runtime-only solid-colour 1x1 texture. Not registry-tracked — used by
          * Renderer2D as the white pixel for tinted untextured quads.
@@ -76,15 +97,29 @@ namespace Opaax
         AssetType          GetType()       const override { return AssetType::Texture2D; }
         EAssetState        GetState()      const override { return m_State;      }
         const OpaaxString& GetSourcePath() const override { return m_SourcePath; }
+        Uint64             GetMemorySize() const override { return GetGpuMemorySize(); }
         //~ End IAsset interface
 
     public:
         void Bind(Uint32 InSlot = 0) const;
         void Unbind()                const;
 
-        // The composed backend texture — for bind-group population (IBindGroup::SetTexture). Not owned by the caller.
+        // The composed backend texture, or nullptr while evicted. Not owned by the caller.
         ITexture2D* GetRHITexture() const noexcept { return m_Gpu.get(); }
 
+        // Draw-path accessor for bind-group population (IBindGroup::SetTexture): stamps the texture
+        // as used this residency frame and re-uploads an evicted GPU copy. nullptr only if that
+        // re-upload failed (the asset is then Failed). Safe from parallel pass recorders: residency-
+        // tracked textures take a process-wide lock (eviction only happens between frames).
+        ITexture2D* AcquireRHITexture();
+
+        // Drop the GPU copy (TextureResidency). No-op for runtime textures — nothing to reload from.
+        void EvictGpu();
+
+        bool   IsResident()       const noexcept { return m_Gpu != nullptr; }
+        Uint64 GetGpuMemorySize() const noexcept { return m_Gpu ? m_GpuBytes : 0u; }
+        Uint64 GetLastUsedFrame() const noexcept { return m_LastUsedFrame; }
+
         //------------------------------------------------------------------------------
         //  Get - Set
 
@@ -93,6 +128,16 @@ namespace Opaax
         Uint32 GetRendererID() const noexcept;
         bool   IsLoaded()      const noexcept;
 
+        // Colour stored as rgb * a (cooked with --premultiply) — draw with EBlendMode::PremultipliedAlpha.
+        bool   IsPremultipliedAlpha() const noexcept { return m_bPremultipliedAlpha; }
+
+    private:
+        // Refresh the cached size / byte count from m_Gpu and report the bytes for this asset.
+        void CacheGpuInfo();
+
+        // Disk-loaded ctors: settle the state and, once Loaded, register with TextureResidency.
+        void FinishDiskLoad();
+
         // =============================================================================
         // Members
         // =============================================================================
@@ -101,6 +146,15 @@ namespace Opaax
         OpaaxString                m_SourcePath;
         EAssetState                m_State      = EAssetState::Unloaded;
         UniquePtr<ITexture2D>      m_Gpu;
+
+        // Cached from the GPU copy so size queries survive eviction.
+        Uint32                     m_Width      = 0;
+        Uint32                     m_Height     = 0;
+        Uint64                     m_GpuBytes   = 0;
+
+        Uint64                     m_LastUsedFrame = 0;       // TextureResidency frame of the last draw
+        bool                       m_bResidencyTracked = false;   // disk-loaded + registered
+        bool                       m_bPremultipliedAlpha = false;
     };
 
 } // namespace Opaax
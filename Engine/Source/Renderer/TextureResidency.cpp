@@ -0,0 +1,77 @@
+#include "TextureResidency.h"
+
+#include "Renderer/Texture2D.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxLruEviction.h"
+
+namespace Opaax
+{
+    namespace
+    {
+        std::mutex              s_Mutex;
+        TDynArray<Texture2D*>   s_Textures;
+
+        // NewFrame -> SelectLruEvictions; s_CandidateTextures is parallel to s_Candidates.
+        TDynArray<LruCandidate>       s_Candidates;
+        TDynArray<Texture2D*>         s_CandidateTextures;
+        TDynArray<Uint32>             s_Evict;
+    }
+
+    Uint64 TextureResidency::s_Frame         = 0;
+    Uint64 TextureResidency::s_ResidentBytes = 0;
+    Uint32 TextureResidency::s_Evictions     = 0;
+
+    void TextureResidency::Register(Texture2D& InTexture)
+    {
+        std::scoped_lock lLock(s_Mutex);
+        s_Textures.push_back(&InTexture);
+    }
+
+    void TextureResidency::Unregister(Texture2D& InTexture)
+    {
+        std::scoped_lock lLock(s_Mutex);
+        const auto lIt = std::find(s_Textures.begin(), s_Textures.end(), &InTexture);
+        if (lIt != s_Textures.end())
+        {
+            *lIt = s_Textures.back();   // order is irrelevant — swap-and-pop
+            s_Textures.pop_back();
+        }
+    }
+
+    void TextureResidency::NewFrame()
+    {
+        ++s_Frame;
+
+        std::scoped_lock lLock(s_Mutex);
+
+        s_Candidates.clear();
+        s_CandidateTextures.clear();
+        Uint64 lResident = 0;
+        for (Texture2D* lTex : s_Textures)
+        {
+            if (!lTex->IsResident()) { continue; }
+            lResident += lTex->GetGpuMemorySize();
+            s_Candidates.push_back({ lTex->GetGpuMemorySize(), lTex->GetLastUsedFrame() });
+            s_CandidateTextures.push_back(lTex);
+        }
+        s_ResidentBytes = lResident;
+
+        const Uint64 lBudget = static_cast<Uint64>(EngineConfig::TextureBudgetMB()) * 1024ull * 1024ull;
+        if (lBudget == 0 || lResident <= lBudget) { return; }
+
+        const Uint32 lMinIdle = std::max(EngineConfig::TextureEvictFrames(), LruMinIdleFrames);
+        const Uint64 lFreed   = SelectLruEvictions(s_Candidates.data(), static_cast<Uint32>(s_Candidates.size()),
+                                                   lResident, lBudget, s_Frame, lMinIdle, s_Evict);
+        if (s_Evict.empty()) { return; }
+
+        for (Uint32 lIndex : s_Evict) { s_CandidateTextures[lIndex]->EvictGpu(); }
+        s_ResidentBytes -= lFreed;
+        s_Evictions     += static_cast<Uint32>(s_Evict.size());
+
+        OPAAX_CORE_INFO("TextureResidency: evicted {} texture(s), {:.2f} MiB (resident {:.2f} / budget {} MiB).",
+                        s_Evict.size(), static_cast<double>(lFreed) / (1024.0 * 1024.0),
+                        static_cast<double>(s_ResidentBytes) / (1024.0 * 1024.0), EngineConfig::TextureBudgetMB());
+    }
+
+} // namespace Opaax
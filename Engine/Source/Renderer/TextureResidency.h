@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Core/EngineAPI.h"
+#include "Core/OpaaxTypes.h"
+
+namespace Opaax
+{
+    class Texture2D;
+
+    // =============================================================================
+    // TextureResidency
+    // =============================================================================
+    /**
+     * @class TextureResidency
+     *
+     * Budgets the GPU copies of disk-loaded Texture2Ds. Textures register themselves on load and
+     * stamp the residency frame whenever they are drawn (Texture2D::AcquireRHITexture); NewFrame
+     * advances the frame and, when the resident total exceeds render.textureBudgetMB, drops the GPU
+     * copy of the least recently drawn textures idle for render.textureEvictFrames (SelectLruEvictions).
+     * An evicted texture stays a Loaded asset (size, path, handle all valid) and re-uploads from disk
+     * the next time it is drawn.
+     *
+     * Runtime-only textures (white pixel, font atlases) have no source to re-upload from and never
+     * register. Main thread only for NewFrame; Register/Unregister take a lock.
+     */
+    class OPAAX_API TextureResidency
+    {
+        // =============================================================================
+        // Functions
+        // =============================================================================
+    public:
+        static void Register(Texture2D& InTexture);
+        static void Unregister(Texture2D& InTexture);
+
+        // Advance the residency frame and enforce the budget. Renderer2D::NewFrame calls it.
+        static void NewFrame();
+
+        static Uint64 GetFrame() noexcept { return s_Frame; }
+
+        // Resident GPU bytes of registered textures, as of the last NewFrame.
+        static Uint64 GetResidentBytes() noexcept { return s_ResidentBytes; }
+        static Uint32 GetEvictionCount() noexcept { return s_Evictions; }
+
+        // =============================================================================
+        // Members
+        // =============================================================================
+    private:
+        static Uint64 s_Frame;
+        static Uint64 s_ResidentBytes;
+        static Uint32 s_Evictions;   // across the run
+    };
+
+} // namespace Opaax
@@ -1,9 +1,14 @@
 #include "SceneSerializer.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <string>
 #include <nlohmann/json.hpp>
 #include "Assets/AssetRegistry.h"
+#include "Physics/Collision/CollisionProfile.h"
+#include "Renderer/Texture2D.h"
+#include "Renderer/Text/FontAsset.h"
 #include "Core/OpaaxPath.h"
 #include "ECS/ComponentRegistry.h"
 #include "ECS/Components/ParentComponent.h"
@@ -25,11 +30,32 @@ namespace Opaax
     // Informational only — the loader doesn't gate on it.
     static constexpr const char* kPersistentSceneLabel = "__persistents__";
 
+    // Start every listed dependency through AssetRegistry::LoadAsync before any entity is
+    // built: the decodes run side by side on the job workers, and each component's own
+    // AssetRegistry::Load then only waits for (and finalizes) its already-running request —
+    // scene load time follows the slowest asset instead of the sum of all of them.
+    static Uint32 PrefetchDependencies(const json& InRoot)
+    {
+        Uint32 lCount = 0;
+        for (const AssetDependency& lDep : SceneSerializer::ReadDependencies(InRoot))
+        {
+            switch (lDep.Type)
+            {
+                case AssetType::Texture2D:        AssetRegistry::LoadAsync<Texture2D>(lDep.ID);        break;
+                case AssetType::Font:             AssetRegistry::LoadAsync<FontAsset>(lDep.ID);        break;
+                case AssetType::CollisionProfile: AssetRegistry::LoadAsync<CollisionProfile>(lDep.ID); break;
+                default:                          continue;   // not something a component resolves
+            }
+            ++lCount;
+        }
+        return lCount;
+    }
+
     // =============================================================================
     // Shared serialize helper
     //
-    // Filters World entities by SceneID and writes a {version, scene, entities}
-    // dump to InPath. Used by both Serialize(Scene&) and SerializePersistents.
+    // Filters World entities by SceneID and writes a {version, scene, entities,
+    // dependencies} dump to InPath. Used by both Serialize(Scene&) and SerializePersistents.
     // =============================================================================
     static bool SerializeEntitiesBySceneID(const World&   InWorld,
                                            const char*    InPath,
@@ -42,6 +68,7 @@ namespace Opaax
         lRoot["entities"] = json::array();
 
         const auto& lRegistry = InWorld.GetRegistry();
+        TDynArray<AssetDependency> lDeps;
 
         auto lView = lRegistry.view<const ECS::TagComponent, const ECS::SceneIDComponent>();
 
@@ -92,12 +119,15 @@ namespace Opaax
                 {
                     lEntityJson["components"][lName.ToString().CStr()] =
                         InEntry.Save(InWorld, lEntity);
+                    InEntry.CollectDependencies(InWorld, lEntity, lDeps);
                 }
             });
 
             lRoot["entities"].push_back(lEntityJson);
         }
 
+        lRoot["dependencies"] = SceneSerializer::WriteDependencies(lDeps);
+
         std::ofstream lFile(InPath);
         if (!lFile.is_open())
         {
@@ -107,8 +137,8 @@ namespace Opaax
 
         std::string lString = lRoot.dump(4);
         lFile << lString;  // 4-space indent — human readable
-        OPAAX_CORE_INFO("SceneSerializer: saved '{}' ({} entities).",
-            InPath, lRoot["entities"].size());
+        OPAAX_CORE_INFO("SceneSerializer: saved '{}' ({} entities, {} asset dependencies).",
+            InPath, lRoot["entities"].size(), lRoot["dependencies"].size());
 
         return true;
     }
@@ -142,6 +172,9 @@ namespace Opaax
             return false;
         }
 
+        // Pass 0 — start loading every recorded asset dependency in parallel.
+        const Uint32 lPrefetched = PrefetchDependencies(lRoot);
+
         // Pass 1 — create entities, restore non-relational state. We collect (child, parent_uuid)
         // pairs as we go and resolve them once every UUID is in place.
         struct PendingLink { EntityID Child; Uint64 ParentUuid; };
@@ -234,12 +267,52 @@ namespace Opaax
             }
         }
 
-        OPAAX_CORE_INFO("SceneSerializer: loaded '{}' ({} entities, {} parent links).",
-            InPath, lRoot["entities"].size(), lPending.size());
+        OPAAX_CORE_INFO("SceneSerializer: loaded '{}' ({} entities, {} parent links, {} assets prefetched).",
+            InPath, lRoot["entities"].size(), lPending.size(), lPrefetched);
 
         return true;
     }
 
+    // =============================================================================
+    // Public — dependency list
+    // =============================================================================
+    json SceneSerializer::WriteDependencies(TDynArray<AssetDependency>& InOutDeps)
+    {
+        std::sort(InOutDeps.begin(), InOutDeps.end(), [](const AssetDependency& A, const AssetDependency& B)
+        {
+            return std::strcmp(A.ID.ToString().CStr(), B.ID.ToString().CStr()) < 0;
+        });
+        InOutDeps.erase(std::unique(InOutDeps.begin(), InOutDeps.end(), [](const AssetDependency& A, const AssetDependency& B)
+        {
+            return A.ID == B.ID;
+        }), InOutDeps.end());
+
+        json lArray = json::array();
+        for (const AssetDependency& lDep : InOutDeps)
+        {
+            lArray.push_back({ { "id",   lDep.ID.ToString().CStr() },
+                               { "type", ToStringID(lDep.Type).ToString().CStr() } });
+        }
+        return lArray;
+    }
+
+    TDynArray<AssetDependency> SceneSerializer::ReadDependencies(const json& InRoot)
+    {
+        TDynArray<AssetDependency> lDeps;
+        if (!InRoot.is_object() || !InRoot.contains("dependencies") || !InRoot["dependencies"].is_array()) { return lDeps; }
+
+        // Prefetch-only data: a malformed entry is skipped, never allowed to fail the scene load.
+        for (const auto& lDep : InRoot["dependencies"])
+        {
+            if (!lDep.is_object() || !lDep.contains("id") || !lDep.contains("type")) { continue; }
+            if (!lDep["id"].is_string() || !lDep["type"].is_string())              { continue; }
+
+            lDeps.push_back({ OpaaxStringID(lDep["id"].get<std::string>()),
+                              AssetTypeFromStringID(OpaaxStringID(lDep["type"].get<std::string>())) });
+        }
+        return lDeps;
+    }
+
     // =============================================================================
     // Public — scene-based
     // =============================================================================
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <nlohmann/json.hpp>
+
 #include "Scene.h"
+#include "Assets/IAsset.hpp"
 #include "Core/EngineAPI.h"
 #include "Core/OpaaxString.hpp"
 #include "Core/Log/OpaaxLog.h"
@@ -20,6 +23,9 @@ namespace Opaax
      * the project-relative path. Never an absolute path. Deserialization calls
      * AssetRegistry::Load() for each ID, which routes through Normalize().
      *
+     * Each dump also lists its asset dependencies (id + type). Deserialize starts them all
+     * through AssetRegistry::LoadAsync before building entities, so they decode in parallel.
+     *
      * Only components registered in the component registry are serialized/deserialized. Unknown components are silently skipped.
      */
     class OPAAX_API SceneSerializer
@@ -63,6 +69,26 @@ namespace Opaax
          * @return true on success; false if the file is missing or malformed.
          */
         static bool DeserializePersistents(World& InWorld, const char* InPath);
+
+        // =============================================================================
+        // Dependency list
+        //
+        // Every asset the dump's components resolve on load, written as
+        // "dependencies": [{ "id", "type" }] (sorted, unique). Optional on read —
+        // older scenes simply load without a prefetch.
+        // =============================================================================
+    public:
+        /**
+         * Sort InOutDeps by ID and drop duplicates (in place).
+         * @return the dump's "dependencies" array.
+         */
+        static nlohmann::json WriteDependencies(TDynArray<AssetDependency>& InOutDeps);
+
+        /**
+         * The "dependencies" listed in a parsed dump; empty when it has none. Entries whose
+         * "id" or "type" is missing or not a string are skipped.
+         */
+        static TDynArray<AssetDependency> ReadDependencies(const nlohmann::json& InRoot);
     };
 
 } // namespace Opaax
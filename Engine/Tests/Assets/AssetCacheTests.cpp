@@ -0,0 +1,136 @@
+// Suite: AssetRegistry cache budget (Assets/AssetRegistry.h — UpdateCache / GetCacheStats).
+//
+// A fake IAsset reports a fixed GetMemorySize, so the budget math is exact: per-type accounting,
+// LRU eviction of handle-free assets only, the idle-frame floor, and re-load counting.
+#include <doctest.h>
+
+#include "Assets/AssetRegistry.h"
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr Uint64 k_AssetBytes = 1024 * 1024;
+
+    class FakeCacheAsset final : public IAsset
+    {
+    public:
+        explicit FakeCacheAsset(OpaaxStringID InID) : m_ID(InID) {}
+
+        OpaaxStringID      GetAssetID()    const override { return m_ID; }
+        AssetType          GetType()       const override { return AssetType::Scene; }
+        EAssetState        GetState()      const override { return EAssetState::Loaded; }
+        const OpaaxString& GetSourcePath() const override { return m_Path; }
+        Uint64             GetMemorySize() const override { return k_AssetBytes; }
+
+    private:
+        OpaaxStringID m_ID;
+        OpaaxString   m_Path;
+    };
+
+    struct FakeCacheLoader final : IAssetLoader<FakeCacheAsset>
+    {
+        Uint32 LoadCount = 0;
+
+        FakeCacheAsset* Load(const char* /*InAbsPath*/, OpaaxStringID InCanonicalID) override
+        {
+            ++LoadCount;
+            return new FakeCacheAsset(InCanonicalID);
+        }
+
+        bool IsValid(FakeCacheAsset* InAsset) override { return InAsset != nullptr; }
+    };
+
+    FakeCacheLoader* RegisterFakeCacheLoader()
+    {
+        UniquePtr<FakeCacheLoader> lLoader = MakeUnique<FakeCacheLoader>();
+        FakeCacheLoader*           lRaw    = lLoader.get();
+        AssetLoaderRegistry::Register<FakeCacheAsset>(Move(lLoader));
+        return lRaw;
+    }
+
+    void RunFrames(Uint32 InCount)
+    {
+        for (Uint32 i = 0; i < InCount; ++i) { AssetRegistry::UpdateCache(); }
+    }
+
+    constexpr Uint64 k_EntryBytes = sizeof(FakeCacheAsset) + k_AssetBytes;
+}
+
+TEST_CASE("AssetRegistry cache: resident bytes are accounted per type, nothing evicts without a budget")
+{
+    RegisterFakeCacheLoader();
+
+    AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/A"));
+    AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/B"));
+    RunFrames(10);
+
+    const AssetCacheStats& lStats = AssetRegistry::GetCacheStats();
+    CHECK(lStats.ResidentCount == 2u);
+    CHECK(lStats.ResidentBytes == 2 * k_EntryBytes);
+    CHECK(lStats.EvictableCount == 2u);
+    CHECK(lStats.Get(AssetType::Scene).ResidentBytes == 2 * k_EntryBytes);
+    CHECK(lStats.Get(AssetType::Texture2D).ResidentCount == 0u);
+    CHECK(lStats.Evictions == 0u);
+    CHECK(AssetRegistry::IsLoaded(OPAAX_ID("Cache/A")));
+
+    AssetRegistry::Shutdown();
+}
+
+TEST_CASE("AssetRegistry cache: over budget, only idle handle-free assets go, least recently used first")
+{
+    RegisterFakeCacheLoader();
+    AssetRegistry::SetCacheBudget(2 * k_EntryBytes, 8);
+
+    AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/Old"));
+    RunFrames(2);
+    AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/Newer"));
+    const TAssetHandle<FakeCacheAsset> lHeld = AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/Held"));
+
+    // Over budget, but nothing has been idle long enough yet.
+    RunFrames(4);
+    CHECK(AssetRegistry::GetCacheStats().Evictions == 0u);
+
+    // One eviction brings it back under — the oldest unreferenced asset, not the held one.
+    RunFrames(8);
+    const AssetCacheStats& lStats = AssetRegistry::GetCacheStats();
+    CHECK(lStats.Evictions == 1u);
+    CHECK(lStats.Get(AssetType::Scene).Evictions == 1u);
+    CHECK(lStats.ResidentBytes == 2 * k_EntryBytes);
+    CHECK_FALSE(AssetRegistry::IsLoaded(OPAAX_ID("Cache/Old")));
+    CHECK(AssetRegistry::IsLoaded(OPAAX_ID("Cache/Newer")));
+    REQUIRE(lHeld.IsValid());
+
+    AssetRegistry::Shutdown();
+}
+
+TEST_CASE("AssetRegistry cache: loading an evicted asset again counts a re-load")
+{
+    FakeCacheLoader* lLoader = RegisterFakeCacheLoader();
+    AssetRegistry::SetCacheBudget(1, 0);
+
+    AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/Reload"));
+    RunFrames(8);
+    REQUIRE(AssetRegistry::GetCacheStats().Evictions == 1u);
+    CHECK(AssetRegistry::GetCacheStats().ResidentCount == 0u);
+
+    {
+        const TAssetHandle<FakeCacheAsset> lHandle = AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/Reload"));
+        REQUIRE(lHandle.IsValid());
+        CHECK(lLoader->LoadCount == 2u);
+        CHECK(AssetRegistry::GetCacheStats().Reloads == 1u);
+        CHECK(AssetRegistry::GetCacheStats().Get(AssetType::Scene).Reloads == 1u);
+
+        // Still over budget (1 byte) but referenced — never evicted under a live handle.
+        RunFrames(8);
+        CHECK(lHandle.IsValid());
+        CHECK(AssetRegistry::GetCacheStats().Evictions == 1u);
+    }
+
+    // A plain cache hit is not a re-load.
+    AssetRegistry::Load<FakeCacheAsset>(OPAAX_ID("Cache/Reload"));
+    CHECK(AssetRegistry::GetCacheStats().Reloads == 1u);
+
+    AssetRegistry::Shutdown();
+    CHECK(AssetRegistry::GetCacheStats().Evictions == 0u);
+}
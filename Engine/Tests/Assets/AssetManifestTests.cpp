@@ -0,0 +1,89 @@
+// Suite: AssetManifest path index (Assets/AssetManifest.h) — FindByPath stays in sync with
+// Add / Remove / LoadFile overrides / Clear. Manifests are written under the system temp directory.
+#include <doctest.h>
+
+#include "Assets/AssetManifest.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Opaax;
+
+namespace
+{
+    AssetDescriptor MakeDesc(const char* InID, const char* InRelPath)
+    {
+        AssetDescriptor lDesc;
+        lDesc.ID      = OpaaxStringID(InID);
+        lDesc.RelPath = OpaaxString(InRelPath);
+        lDesc.Type    = OPAAX_ID("Texture2D");
+        return lDesc;
+    }
+
+    OpaaxString WriteManifest(const char* InName, const char* InJson)
+    {
+        const std::filesystem::path lPath = std::filesystem::temp_directory_path() / "OpaaxTests" / InName;
+        std::filesystem::create_directories(lPath.parent_path());
+        std::ofstream(lPath) << InJson;
+        return OpaaxString(lPath.string().c_str());
+    }
+}
+
+TEST_CASE("AssetManifest::FindByPath: added entries are found by path, removed ones are not")
+{
+    AssetManifest::Add(MakeDesc("Manifest/Player", "Game/Assets/Player.png"));
+    AssetManifest::Add(MakeDesc("Manifest/Enemy", "Game/Assets/Enemy.png"));
+
+    const AssetDescriptor* lHit = AssetManifest::FindByPath(OpaaxString("Game/Assets/Enemy.png"));
+    REQUIRE(lHit);
+    CHECK(lHit->ID == OPAAX_ID("Manifest/Enemy"));
+    CHECK_FALSE(AssetManifest::FindByPath(OpaaxString("Game/Assets/Nope.png")));
+
+    // Add never overwrites: the index keeps pointing at the original path.
+    AssetManifest::Add(MakeDesc("Manifest/Player", "Game/Assets/Other.png"));
+    CHECK(AssetManifest::FindByPath(OpaaxString("Game/Assets/Player.png")));
+    CHECK_FALSE(AssetManifest::FindByPath(OpaaxString("Game/Assets/Other.png")));
+
+    CHECK(AssetManifest::Remove(OPAAX_ID("Manifest/Enemy")));
+    CHECK_FALSE(AssetManifest::FindByPath(OpaaxString("Game/Assets/Enemy.png")));
+
+    AssetManifest::Clear();
+    CHECK_FALSE(AssetManifest::FindByPath(OpaaxString("Game/Assets/Player.png")));
+}
+
+TEST_CASE("AssetManifest::FindByPath: a later manifest moving an ID re-indexes its path")
+{
+    const OpaaxString lBase  = WriteManifest("Base.json",
+        R"({ "assets": [ { "id": "Manifest/Hero", "path": "Engine/Assets/Hero.png" } ] })");
+    const OpaaxString lPatch = WriteManifest("Patch.json",
+        R"({ "assets": [ { "id": "Manifest/Hero", "path": "Game/Assets/Hero.png" } ] })");
+
+    REQUIRE(AssetManifest::LoadFile(lBase) == 1);
+    REQUIRE(AssetManifest::LoadFile(lPatch) == 1);
+
+    const AssetDescriptor* lHit = AssetManifest::FindByPath(OpaaxString("Game/Assets/Hero.png"));
+    REQUIRE(lHit);
+    CHECK(lHit->ID == OPAAX_ID("Manifest/Hero"));
+    CHECK_FALSE(AssetManifest::FindByPath(OpaaxString("Engine/Assets/Hero.png")));
+
+    AssetManifest::Clear();
+    std::filesystem::remove(lBase.CStr());
+    std::filesystem::remove(lPatch.CStr());
+}
+
+TEST_CASE("AssetManifest::FindByPath: removing one of two entries sharing a path keeps the other")
+{
+    AssetManifest::Add(MakeDesc("Manifest/A", "Game/Assets/Shared.png"));
+    AssetManifest::Add(MakeDesc("Manifest/B", "Game/Assets/Shared.png"));
+
+    const AssetDescriptor* lHit = AssetManifest::FindByPath(OpaaxString("Game/Assets/Shared.png"));
+    REQUIRE(lHit);
+    CHECK(lHit->ID == OPAAX_ID("Manifest/B"));   // indexed last
+
+    AssetManifest::Remove(OPAAX_ID("Manifest/B"));
+    lHit = AssetManifest::FindByPath(OpaaxString("Game/Assets/Shared.png"));
+    REQUIRE(lHit);
+    CHECK(lHit->ID == OPAAX_ID("Manifest/A"));
+
+    AssetManifest::Clear();
+}
@@ -0,0 +1,184 @@
+// Suite: cooked asset packs — AssetPackWriter layout + PackFileSystem mount / lookup
+// (Assets/Pack). Packs are written under the system temp directory and removed afterwards.
+#include <doctest.h>
+
+#include "Assets/Pack/AssetPackWriter.h"
+#include "Assets/Pack/PackFileSystem.h"
+#include "Core/OpaaxFile.h"
+
+#include <cstring>
+#include <filesystem>
+
+using namespace Opaax;
+
+namespace
+{
+    OpaaxString TempPackPath(const char* InName)
+    {
+        const std::filesystem::path lPath = std::filesystem::temp_directory_path() / "OpaaxTests" / InName;
+        return OpaaxString(lPath.string().c_str());
+    }
+
+    TDynArray<Uint8> Bytes(const char* InText)
+    {
+        return TDynArray<Uint8>(InText, InText + std::strlen(InText));
+    }
+
+    bool BlobEquals(const AssetPackBlob& InBlob, const char* InText)
+    {
+        return InBlob && InBlob.Size == std::strlen(InText) && std::memcmp(InBlob.Data, InText, InBlob.Size) == 0;
+    }
+}
+
+TEST_CASE("PackFileSystem: every written blob is found, aligned, zero-copy")
+{
+    const OpaaxString lPath = TempPackPath("Basic.opak");
+
+    AssetPackWriter lWriter;
+    for (Uint32 i = 0; i < 100; ++i)
+    {
+        const std::string lName = "Pack/Asset_" + std::to_string(i);
+        lWriter.Add(OPAAX_ID(lName), EAssetPackFormat::Source, Bytes(lName.c_str()));
+    }
+    REQUIRE(lWriter.Write(lPath.CStr()));
+    REQUIRE(PackFileSystem::Mount(lPath));
+
+    for (Uint32 i = 0; i < 100; ++i)
+    {
+        const std::string   lName = "Pack/Asset_" + std::to_string(i);
+        const AssetPackBlob lBlob = PackFileSystem::Find(OPAAX_ID(lName));
+        REQUIRE(BlobEquals(lBlob, lName.c_str()));
+        CHECK(reinterpret_cast<uintptr_t>(lBlob.Data) % AssetPackAlignment == 0);
+        CHECK(lBlob.Format == EAssetPackFormat::Source);
+    }
+    CHECK_FALSE(PackFileSystem::Find(OPAAX_ID("Pack/NotThere")));
+    CHECK_FALSE(PackFileSystem::Find(OpaaxStringID{}));
+
+    PackFileSystem::UnmountAll();
+    CHECK_FALSE(PackFileSystem::Find(OPAAX_ID("Pack/Asset_0")));
+    std::filesystem::remove(lPath.CStr());
+}
+
+TEST_CASE("PackFileSystem: lookups do not depend on the order IDs were interned in")
+{
+    // Laid out by hand, as another process would have cooked it: these IDs are not interned yet,
+    // and a pile of unrelated strings goes into the pool before the game side looks them up.
+    const char* lNames[] = { "Pack/Fixture_Late", "Pack/Fixture_Early" };
+    const char* lPayloads[] = { "late", "early" };
+
+    constexpr Uint32 lCapacity = 4;
+    const Uint64 lBlobOffset = AssetPackAlignment;
+    const Uint64 lTocOffset  = lBlobOffset + 2 * AssetPackAlignment;
+
+    AssetPackHeader lHeader;
+    lHeader.EntryCount  = 2;
+    lHeader.TocCapacity = lCapacity;
+    lHeader.TocOffset   = lTocOffset;
+    lHeader.FileSize    = lTocOffset + lCapacity * sizeof(AssetPackTocEntry);
+
+    TDynArray<Uint8>  lFile(static_cast<size_t>(lHeader.FileSize), 0);
+    AssetPackTocEntry lToc[lCapacity]{};
+    for (Uint32 i = 0; i < 2; ++i)
+    {
+        const Uint64 lOffset = lBlobOffset + i * AssetPackAlignment;
+        std::memcpy(lFile.data() + lOffset, lPayloads[i], std::strlen(lPayloads[i]));
+
+        const Uint64 lKey = AssetPackKey(lNames[i]);
+        Uint32 lBucket = static_cast<Uint32>(lKey) & (lCapacity - 1);
+        while (lToc[lBucket].Key != 0) { lBucket = (lBucket + 1) & (lCapacity - 1); }
+        lToc[lBucket] = { lKey, static_cast<Uint32>(EAssetPackFormat::Source), 0, lOffset, std::strlen(lPayloads[i]) };
+    }
+    std::memcpy(lFile.data(), &lHeader, sizeof(lHeader));
+    std::memcpy(lFile.data() + lTocOffset, lToc, sizeof(lToc));
+
+    const OpaaxString lPath = TempPackPath("Fixture.opak");
+    REQUIRE(OpaaxFile::WriteBinaryAtomic(lPath.CStr(), lFile.data(), lFile.size()));
+
+    for (Uint32 i = 0; i < 64; ++i)
+    {
+        (void)OPAAX_ID("Pack/Unrelated_" + std::to_string(i));
+    }
+
+    REQUIRE(PackFileSystem::Mount(lPath));
+    CHECK(BlobEquals(PackFileSystem::Find(OPAAX_ID("Pack/Fixture_Early")), "early"));
+    CHECK(BlobEquals(PackFileSystem::Find(OPAAX_ID("Pack/Fixture_Late")), "late"));
+    CHECK_FALSE(PackFileSystem::Find(OPAAX_ID("Pack/Unrelated_0")));
+
+    PackFileSystem::UnmountAll();
+    std::filesystem::remove(lPath.CStr());
+}
+
+TEST_CASE("AssetPackWriter: the TOC stores the full key of the ID string")
+{
+    const OpaaxString lPath = TempPackPath("Keys.opak");
+
+    AssetPackWriter lWriter;
+    REQUIRE(lWriter.Add(OPAAX_ID("Pack/Keyed"), EAssetPackFormat::Source, Bytes("keyed")));
+    REQUIRE(lWriter.Write(lPath.CStr()));
+
+    TDynArray<Uint8> lFile;
+    REQUIRE(OpaaxFile::ReadBinary(lPath.CStr(), lFile));
+
+    AssetPackHeader lHeader;
+    std::memcpy(&lHeader, lFile.data(), sizeof(lHeader));
+    CHECK(lHeader.Version == AssetPackVersion);
+
+    const auto* lToc = reinterpret_cast<const AssetPackTocEntry*>(lFile.data() + lHeader.TocOffset);
+    const AssetPackTocEntry* lEntry = AssetPackFindEntry(lToc, lHeader.TocCapacity, AssetPackKey("Pack/Keyed"));
+    REQUIRE(lEntry != nullptr);
+    CHECK(lEntry->Key == OpaaxHash::Hash64("Pack/Keyed"));
+    CHECK(lEntry->Size == 5u);
+
+    // A different key landing in the same bucket is not a match.
+    CHECK(AssetPackFindEntry(lToc, lHeader.TocCapacity, lEntry->Key + lHeader.TocCapacity) == nullptr);
+    std::filesystem::remove(lPath.CStr());
+}
+
+TEST_CASE("PackFileSystem: the last mounted pack shadows earlier ones")
+{
+    const OpaaxString lBasePath  = TempPackPath("Base.opak");
+    const OpaaxString lPatchPath = TempPackPath("Patch.opak");
+
+    AssetPackWriter lBase;
+    lBase.Add(OPAAX_ID("Pack/Shared"), EAssetPackFormat::Source, Bytes("base"));
+    lBase.Add(OPAAX_ID("Pack/BaseOnly"), EAssetPackFormat::Source, Bytes("base only"));
+    REQUIRE(lBase.Write(lBasePath.CStr()));
+
+    AssetPackWriter lPatch;
+    lPatch.Add(OPAAX_ID("Pack/Shared"), EAssetPackFormat::Source, Bytes("patched"));
+    REQUIRE(lPatch.Write(lPatchPath.CStr()));
+
+    REQUIRE(PackFileSystem::Mount(lBasePath));
+    REQUIRE(PackFileSystem::Mount(lPatchPath));
+    CHECK(PackFileSystem::GetMountCount() == 2u);
+    CHECK(BlobEquals(PackFileSystem::Find(OPAAX_ID("Pack/Shared")), "patched"));
+    CHECK(BlobEquals(PackFileSystem::Find(OPAAX_ID("Pack/BaseOnly")), "base only"));
+
+    PackFileSystem::UnmountAll();
+    std::filesystem::remove(lBasePath.CStr());
+    std::filesystem::remove(lPatchPath.CStr());
+}
+
+TEST_CASE("PackFileSystem: truncated or foreign files are refused")
+{
+    const OpaaxString lPath = TempPackPath("Corrupt.opak");
+
+    AssetPackWriter lWriter;
+    lWriter.Add(OPAAX_ID("Pack/A"), EAssetPackFormat::Source, Bytes("payload"));
+    REQUIRE(lWriter.Write(lPath.CStr()));
+
+    TDynArray<Uint8> lFile;
+    REQUIRE(OpaaxFile::ReadBinary(lPath.CStr(), lFile));
+
+    TDynArray<Uint8> lTruncated(lFile.begin(), lFile.end() - 8);
+    REQUIRE(OpaaxFile::WriteBinaryAtomic(lPath.CStr(), lTruncated.data(), lTruncated.size()));
+    CHECK_FALSE(PackFileSystem::Mount(lPath));
+
+    lFile[0] = 'X';
+    REQUIRE(OpaaxFile::WriteBinaryAtomic(lPath.CStr(), lFile.data(), lFile.size()));
+    CHECK_FALSE(PackFileSystem::Mount(lPath));
+
+    CHECK_FALSE(PackFileSystem::Mount(TempPackPath("Missing.opak")));
+    CHECK(PackFileSystem::GetMountCount() == 0u);
+    std::filesystem::remove(lPath.CStr());
+}
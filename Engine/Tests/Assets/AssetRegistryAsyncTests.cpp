@@ -0,0 +1,416 @@
+// Suite: AssetRegistry::LoadAsync state machine (Assets/AssetRegistry.h).
+//
+// Uses a fake asset type + loader — no disk, no GPU — so only the registry logic is exercised:
+// the Loading placeholder, PrepareDecode on the requesting thread, Decode on a JobSubsystem
+// worker, Finalize in the main-thread drain, a sync Load finishing an in-flight request, failure
+// + retry, and Unload while decoding. The IOSubsystem cases read a real temp file through a
+// loader that decodes from memory.
+#include <doctest.h>
+
+#include "Assets/AssetRegistry.h"
+#include "Core/IO/IOSubsystem.h"
+#include "Core/Jobs/JobSubsystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace Opaax;
+
+namespace
+{
+    struct FakeAsset
+    {
+        Int32 Value = 0;
+    };
+
+    struct FakeDecodeData final : AssetDecodeData
+    {
+        Int32 Value = 0;
+    };
+
+    // Counts every stage and records where they ran. Paths containing "bad" fail to decode. The
+    // decoded value comes from PrepareDecode's snapshot, so it only survives if the registry
+    // carries the snapshot to the worker.
+    struct FakeLoader final : IAssetLoader<FakeAsset>
+    {
+        std::atomic<Uint32>     DecodeCount    { 0 };
+        std::atomic<bool>       bDecodeOffMain { false };
+        Uint32                  PrepareCount   = 0;
+        bool                    bPrepareOnMain = true;
+        Uint32                  FinalizeCount  = 0;
+        std::thread::id         MainThread     = std::this_thread::get_id();
+
+        FakeAsset* Load(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override
+        {
+            return new FakeAsset{ 7 };
+        }
+
+        bool IsValid(FakeAsset* InAsset) override { return InAsset != nullptr; }
+
+        UniquePtr<AssetDecodeData> PrepareDecode(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override
+        {
+            ++PrepareCount;
+            bPrepareOnMain = bPrepareOnMain && std::this_thread::get_id() == MainThread;
+
+            UniquePtr<FakeDecodeData> lData = MakeUnique<FakeDecodeData>();
+            lData->Value = 42;
+            return lData;
+        }
+
+        UniquePtr<AssetDecodeData> Decode(const char* InAbsPath, OpaaxStringID /*InCanonicalID*/,
+                                          UniquePtr<AssetDecodeData> InPrepared) override
+        {
+            ++DecodeCount;
+            bDecodeOffMain = std::this_thread::get_id() != MainThread;
+            if (OpaaxString(InAbsPath).Find("bad") >= 0) { return nullptr; }
+            return InPrepared;
+        }
+
+        FakeAsset* Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* /*InAbsPath*/,
+                            OpaaxStringID /*InCanonicalID*/) override
+        {
+            CHECK(std::this_thread::get_id() == MainThread);
+            ++FinalizeCount;
+            const auto* lData = static_cast<const FakeDecodeData*>(InDecoded.get());
+            return lData ? new FakeAsset{ lData->Value } : nullptr;
+        }
+    };
+
+    // Decodes the file's first byte from IOSubsystem's read; Decode (the path-based stage) must not run.
+    struct BytesLoader final : IAssetLoader<FakeAsset>
+    {
+        std::atomic<Uint32> DecodeCount      { 0 };
+        std::atomic<Uint32> DecodeMemoryCount{ 0 };
+        std::atomic<bool>   bDecodeOffMain   { false };
+        std::atomic<Uint32> DecodesOnMain    { 0 };
+        std::thread::id     MainThread       = std::this_thread::get_id();
+
+        FakeAsset* Load(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override { return nullptr; }
+        bool       IsValid(FakeAsset* InAsset) override { return InAsset != nullptr; }
+
+        // A snapshot that must never be finalized as if it were decoded — a failed read drops it.
+        UniquePtr<AssetDecodeData> PrepareDecode(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override
+        {
+            UniquePtr<FakeDecodeData> lData = MakeUnique<FakeDecodeData>();
+            lData->Value = -1;
+            return lData;
+        }
+
+        UniquePtr<AssetDecodeData> Decode(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/,
+                                          UniquePtr<AssetDecodeData> /*InPrepared*/) override
+        {
+            ++DecodeCount;
+            return nullptr;
+        }
+
+        bool DecodesFromMemory(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override { return true; }
+
+        UniquePtr<AssetDecodeData> DecodeMemory(const Uint8* InData, Uint64 InSize, const char* /*InAbsPath*/,
+                                                OpaaxStringID /*InCanonicalID*/,
+                                                UniquePtr<AssetDecodeData> InPrepared) override
+        {
+            ++DecodeMemoryCount;
+            bDecodeOffMain = std::this_thread::get_id() != MainThread;
+            if (!bDecodeOffMain) { ++DecodesOnMain; }
+            if (!InPrepared || !InData || InSize == 0) { return nullptr; }
+
+            static_cast<FakeDecodeData*>(InPrepared.get())->Value = InData[0];
+            return InPrepared;
+        }
+
+        FakeAsset* Finalize(UniquePtr<AssetDecodeData> InDecoded, const char* /*InAbsPath*/,
+                            OpaaxStringID /*InCanonicalID*/) override
+        {
+            const auto* lData = static_cast<const FakeDecodeData*>(InDecoded.get());
+            return lData ? new FakeAsset{ lData->Value } : nullptr;
+        }
+    };
+
+    // Manifest entry InID -> an absolute temp path (written when InFirstByte >= 0), so Normalize
+    // resolves to a real file whatever OpaaxPath's roots are.
+    void AddTempAsset(const char* InID, const char* InFileName, Int32 InFirstByte)
+    {
+        const std::filesystem::path lPath = std::filesystem::temp_directory_path() / "OpaaxTests" / InFileName;
+        std::filesystem::create_directories(lPath.parent_path());
+        std::filesystem::remove(lPath);
+        if (InFirstByte >= 0) { std::ofstream(lPath, std::ios::binary) << static_cast<char>(InFirstByte) << "rest"; }
+
+        AssetDescriptor lDesc;
+        lDesc.ID      = OpaaxStringID(InID);
+        lDesc.RelPath = OpaaxString(lPath.generic_string().c_str());
+        AssetManifest::Add(Move(lDesc));
+    }
+
+    FakeLoader* RegisterFakeLoader()
+    {
+        UniquePtr<FakeLoader> lLoader = MakeUnique<FakeLoader>();
+        FakeLoader*           lRaw    = lLoader.get();
+        AssetLoaderRegistry::Register<FakeAsset>(Move(lLoader));
+        return lRaw;
+    }
+
+    // Pump the completion drain until every async load settled (bounded, so a bug fails, not hangs).
+    void DrainPendingLoads(JobSubsystem& InJobs, IOSubsystem* InIO = nullptr)
+    {
+        for (Uint32 i = 0; i < 2000 && AssetRegistry::GetPendingLoadCount() > 0; ++i)
+        {
+            if (InIO) { InIO->Update(0.0); }
+            InJobs.Update(0.0);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: without a job system both stages run inline")
+{
+    FakeLoader* lLoader = RegisterFakeLoader();
+
+    Uint32 lSettled = 0;
+    TAssetHandle<FakeAsset> lHandle = AssetRegistry::LoadAsync<FakeAsset>(
+        OPAAX_ID("Fake/Inline"), [&lSettled](const TAssetHandle<FakeAsset>& InHandle)
+        {
+            ++lSettled;
+            CHECK(InHandle.IsValid());
+        });
+
+    CHECK(lSettled == 1u);
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 42);
+    CHECK(lLoader->DecodeCount == 1u);
+    CHECK(lLoader->FinalizeCount == 1u);
+    CHECK(AssetRegistry::GetState(OPAAX_ID("Fake/Inline")) == EAssetState::Loaded);
+
+    AssetRegistry::Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: decode on a worker, finalize in the main-thread drain")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    FakeLoader* lLoader = RegisterFakeLoader();
+
+    Uint32 lSettled = 0;
+    TAssetHandle<FakeAsset> lHandle = AssetRegistry::LoadAsync<FakeAsset>(
+        OPAAX_ID("Fake/Async"), [&lSettled](const TAssetHandle<FakeAsset>&) { ++lSettled; });
+
+    // Nothing is finalized before the drain, whatever the worker already did.
+    CHECK_FALSE(lHandle.IsValid());
+    CHECK(AssetRegistry::GetState(OPAAX_ID("Fake/Async")) == EAssetState::Loading);
+    CHECK_FALSE(AssetRegistry::IsLoaded(OPAAX_ID("Fake/Async")));
+
+    // A second request joins the in-flight one instead of decoding again.
+    Uint32 lSecondSettled = 0;
+    AssetRegistry::LoadAsync<FakeAsset>(OPAAX_ID("Fake/Async"),
+                                        [&lSecondSettled](const TAssetHandle<FakeAsset>&) { ++lSecondSettled; });
+
+    DrainPendingLoads(lJobs);
+
+    CHECK(lSettled == 1u);
+    CHECK(lSecondSettled == 1u);
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 42);
+    CHECK(lLoader->PrepareCount == 1u);
+    CHECK(lLoader->bPrepareOnMain);
+    CHECK(lLoader->DecodeCount == 1u);
+    CHECK(lLoader->bDecodeOffMain);
+    CHECK(lLoader->FinalizeCount == 1u);
+
+    AssetRegistry::Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: a sync Load of an in-flight asset finalizes it once, inline")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    FakeLoader* lLoader = RegisterFakeLoader();
+
+    Uint32 lSettled = 0;
+    AssetRegistry::LoadAsync<FakeAsset>(OPAAX_ID("Fake/Now"),
+                                        [&lSettled](const TAssetHandle<FakeAsset>&) { ++lSettled; });
+
+    TAssetHandle<FakeAsset> lHandle = AssetRegistry::Load<FakeAsset>(OPAAX_ID("Fake/Now"));
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 42);   // the async decode, not a second (sync) Load
+    CHECK(lSettled == 1u);
+    CHECK(AssetRegistry::GetPendingLoadCount() == 0u);
+
+    // The job's own completion still arrives in the drain — and must be a no-op.
+    for (Uint32 i = 0; i < 20; ++i) { lJobs.Update(0.0); std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+    CHECK(lLoader->FinalizeCount == 1u);
+    CHECK(lSettled == 1u);
+
+    AssetRegistry::Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: a failed decode leaves the entry Failed and the next request retries")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    FakeLoader* lLoader = RegisterFakeLoader();
+
+    bool lSettledValid = true;
+    AssetRegistry::LoadAsync<FakeAsset>(OPAAX_ID("Fake/bad"),
+                                        [&lSettledValid](const TAssetHandle<FakeAsset>& InHandle)
+                                        {
+                                            lSettledValid = InHandle.IsValid();
+                                        });
+    DrainPendingLoads(lJobs);
+
+    CHECK_FALSE(lSettledValid);
+    CHECK(AssetRegistry::GetState(OPAAX_ID("Fake/bad")) == EAssetState::Failed);
+
+    AssetRegistry::LoadAsync<FakeAsset>(OPAAX_ID("Fake/bad"));
+    DrainPendingLoads(lJobs);
+    CHECK(lLoader->DecodeCount == 2u);
+
+    AssetRegistry::Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: unloading while decoding drops the result")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    FakeLoader* lLoader = RegisterFakeLoader();
+
+    Uint32 lSettled = 0;
+    TAssetHandle<FakeAsset> lHandle = AssetRegistry::LoadAsync<FakeAsset>(
+        OPAAX_ID("Fake/Dropped"), [&lSettled](const TAssetHandle<FakeAsset>&) { ++lSettled; });
+    AssetRegistry::Unload(OPAAX_ID("Fake/Dropped"));
+
+    DrainPendingLoads(lJobs);
+
+    CHECK(lSettled == 1u);
+    CHECK(lLoader->FinalizeCount == 0u);
+    CHECK_FALSE(lHandle.IsValid());
+    CHECK(AssetRegistry::GetState(OPAAX_ID("Fake/Dropped")) == EAssetState::Unloaded);
+
+    AssetRegistry::Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: with an IO system, the file is read on IO and decoded from memory")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    IOSubsystem lIO;
+    REQUIRE(lIO.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    AssetRegistry::SetIOSystem(&lIO);
+
+    UniquePtr<BytesLoader> lOwned  = MakeUnique<BytesLoader>();
+    BytesLoader*           lLoader = lOwned.get();
+    AssetLoaderRegistry::Register<FakeAsset>(Move(lOwned));
+
+    AddTempAsset("Bytes/Ok", "BytesOk.bin", 42);
+    AddTempAsset("Bytes/Missing", "BytesMissing.bin", -1);
+
+    Uint32 lSettled = 0;
+    TAssetHandle<FakeAsset> lHandle = AssetRegistry::LoadAsync<FakeAsset>(
+        OPAAX_ID("Bytes/Ok"), [&lSettled](const TAssetHandle<FakeAsset>&) { ++lSettled; });
+    TAssetHandle<FakeAsset> lMissing = AssetRegistry::LoadAsync<FakeAsset>(OPAAX_ID("Bytes/Missing"));
+
+    CHECK(AssetRegistry::GetState(OPAAX_ID("Bytes/Ok")) == EAssetState::Loading);
+    DrainPendingLoads(lJobs, &lIO);
+
+    CHECK(lSettled == 1u);
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 42);
+    CHECK(lLoader->bDecodeOffMain);
+    CHECK(lLoader->DecodeMemoryCount == 1u);   // the missing file never reaches a decode
+    CHECK(lLoader->DecodeCount == 0u);
+    CHECK(AssetRegistry::GetState(OPAAX_ID("Bytes/Missing")) == EAssetState::Failed);
+    CHECK(lIO.GetStats().Reads == 2u);
+
+    lHandle.Reset();
+    AssetRegistry::Shutdown();
+    lIO.Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: a sync Load during the IO read waits for its decode job")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    IOSubsystem lIO;
+    REQUIRE(lIO.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    AssetRegistry::SetIOSystem(&lIO);
+
+    UniquePtr<BytesLoader> lOwned  = MakeUnique<BytesLoader>();
+    BytesLoader*           lLoader = lOwned.get();
+    AssetLoaderRegistry::Register<FakeAsset>(Move(lOwned));
+    AddTempAsset("Bytes/Now", "BytesNow.bin", 9);
+
+    Uint32 lSettled = 0;
+    AssetRegistry::LoadAsync<FakeAsset>(OPAAX_ID("Bytes/Now"),
+                                        [&lSettled](const TAssetHandle<FakeAsset>&) { ++lSettled; });
+
+    // No drain has run: Load waits for the read, whose completion already queued the decode on a worker.
+    TAssetHandle<FakeAsset> lHandle = AssetRegistry::Load<FakeAsset>(OPAAX_ID("Bytes/Now"));
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 9);
+    CHECK(lSettled == 1u);
+    CHECK(lLoader->bDecodeOffMain);
+
+    // The decode job's own completion still arrives in the drain — and must be a no-op.
+    for (Uint32 i = 0; i < 20; ++i) { lIO.Update(0.0); lJobs.Update(0.0); }
+    CHECK(lLoader->DecodeMemoryCount == 1u);
+    CHECK(lSettled == 1u);
+
+    lHandle.Reset();
+    AssetRegistry::Shutdown();
+    lIO.Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry::LoadAsync: back-to-back IO loads decode on workers without a drain")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    IOSubsystem lIO;
+    REQUIRE(lIO.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    AssetRegistry::SetIOSystem(&lIO);
+
+    UniquePtr<BytesLoader> lOwned  = MakeUnique<BytesLoader>();
+    BytesLoader*           lLoader = lOwned.get();
+    AssetLoaderRegistry::Register<FakeAsset>(Move(lOwned));
+
+    // The scene-load pattern: prefetch everything, then Load each in turn on the main thread.
+    constexpr Uint32 lCount = 8;
+    for (Uint32 i = 0; i < lCount; ++i)
+    {
+        const std::string lID   = "Bytes/Batch" + std::to_string(i);
+        const std::string lFile = "BytesBatch" + std::to_string(i) + ".bin";
+        AddTempAsset(lID.c_str(), lFile.c_str(), static_cast<Int32>(i + 1));
+        AssetRegistry::LoadAsync<FakeAsset>(OpaaxStringID(lID.c_str()));
+    }
+
+    for (Uint32 i = 0; i < lCount; ++i)
+    {
+        const std::string       lID     = "Bytes/Batch" + std::to_string(i);
+        TAssetHandle<FakeAsset> lHandle = AssetRegistry::Load<FakeAsset>(OpaaxStringID(lID.c_str()));
+        REQUIRE(lHandle.IsValid());
+        CHECK(lHandle->Value == static_cast<Int32>(i + 1));
+    }
+
+    CHECK(AssetRegistry::GetPendingLoadCount() == 0u);
+    CHECK(lLoader->DecodeMemoryCount == lCount);
+    CHECK(lLoader->DecodesOnMain == 0u);
+    CHECK(lLoader->DecodeCount == 0u);
+
+    AssetRegistry::Shutdown();
+    lIO.Shutdown();
+    lJobs.Shutdown();
+}
@@ -0,0 +1,286 @@
+// Suite: AssetRegistry lookups from worker threads (Assets/AssetRegistry.h — Thread safety).
+//
+// The stress case runs frames like the engine loop: every JobSubsystem worker resolves handles
+// (TAssetHandle::Get, Find<T>, GetState) while the main thread loads, unloads, reloads and evicts;
+// the frame ends by joining the workers and calling UpdateCache. Payloads carry their key and a
+// canary, so a torn, wrong-type or freed resolve fails a check instead of only crashing.
+#include <doctest.h>
+
+#include "Assets/AssetRegistry.h"
+#include "Assets/AssetSlotTable.hpp"
+#include "Core/Jobs/JobSubsystem.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr Uint32 k_Canary = 0xA55E7C0Du;
+
+    std::atomic<Uint32> g_Destroyed{ 0 };
+
+    struct StressAsset
+    {
+        Uint32 Key    = 0;
+        Uint32 Canary = k_Canary;
+
+        ~StressAsset()
+        {
+            Canary = 0;
+            ++g_Destroyed;
+        }
+    };
+
+    // Loaded under other IDs, so slots and lookup shards are shared between the two types.
+    struct OtherAsset
+    {
+        Uint64 Value = 0;
+    };
+
+    struct StressLoader final : IAssetLoader<StressAsset>
+    {
+        StressAsset* Load(const char* /*InAbsPath*/, OpaaxStringID InCanonicalID) override
+        {
+            return new StressAsset{ InCanonicalID.GetId() };
+        }
+
+        bool IsValid(StressAsset* InAsset) override { return InAsset != nullptr; }
+    };
+
+    struct OtherLoader final : IAssetLoader<OtherAsset>
+    {
+        OtherAsset* Load(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override
+        {
+            return new OtherAsset{ ~0ull };
+        }
+
+        bool IsValid(OtherAsset* InAsset) override { return InAsset != nullptr; }
+    };
+
+    TDynArray<OpaaxStringID> MakeIDs(const char* InPrefix, Uint32 InCount)
+    {
+        TDynArray<OpaaxStringID> lIDs;
+        for (Uint32 i = 0; i < InCount; ++i)
+        {
+            lIDs.push_back(OPAAX_ID((std::string(InPrefix) + std::to_string(i)).c_str()));
+        }
+        return lIDs;
+    }
+
+    // Cheap per-thread LCG — std::rand is not thread-safe.
+    FORCEINLINE Uint32 NextRandom(Uint32& InOutState) noexcept
+    {
+        InOutState = InOutState * 1664525u + 1013904223u;
+        return InOutState >> 8;
+    }
+}
+
+TEST_CASE("AssetRegistry: handles resolve from every worker while the main thread loads and unloads")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    AssetLoaderRegistry::Register<StressAsset>(MakeUnique<StressLoader>());
+    AssetLoaderRegistry::Register<OtherAsset>(MakeUnique<OtherLoader>());
+    AssetRegistry::SetCacheBudget(1, 0);   // evict every idle handle-free asset too
+
+    const TDynArray<OpaaxStringID> lPinnedIDs = MakeIDs("Stress/Pinned/", 16);
+    const TDynArray<OpaaxStringID> lChurnIDs  = MakeIDs("Stress/Churn/", 64);
+    const TDynArray<OpaaxStringID> lOtherIDs  = MakeIDs("Stress/Other/", 64);
+
+    TDynArray<TAssetHandle<StressAsset>> lPinned;
+    for (const OpaaxStringID& lID : lPinnedIDs) { lPinned.push_back(AssetRegistry::Load<StressAsset>(lID)); }
+
+    std::atomic<bool>   lStop{ false };
+    std::atomic<Uint32> lErrors{ 0 };
+    std::atomic<Uint64> lResolves{ 0 };
+    std::atomic<Uint64> lChurnHits{ 0 };
+
+    const auto lWorkerBody = [&](Uint32 InSeed)
+    {
+        Uint32 lRandom = InSeed * 2654435761u + 1u;
+        Uint64 lLocalResolves = 0;
+        Uint64 lLocalHits     = 0;
+        TAssetHandle<StressAsset> lKept;
+
+        // Bounded so a pool that runs jobs late (or inline) still ends the frame.
+        for (Uint32 lIter = 0; lIter < 200000 && !lStop.load(std::memory_order_relaxed); ++lIter)
+        {
+            const TAssetHandle<StressAsset>& lPin = lPinned[NextRandom(lRandom) % lPinned.size()];
+            const StressAsset* lPinPtr = lPin.Get();
+            if (!lPinPtr || lPinPtr->Key != lPin.GetID().GetId() || lPinPtr->Canary != k_Canary) { ++lErrors; }
+
+            const OpaaxStringID lChurnID = lChurnIDs[NextRandom(lRandom) % lChurnIDs.size()];
+            TAssetHandle<StressAsset> lFound = AssetRegistry::Find<StressAsset>(lChurnID);
+            if (const StressAsset* lPtr = lFound.Get())
+            {
+                if (lPtr->Key != lChurnID.GetId() || lPtr->Canary != k_Canary) { ++lErrors; }
+                ++lLocalHits;
+                lKept = lFound;
+            }
+
+            // A handle held across main-thread unloads: null, or still the right asset.
+            if (const StressAsset* lPtr = lKept.Get())
+            {
+                if (lPtr->Key != lKept.GetID().GetId() || lPtr->Canary != k_Canary) { ++lErrors; }
+            }
+
+            // Churn IDs are only ever StressAsset.
+            if (AssetRegistry::Find<OtherAsset>(lChurnID).IsValid()) { ++lErrors; }
+
+            const EAssetState lState = AssetRegistry::GetState(lChurnID);
+            if (lState != EAssetState::Loaded && lState != EAssetState::Unloaded) { ++lErrors; }
+
+            lLocalResolves += 3;
+        }
+        lResolves  += lLocalResolves;
+        lChurnHits += lLocalHits;
+    };
+
+    const Uint32 lWorkers = lJobs.GetWorkerCount();
+    Uint32       lRandom  = 12345u;
+    TDynArray<TAssetHandle<StressAsset>> lHeld;   // main-thread handles, dropped at random
+
+    for (Uint32 lFrame = 0; lFrame < 40; ++lFrame)
+    {
+        lStop = false;
+        TDynArray<JobHandle> lJobHandles;
+        for (Uint32 w = 0; w < lWorkers; ++w)
+        {
+            lJobHandles.push_back(lJobs.Submit([&lWorkerBody, w, lFrame] { lWorkerBody(lFrame * 64u + w); }));
+        }
+
+        for (Uint32 lOp = 0; lOp < 400; ++lOp)
+        {
+            const Uint32        lIndex   = NextRandom(lRandom) % lChurnIDs.size();
+            const OpaaxStringID lChurnID = lChurnIDs[lIndex];
+            switch (NextRandom(lRandom) % 6)
+            {
+                case 0: lHeld.push_back(AssetRegistry::Load<StressAsset>(lChurnID));  break;
+                case 1: AssetRegistry::Load<StressAsset>(lChurnID);                   break;
+                case 2: if (AssetRegistry::IsLoaded(lChurnID)) { AssetRegistry::Unload(lChurnID); } break;
+                case 3: AssetRegistry::Reload<StressAsset>(lChurnID);                 break;
+                case 4:
+                    if (AssetRegistry::IsLoaded(lOtherIDs[lIndex])) { AssetRegistry::Unload(lOtherIDs[lIndex]); }
+                    else                                            { AssetRegistry::Load<OtherAsset>(lOtherIDs[lIndex]); }
+                    break;
+                default:
+                    if (!lHeld.empty()) { lHeld.erase(lHeld.begin() + NextRandom(lRandom) % lHeld.size()); }
+                    break;
+            }
+        }
+
+        lStop = true;
+        for (const JobHandle& lJob : lJobHandles) { lJobs.Wait(lJob); }
+        AssetRegistry::UpdateCache();
+    }
+
+    CHECK(lErrors.load() == 0u);
+    CHECK(lResolves.load() > 0u);
+    CHECK(lChurnHits.load() > 0u);
+    for (const TAssetHandle<StressAsset>& lPin : lPinned) { CHECK(lPin.IsValid()); }
+
+    lHeld.clear();
+    lPinned.clear();
+    AssetRegistry::Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry: with a job system, a removed payload outlives its entry by the retire grace")
+{
+    JobSubsystem lJobs;
+    REQUIRE(lJobs.Startup());
+    AssetRegistry::SetJobSystem(&lJobs);
+    AssetLoaderRegistry::Register<StressAsset>(MakeUnique<StressLoader>());
+
+    const OpaaxStringID lID = OPAAX_ID("Stress/Retired");
+    TAssetHandle<StressAsset> lHandle = AssetRegistry::Load<StressAsset>(lID);
+    const StressAsset* lPtr = lHandle.Get();
+    REQUIRE(lPtr);
+
+    const Uint32 lDestroyedBefore = g_Destroyed.load();
+    AssetRegistry::Unload(lID);
+
+    // Gone from every lookup at once...
+    CHECK_FALSE(lHandle.IsValid());
+    CHECK_FALSE(AssetRegistry::Find<StressAsset>(lID).IsValid());
+    CHECK(AssetRegistry::GetState(lID) == EAssetState::Unloaded);
+
+    // ...but a pointer resolved before the Unload stays readable for the rest of the frame.
+    AssetRegistry::UpdateCache();
+    CHECK(g_Destroyed.load() == lDestroyedBefore);
+    CHECK(lPtr->Canary == k_Canary);
+
+    for (Uint32 i = 0; i < 8; ++i) { AssetRegistry::UpdateCache(); }
+    CHECK(g_Destroyed.load() == lDestroyedBefore + 1);
+
+    lHandle.Reset();
+    AssetRegistry::Shutdown();
+    lJobs.Shutdown();
+}
+
+TEST_CASE("AssetRegistry: a handle taken with Find<T> keeps the asset from being evicted")
+{
+    AssetLoaderRegistry::Register<StressAsset>(MakeUnique<StressLoader>());
+    AssetRegistry::SetCacheBudget(1, 0);
+
+    const OpaaxStringID lID = OPAAX_ID("Stress/Found");
+    AssetRegistry::Load<StressAsset>(lID);
+
+    {
+        TAssetHandle<StressAsset> lFound = AssetRegistry::Find<StressAsset>(lID);
+        REQUIRE(lFound.IsValid());
+        CHECK(lFound.GetRefCount() == 2u);   // registry + this handle
+        CHECK_FALSE(AssetRegistry::Find<OtherAsset>(lID).IsValid());
+
+        for (Uint32 i = 0; i < 8; ++i) { AssetRegistry::UpdateCache(); }
+        CHECK(lFound.IsValid());
+        CHECK(AssetRegistry::GetCacheStats().Evictions == 0u);
+    }
+
+    for (Uint32 i = 0; i < 8; ++i) { AssetRegistry::UpdateCache(); }
+    CHECK_FALSE(AssetRegistry::IsLoaded(lID));
+    CHECK(AssetRegistry::GetCacheStats().Evictions == 1u);
+
+    // Find never loads.
+    CHECK_FALSE(AssetRegistry::Find<StressAsset>(lID).IsValid());
+    CHECK_FALSE(AssetRegistry::IsLoaded(lID));
+
+    AssetRegistry::Shutdown();
+}
+
+TEST_CASE("AssetSlotTable: a slot resolves from another thread while the table grows past several pages")
+{
+    Int32  lPayload = 0;
+    Uint32 lGen     = 0;
+    const Uint32 lSlot = AssetSlotTable::Allocate(lGen);
+    AssetSlotTable::SetPayload(lSlot, &lPayload);
+
+    std::atomic<bool>   lDone{ false };
+    std::atomic<Uint32> lMisses{ 0 };
+    std::thread lReader([&]
+    {
+        while (!lDone.load(std::memory_order_relaxed))
+        {
+            if (AssetSlotTable::Resolve(lSlot, lGen) != &lPayload) { ++lMisses; }
+        }
+    });
+
+    TDynArray<Uint32> lSlots;
+    for (Uint32 i = 0; i < AssetSlotTable::PageSize * 4; ++i)
+    {
+        Uint32 lOtherGen = 0;
+        lSlots.push_back(AssetSlotTable::Allocate(lOtherGen));
+        if (i % 3 == 0) { AssetSlotTable::Free(lSlots.back()); }
+    }
+
+    lDone = true;
+    lReader.join();
+    CHECK(lMisses.load() == 0u);
+    CHECK(AssetSlotTable::Resolve(lSlot, lGen) == &lPayload);
+
+    AssetSlotTable::Clear();
+}
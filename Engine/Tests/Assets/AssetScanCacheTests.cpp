@@ -0,0 +1,83 @@
+// Suite: incremental asset-scan cache blob (AssetScanCache::Serialize / Deserialize).
+//
+// The encode/decode half is header-inline and never touches disk, so a hand-built
+// AssetScanCacheData stands in for a real scan — no content tree, no manifest.
+#include <doctest.h>
+
+#include "Assets/AssetScanCache.h"
+
+using namespace Opaax;
+
+namespace
+{
+    AssetScanCacheData MakeData()
+    {
+        AssetScanCacheData lData;
+        lData.ManifestFingerprint = 0x1234'5678'9ABC'DEF0ull;
+
+        AssetScanCacheEntry lPlayer;
+        lPlayer.Size    = 4096;
+        lPlayer.MTime   = -42;
+        lPlayer.ID      = "Textures/Player";
+        lPlayer.RelPath = "Game/Assets/Textures/Player.png";
+        lPlayer.Type    = OpaaxStringID("Texture2D");
+        lData.Files.emplace(OpaaxString("Textures/Player.png"), lPlayer);
+
+        AssetScanCacheEntry lReadme;   // skipped extension: no ID / path
+        lReadme.Size  = 12;
+        lReadme.MTime = 7;
+        lReadme.Type  = OpaaxStringID("Unknown");
+        lData.Files.emplace(OpaaxString("README.txt"), lReadme);
+        return lData;
+    }
+}
+
+TEST_CASE("AssetScanCache: serialize/deserialize round-trips every entry")
+{
+    TDynArray<Uint8> lBytes;
+    AssetScanCache::Serialize("Game/Assets", MakeData(), lBytes);
+
+    AssetScanCacheData lOut;
+    REQUIRE(AssetScanCache::Deserialize(lBytes.data(), lBytes.size(), "Game/Assets", lOut));
+
+    CHECK(lOut.ManifestFingerprint == 0x1234'5678'9ABC'DEF0ull);
+    REQUIRE(lOut.Files.size() == 2);
+
+    const auto lIt = lOut.Files.find(OpaaxString("Textures/Player.png"));
+    REQUIRE(lIt != lOut.Files.end());
+    CHECK(lIt->second.Size == 4096);
+    CHECK(lIt->second.MTime == -42);
+    CHECK(lIt->second.ID == "Textures/Player");
+    CHECK(lIt->second.RelPath == "Game/Assets/Textures/Player.png");
+    CHECK(lIt->second.Type == OpaaxStringID("Texture2D"));
+
+    const auto lSkipped = lOut.Files.find(OpaaxString("README.txt"));
+    REQUIRE(lSkipped != lOut.Files.end());
+    CHECK(lSkipped->second.ID.IsEmpty());
+    CHECK(lSkipped->second.Type == OpaaxStringID("Unknown"));
+}
+
+TEST_CASE("AssetScanCache: a cache written for another scan root is rejected")
+{
+    TDynArray<Uint8> lBytes;
+    AssetScanCache::Serialize("Engine/Assets", MakeData(), lBytes);
+
+    AssetScanCacheData lOut;
+    CHECK_FALSE(AssetScanCache::Deserialize(lBytes.data(), lBytes.size(), "Game/Assets", lOut));
+    CHECK(lOut.Files.empty());
+}
+
+TEST_CASE("AssetScanCache: truncated or corrupted blobs are rejected")
+{
+    TDynArray<Uint8> lBytes;
+    AssetScanCache::Serialize("Game/Assets", MakeData(), lBytes);
+
+    AssetScanCacheData lOut;
+    CHECK_FALSE(AssetScanCache::Deserialize(lBytes.data(), lBytes.size() - 5, "Game/Assets", lOut));
+
+    lBytes[lBytes.size() / 2] ^= 0x5Au;
+    CHECK_FALSE(AssetScanCache::Deserialize(lBytes.data(), lBytes.size(), "Game/Assets", lOut));
+    CHECK(lOut.Files.empty());
+
+    CHECK_FALSE(AssetScanCache::Deserialize(nullptr, 0, "Game/Assets", lOut));
+}
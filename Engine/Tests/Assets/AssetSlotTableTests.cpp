@@ -0,0 +1,98 @@
+// Suite: AssetSlotTable + TAssetHandle's slot fast path (Assets/AssetSlotTable.hpp).
+//
+// Table-level cases drive Allocate / Free / Clear directly; the handle cases go through
+// AssetRegistry with a fake loader to check that a stale slot never resolves and that the
+// ID fallback still finds an asset re-loaded under the same name.
+#include <doctest.h>
+
+#include "Assets/AssetRegistry.h"
+#include "Assets/AssetSlotTable.hpp"
+
+using namespace Opaax;
+
+namespace
+{
+    struct SlotAsset
+    {
+        Int32 Value = 0;
+    };
+
+    struct SlotAssetLoader final : IAssetLoader<SlotAsset>
+    {
+        Int32 Next = 1;
+
+        SlotAsset* Load(const char* /*InAbsPath*/, OpaaxStringID /*InCanonicalID*/) override
+        {
+            return new SlotAsset{ Next++ };
+        }
+
+        bool IsValid(SlotAsset* InAsset) override { return InAsset != nullptr; }
+    };
+}
+
+TEST_CASE("AssetSlotTable: a freed slot is reused under a new generation")
+{
+    Int32  lPayload = 0;
+    Uint32 lGenA    = 0;
+    const Uint32 lSlotA = AssetSlotTable::Allocate(lGenA);
+    AssetSlotTable::SetPayload(lSlotA, &lPayload);
+    CHECK(AssetSlotTable::Resolve(lSlotA, lGenA) == &lPayload);
+    CHECK(AssetSlotTable::GetLiveCount() == 1u);
+
+    AssetSlotTable::Free(lSlotA);
+    CHECK(AssetSlotTable::Resolve(lSlotA, lGenA) == nullptr);
+
+    Uint32 lGenB = 0;
+    const Uint32 lSlotB = AssetSlotTable::Allocate(lGenB);
+    AssetSlotTable::SetPayload(lSlotB, &lPayload);
+    CHECK(lSlotB == lSlotA);
+    CHECK(lGenB != lGenA);
+    CHECK(AssetSlotTable::Resolve(lSlotA, lGenA) == nullptr);   // the old handle stays dead
+    CHECK(AssetSlotTable::Resolve(lSlotB, lGenB) == &lPayload);
+
+    AssetSlotTable::Clear();
+    CHECK(AssetSlotTable::GetLiveCount() == 0u);
+}
+
+TEST_CASE("AssetSlotTable: out-of-range and cleared slots resolve to null")
+{
+    CHECK(AssetSlotTable::Resolve(AssetSlotTable::InvalidIndex, 0) == nullptr);
+
+    Int32  lPayload = 0;
+    Uint32 lGen     = 0;
+    const Uint32 lSlot = AssetSlotTable::Allocate(lGen);
+    AssetSlotTable::SetPayload(lSlot, &lPayload);
+    AssetSlotTable::Clear();
+
+    // The same index handed out after Clear carries a generation no earlier handle holds.
+    Uint32 lGenAfter = 0;
+    const Uint32 lSlotAfter = AssetSlotTable::Allocate(lGenAfter);
+    CHECK(lSlotAfter == lSlot);
+    CHECK(lGenAfter != lGen);
+    CHECK(AssetSlotTable::Resolve(lSlot, lGen) == nullptr);
+
+    AssetSlotTable::Clear();
+}
+
+TEST_CASE("TAssetHandle: Unload invalidates the slot, a re-Load resolves by ID again")
+{
+    AssetLoaderRegistry::Register<SlotAsset>(MakeUnique<SlotAssetLoader>());
+
+    TAssetHandle<SlotAsset> lHandle = AssetRegistry::Load<SlotAsset>(OPAAX_ID("Slot/A"));
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 1);
+
+    AssetRegistry::Unload(OPAAX_ID("Slot/A"));
+    CHECK_FALSE(lHandle.IsValid());
+
+    // The new entry gets a fresh slot; the old handle falls back to the ID and finds it.
+    TAssetHandle<SlotAsset> lReloaded = AssetRegistry::Load<SlotAsset>(OPAAX_ID("Slot/A"));
+    REQUIRE(lReloaded.IsValid());
+    REQUIRE(lHandle.IsValid());
+    CHECK(lHandle->Value == 2);
+    CHECK(lHandle.Get() == lReloaded.Get());
+
+    AssetRegistry::Shutdown();
+    CHECK_FALSE(lReloaded.IsValid());
+    CHECK(AssetSlotTable::GetLiveCount() == 0u);
+}
@@ -0,0 +1,264 @@
+// Suite: offline texture cooking (Assets/Pack/TextureCook.h) — mip chain layout, premultiplied
+// alpha, the BC1 / BC3 block encoder, the blob round trip through a mounted pack, and
+// TextureLoader / Texture2D uploading it on the null backend.
+#include <doctest.h>
+
+#include "Assets/Loader/TextureLoader.h"
+#include "Assets/Pack/AssetPackWriter.h"
+#include "Assets/Pack/PackFileSystem.h"
+#include "Assets/Pack/TextureCook.h"
+#include "Core/OpaaxFile.h"
+#include "RHI/Null/NullResources.h"
+#include "RHI/RenderAPI.h"
+#include "Renderer/Texture2D.h"
+
+#include <cstring>
+#include <filesystem>
+
+using namespace Opaax;
+
+namespace
+{
+    TDynArray<Uint8> SolidRGBA(Uint32 InWidth, Uint32 InHeight, Uint8 InR, Uint8 InG, Uint8 InB, Uint8 InA)
+    {
+        TDynArray<Uint8> lPixels(static_cast<size_t>(InWidth) * InHeight * 4u);
+        for (size_t i = 0; i < lPixels.size(); i += 4)
+        {
+            lPixels[i + 0] = InR;
+            lPixels[i + 1] = InG;
+            lPixels[i + 2] = InB;
+            lPixels[i + 3] = InA;
+        }
+        return lPixels;
+    }
+
+    // The blob is not in a pack yet — view it the way PackFileSystem::Find would.
+    AssetPackBlob AsBlob(const TDynArray<Uint8>& InBlob)
+    {
+        return AssetPackBlob{ InBlob.data(), InBlob.size(), EAssetPackFormat::CookedTexture };
+    }
+
+    // A one-entry pack laid out by hand, as a cooker in another process would have written it —
+    // InCanonicalID is never interned on the writing side.
+    bool WriteSingleTexturePack(const std::filesystem::path& InPath, const char* InCanonicalID,
+                                const TDynArray<Uint8>& InBlob)
+    {
+        constexpr Uint32 lCapacity  = 2;
+        const Uint64     lTocOffset = AssetPackAlignment
+                                    + (InBlob.size() + AssetPackAlignment - 1) / AssetPackAlignment * AssetPackAlignment;
+
+        AssetPackHeader lHeader;
+        lHeader.EntryCount  = 1;
+        lHeader.TocCapacity = lCapacity;
+        lHeader.TocOffset   = lTocOffset;
+        lHeader.FileSize    = lTocOffset + lCapacity * sizeof(AssetPackTocEntry);
+
+        AssetPackTocEntry lToc[lCapacity]{};
+        const Uint64 lKey = AssetPackKey(InCanonicalID);
+        lToc[lKey & (lCapacity - 1)] = { lKey, static_cast<Uint32>(EAssetPackFormat::CookedTexture), 0,
+                                         AssetPackAlignment, InBlob.size() };
+
+        TDynArray<Uint8> lFile(static_cast<size_t>(lHeader.FileSize), 0);
+        std::memcpy(lFile.data(), &lHeader, sizeof(lHeader));
+        std::memcpy(lFile.data() + AssetPackAlignment, InBlob.data(), InBlob.size());
+        std::memcpy(lFile.data() + lTocOffset, lToc, sizeof(lToc));
+        return OpaaxFile::WriteBinaryAtomic(InPath.string().c_str(), lFile.data(), lFile.size());
+    }
+
+    const NullTexture2D* AsNull(const ITexture2D* InTexture)
+    {
+        return dynamic_cast<const NullTexture2D*>(InTexture);
+    }
+}
+
+TEST_CASE("TextureCook: the mip chain runs down to 1x1, levels back to back")
+{
+    const TDynArray<Uint8> lPixels = SolidRGBA(8, 2, 10, 20, 30, 255);
+
+    TDynArray<Uint8> lBlob;
+    REQUIRE(TextureCook::Cook(lPixels.data(), 8, 2, TextureCookSettings{}, lBlob));
+
+    TextureDesc lDesc;
+    bool        lPremultiplied = true;
+    REQUIRE(TextureCook::Read(AsBlob(lBlob), lDesc, lPremultiplied));
+    CHECK(lDesc.Format == ETextureFormat::RGBA8);
+    CHECK(lDesc.MipCount == 4u);   // 8x2, 4x1, 2x1, 1x1
+    CHECK_FALSE(lPremultiplied);
+    CHECK(lDesc.Mips[1] == lDesc.Mips[0] + 8 * 2 * 4);
+    CHECK(lDesc.Mips[3] == lDesc.Mips[2] + 2 * 1 * 4);
+    CHECK(lDesc.Mips[3][0] == 10);   // a solid colour survives every box filter
+    CHECK(lDesc.Mips[3][3] == 255);
+
+    TextureCookSettings lNoMips;
+    lNoMips.bGenerateMips = false;
+    REQUIRE(TextureCook::Cook(lPixels.data(), 8, 2, lNoMips, lBlob));
+    REQUIRE(TextureCook::Read(AsBlob(lBlob), lDesc, lPremultiplied));
+    CHECK(lDesc.MipCount == 1u);
+}
+
+TEST_CASE("TextureCook: premultiply scales colour by alpha and is flagged")
+{
+    const TDynArray<Uint8> lPixels = SolidRGBA(2, 2, 200, 100, 0, 128);
+
+    TextureCookSettings lSettings;
+    lSettings.bPremultiplyAlpha = true;
+    TDynArray<Uint8> lBlob;
+    REQUIRE(TextureCook::Cook(lPixels.data(), 2, 2, lSettings, lBlob));
+
+    TextureDesc lDesc;
+    bool        lPremultiplied = false;
+    REQUIRE(TextureCook::Read(AsBlob(lBlob), lDesc, lPremultiplied));
+    CHECK(lPremultiplied);
+    CHECK(lDesc.Mips[0][0] == 100);   // (200 * 128 + 127) / 255
+    CHECK(lDesc.Mips[0][1] == 50);
+    CHECK(lDesc.Mips[0][3] == 128);
+}
+
+TEST_CASE("TextureCook: compression picks BC1 for opaque, BC3 for alpha, with block-sized levels")
+{
+    const TDynArray<Uint8> lOpaque      = SolidRGBA(6, 6, 255, 0, 0, 255);
+    const TDynArray<Uint8> lTranslucent = SolidRGBA(6, 6, 255, 0, 0, 64);
+
+    TextureCookSettings lSettings;
+    lSettings.bCompress = true;
+
+    TDynArray<Uint8> lBlob;
+    TextureDesc      lDesc;
+    bool             lPremultiplied = false;
+
+    REQUIRE(TextureCook::Cook(lOpaque.data(), 6, 6, lSettings, lBlob));
+    REQUIRE(TextureCook::Read(AsBlob(lBlob), lDesc, lPremultiplied));
+    CHECK(lDesc.Format == ETextureFormat::BC1);
+    CHECK(lDesc.MipCount == 3u);                            // 6, 3, 1
+    CHECK(lDesc.Mips[1] == lDesc.Mips[0] + 4 * 8);          // 2x2 blocks of 8 bytes
+    CHECK(lBlob.size() == sizeof(AssetPackTextureHeader) + (4 + 1 + 1) * 8);
+
+    REQUIRE(TextureCook::Cook(lTranslucent.data(), 6, 6, lSettings, lBlob));
+    REQUIRE(TextureCook::Read(AsBlob(lBlob), lDesc, lPremultiplied));
+    CHECK(lDesc.Format == ETextureFormat::BC3);
+    CHECK(lBlob.size() == sizeof(AssetPackTextureHeader) + (4 + 1 + 1) * 16);
+    CHECK(lDesc.Mips[0][0] == 64);                          // BC3 alpha endpoints
+    CHECK(lDesc.Mips[0][1] == 64);
+}
+
+TEST_CASE("TextureCook: BC1 endpoints bracket the block, indices pick the nearest end")
+{
+    // Left half black, right half white: endpoints near each extreme (inset by 1/16 of the
+    // range), each texel on its own end.
+    Uint8 lTexels[16 * 4];
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const Uint8 lValue = (i % 4) < 2 ? 0 : 255;
+        lTexels[i * 4 + 0] = lValue;
+        lTexels[i * 4 + 1] = lValue;
+        lTexels[i * 4 + 2] = lValue;
+        lTexels[i * 4 + 3] = 255;
+    }
+
+    Uint8 lBlock[8];
+    TextureCook::EncodeBC1Block(lTexels, lBlock);
+
+    const Uint16 lColor0  = static_cast<Uint16>(lBlock[0] | (lBlock[1] << 8));
+    const Uint16 lColor1  = static_cast<Uint16>(lBlock[2] | (lBlock[3] << 8));
+    const Uint32 lIndices = lBlock[4] | (lBlock[5] << 8) | (lBlock[6] << 16) | (static_cast<Uint32>(lBlock[7]) << 24);
+    CHECK(lColor0 > lColor1);    // 4-colour mode
+    CHECK((lColor0 >> 11) >= 28u);
+    CHECK((lColor1 >> 11) <= 3u);
+    CHECK((lIndices & 3u) == 1u);          // texel 0 is black -> color1
+    CHECK(((lIndices >> 6) & 3u) == 0u);   // texel 3 is white -> color0
+
+    // A flat block collapses onto one exact endpoint.
+    for (Uint32 i = 0; i < 16; ++i) { lTexels[i * 4 + 0] = 255; lTexels[i * 4 + 1] = 0; lTexels[i * 4 + 2] = 0; }
+    TextureCook::EncodeBC1Block(lTexels, lBlock);
+    CHECK(static_cast<Uint16>(lBlock[0] | (lBlock[1] << 8)) == 0xF800u);
+    CHECK(static_cast<Uint16>(lBlock[2] | (lBlock[3] << 8)) == 0xF800u);
+    CHECK((lBlock[4] | lBlock[5] | lBlock[6] | lBlock[7]) == 0);
+}
+
+TEST_CASE("TextureCook: a cooked texture reads back from a mounted pack")
+{
+    const std::filesystem::path lPath = std::filesystem::temp_directory_path() / "OpaaxTests" / "Cooked.opak";
+    const TDynArray<Uint8> lPixels = SolidRGBA(4, 4, 1, 2, 3, 255);
+
+    TDynArray<Uint8> lBlob;
+    REQUIRE(TextureCook::Cook(lPixels.data(), 4, 4, TextureCookSettings{}, lBlob));
+
+    AssetPackWriter lWriter;
+    lWriter.Add(OPAAX_ID("Pack/Texture"), EAssetPackFormat::CookedTexture, Move(lBlob));
+    lWriter.Add(OPAAX_ID("Pack/Json"), EAssetPackFormat::Source, TDynArray<Uint8>{ '{', '}' });
+    REQUIRE(lWriter.Write(lPath.string().c_str()));
+    REQUIRE(PackFileSystem::Mount(OpaaxString(lPath.string().c_str())));
+
+    TextureDesc lDesc;
+    bool        lPremultiplied = false;
+    REQUIRE(TextureCook::Read(PackFileSystem::Find(OPAAX_ID("Pack/Texture")), lDesc, lPremultiplied));
+    CHECK(lDesc.Width == 4u);
+    CHECK(lDesc.MipCount == 3u);
+    CHECK(lDesc.Mips[0][2] == 3);
+    CHECK_FALSE(TextureCook::Read(PackFileSystem::Find(OPAAX_ID("Pack/Json")), lDesc, lPremultiplied));
+
+    PackFileSystem::UnmountAll();
+    std::filesystem::remove(lPath);
+}
+
+TEST_CASE("TextureLoader: a texture cooked elsewhere uploads from the pack on every path")
+{
+    const UniquePtr<IRenderAPI> lRHI = RenderAPI::Create(EBackend::Null);
+
+    const std::filesystem::path lDir  = std::filesystem::temp_directory_path() / "OpaaxTests";
+    const std::filesystem::path lPath = lDir / "CookedElsewhere.opak";
+    std::filesystem::create_directories(lDir);
+
+    // BC1, 8x8 -> 4 levels. The loose PNG does not exist: stb_image could not have produced it.
+    const TDynArray<Uint8> lPixels = SolidRGBA(8, 8, 200, 100, 50, 255);
+    TextureCookSettings    lSettings;
+    lSettings.bCompress = true;
+
+    TDynArray<Uint8> lBlob;
+    REQUIRE(TextureCook::Cook(lPixels.data(), 8, 8, lSettings, lBlob));
+    REQUIRE(WriteSingleTexturePack(lPath, "Textures/CookedElsewhere", lBlob));
+
+    // The game interns its own strings first, so the ID's index is unrelated to the cooker's.
+    for (Uint32 i = 0; i < 32; ++i)
+    {
+        (void)OPAAX_ID("Textures/InternedFirst_" + std::to_string(i));
+    }
+    const OpaaxStringID lID    = OPAAX_ID("Textures/CookedElsewhere");
+    const std::string   lLoose = (lDir / "CookedElsewhere.png").string();
+    REQUIRE(PackFileSystem::Mount(OpaaxString(lPath.string().c_str())));
+
+    TextureLoader lLoader;
+    CHECK_FALSE(lLoader.DecodesFromMemory(lLoose.c_str(), lID));   // nothing to read — it is mapped
+
+    SUBCASE("sync Load")
+    {
+        UniquePtr<Texture2D> lTexture(lLoader.Load(lLoose.c_str(), lID));
+        REQUIRE(lLoader.IsValid(lTexture.get()));
+
+        const NullTexture2D* lGpu = AsNull(lTexture->GetRHITexture());
+        REQUIRE(lGpu != nullptr);
+        CHECK(lGpu->GetFormat() == ETextureFormat::BC1);
+        CHECK(lGpu->GetMipCount() == 4u);
+        CHECK(lTexture->GetWidth() == 8u);
+    }
+
+    SUBCASE("async Decode + Finalize, then an evicted re-upload")
+    {
+        UniquePtr<AssetDecodeData> lDecoded = lLoader.Decode(lLoose.c_str(), lID, lLoader.PrepareDecode(lLoose.c_str(), lID));
+        REQUIRE(lDecoded != nullptr);
+        UniquePtr<Texture2D> lTexture(lLoader.Finalize(Move(lDecoded), lLoose.c_str(), lID));
+        REQUIRE(lLoader.IsValid(lTexture.get()));
+        CHECK(AsNull(lTexture->GetRHITexture())->GetMipCount() == 4u);
+
+        lTexture->EvictGpu();
+        REQUIRE_FALSE(lTexture->IsResident());
+
+        const NullTexture2D* lGpu = AsNull(lTexture->AcquireRHITexture());
+        REQUIRE(lGpu != nullptr);
+        CHECK(lGpu->GetFormat() == ETextureFormat::BC1);
+        CHECK(lGpu->GetMipCount() == 4u);
+    }
+
+    PackFileSystem::UnmountAll();
+    std::filesystem::remove(lPath);
+}
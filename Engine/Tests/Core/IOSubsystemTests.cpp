@@ -0,0 +1,310 @@
+// Suite: IOSubsystem async reads (Core/IO/IOSubsystem.h).
+//
+// Files are written under the system temp directory. Every read case runs on the default backend
+// (io_uring where the build and kernel allow it) and on the forced pread pool. Priority order is
+// checked on a one-thread pool: ReadBatch queues the whole batch under one lock, so the single IO
+// thread sees it complete before popping anything.
+#include <doctest.h>
+
+#include "Core/IO/IOSubsystem.h"
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace Opaax;
+
+namespace
+{
+    OpaaxString TempPath(const char* InName)
+    {
+        const std::filesystem::path lPath = std::filesystem::temp_directory_path() / "OpaaxTests" / InName;
+        return OpaaxString(lPath.generic_string().c_str());
+    }
+
+    OpaaxString WriteTempFile(const char* InName, const std::string& InContent)
+    {
+        const OpaaxString lPath = TempPath(InName);
+        std::filesystem::create_directories(std::filesystem::path(lPath.CStr()).parent_path());
+        std::ofstream(lPath.CStr(), std::ios::binary) << InContent;
+        return lPath;
+    }
+
+    // InCount bytes following a fixed pattern, so any range can be checked without keeping the file around.
+    std::string PatternBytes(Uint32 InCount)
+    {
+        std::string lBytes(InCount, '\0');
+        for (Uint32 i = 0; i < InCount; ++i) { lBytes[i] = static_cast<char>((i * 31u + 7u) & 0xFFu); }
+        return lBytes;
+    }
+
+    bool ResultEquals(const IOReadResult& InResult, const std::string& InExpected)
+    {
+        return InResult.IsOk() && InResult.GetSize() == InExpected.size()
+            && std::memcmp(InResult.GetData(), InExpected.data(), InExpected.size()) == 0;
+    }
+
+    IOReadRequest MakeRequest(const OpaaxString& InPath, Uint64 InOffset = 0, Uint64 InSize = IOWholeFile)
+    {
+        IOReadRequest lRequest;
+        lRequest.AbsPath = InPath;
+        lRequest.Offset  = InOffset;
+        lRequest.Size    = InSize;
+        return lRequest;
+    }
+}
+
+TEST_CASE("IOSubsystem: whole-file, ranged and missing reads")
+{
+    IOSubsystem lIO;
+    SUBCASE("default backend") {}
+    SUBCASE("pread thread pool") { lIO.SetForceThreadPool(true); }
+    REQUIRE(lIO.Startup());
+    CHECK(std::strcmp(lIO.GetBackendName(), "Inline") != 0);
+
+    const std::string lContent = PatternBytes(10000);
+    const OpaaxString lPath    = WriteTempFile("IORead.bin", lContent);
+
+    IORequestHandle lWhole   = lIO.Read(MakeRequest(lPath));
+    IORequestHandle lRange   = lIO.Read(MakeRequest(lPath, 1000, 500));
+    IORequestHandle lTail    = lIO.Read(MakeRequest(lPath, 9990, 100));   // clamped to the end
+    IORequestHandle lPastEnd = lIO.Read(MakeRequest(lPath, 20000, 10));
+    IORequestHandle lMissing = lIO.Read(MakeRequest(TempPath("IONope.bin")));
+
+    for (const IORequestHandle& lHandle : { lWhole, lRange, lTail, lPastEnd, lMissing }) { lIO.Wait(lHandle); }
+
+    CHECK(ResultEquals(lWhole.GetResult(), lContent));
+    CHECK(ResultEquals(lRange.GetResult(), lContent.substr(1000, 500)));
+    CHECK(ResultEquals(lTail.GetResult(), lContent.substr(9990)));
+    CHECK(lPastEnd.GetResult().Status == EIOStatus::Failed);
+    CHECK(lMissing.GetResult().Status == EIOStatus::NotFound);
+    CHECK(lMissing.GetResult().GetData() == nullptr);
+
+    const IOStats lStats = lIO.GetStats();
+    CHECK(lStats.Requests == 5u);
+    CHECK(lStats.Reads == 5u);
+    CHECK(lStats.Failed == 2u);
+    CHECK(lStats.BytesRead == 10000u + 500u + 10u);
+    CHECK(lStats.InFlight == 0u);
+
+    lIO.Shutdown();
+}
+
+TEST_CASE("IOSubsystem: a read that errors fails rather than coming back short")
+{
+    // A directory opens and sizes fine on POSIX, but reading it fails (EISDIR); Windows refuses to open it.
+    IOSubsystem lIO;
+    bool bStart = true;
+    SUBCASE("default backend") {}
+    SUBCASE("pread thread pool") { lIO.SetForceThreadPool(true); }
+    SUBCASE("inline")            { bStart = false; }
+    if (bStart) { REQUIRE(lIO.Startup()); }
+
+    const OpaaxString lDir = TempPath("IODir");
+    std::filesystem::create_directories(lDir.CStr());
+
+    IORequestHandle lHandle = lIO.Read(MakeRequest(lDir));
+    lIO.Wait(lHandle);
+
+    CHECK(lHandle.GetResult().Status == EIOStatus::Failed);
+    CHECK(lHandle.GetResult().GetData() == nullptr);
+    if (bStart)
+    {
+        CHECK(lIO.GetStats().Failed == 1u);
+        lIO.Shutdown();
+    }
+}
+
+TEST_CASE("IOSubsystem: requests for the same range share one read")
+{
+    IOSubsystem lIO;
+    SUBCASE("default backend") {}
+    SUBCASE("pread thread pool") { lIO.SetForceThreadPool(true); }
+    REQUIRE(lIO.Startup());
+
+    const std::string lContent = PatternBytes(4096);
+    const OpaaxString lPath    = WriteTempFile("IOCoalesce.bin", lContent);
+
+    TDynArray<IOReadRequest> lBatch;
+    lBatch.push_back(MakeRequest(lPath));
+    lBatch.push_back(MakeRequest(lPath));
+    lBatch.push_back(MakeRequest(lPath, 0, 128));   // different range — its own read
+    lBatch.push_back(MakeRequest(lPath));
+    const TDynArray<IORequestHandle> lHandles = lIO.ReadBatch(Move(lBatch));
+    REQUIRE(lHandles.size() == 4u);
+    for (const IORequestHandle& lHandle : lHandles) { lIO.Wait(lHandle); }
+
+    CHECK(ResultEquals(lHandles[0].GetResult(), lContent));
+    CHECK(ResultEquals(lHandles[2].GetResult(), lContent.substr(0, 128)));
+
+    // Coalesced requests hold the very same bytes.
+    CHECK(lHandles[0].GetResult().Bytes == lHandles[1].GetResult().Bytes);
+    CHECK(lHandles[0].GetResult().Bytes == lHandles[3].GetResult().Bytes);
+
+    const IOStats lStats = lIO.GetStats();
+    CHECK(lStats.Requests == 4u);
+    CHECK(lStats.Coalesced == 2u);
+    CHECK(lStats.Reads == 2u);
+
+    // Once landed, the same range is read again.
+    IORequestHandle lAgain = lIO.Read(MakeRequest(lPath));
+    lIO.Wait(lAgain);
+    CHECK(ResultEquals(lAgain.GetResult(), lContent));
+    CHECK(lIO.GetStats().Reads == 3u);
+
+    lIO.Shutdown();
+}
+
+TEST_CASE("IOSubsystem: queued reads start by priority, and a High request bumps a queued Low read")
+{
+    IOSubsystem lIO;
+    lIO.SetForceThreadPool(true);
+    lIO.SetThreadCount(1);
+    REQUIRE(lIO.Startup());
+
+    const OpaaxString lPath = WriteTempFile("IOPriority.bin", PatternBytes(1024));
+
+    std::mutex          lOrderMutex;
+    TDynArray<Uint64>   lOrder;   // request offsets, in completion order
+    const auto lMakeTracked = [&](Uint64 InOffset, EIOPriority InPriority)
+    {
+        IOReadRequest lRequest = MakeRequest(lPath, InOffset, 16);
+        lRequest.Priority   = InPriority;
+        lRequest.CompleteOn = EIOCompletionThread::IO;
+        lRequest.OnComplete = [&lOrderMutex, &lOrder, InOffset](const IOReadResult&)
+        {
+            std::lock_guard<std::mutex> lLock(lOrderMutex);
+            lOrder.push_back(InOffset);
+        };
+        return lRequest;
+    };
+
+    TDynArray<IOReadRequest> lBatch;
+    lBatch.push_back(lMakeTracked(0,  EIOPriority::Low));
+    lBatch.push_back(lMakeTracked(16, EIOPriority::Normal));
+    lBatch.push_back(lMakeTracked(32, EIOPriority::Low));
+    lBatch.push_back(lMakeTracked(48, EIOPriority::High));
+    lBatch.push_back(lMakeTracked(64, EIOPriority::Low));
+    lBatch.push_back(lMakeTracked(32, EIOPriority::High));   // joins offset 32 and bumps it
+    const TDynArray<IORequestHandle> lHandles = lIO.ReadBatch(Move(lBatch));
+    for (const IORequestHandle& lHandle : lHandles) { lIO.Wait(lHandle); }
+
+    // Callbacks of one read fire together, so the bumped read reports twice.
+    const TDynArray<Uint64> lExpected{ 48, 32, 32, 16, 0, 64 };
+    {
+        std::lock_guard<std::mutex> lLock(lOrderMutex);
+        CHECK(lOrder == lExpected);
+    }
+    CHECK(lIO.GetStats().Reads == 5u);
+
+    lIO.Shutdown();
+}
+
+TEST_CASE("IOSubsystem: hundreds of reads in flight land intact")
+{
+    IOSubsystem lIO;
+    SUBCASE("default backend") {}
+    SUBCASE("pread thread pool") { lIO.SetForceThreadPool(true); }
+    REQUIRE(lIO.Startup());
+
+    constexpr Uint32 lReads = 300;
+    constexpr Uint32 lChunk = 4096;
+    const std::string lContent = PatternBytes(lReads * lChunk);
+    const OpaaxString lPath    = WriteTempFile("IOMany.bin", lContent);
+
+    TDynArray<IOReadRequest> lBatch;
+    for (Uint32 i = 0; i < lReads; ++i)
+    {
+        lBatch.push_back(MakeRequest(lPath, static_cast<Uint64>(i) * lChunk, lChunk));
+        lBatch.back().Priority = static_cast<EIOPriority>(i % 3);
+    }
+    const TDynArray<IORequestHandle> lHandles = lIO.ReadBatch(Move(lBatch));
+
+    Uint32 lIntact = 0;
+    for (Uint32 i = 0; i < lReads; ++i)
+    {
+        lIO.Wait(lHandles[i]);
+        if (ResultEquals(lHandles[i].GetResult(), lContent.substr(static_cast<size_t>(i) * lChunk, lChunk))) { ++lIntact; }
+    }
+    CHECK(lIntact == lReads);
+
+    const IOStats lStats = lIO.GetStats();
+    CHECK(lStats.Reads == lReads);
+    CHECK(lStats.BytesRead == static_cast<Uint64>(lReads) * lChunk);
+    CHECK(lStats.Queued == 0u);
+
+    lIO.Shutdown();
+}
+
+TEST_CASE("IOSubsystem: callbacks run on the IO thread or in the main-thread drain")
+{
+    IOSubsystem lIO;
+    SUBCASE("default backend") {}
+    SUBCASE("pread thread pool") { lIO.SetForceThreadPool(true); }
+    REQUIRE(lIO.Startup());
+
+    const std::string lContent = PatternBytes(256);
+    const OpaaxString lPath    = WriteTempFile("IOCallbacks.bin", lContent);
+    const std::thread::id lMain = std::this_thread::get_id();
+
+    std::atomic<bool> lIOFired{ false };
+    std::atomic<bool> lIOOffMain{ false };
+    IOReadRequest lOnIO = MakeRequest(lPath, 0, 128);
+    lOnIO.CompleteOn = EIOCompletionThread::IO;
+    lOnIO.OnComplete = [&](const IOReadResult& InResult)
+    {
+        lIOOffMain = std::this_thread::get_id() != lMain;
+        lIOFired   = ResultEquals(InResult, lContent.substr(0, 128));
+    };
+
+    Uint32 lMainFired = 0;
+    bool   lMainOk    = false;
+    IOReadRequest lOnMain = MakeRequest(lPath, 128, 128);
+    lOnMain.OnComplete = [&](const IOReadResult& InResult)
+    {
+        ++lMainFired;
+        lMainOk = std::this_thread::get_id() == lMain && ResultEquals(InResult, lContent.substr(128, 128));
+    };
+
+    const IORequestHandle lIOHandle   = lIO.Read(Move(lOnIO));
+    const IORequestHandle lMainHandle = lIO.Read(Move(lOnMain));
+    lIO.Wait(lIOHandle);
+    lIO.Wait(lMainHandle);
+
+    // Landed, but a main-thread callback waits for the drain.
+    CHECK(lMainHandle.IsComplete());
+    CHECK(lMainFired == 0u);
+    lIO.Update(0.0);
+    CHECK(lMainFired == 1u);
+    CHECK(lMainOk);
+    lIO.Update(0.0);
+    CHECK(lMainFired == 1u);
+
+    // An IO-thread callback has already run by the time its handle completes.
+    CHECK(lIOFired);
+    CHECK(lIOOffMain);
+
+    lIO.Shutdown();
+}
+
+TEST_CASE("IOSubsystem: without a backend, reads are served inline")
+{
+    IOSubsystem lIO;
+
+    const std::string lContent = PatternBytes(64);
+    const OpaaxString lPath    = WriteTempFile("IOInline.bin", lContent);
+
+    bool lFired = false;
+    IOReadRequest lRequest = MakeRequest(lPath);
+    lRequest.OnComplete = [&lFired](const IOReadResult& InResult) { lFired = InResult.IsOk(); };
+
+    const IORequestHandle lHandle = lIO.Read(Move(lRequest));
+    CHECK(lHandle.IsComplete());
+    CHECK(lFired);
+    CHECK(ResultEquals(lHandle.GetResult(), lContent));
+    CHECK(std::strcmp(lIO.GetBackendName(), "Inline") == 0);
+}
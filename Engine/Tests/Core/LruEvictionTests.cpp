@@ -0,0 +1,58 @@
+// Suite: LRU eviction policy (Core/OpaaxLruEviction.h) — shared by TextureResidency and the
+// AssetRegistry cache.
+//
+// SelectLruEvictions is header-inline + pure (candidates are byte counts + last-used frames),
+// so this pins the policy without a GPU: nothing is selected under budget, only items idle for
+// the minimum window are eligible, least recently used go first, and selection stops at budget.
+#include <doctest.h>
+
+#include "Core/OpaaxLruEviction.h"
+
+using namespace Opaax;
+
+TEST_CASE("SelectLruEvictions: under budget or unlimited selects nothing")
+{
+    const LruCandidate lC[2] = { { 100, 0 }, { 100, 0 } };
+    TDynArray<Uint32>  lOut;
+
+    CHECK(SelectLruEvictions(lC, 2, 200, 300, 1000, 10, lOut) == 0u);
+    CHECK(lOut.empty());
+    CHECK(SelectLruEvictions(lC, 2, 200, 0, 1000, 10, lOut) == 0u);   // budget 0 = unlimited
+    CHECK(lOut.empty());
+}
+
+TEST_CASE("SelectLruEvictions: least recently used first, stopping once under budget")
+{
+    // Frame 100, idle window 10. [2] was drawn this frame and is never eligible.
+    const LruCandidate lC[4] = { { 100, 50 }, { 100, 20 }, { 100, 100 }, { 100, 80 } };
+    TDynArray<Uint32>  lOut;
+
+    const Uint64 lFreed = SelectLruEvictions(lC, 4, 400, 250, 100, 10, lOut);
+
+    CHECK(lFreed == 200u);
+    REQUIRE(lOut.size() == 2u);
+    CHECK(lOut[0] == 1u);   // frame 20
+    CHECK(lOut[1] == 0u);   // frame 50
+}
+
+TEST_CASE("SelectLruEvictions: recently used items are kept even if the budget stays exceeded")
+{
+    const LruCandidate lC[3] = { { 500, 95 }, { 100, 10 }, { 500, 99 } };
+    TDynArray<Uint32>  lOut;
+
+    const Uint64 lFreed = SelectLruEvictions(lC, 3, 1100, 200, 100, 10, lOut);
+
+    CHECK(lFreed == 100u);
+    REQUIRE(lOut.size() == 1u);
+    CHECK(lOut[0] == 1u);
+}
+
+TEST_CASE("SelectLruEvictions: equally idle items evict the larger first")
+{
+    const LruCandidate lC[2] = { { 64, 5 }, { 256, 5 } };
+    TDynArray<Uint32>  lOut;
+
+    CHECK(SelectLruEvictions(lC, 2, 320, 100, 50, 10, lOut) == 256u);
+    REQUIRE(lOut.size() == 1u);
+    CHECK(lOut[0] == 1u);
+}
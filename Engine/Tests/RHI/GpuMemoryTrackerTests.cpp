@@ -0,0 +1,58 @@
+// Suite: GPU memory accounting (RHI/GpuMemoryTracker).
+//
+// The tracker is OPAAX_API and touches no device — backends report into it — so its bookkeeping
+// runs here directly: per-category bytes/allocation counts, the per-asset table, and Reset.
+#include <doctest.h>
+
+#include "RHI/GpuMemoryTracker.h"
+
+using namespace Opaax;
+
+TEST_CASE("GpuMemoryTracker: categories balance across allocate / free")
+{
+    GpuMemoryTracker::Reset();
+
+    GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, 4096);
+    GpuMemoryTracker::Allocate(EGpuMemoryCategory::Texture, 1024);
+    GpuMemoryTracker::Allocate(EGpuMemoryCategory::VertexBuffer, 512);
+
+    GpuMemoryStats lStats = GpuMemoryTracker::GetStats();
+    CHECK(lStats.GetBytes(EGpuMemoryCategory::Texture)      == 5120u);
+    CHECK(lStats.GetBytes(EGpuMemoryCategory::VertexBuffer) == 512u);
+    CHECK(lStats.Allocations[static_cast<Uint32>(EGpuMemoryCategory::Texture)] == 2u);
+    CHECK(lStats.GetTotalBytes() == 5632u);
+
+    GpuMemoryTracker::Free(EGpuMemoryCategory::Texture, 4096);
+    lStats = GpuMemoryTracker::GetStats();
+    CHECK(lStats.GetBytes(EGpuMemoryCategory::Texture) == 1024u);
+    CHECK(lStats.Allocations[static_cast<Uint32>(EGpuMemoryCategory::Texture)] == 1u);
+
+    GpuMemoryTracker::Reset();
+    CHECK(GpuMemoryTracker::GetStats().GetTotalBytes() == 0u);
+}
+
+TEST_CASE("GpuMemoryTracker: per-asset bytes, largest first, zero drops the entry")
+{
+    GpuMemoryTracker::Reset();
+
+    GpuMemoryTracker::SetAssetBytes(7, 100);
+    GpuMemoryTracker::SetAssetBytes(9, 300);
+    GpuMemoryTracker::SetAssetBytes(7, 200);   // re-upload replaces, not adds
+
+    CHECK(GpuMemoryTracker::GetAssetBytes(7) == 200u);
+
+    TDynArray<std::pair<Uint32, Uint64>> lAssets;
+    GpuMemoryTracker::GetAssetBreakdown(lAssets);
+    REQUIRE(lAssets.size() == 2u);
+    CHECK(lAssets[0].first == 9u);
+    CHECK(lAssets[1].first == 7u);
+
+    GpuMemoryTracker::SetAssetBytes(9, 0);
+    CHECK(GpuMemoryTracker::GetAssetBytes(9) == 0u);
+    GpuMemoryTracker::GetAssetBreakdown(lAssets);
+    CHECK(lAssets.size() == 1u);
+
+    GpuMemoryTracker::SetDeviceMemory(1u << 20, 1u << 30);
+    CHECK(GpuMemoryTracker::GetStats().DeviceBudget == (1u << 30));
+    GpuMemoryTracker::Reset();
+}
@@ -0,0 +1,183 @@
+// Suite: headless null backend command stream (RHI/Null).
+//
+// NullCommandBuffer + NullCommandStream are OPAAX_API and touch no device, and the null resource
+// stubs are header-inline — so the whole record path runs here without a window. Pins what the
+// benchmarks read: per-frame counters, the bind-vs-change distinction, upload byte counts, the
+// one-frame-late publish, that the command list is only kept while recording, and that secondaries
+// recorded on other threads merge in ExecuteSecondary order.
+#include <doctest.h>
+
+#include "RHI/Null/NullCommandStream.h"
+#include "RHI/Null/NullCommandBuffer.h"
+#include "RHI/Null/NullResources.h"
+#include "Renderer/RenderTarget.hpp"
+
+#include <thread>
+
+using namespace Opaax;
+
+TEST_CASE("NullCommandBuffer: draws and binds are counted, changes only on a new object")
+{
+    NullCommandStream::Reset();
+    NullCommandStream::SetRecording(false);
+
+    NullCommandBuffer   lCmd;
+    DefaultRenderTarget lTarget(640, 480);
+    NullPipeline        lPipeA{ PipelineDesc{} };
+    NullPipeline        lPipeB{ PipelineDesc{} };
+
+    lCmd.BeginRenderPass(lTarget, ELoadOp::Clear, Vector4F(0.f));
+    lCmd.BindPipeline(lPipeA);
+    lCmd.BindPipeline(lPipeA);   // redundant
+    lCmd.BindPipeline(lPipeB);
+    lCmd.DrawIndexed(6);
+    lCmd.DrawIndexed(12);
+    lCmd.EndRenderPass();
+
+    const NullFrameCounters& lC = NullCommandStream::Counters();
+    CHECK(lC.RenderPasses    == 1u);
+    CHECK(lC.DrawCalls       == 2u);
+    CHECK(lC.IndicesDrawn    == 18u);
+    CHECK(lC.PipelineBinds   == 3u);
+    CHECK(lC.PipelineChanges == 2u);
+
+    // Frame state reset -> the next bind of the same pipeline is a change again.
+    lCmd.ResetFrameState();
+    lCmd.BindPipeline(lPipeB);
+    CHECK(NullCommandStream::Counters().PipelineChanges == 3u);
+}
+
+TEST_CASE("NullCommandBuffer: an indirect submission is one draw call carrying every packed draw")
+{
+    NullCommandStream::Reset();
+    NullCommandStream::SetRecording(true);
+
+    NullCommandBuffer lCmd;
+    REQUIRE(lCmd.SupportsDrawIndirect());
+
+    DrawIndexedIndirectCommand lDraws[3];
+    lDraws[0].IndexCount = 6000;
+    lDraws[1].IndexCount = 6000; lDraws[1].VertexOffset = 4000;
+    lDraws[2].IndexCount = 600;  lDraws[2].VertexOffset = 8000;
+    lCmd.DrawIndexedIndirect(lDraws, 3);
+
+    const NullFrameCounters& lC = NullCommandStream::Counters();
+    CHECK(lC.DrawCalls     == 1u);
+    CHECK(lC.IndirectDraws == 3u);
+    CHECK(lC.IndicesDrawn  == 12600u);
+
+    NullCommandStream::BeginFrame();
+    const TDynArray<NullCommand>& lList = NullCommandStream::GetLastCommands();
+    REQUIRE(lList.size() == 1u);
+    CHECK(lList[0].Type == ENullCommand::DrawIndexedIndirect);
+    CHECK(lList[0].Arg  == 3u);
+
+    NullCommandStream::SetRecording(false);
+}
+
+TEST_CASE("NullCommandStream: BeginFrame publishes the finished frame and zeroes the accumulator")
+{
+    NullCommandStream::Reset();
+
+    NullVertexBuffer lVBO(1024u);
+    lVBO.SetData(nullptr, 256u);
+    lVBO.SetData(nullptr, 128u);
+
+    CHECK(NullCommandStream::Counters().Uploads       == 2u);
+    CHECK(NullCommandStream::Counters().BytesUploaded == 384u);
+
+    NullCommandStream::BeginFrame();
+
+    CHECK(NullCommandStream::GetLastFrame().BytesUploaded == 384u);
+    CHECK(NullCommandStream::Counters().BytesUploaded     == 0u);
+    CHECK(NullCommandStream::GetFrameCount()              == 1u);
+}
+
+TEST_CASE("NullCommandStream: the command list is kept only while recording")
+{
+    NullCommandStream::Reset();
+    NullCommandBuffer lCmd;
+
+    NullCommandStream::SetRecording(false);
+    lCmd.DrawIndexed(6);
+    NullCommandStream::BeginFrame();
+    CHECK(NullCommandStream::GetLastCommands().empty());
+
+    NullCommandStream::SetRecording(true);
+    lCmd.SetViewport(0, 0, 800, 600);
+    lCmd.DrawIndexed(6);
+    NullCommandStream::BeginFrame();
+
+    const auto& lList = NullCommandStream::GetLastCommands();
+    REQUIRE(lList.size() == 2u);
+    CHECK(lList[0].Type == ENullCommand::SetViewport);
+    CHECK(lList[0].Arg  == ((800ull << 32) | 600ull));
+    CHECK(lList[1].Type == ENullCommand::DrawIndexed);
+    CHECK(lList[1].Arg  == 6u);
+
+    NullCommandStream::SetRecording(false);
+    NullCommandStream::Reset();
+}
+
+TEST_CASE("NullCommandBuffer: secondaries recorded on other threads replay in ExecuteSecondary order")
+{
+    NullCommandStream::Reset();
+    NullCommandStream::SetRecording(true);
+
+    DefaultRenderTarget lTarget(640, 480);
+    NullCommandBuffer   lPrimary;
+    NullCommandBuffer   lWorld(true);
+    NullCommandBuffer   lOverlay(true);
+    REQUIRE(lWorld.IsSecondary());
+
+    // Overlay finishes first on purpose — replay order must follow ExecuteSecondary, not recording.
+    std::thread lOverlayThread([&]()
+    {
+        lOverlay.BeginRenderPass(lTarget, ELoadOp::Load, Vector4F(0.f));
+        lOverlay.DrawIndexed(12);
+        lOverlay.EndRenderPass();
+    });
+    lOverlayThread.join();
+
+    std::thread lWorldThread([&]()
+    {
+        lWorld.BeginRenderPass(lTarget, ELoadOp::Clear, Vector4F(0.f));
+        lWorld.DrawIndexed(6);
+        lWorld.DrawIndexed(6);
+        lWorld.EndRenderPass();
+    });
+    lWorldThread.join();
+
+    // Nothing reaches the shared stream until the primary executes the secondaries.
+    CHECK(NullCommandStream::Counters().DrawCalls    == 0u);
+    CHECK(NullCommandStream::Counters().RenderPasses == 0u);
+    CHECK(lWorld.GetLocalCounters().DrawCalls        == 2u);
+
+    lPrimary.ExecuteSecondary(lWorld);
+    lPrimary.ExecuteSecondary(lOverlay);
+
+    const NullFrameCounters& lC = NullCommandStream::Counters();
+    CHECK(lC.RenderPasses      == 2u);
+    CHECK(lC.DrawCalls         == 3u);
+    CHECK(lC.IndicesDrawn      == 24u);
+    CHECK(lC.SecondaryExecutes == 2u);
+    CHECK(lWorld.GetLocalCounters().DrawCalls == 0u);   // consumed by the merge
+
+    NullCommandStream::BeginFrame();
+    const auto& lList = NullCommandStream::GetLastCommands();
+    REQUIRE(lList.size() == 9u);
+    CHECK(lList[0].Type == ENullCommand::ExecuteSecondary);
+    CHECK(lList[0].Arg  == 4u);
+    CHECK(lList[1].Type == ENullCommand::BeginRenderPass);
+    CHECK(lList[1].Arg  == 1u);
+    CHECK(lList[4].Type == ENullCommand::EndRenderPass);
+    CHECK(lList[5].Type == ENullCommand::ExecuteSecondary);
+    CHECK(lList[5].Arg  == 3u);
+    CHECK(lList[6].Type == ENullCommand::BeginRenderPass);
+    CHECK(lList[6].Arg  == 0u);
+    CHECK(lList[7].Type == ENullCommand::DrawIndexed);
+    CHECK(lList[7].Arg  == 12u);
+
+    NullCommandStream::SetRecording(false);
+    NullCommandStream::Reset();
+}
@@ -0,0 +1,70 @@
+// Suite: SPIR-V compile cache entry (SpirvCache::MakeKeyMaterial / Serialize / Deserialize).
+//
+// Header-inline half only — no glslang, no disk. Hand-written word arrays stand in for real
+// SPIR-V; the cache never interprets them.
+#include <doctest.h>
+
+#include "RHI/SpirvCache.h"
+
+using namespace Opaax;
+
+namespace
+{
+    constexpr const char* Glsl = "#version 450\nlayout(location=0) out vec4 o;\nvoid main(){ o = vec4(1); }\n";
+    constexpr const char* Tag  = "glslang 11 | glsl450 vulkan1.0 spv1.0";
+
+    TDynArray<Uint32> MakeSpirv() { return { 0x07230203u, 0x00010000u, 8u, 42u, 0u, 17u }; }
+}
+
+TEST_CASE("SpirvCache: serialize/deserialize round-trips the SPIR-V words")
+{
+    const std::string lKey = SpirvCache::MakeKeyMaterial(1u, "#define FOO 1\n", Glsl, Tag);
+
+    TDynArray<Uint8> lBytes;
+    SpirvCache::Serialize(lKey, MakeSpirv(), lBytes);
+
+    TDynArray<Uint32> lOut;
+    REQUIRE(SpirvCache::Deserialize(lBytes.data(), lBytes.size(), lKey, lOut));
+    CHECK(lOut == MakeSpirv());
+}
+
+TEST_CASE("SpirvCache: stage, defines, source and compiler all change the key")
+{
+    const std::string lBase = SpirvCache::MakeKeyMaterial(0u, "", Glsl, Tag);
+
+    CHECK(SpirvCache::MakeKeyMaterial(1u, "", Glsl, Tag)                   != lBase);
+    CHECK(SpirvCache::MakeKeyMaterial(0u, "#define A\n", Glsl, Tag)         != lBase);
+    CHECK(SpirvCache::MakeKeyMaterial(0u, "", "#version 450\n", Tag)        != lBase);
+    CHECK(SpirvCache::MakeKeyMaterial(0u, "", Glsl, "glslang 12 | glsl450") != lBase);
+    CHECK(SpirvCache::MakeKeyMaterial(0u, nullptr, Glsl, Tag)               == lBase);
+
+    // Field boundaries are delimited: moving text between defines and source is still a new key.
+    CHECK(SpirvCache::MakeKeyMaterial(0u, "ab", "c", Tag) != SpirvCache::MakeKeyMaterial(0u, "a", "bc", Tag));
+
+    // A blob written under one key is a miss for any other, even with an identical file name.
+    TDynArray<Uint8> lBytes;
+    SpirvCache::Serialize(lBase, MakeSpirv(), lBytes);
+    TDynArray<Uint32> lOut;
+    CHECK_FALSE(SpirvCache::Deserialize(lBytes.data(), lBytes.size(),
+                                        SpirvCache::MakeKeyMaterial(1u, "", Glsl, Tag), lOut));
+    CHECK(lOut.empty());
+}
+
+TEST_CASE("SpirvCache: corrupt, truncated or empty entries are rejected")
+{
+    const std::string lKey = SpirvCache::MakeKeyMaterial(0u, "", Glsl, Tag);
+    TDynArray<Uint8> lBytes;
+    SpirvCache::Serialize(lKey, MakeSpirv(), lBytes);
+    TDynArray<Uint32> lOut;
+
+    TDynArray<Uint8> lFlipped = lBytes;
+    lFlipped[lFlipped.size() - 8] ^= 0x01u;
+    CHECK_FALSE(SpirvCache::Deserialize(lFlipped.data(), lFlipped.size(), lKey, lOut));
+
+    CHECK_FALSE(SpirvCache::Deserialize(lBytes.data(), lBytes.size() - 4, lKey, lOut));
+    CHECK_FALSE(SpirvCache::Deserialize(nullptr, 0, lKey, lOut));
+
+    TDynArray<Uint8> lEmpty;
+    SpirvCache::Serialize(lKey, {}, lEmpty);
+    CHECK_FALSE(SpirvCache::Deserialize(lEmpty.data(), lEmpty.size(), lKey, lOut));
+}
@@ -0,0 +1,42 @@
+// Suite: descriptor write diffing (CollectDirtyRuns).
+//
+// Vulkan-free: plain integers stand in for the (texture, view, sampler) keys VulkanBindGroup uses.
+#include <doctest.h>
+
+#include "RHI/Vulkan/VulkanDescriptorDiff.h"
+
+using namespace Opaax;
+
+TEST_CASE("CollectDirtyRuns: a fresh shadow writes everything as one run")
+{
+    const Uint32 lDesired[4] = { 7, 8, 9, 10 };
+    Uint32       lShadow[4]  = {};
+    TDynArray<DescriptorRun> lRuns;
+
+    CHECK(CollectDirtyRuns(lDesired, lShadow, 4, lRuns) == 4);
+    REQUIRE(lRuns.size() == 1);
+    CHECK(lRuns[0].First == 0);
+    CHECK(lRuns[0].Count == 4);
+    CHECK(lShadow[3] == 10);
+}
+
+TEST_CASE("CollectDirtyRuns: unchanged slots produce no writes, changes split into runs")
+{
+    Uint32 lShadow[6] = { 1, 2, 3, 4, 5, 6 };
+    TDynArray<DescriptorRun> lRuns;
+
+    const Uint32 lSame[6] = { 1, 2, 3, 4, 5, 6 };
+    CHECK(CollectDirtyRuns(lSame, lShadow, 6, lRuns) == 0);
+    CHECK(lRuns.empty());
+
+    const Uint32 lChanged[6] = { 1, 20, 30, 4, 5, 60 };
+    CHECK(CollectDirtyRuns(lChanged, lShadow, 6, lRuns) == 3);
+    REQUIRE(lRuns.size() == 2);
+    CHECK(lRuns[0].First == 1);
+    CHECK(lRuns[0].Count == 2);
+    CHECK(lRuns[1].First == 5);
+    CHECK(lRuns[1].Count == 1);
+
+    lRuns.clear();
+    CHECK(CollectDirtyRuns(lChanged, lShadow, 6, lRuns) == 0);   // shadow caught up
+}
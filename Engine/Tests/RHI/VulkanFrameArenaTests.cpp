@@ -0,0 +1,67 @@
+// Suite: per-frame linear allocator bookkeeping (VulkanFrameArena).
+//
+// Pure page/offset arithmetic — the mapped VkBuffers live in VulkanFrameAllocator, so pages are
+// just sizes here.
+#include <doctest.h>
+
+#include "RHI/Vulkan/VulkanFrameArena.h"
+
+using namespace Opaax;
+
+TEST_CASE("VulkanFrameArena: allocations are aligned and chain onto a new page on overflow")
+{
+    VulkanFrameArena lArena(1024);
+    Uint32 lPage = 0;
+    Uint64 lOffset = 0;
+
+    CHECK_FALSE(lArena.Allocate(16, 16, lPage, lOffset));   // no pages yet
+    lArena.AddPage(lArena.RequiredPageSize(16));
+    CHECK(lArena.GetCapacity() == 1024);
+
+    REQUIRE(lArena.Allocate(100, 1, lPage, lOffset));
+    CHECK(lPage == 0);
+    CHECK(lOffset == 0);
+    REQUIRE(lArena.Allocate(64, 256, lPage, lOffset));     // UBO-style alignment
+    CHECK(lOffset == 256);
+    CHECK(lArena.GetUsed() == 320);
+
+    CHECK_FALSE(lArena.Allocate(800, 4, lPage, lOffset));  // 704 left in page 0
+    lArena.AddPage(lArena.RequiredPageSize(800));
+    REQUIRE(lArena.Allocate(800, 4, lPage, lOffset));
+    CHECK(lPage == 1);
+    CHECK(lOffset == 0);
+    CHECK(lArena.GetPageCount() == 2);
+}
+
+TEST_CASE("VulkanFrameArena: oversized requests get a page of their own size")
+{
+    VulkanFrameArena lArena(1024);
+    CHECK(lArena.RequiredPageSize(4096) == 4096);
+    CHECK(lArena.RequiredPageSize(10) == 1024);
+
+    lArena.AddPage(lArena.RequiredPageSize(4096));
+    Uint32 lPage = 0;
+    Uint64 lOffset = 0;
+    REQUIRE(lArena.Allocate(4096, 16, lPage, lOffset));
+    CHECK(lArena.GetUsed() == 4096);
+}
+
+TEST_CASE("VulkanFrameArena: Reset rewinds to the first page and keeps the chain")
+{
+    VulkanFrameArena lArena(256);
+    lArena.AddPage(256);
+    lArena.AddPage(256);
+
+    Uint32 lPage = 0;
+    Uint64 lOffset = 0;
+    REQUIRE(lArena.Allocate(200, 1, lPage, lOffset));
+    REQUIRE(lArena.Allocate(200, 1, lPage, lOffset));
+    CHECK(lPage == 1);
+
+    lArena.Reset();
+    CHECK(lArena.GetUsed() == 0);
+    CHECK(lArena.GetPageCount() == 2);
+    REQUIRE(lArena.Allocate(200, 1, lPage, lOffset));
+    CHECK(lPage == 0);
+    CHECK(lOffset == 0);
+}
@@ -0,0 +1,93 @@
+// Suite: persisted Vulkan pipeline-cache blob (VulkanPipelineCacheBlob::Wrap / Unwrap).
+//
+// The wrapper is vulkan.h-free, so a fake driver payload (a VkPipelineCacheHeaderVersionOne
+// laid out by hand + opaque bytes) stands in for vkGetPipelineCacheData output — no device.
+#include <doctest.h>
+
+#include "RHI/Vulkan/VulkanPipelineCacheBlob.h"
+
+using namespace Opaax;
+
+namespace
+{
+    VulkanPipelineCacheIdentity MakeIdentity()
+    {
+        VulkanPipelineCacheIdentity lId;
+        lId.VendorID      = 0x10005u;   // Mesa lavapipe
+        lId.DeviceID      = 0x0000u;
+        lId.DriverVersion = 0x06000000u;
+        for (Uint8 i = 0; i < 16; ++i) { lId.CacheUUID[i] = static_cast<Uint8>(0xA0 + i); }
+        return lId;
+    }
+
+    TDynArray<Uint8> MakeDriverPayload(const VulkanPipelineCacheIdentity& InId)
+    {
+        TDynArray<Uint8> lPayload(VulkanPipelineCacheBlob::VkHeaderSize + 24, 0x5A);
+        const Uint32 lHeader[4] = { static_cast<Uint32>(VulkanPipelineCacheBlob::VkHeaderSize), 1u,
+                                    InId.VendorID, InId.DeviceID };
+        std::memcpy(lPayload.data(), lHeader, sizeof(lHeader));
+        std::memcpy(lPayload.data() + 16, InId.CacheUUID, 16);
+        return lPayload;
+    }
+}
+
+TEST_CASE("VulkanPipelineCacheBlob: wrap/unwrap returns the driver payload untouched")
+{
+    const VulkanPipelineCacheIdentity lId      = MakeIdentity();
+    const TDynArray<Uint8>            lPayload = MakeDriverPayload(lId);
+
+    TDynArray<Uint8> lBlob;
+    VulkanPipelineCacheBlob::Wrap(lId, lPayload.data(), lPayload.size(), lBlob);
+
+    const Uint8* lData = nullptr;
+    size_t       lSize = 0;
+    REQUIRE(VulkanPipelineCacheBlob::Unwrap(lBlob.data(), lBlob.size(), lId, lData, lSize));
+    REQUIRE(lSize == lPayload.size());
+    CHECK(std::memcmp(lData, lPayload.data(), lSize) == 0);
+}
+
+TEST_CASE("VulkanPipelineCacheBlob: another device, driver or UUID is rejected")
+{
+    const VulkanPipelineCacheIdentity lId      = MakeIdentity();
+    const TDynArray<Uint8>            lPayload = MakeDriverPayload(lId);
+    TDynArray<Uint8> lBlob;
+    VulkanPipelineCacheBlob::Wrap(lId, lPayload.data(), lPayload.size(), lBlob);
+
+    const Uint8* lData = nullptr;
+    size_t       lSize = 0;
+
+    VulkanPipelineCacheIdentity lOther = lId;
+    lOther.DriverVersion += 1u;
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(lBlob.data(), lBlob.size(), lOther, lData, lSize));
+
+    lOther = lId;
+    lOther.DeviceID = 0x1234u;
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(lBlob.data(), lBlob.size(), lOther, lData, lSize));
+
+    lOther = lId;
+    lOther.CacheUUID[7] ^= 0xFFu;
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(lBlob.data(), lBlob.size(), lOther, lData, lSize));
+}
+
+TEST_CASE("VulkanPipelineCacheBlob: corrupt or mismatched payloads are rejected")
+{
+    const VulkanPipelineCacheIdentity lId = MakeIdentity();
+    const Uint8* lData = nullptr;
+    size_t       lSize = 0;
+
+    // Payload whose own Vulkan header names another vendor, under a correct outer header.
+    VulkanPipelineCacheIdentity lForeign = lId;
+    lForeign.VendorID = 0x10DEu;
+    const TDynArray<Uint8> lForeignPayload = MakeDriverPayload(lForeign);
+    TDynArray<Uint8> lBlob;
+    VulkanPipelineCacheBlob::Wrap(lId, lForeignPayload.data(), lForeignPayload.size(), lBlob);
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(lBlob.data(), lBlob.size(), lId, lData, lSize));
+
+    const TDynArray<Uint8> lPayload = MakeDriverPayload(lId);
+    VulkanPipelineCacheBlob::Wrap(lId, lPayload.data(), lPayload.size(), lBlob);
+    TDynArray<Uint8> lFlipped = lBlob;
+    lFlipped[lFlipped.size() - 8] ^= 0x01u;
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(lFlipped.data(), lFlipped.size(), lId, lData, lSize));
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(lBlob.data(), lBlob.size() - 1, lId, lData, lSize));
+    CHECK_FALSE(VulkanPipelineCacheBlob::Unwrap(nullptr, 0, lId, lData, lSize));
+}
@@ -0,0 +1,75 @@
+// Suite: upload staging ring bookkeeping (VulkanStagingRing).
+//
+// Pure offset arithmetic — the VkBuffer and fences live in VulkanUploadManager, so batches are
+// simulated with Close/Retire serials.
+#include <doctest.h>
+
+#include "RHI/Vulkan/VulkanStagingRing.h"
+
+using namespace Opaax;
+
+TEST_CASE("VulkanStagingRing: allocations are aligned and packed until the ring is full")
+{
+    VulkanStagingRing lRing(1024);
+    Uint64 lA = 0, lB = 0, lC = 0;
+
+    REQUIRE(lRing.Allocate(100, 16, lA));
+    REQUIRE(lRing.Allocate(100, 16, lB));
+    CHECK(lA == 0);
+    CHECK(lB == 112);                 // 100 rounded up to the 16-byte boundary
+    CHECK(lRing.GetUsed() == 212);
+
+    CHECK_FALSE(lRing.Allocate(900, 16, lC));   // only 812 bytes left
+    CHECK_FALSE(lRing.Allocate(2048, 16, lC));  // never fits — caller goes dedicated
+    REQUIRE(lRing.Allocate(812, 4, lC));
+    CHECK(lC == 212);
+    CHECK(lRing.GetUsed() == 1024);
+    CHECK_FALSE(lRing.Allocate(1, 1, lC));
+}
+
+TEST_CASE("VulkanStagingRing: space comes back only when its batch retires, in order")
+{
+    VulkanStagingRing lRing(1024);
+    Uint64 lOffset = 0;
+
+    REQUIRE(lRing.Allocate(512, 16, lOffset));
+    lRing.Close(1);
+    REQUIRE(lRing.Allocate(256, 16, lOffset));
+    lRing.Close(2);
+    REQUIRE(lRing.Allocate(256, 16, lOffset));   // open batch, not closed yet
+
+    CHECK_FALSE(lRing.Allocate(64, 16, lOffset));
+    lRing.Retire(0);
+    CHECK(lRing.GetUsed() == 1024);
+
+    lRing.Retire(1);
+    CHECK(lRing.GetUsed() == 512);
+    REQUIRE(lRing.Allocate(400, 16, lOffset));
+    CHECK(lOffset == 0);                         // wrapped into the freed front
+
+    lRing.Close(3);
+    lRing.Retire(3);
+    CHECK(lRing.IsEmpty());
+}
+
+TEST_CASE("VulkanStagingRing: a wrap charges the skipped tail and an empty ring restarts at 0")
+{
+    VulkanStagingRing lRing(1000);
+    Uint64 lOffset = 0;
+
+    REQUIRE(lRing.Allocate(600, 1, lOffset));
+    lRing.Close(1);
+    REQUIRE(lRing.Allocate(300, 1, lOffset));
+    lRing.Close(2);
+    lRing.Retire(1);                             // [0, 600) free, head at 900
+
+    REQUIRE(lRing.Allocate(200, 1, lOffset));    // does not fit in [900, 1000) -> wraps
+    CHECK(lOffset == 0);
+    CHECK(lRing.GetUsed() == 300 + 100 + 200);   // live + skipped tail + new
+    lRing.Close(3);
+
+    lRing.Retire(3);
+    CHECK(lRing.IsEmpty());
+    REQUIRE(lRing.Allocate(1000, 1, lOffset));   // whole ring again
+    CHECK(lOffset == 0);
+}
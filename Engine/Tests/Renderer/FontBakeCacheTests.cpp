@@ -0,0 +1,94 @@
+// Suite: baked-font cache blob (FontBakeCache::Serialize / Deserialize).
+//
+// The encode/decode half is header-inline and never touches disk or stb_truetype, so a
+// hand-built FontBakeData stands in for a real bake — no TTF, no RHI.
+#include <doctest.h>
+
+#include "Renderer/Text/FontBakeCache.h"
+
+using namespace Opaax;
+
+namespace
+{
+    FontBakeKey MakeKey()
+    {
+        FontBakeKey lKey;
+        lKey.FileHash    = 0xC0FFEEu;
+        lKey.FileSize    = 4096u;
+        lKey.PixelHeight = FontAsset::PixelHeight;
+        lKey.OversampleH = 2u;
+        lKey.OversampleV = 2u;
+        lKey.Mode        = EFontBakeMode::Bitmap;
+        return lKey;
+    }
+
+    FontBakeData MakeData()
+    {
+        FontBakeData lData;
+        lData.AtlasSize = 8u;
+        lData.Atlas.resize(64u);
+        for (Uint32 i = 0; i < 64u; ++i) { lData.Atlas[i] = static_cast<unsigned char>(i * 3u); }
+
+        lData.VMetrics = { 24.f, -6.f, 1.f, 31.f };
+        for (Uint32 i = 0; i < FontAsset::CodepointCount; ++i)
+        {
+            lData.Glyphs[i].UVMin    = { 0.1f, 0.2f };
+            lData.Glyphs[i].XAdvance = static_cast<float>(i);
+        }
+        lData.Kerning = { { 'A', 'V', -1.5f }, { 'T', 'o', -2.f } };
+        return lData;
+    }
+}
+
+TEST_CASE("FontBakeCache: serialize/deserialize round-trips every field")
+{
+    TDynArray<Uint8> lBytes;
+    FontBakeCache::Serialize(MakeKey(), MakeData(), lBytes);
+
+    FontBakeData lOut;
+    REQUIRE(FontBakeCache::Deserialize(lBytes.data(), lBytes.size(), MakeKey(), lOut));
+
+    const FontBakeData lRef = MakeData();
+    CHECK(lOut.AtlasSize == lRef.AtlasSize);
+    CHECK(lOut.Atlas == lRef.Atlas);
+    CHECK(lOut.VMetrics.LineAdvance == doctest::Approx(31.f));
+    CHECK(lOut.Glyphs[42].XAdvance == doctest::Approx(42.f));
+    CHECK(lOut.Glyphs[42].UVMin.y == doctest::Approx(0.2f));
+    REQUIRE(lOut.Kerning.size() == 2);
+    CHECK(lOut.Kerning[1].First == 'T');
+    CHECK(lOut.Kerning[1].Advance == doctest::Approx(-2.f));
+}
+
+TEST_CASE("FontBakeCache: any key difference is a miss")
+{
+    TDynArray<Uint8> lBytes;
+    FontBakeCache::Serialize(MakeKey(), MakeData(), lBytes);
+
+    FontBakeData lOut;
+    FontBakeKey  lKey = MakeKey();
+    lKey.FileHash ^= 1u;
+    CHECK_FALSE(FontBakeCache::Deserialize(lBytes.data(), lBytes.size(), lKey, lOut));
+
+    lKey = MakeKey();
+    lKey.OversampleH = 1u;
+    CHECK_FALSE(FontBakeCache::Deserialize(lBytes.data(), lBytes.size(), lKey, lOut));
+
+    lKey = MakeKey();
+    lKey.Mode = EFontBakeMode::DistanceField;
+    CHECK_FALSE(FontBakeCache::Deserialize(lBytes.data(), lBytes.size(), lKey, lOut));
+}
+
+TEST_CASE("FontBakeCache: corrupt, truncated or foreign blobs are rejected")
+{
+    TDynArray<Uint8> lBytes;
+    FontBakeCache::Serialize(MakeKey(), MakeData(), lBytes);
+    FontBakeData lOut;
+
+    TDynArray<Uint8> lFlipped = lBytes;
+    lFlipped[lFlipped.size() / 2] ^= 0x40u;
+    CHECK_FALSE(FontBakeCache::Deserialize(lFlipped.data(), lFlipped.size(), MakeKey(), lOut));
+
+    CHECK_FALSE(FontBakeCache::Deserialize(lBytes.data(), lBytes.size() - 5, MakeKey(), lOut));
+    CHECK_FALSE(FontBakeCache::Deserialize(lBytes.data(), 2, MakeKey(), lOut));
+    CHECK_FALSE(FontBakeCache::Deserialize(nullptr, 0, MakeKey(), lOut));
+}
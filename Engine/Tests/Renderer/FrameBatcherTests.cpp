@@ -95,3 +95,38 @@ TEST_CASE("AssignBatches: batch indices are non-decreasing (concatenation preser
         CHECK(lOut[i].Slot < 3u);
     }
 }
+
+namespace
+{
+    // Same field set as DrawIndexedIndirectCommand — BuildQuadDraws only needs the names.
+    struct TestDraw
+    {
+        Uint32 IndexCount    = 0;
+        Uint32 InstanceCount = 0;
+        Uint32 FirstIndex    = 7;
+        Int32  VertexOffset  = -1;
+        Uint32 FirstInstance = 7;
+    };
+}
+
+TEST_CASE("BuildQuadDraws: a batch past the index-buffer cap splits into rebased draws")
+{
+    TestDraw lDraws[3];
+
+    // 2500 quads over a 1000-quad index buffer -> 1000 + 1000 + 500.
+    const Uint32 lCount = BuildQuadDraws(2500, 1000, lDraws);
+
+    REQUIRE(lCount == 3u);
+    CHECK(lDraws[0].IndexCount == 6000u); CHECK(lDraws[0].VertexOffset == 0);
+    CHECK(lDraws[1].IndexCount == 6000u); CHECK(lDraws[1].VertexOffset == 4000);
+    CHECK(lDraws[2].IndexCount == 3000u); CHECK(lDraws[2].VertexOffset == 8000);
+    for (const TestDraw& lDraw : lDraws)
+    {
+        CHECK(lDraw.InstanceCount == 1u);
+        CHECK(lDraw.FirstIndex    == 0u);    // every draw reuses the shared index range
+        CHECK(lDraw.FirstInstance == 0u);
+    }
+
+    CHECK(BuildQuadDraws(0, 1000, lDraws) == 0u);
+    CHECK(BuildQuadDraws(1000, 1000, lDraws) == 1u);
+}
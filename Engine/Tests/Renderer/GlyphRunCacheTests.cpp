@@ -0,0 +1,106 @@
+// Suite: Text2D glyph-run cache (LRU + budgets).
+//
+// GlyphRunCache is header-inline and never dereferences the font pointer (it is pure key
+// identity), so synthetic addresses stand in for FontAssets — no atlas bake, no RHI.
+#include <doctest.h>
+
+#include "Renderer/Text/GlyphRunCache.h"
+
+using namespace Opaax;
+using namespace Opaax::Text2D;
+
+namespace
+{
+    const FontAsset* FakeFont(Uint64 InId) { return reinterpret_cast<const FontAsset*>(InId * 64u); }
+
+    GlyphRunKey MakeKey(Uint32 InHash, const FontAsset* InFont = FakeFont(1), float InScale = 1.f)
+    {
+        GlyphRunKey lKey;
+        lKey.TextHash = InHash;
+        lKey.Font     = InFont;
+        lKey.Scale    = InScale;
+        return lKey;
+    }
+
+    GlyphRun MakeRun(const char* InText, Uint32 InQuads)
+    {
+        GlyphRun lRun;
+        lRun.Text = InText;
+        lRun.Quads.resize(InQuads);
+        lRun.Size = { static_cast<float>(InQuads), 1.f };
+        return lRun;
+    }
+}
+
+TEST_CASE("GlyphRunCache: miss, insert, then hit returns the stored run")
+{
+    GlyphRunCache lCache;
+    CHECK(lCache.Find(MakeKey(1), "abc") == nullptr);
+
+    lCache.Insert(MakeKey(1), MakeRun("abc", 3));
+    const GlyphRun* lHit = lCache.Find(MakeKey(1), "abc");
+    REQUIRE(lHit != nullptr);
+    CHECK(lHit->Quads.size() == 3);
+    CHECK(lHit->Size.x == doctest::Approx(3.f));
+
+    CHECK(lCache.GetStats().Hits    == 1);
+    CHECK(lCache.GetStats().Misses  == 1);
+    CHECK(lCache.GetStats().Entries == 1);
+    CHECK(lCache.GetStats().Quads   == 3);
+}
+
+TEST_CASE("GlyphRunCache: key covers font and layout params; text guards hash collisions")
+{
+    GlyphRunCache lCache;
+    lCache.Insert(MakeKey(7), MakeRun("abc", 3));
+
+    CHECK(lCache.Find(MakeKey(7, FakeFont(2)), "abc")      == nullptr);  // other font
+    CHECK(lCache.Find(MakeKey(7, FakeFont(1), 2.f), "abc") == nullptr);  // other scale
+    CHECK(lCache.Find(MakeKey(7), "xyz")                   == nullptr);  // same hash, other text
+    CHECK(lCache.Find(MakeKey(7), "abc")                   != nullptr);
+}
+
+TEST_CASE("GlyphRunCache: entry budget evicts the least-recently used run")
+{
+    GlyphRunCache lCache(2, 1000);
+    lCache.Insert(MakeKey(1), MakeRun("a", 1));
+    lCache.Insert(MakeKey(2), MakeRun("b", 1));
+    REQUIRE(lCache.Find(MakeKey(1), "a") != nullptr);   // touch 1 -> 2 is now LRU
+
+    lCache.Insert(MakeKey(3), MakeRun("c", 1));
+    CHECK(lCache.Find(MakeKey(1), "a") != nullptr);
+    CHECK(lCache.Find(MakeKey(2), "b") == nullptr);
+    CHECK(lCache.Find(MakeKey(3), "c") != nullptr);
+    CHECK(lCache.GetStats().Evictions == 1);
+}
+
+TEST_CASE("GlyphRunCache: quad budget evicts until the new run fits; oversize runs are refused")
+{
+    GlyphRunCache lCache(100, 10);
+    lCache.Insert(MakeKey(1), MakeRun("a", 4));
+    lCache.Insert(MakeKey(2), MakeRun("b", 4));
+    lCache.Insert(MakeKey(3), MakeRun("c", 4));          // 12 > 10 -> drop "a"
+
+    CHECK(lCache.Find(MakeKey(1), "a") == nullptr);
+    CHECK(lCache.GetStats().Quads == 8);
+
+    CHECK(lCache.CanAdmit(10));
+    CHECK_FALSE(lCache.CanAdmit(11));
+}
+
+TEST_CASE("GlyphRunCache: EvictFont drops only that font's runs; shrinking evicts immediately")
+{
+    GlyphRunCache lCache;
+    lCache.Insert(MakeKey(1, FakeFont(1)), MakeRun("a", 2));
+    lCache.Insert(MakeKey(2, FakeFont(2)), MakeRun("b", 2));
+    lCache.Insert(MakeKey(3, FakeFont(1)), MakeRun("c", 2));
+
+    lCache.EvictFont(FakeFont(1));
+    CHECK(lCache.GetStats().Entries == 1);
+    CHECK(lCache.GetStats().Quads   == 2);
+    CHECK(lCache.Find(MakeKey(2, FakeFont(2)), "b") != nullptr);
+
+    lCache.SetCapacity(0, 0);
+    CHECK(lCache.GetStats().Entries == 0);
+    CHECK_FALSE(lCache.CanAdmit(0));
+}
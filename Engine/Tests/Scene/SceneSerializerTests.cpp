@@ -0,0 +1,192 @@
+// Suite: scene asset dependency list (Scene/SceneSerializer.h, ECS/ComponentRegistry.h).
+//
+// Covers how the list is written (sorted, unique) and read back, that a scene without one — or
+// with malformed entries — still loads, and which components contribute to it. Components go
+// through a local ComponentEntry<T>, as in ComponentRegistryTests: the process-global
+// ComponentRegistry is populated engine-side at startup, which does not run here.
+#include <doctest.h>
+
+#include "Assets/AssetRegistry.h"
+#include "Assets/Loader/CollisionProfileLoader.h"
+#include "ECS/ComponentRegistry.h"
+#include "ECS/Components/ColliderComponent.h"
+#include "ECS/Components/ParentComponent.h"
+#include "ECS/Components/TagComponent.h"
+#include "ECS/Components/TransformComponent.h"
+#include "Physics/Collision/CollisionProfile.h"
+#include "Scene/SceneSerializer.h"
+#include "World/World.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Opaax;
+using json = nlohmann::json;
+
+namespace
+{
+    std::filesystem::path TempScenePath(const char* InFileName)
+    {
+        const std::filesystem::path lPath = std::filesystem::temp_directory_path() / "OpaaxTests" / InFileName;
+        std::filesystem::create_directories(lPath.parent_path());
+        return lPath;
+    }
+
+    void WriteJson(const std::filesystem::path& InPath, const json& InRoot)
+    {
+        std::ofstream(InPath) << InRoot.dump(4);
+    }
+
+    // Two entities, the second parented to the first — no components, so no registry is needed.
+    json MakeSceneRoot()
+    {
+        const char* lTag = ECS::TagComponent::TagComponentName.CStr();
+
+        json lRoot;
+        lRoot["version"]  = 2;
+        lRoot["scene"]    = "DependencyTest";
+        lRoot["entities"] = json::array();
+        lRoot["entities"].push_back({ { lTag, "Root" },  { "uuid", "1001" }, { "components", json::object() } });
+        lRoot["entities"].push_back({ { lTag, "Child" }, { "uuid", "1002" }, { "parent_uuid", "1001" },
+                                      { "components", json::object() } });
+        return lRoot;
+    }
+
+    void CheckSceneLoaded(const World& InWorld)
+    {
+        const EntityID lRoot  = InWorld.FindByUuid(1001);
+        const EntityID lChild = InWorld.FindByUuid(1002);
+        REQUIRE(lRoot  != ENTITY_NONE);
+        REQUIRE(lChild != ENTITY_NONE);
+
+        const ECS::ParentComponent* lParent = InWorld.GetComponent<ECS::ParentComponent>(lChild);
+        REQUIRE(lParent != nullptr);
+        CHECK(lParent->Parent == lRoot);
+    }
+}
+
+TEST_CASE("SceneSerializer::WriteDependencies: sorted by id, duplicates dropped")
+{
+    TDynArray<AssetDependency> lDeps{
+        { OPAAX_ID("Textures/Zed"),     AssetType::Texture2D },
+        { OPAAX_ID("Fonts/Main"),       AssetType::Font },
+        { OPAAX_ID("Textures/Zed"),     AssetType::Texture2D },
+        { OPAAX_ID("Profiles/Pawn"),    AssetType::CollisionProfile },
+        { OPAAX_ID("Fonts/Main"),       AssetType::Font },
+    };
+
+    const json lArray = SceneSerializer::WriteDependencies(lDeps);
+
+    REQUIRE(lArray.is_array());
+    REQUIRE(lArray.size() == 3u);
+    CHECK(lArray[0]["id"] == "Fonts/Main");
+    CHECK(lArray[1]["id"] == "Profiles/Pawn");
+    CHECK(lArray[2]["id"] == "Textures/Zed");
+    CHECK(lArray[0]["type"] == ToStringID(AssetType::Font).ToString().CStr());
+
+    // Sorted and de-duplicated in place too.
+    REQUIRE(lDeps.size() == 3u);
+    CHECK(lDeps[0].ID == OPAAX_ID("Fonts/Main"));
+    CHECK(lDeps[2].ID == OPAAX_ID("Textures/Zed"));
+}
+
+TEST_CASE("SceneSerializer: the dependency list survives a save -> load round trip")
+{
+    TDynArray<AssetDependency> lDeps{
+        { OPAAX_ID("Textures/Player"), AssetType::Texture2D },
+        { OPAAX_ID("Profiles/Pawn"),   AssetType::CollisionProfile },
+        { OPAAX_ID("Fonts/Main"),      AssetType::Font },
+    };
+
+    json lRoot = MakeSceneRoot();
+    lRoot["dependencies"] = SceneSerializer::WriteDependencies(lDeps);
+
+    const std::filesystem::path lPath = TempScenePath("DependencyRoundTrip.json");
+    WriteJson(lPath, lRoot);
+
+    json lLoaded;
+    std::ifstream(lPath) >> lLoaded;
+    const TDynArray<AssetDependency> lRead = SceneSerializer::ReadDependencies(lLoaded);
+
+    REQUIRE(lRead.size() == lDeps.size());
+    for (size_t i = 0; i < lDeps.size(); ++i)
+    {
+        CHECK(lRead[i].ID   == lDeps[i].ID);
+        CHECK(lRead[i].Type == lDeps[i].Type);
+    }
+}
+
+TEST_CASE("SceneSerializer::Deserialize: a scene without a dependency list loads unchanged")
+{
+    const json lRoot = MakeSceneRoot();
+    CHECK(SceneSerializer::ReadDependencies(lRoot).empty());
+
+    const std::filesystem::path lPath = TempScenePath("NoDependencies.json");
+    WriteJson(lPath, lRoot);
+
+    World lWorld;
+    Scene lScene("NoDependencies");
+    REQUIRE(SceneSerializer::Deserialize(lScene, lPath.string().c_str(), lWorld));
+    CHECK(lWorld.GetEntityCount() == 2u);
+    CheckSceneLoaded(lWorld);
+}
+
+TEST_CASE("SceneSerializer::Deserialize: malformed dependency entries are skipped, not fatal")
+{
+    json lRoot = MakeSceneRoot();
+    lRoot["dependencies"] = json::array({
+        { { "id", 5 },              { "type", "Texture2D" } },   // id not a string
+        { { "id", "Textures/X" },   { "type", nullptr } },       // type not a string
+        { { "id", "Textures/Y" } },                              // no type
+        "Textures/Z",                                            // not an object
+    });
+    CHECK(SceneSerializer::ReadDependencies(lRoot).empty());
+
+    const std::filesystem::path lPath = TempScenePath("BadDependencies.json");
+    WriteJson(lPath, lRoot);
+
+    World lWorld;
+    Scene lScene("BadDependencies");
+    REQUIRE(SceneSerializer::Deserialize(lScene, lPath.string().c_str(), lWorld));
+    CHECK(lWorld.GetEntityCount() == 2u);
+    CheckSceneLoaded(lWorld);
+}
+
+TEST_CASE("ComponentEntry::CollectDependencies: only components declaring CollectAssetDependencies contribute")
+{
+    World lWorld;
+    const EntityID lEntity = lWorld.CreateEntity("E");
+    lWorld.AddComponent<ECS::TransformComponent>(lEntity);
+    auto& lCollider = lWorld.AddComponent<ECS::ColliderComponent>(lEntity);
+
+    const ComponentEntry<ECS::TransformComponent> lTransformEntry("TransformComponent", true);
+    const ComponentEntry<ECS::ColliderComponent>  lColliderEntry("ColliderComponent", true);
+
+    TDynArray<AssetDependency> lDeps;
+
+    // No CollectAssetDependencies on the type — nothing, whatever the component holds.
+    lTransformEntry.CollectDependencies(lWorld, lEntity, lDeps);
+    CHECK(lDeps.empty());
+
+    // Declares it, but no profile assigned yet.
+    lColliderEntry.CollectDependencies(lWorld, lEntity, lDeps);
+    CHECK(lDeps.empty());
+
+    // A missing profile file still loads (block-all), so no file needs to exist.
+    AssetLoaderRegistry::Register<CollisionProfile>(MakeUnique<CollisionProfileLoader>());
+    AssetDescriptor lDesc;
+    lDesc.ID      = OPAAX_ID("Profiles/DependencyTest");
+    lDesc.RelPath = OpaaxString(TempScenePath("DependencyTest.profile.json").generic_string().c_str());
+    AssetManifest::Add(Move(lDesc));
+
+    lCollider.Profile = AssetRegistry::Load<CollisionProfile>(OPAAX_ID("Profiles/DependencyTest"));
+    REQUIRE(lCollider.Profile.IsValid());
+
+    lColliderEntry.CollectDependencies(lWorld, lEntity, lDeps);
+    REQUIRE(lDeps.size() == 1u);
+    CHECK(lDeps[0].ID   == OPAAX_ID("Profiles/DependencyTest"));
+    CHECK(lDeps[0].Type == AssetType::CollisionProfile);
+
+    lCollider.Profile.Reset();
+    AssetRegistry::Shutdown();
+}
@@ -0,0 +1,97 @@
+// OpaaxAssetCook entry point.
+//
+// Bootstraps only what CoreEngineApp does before the window exists — log, paths, engine and
+// project config, asset manifests — then cooks every manifest entry into one pack through
+// AssetCooker. The output defaults to engine.config.json "assets.pack", so the next launch
+// from the same directory mounts exactly what was cooked.
+//
+// Usage: OpaaxAssetCook [--project <file.opaaxproj>] [--out <pack path>]
+//                       [--compress] [--no-mips] [--premultiply]
+// Textures are cooked to RGBA8 with a full mip chain by default; --compress picks BC1 (opaque)
+// or BC3 (with alpha), --premultiply stores rgb * a for EBlendMode::PremultipliedAlpha.
+// Run from the game's output directory (same engine.config.json as the runtime).
+#include "Assets/AssetManifest.h"
+#include "Assets/Pack/AssetCooker.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/Config/ProjectConfig.h"
+#include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxPath.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+using namespace Opaax;
+
+namespace
+{
+    // `--project <path>` / `--out <path>` + the texture switches; the project defaults to the
+    // repo-layout one CoreEngineApp falls back to, the output to assets.pack (resolved after the
+    // config loads).
+    bool ParseArgs(int argc, char** argv, OpaaxString& OutProject, OpaaxString& OutPack,
+                   TextureCookSettings& OutTextures)
+    {
+        OutProject = OpaaxPath::ToAbsolute("Game/Game.opaaxproj");
+        for (int i = 1; i < argc; ++i)
+        {
+            if      (!std::strcmp(argv[i], "--project") && i + 1 < argc) { OutProject = OpaaxPath::ToAbsolute(argv[++i]); }
+            else if (!std::strcmp(argv[i], "--out")     && i + 1 < argc) { OutPack    = OpaaxPath::ToAbsolute(argv[++i]); }
+            else if (!std::strcmp(argv[i], "--compress"))    { OutTextures.bCompress         = true;  }
+            else if (!std::strcmp(argv[i], "--no-mips"))     { OutTextures.bGenerateMips     = false; }
+            else if (!std::strcmp(argv[i], "--premultiply")) { OutTextures.bPremultiplyAlpha = true;  }
+            else
+            {
+                std::fprintf(stderr, "usage: OpaaxAssetCook [--project file.opaaxproj] [--out pack]"
+                                     " [--compress] [--no-mips] [--premultiply]\n");
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    OpaaxLog::Init();
+    OpaaxPath::Init();
+
+    OpaaxString lProject;
+    OpaaxString lPack;
+    TextureCookSettings lTextures;
+    if (!ParseArgs(argc, argv, lProject, lPack, lTextures))
+    {
+        return 2;
+    }
+
+    EngineConfig::Load(OpaaxPath::ToAbsolute("engine.config.json"));
+    if (lPack.IsEmpty())
+    {
+        if (EngineConfig::AssetPackRelPath().IsEmpty())
+        {
+            OPAAX_CORE_ERROR("AssetCook: no output — pass --out or set assets.pack in engine.config.json.");
+            return 1;
+        }
+        lPack = OpaaxPath::ToAbsolute(EngineConfig::AssetPackRelPath());
+    }
+
+    // Unlike the runtime, never generate a default project here — a typo'd path should not
+    // leave a fresh .opaaxproj behind. Engine assets are still cooked without one.
+    std::error_code lEc;
+    AssetManifest::LoadFile(OpaaxPath::ToAbsolute(EngineConfig::EngineManifestRelPath()));
+    if (std::filesystem::exists(lProject.CStr(), lEc))
+    {
+        ProjectConfig::Load(lProject);
+        AssetManifest::LoadFile(OpaaxPath::ToAbsolute(ProjectConfig::AssetsManifestRelPath()));
+    }
+    else
+    {
+        OPAAX_CORE_WARN("AssetCook: project '{}' not found — cooking engine assets only.", lProject);
+    }
+
+    Uint32 lCooked = 0;
+    Uint32 lFailed = 0;
+    const bool bWritten = AssetCooker::CookManifest(lPack, lCooked, lFailed, lTextures);
+
+    OPAAX_CORE_INFO("AssetCook: {} asset(s) cooked, {} failed -> '{}'", lCooked, lFailed, lPack);
+    return (bWritten && lFailed == 0) ? 0 : 1;
+}
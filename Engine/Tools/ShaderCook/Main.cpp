@@ -0,0 +1,100 @@
+// OpaaxShaderCook entry point.
+//
+// Bootstraps only what CoreEngineApp does before the window exists — log, paths, engine and
+// project config, asset manifests — then cooks every manifest entry typed "Shader" through
+// ShaderAsset::Cook. Each stage lands in the SpirvCache, so the next runtime load of the same
+// source/defines/compiler is a cache hit.
+//
+// Usage: OpaaxShaderCook [--project <file.opaaxproj>]
+// Run from the game's output directory (same engine.config.json / cache dir as the runtime).
+#include "Assets/AssetManifest.h"
+#include "Core/Config/EngineConfig.h"
+#include "Core/Config/ProjectConfig.h"
+#include "Core/Log/OpaaxLog.h"
+#include "Core/OpaaxPath.h"
+#include "Renderer/ShaderAsset.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+using namespace Opaax;
+
+namespace
+{
+    // `--project <path>` if given, else the repo-layout default CoreEngineApp falls back to.
+    bool ParseArgs(int argc, char** argv, OpaaxString& OutProject)
+    {
+        OutProject = OpaaxPath::ToAbsolute("Game/Game.opaaxproj");
+        for (int i = 1; i < argc; ++i)
+        {
+            if (!std::strcmp(argv[i], "--project") && i + 1 < argc) { OutProject = OpaaxPath::ToAbsolute(argv[++i]); }
+            else
+            {
+                std::fprintf(stderr, "usage: OpaaxShaderCook [--project file.opaaxproj]\n");
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    OpaaxLog::Init();
+    OpaaxPath::Init();
+
+    OpaaxString lProject;
+    if (!ParseArgs(argc, argv, lProject))
+    {
+        return 2;
+    }
+
+    EngineConfig::Load(OpaaxPath::ToAbsolute("engine.config.json"));
+    if (EngineConfig::CacheDirectory("Shaders").IsEmpty())
+    {
+        OPAAX_CORE_ERROR("ShaderCook: asset cache is disabled (assets.cacheDir is empty) — nothing to cook into.");
+        return 1;
+    }
+
+    // Unlike the runtime, never generate a default project here — a typo'd path should not
+    // leave a fresh .opaaxproj behind. Engine shaders are still cooked without one.
+    std::error_code lEc;
+    if (std::filesystem::exists(lProject.CStr(), lEc))
+    {
+        ProjectConfig::Load(lProject);
+        AssetManifest::LoadFile(OpaaxPath::ToAbsolute(EngineConfig::EngineManifestRelPath()));
+        AssetManifest::LoadFile(OpaaxPath::ToAbsolute(ProjectConfig::AssetsManifestRelPath()));
+    }
+    else
+    {
+        OPAAX_CORE_WARN("ShaderCook: project '{}' not found — cooking engine shaders only.", lProject);
+        AssetManifest::LoadFile(OpaaxPath::ToAbsolute(EngineConfig::EngineManifestRelPath()));
+    }
+
+    const OpaaxStringID lShaderType("Shader");
+    Uint32 lCooked = 0;
+    Uint32 lFailed = 0;
+    for (const auto& [lKey, lDesc] : AssetManifest::GetAll())
+    {
+        if (lDesc.Type != lShaderType || lDesc.bMissing)
+        {
+            continue;
+        }
+
+        if (ShaderAsset::Cook(OpaaxPath::ToAbsolute(lDesc.RelPath), lDesc.ID.ToString()))
+        {
+            OPAAX_CORE_INFO("ShaderCook: cooked '{}'", lDesc.RelPath);
+            ++lCooked;
+        }
+        else
+        {
+            OPAAX_CORE_ERROR("ShaderCook: failed to cook '{}'", lDesc.RelPath);
+            ++lFailed;
+        }
+    }
+
+    OPAAX_CORE_INFO("ShaderCook: {} shader(s) cooked, {} failed -> '{}'",
+        lCooked, lFailed, EngineConfig::CacheDirectory("Shaders"));
+    return (lFailed == 0 && lCooked > 0) ? 0 : 1;
+}